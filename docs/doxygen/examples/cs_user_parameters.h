@@ -379,6 +379,11 @@
 
   \section cs_user_parameters_h_examples Examples
 
+  Compensated accumulation may be enabled for all moments, so that
+  rounding errors do not build up over long averaging periods:
+
+  \snippet cs_user_parameters-time_moments.c tmom_compensated
+
   \subsection cs_user_parameters_h_example_1 Example 1
 
   In the following example, we define a moment for the mean velocity.
@@ -94,6 +94,7 @@ extern "C" {
 
 #define _EXCHANGE_SENDRECV       100  /* Sendrecv */
 #define _EXCHANGE_ISEND_IRECV    200  /* Isend/Irecv/Waitall */
+#define _EXCHANGE_NEIGHBOR       300  /* Neighbor_alltoallv */
 
 /*============================================================================
  * Type definitions
@@ -124,6 +125,9 @@ struct _ple_locator_t {
 
 #if defined(PLE_HAVE_MPI)
   MPI_Comm  comm;                /* Associated MPI communicator */
+  MPI_Comm  graph_comm;          /* Distributed graph communicator based on
+                                    intersecting ranks, for neighborhood
+                                    collectives (or MPI_COMM_NULL) */
 #endif
 
   int       n_ranks;             /* Number of MPI ranks of distant location */
@@ -162,6 +166,8 @@ struct _ple_locator_t {
   double  location_cpu_time[4];    /* Location CPU time */
   double  exchange_wtime[4];       /* Variable exchange Wall-clock time */
   double  exchange_cpu_time[4];    /* Variable exchange CPU time */
+  double  relocate_wtime[2];       /* Relocation Wall-clock time */
+  double  relocate_cpu_time[2];    /* Relocation CPU time */
 };
 
 /*============================================================================
@@ -266,6 +272,11 @@ typedef int
 
 static int _ple_locator_async_threshold = 128;
 
+/* exchange algorithm type for subsequently set up locators */
+
+static ple_locator_exchange_t _ple_locator_exchange_type
+  = PLE_LOCATOR_EXCHANGE_P2P;
+
 /* global logging function */
 
 static ple_locator_log_t   *_ple_locator_log_func = NULL;
@@ -539,7 +550,7 @@ _location_ranks(ple_locator_t  *this_locator,
   int i, k;
   ple_lnum_t j;
 
-  int loc_vals[2], max_vals[2];
+  int loc_vals[3], max_vals[3];
   int comm_size;
   int *send_flag = NULL, *recv_flag = NULL, *intersect_rank_id = NULL;
 
@@ -549,6 +560,9 @@ _location_ranks(ple_locator_t  *this_locator,
 
   MPI_Comm_size(this_locator->comm, &comm_size);
 
+  if (this_locator->graph_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(this_locator->graph_comm));
+
   PLE_MALLOC(send_flag, comm_size, int);
   PLE_MALLOC(recv_flag, comm_size, int);
 
@@ -617,8 +631,10 @@ _location_ranks(ple_locator_t  *this_locator,
 
   loc_vals[0] = this_locator->n_intersects;
   loc_vals[1] = _ple_locator_async_threshold;
+  loc_vals[2]
+    = (_ple_locator_exchange_type == PLE_LOCATOR_EXCHANGE_P2P) ? 1 : 0;
 
-  MPI_Allreduce(loc_vals, max_vals, 2, MPI_INT, MPI_MAX,
+  MPI_Allreduce(loc_vals, max_vals, 3, MPI_INT, MPI_MAX,
                 this_locator->comm);
 
   if (max_vals[0] <= max_vals[1])
@@ -626,6 +642,41 @@ _location_ranks(ple_locator_t  *this_locator,
   else
     this_locator->exchange_algorithm = _EXCHANGE_SENDRECV;
 
+  /* Build distributed graph communicator for neighborhood collectives;
+     intersections are symmetric, so sources and destinations match;
+     only used if all ranks requested it */
+
+#if (MPI_VERSION >= 3)
+
+  if (max_vals[2] == 0) {
+
+    /* Use explicit unit weights (with some MPI libraries, MPI_UNWEIGHTED
+       is a dummy address, which compilers may flag) */
+
+    int *weight = NULL;
+    PLE_MALLOC(weight, this_locator->n_intersects + 1, int);
+    for (i = 0; i < this_locator->n_intersects + 1; i++)
+      weight[i] = 1;
+
+    MPI_Dist_graph_create_adjacent(this_locator->comm,
+                                   this_locator->n_intersects,
+                                   this_locator->intersect_rank,
+                                   weight,
+                                   this_locator->n_intersects,
+                                   this_locator->intersect_rank,
+                                   weight,
+                                   MPI_INFO_NULL,
+                                   0, /* no reordering */
+                                   &(this_locator->graph_comm));
+
+    PLE_FREE(weight);
+
+    this_locator->exchange_algorithm = _EXCHANGE_NEIGHBOR;
+
+  }
+
+#endif
+
   _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
   this_locator->location_wtime[1] += comm_timing[0];
@@ -863,10 +914,15 @@ _transfer_location_distant(ple_locator_t  *this_locator,
 
     _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
 
+    /* Points lost by a previous relocation have a location of -1,
+       and must be searched for again */
+
     for (k = 0; k < n_points_loc; k++) {
       ple_lnum_t pt_id = _interior_list[_local_point_ids[k]] - idb;
-      location[pt_id] = loc_v_buf[k];
-      location_rank_id[pt_id] = dist_rank;
+      if (loc_v_buf[k] > -1) {
+        location[pt_id] = loc_v_buf[k];
+        location_rank_id[pt_id] = dist_rank;
+      }
     }
 
     PLE_FREE(loc_v_buf);
@@ -1491,7 +1547,7 @@ _transfer_location_local(ple_locator_t  *this_locator,
     const ple_lnum_t *dist_v_ptr = this_locator->distant_point_location;
 
     for (j = 0; j < _n_points; j++) {
-      ple_lnum_t k = _interior_list[_local_point_ids[j] - idb];
+      ple_lnum_t k = _interior_list[_local_point_ids[j]] - idb;
       location[k] = dist_v_ptr[j];
     }
 
@@ -2366,7 +2422,7 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
 
       MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
                 this_locator->comm, &request[i*2]);
-      MPI_Isend(loc_v_buf, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+      MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
                 this_locator->comm, &request[i*2+1]);
 
       loc_v_ptr += loc_v_count*size;
@@ -2390,6 +2446,190 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[1] += comm_timing[1];
 }
 
+#if (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes).
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * This variant of the function uses MPI-3 neighborhood collectives on
+ * the distributed graph communicator built after location, so that
+ * each exchange requires only 2 collective calls, whatever the number
+ * of intersecting ranks.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   datatype      <-- variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_neighbor(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     MPI_Datatype       datatype,
+                                     size_t             stride,
+                                     _Bool              reverse)
+{
+  int i, size;
+  ple_lnum_t k, n_points_loc, n_points_dist, n_points_loc_tot;
+
+  MPI_Aint lb, extent;
+  void *loc_v_buf = NULL;
+  int *dist_v_flag = NULL, *loc_v_flag = NULL;
+  int *dist_v_count = NULL, *dist_v_displ = NULL;
+  int *loc_v_count = NULL, *loc_v_displ = NULL;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  const int n_intersects = this_locator->n_intersects;
+  const ple_lnum_t *_local_point_ids = this_locator->local_point_ids;
+
+  /* Check extent of datatype */
+
+  MPI_Type_get_extent(datatype, &lb, &extent);
+  MPI_Type_size(datatype, &size);
+
+  if (extent != size)
+    ple_error(__FILE__, __LINE__, 0,
+              _("_exchange_point_var() is not implemented for use with\n"
+                "MPI datatypes associated with structures using padding\n"
+                "(for which size != extent)."));
+
+  /* Initialization */
+
+  n_points_loc_tot = this_locator->local_points_idx[n_intersects];
+
+  PLE_MALLOC(dist_v_flag, n_intersects*6, int);
+  loc_v_flag = dist_v_flag + n_intersects;
+  dist_v_count = loc_v_flag + n_intersects;
+  dist_v_displ = dist_v_count + n_intersects;
+  loc_v_count = dist_v_displ + n_intersects;
+  loc_v_displ = loc_v_count + n_intersects;
+
+  PLE_MALLOC(loc_v_buf, n_points_loc_tot*size*stride, char);
+
+  /* Exchange flags for argument checks */
+
+  for (i = 0; i < n_intersects; i++) {
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+    if (distant_var != NULL && n_points_dist > 0)
+      dist_v_flag[i] = 1;
+    else
+      dist_v_flag[i] = 0;
+  }
+
+  _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+  MPI_Neighbor_alltoall(dist_v_flag, 1, MPI_INT, loc_v_flag, 1, MPI_INT,
+                        this_locator->graph_comm);
+
+  _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  for (i = 0; i < n_intersects; i++) {
+
+    n_points_loc =   this_locator->local_points_idx[i+1]
+                   - this_locator->local_points_idx[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    if (loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incoherent arguments to different instances in "
+                  "_exchange_point_var().\n"
+                  "Send and receive operations do not match "
+                  "(dist_rank = %d\n)\n"), this_locator->intersect_rank[i]);
+
+    dist_v_count[i] = n_points_dist * stride * dist_v_flag[i];
+    dist_v_displ[i] = this_locator->distant_points_idx[i] * stride;
+    loc_v_count[i] = n_points_loc * stride * loc_v_flag[i];
+    loc_v_displ[i] = this_locator->local_points_idx[i] * stride;
+
+  }
+
+  if (reverse == false) {
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Neighbor_alltoallv(distant_var, dist_v_count, dist_v_displ, datatype,
+                           loc_v_buf, loc_v_count, loc_v_displ, datatype,
+                           this_locator->graph_comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  }
+
+  /* Copy received data to local variable, or local variable to buffer */
+
+  for (i = 0; i < n_intersects; i++) {
+
+    const size_t nbytes = stride*size;
+    const ple_lnum_t idb = (local_list != NULL) ?
+                           this_locator->point_id_base : 0;
+
+    if (loc_v_flag[i] == 0)
+      continue;
+
+    for (k = this_locator->local_points_idx[i];
+         k < this_locator->local_points_idx[i+1];
+         k++) {
+
+      size_t l;
+      ple_lnum_t l_id = _local_point_ids[k];
+      if (local_list != NULL)
+        l_id = local_list[l_id] - idb;
+
+      char *local_v_p = (char *)local_var + l_id*nbytes;
+      char *loc_v_buf_p = (char *)loc_v_buf + k*nbytes;
+
+      if (reverse == false) {
+        for (l = 0; l < nbytes; l++)
+          local_v_p[l] = loc_v_buf_p[l];
+      }
+      else {
+        for (l = 0; l < nbytes; l++)
+          loc_v_buf_p[l] = local_v_p[l];
+      }
+
+    }
+
+  }
+
+  if (reverse == true) {
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Neighbor_alltoallv(loc_v_buf, loc_v_count, loc_v_displ, datatype,
+                           distant_var, dist_v_count, dist_v_displ, datatype,
+                           this_locator->graph_comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  }
+
+  /* Free temporary arrays */
+
+  PLE_FREE(loc_v_buf);
+  PLE_FREE(dist_v_flag);
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+#endif /* (MPI_VERSION >= 3) */
+
 #endif /* defined(PLE_HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -2533,6 +2773,100 @@ _get_times(const ple_locator_t  *this_locator,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points (i.e. distant processes), or the reverse.
+ *
+ * This is the common part of ple_locator_exchange_point_var() and
+ * ple_locator_relocate(), without the associated timing.
+ *
+ * parameters:
+ *   this_locator <-- pointer to locator structure
+ *   distant_var  <-> variable defined on distant points (ready to send)
+ *   local_var    <-> variable defined on located local points (received)
+ *   local_list   <-- optional indirection list for local_var
+ *   type_size    <-- sizeof (float or double) variable type
+ *   stride       <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse      <-- if nonzero, exchange is reversed
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var(ple_locator_t     *this_locator,
+                    void              *distant_var,
+                    void              *local_var,
+                    const ple_lnum_t  *local_list,
+                    size_t             type_size,
+                    size_t             stride,
+                    int                reverse)
+{
+  int mpi_flag = 0;
+  _Bool _reverse = reverse;
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to ple_locator_exchange_point_var() does\n"
+                  "not correspond to double or float."));
+
+    assert (datatype != MPI_DATATYPE_NULL);
+
+    if (this_locator->exchange_algorithm == _EXCHANGE_SENDRECV)
+      _exchange_point_var_distant(this_locator,
+                                  distant_var,
+                                  local_var,
+                                  local_list,
+                                  datatype,
+                                  stride,
+                                  _reverse);
+
+    else if (this_locator->exchange_algorithm == _EXCHANGE_ISEND_IRECV)
+      _exchange_point_var_distant_asyn(this_locator,
+                                       distant_var,
+                                       local_var,
+                                       local_list,
+                                       datatype,
+                                       stride,
+                                       _reverse);
+
+#if (MPI_VERSION >= 3)
+    else if (this_locator->exchange_algorithm == _EXCHANGE_NEIGHBOR)
+      _exchange_point_var_distant_neighbor(this_locator,
+                                           distant_var,
+                                           local_var,
+                                           local_list,
+                                           datatype,
+                                           stride,
+                                           _reverse);
+#endif
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag)
+    _exchange_point_var_local(this_locator,
+                              distant_var,
+                              local_var,
+                              local_list,
+                              type_size,
+                              stride,
+                              _reverse);
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -2577,6 +2911,7 @@ ple_locator_create(void)
 
 #if defined(PLE_HAVE_MPI)
   this_locator->comm = comm;
+  this_locator->graph_comm = MPI_COMM_NULL;
   this_locator->n_ranks = n_ranks;
   this_locator->start_rank = start_rank;
 #else
@@ -2611,6 +2946,8 @@ ple_locator_create(void)
   for (i = 0; i < 2; i++) {
     this_locator->exchange_wtime[i] = 0.;
     this_locator->exchange_cpu_time[i] = 0.;
+    this_locator->relocate_wtime[i] = 0.;
+    this_locator->relocate_cpu_time[i] = 0.;
   }
 
   return this_locator;
@@ -2645,6 +2982,11 @@ ple_locator_destroy(ple_locator_t  *this_locator)
     PLE_FREE(this_locator->interior_list);
     PLE_FREE(this_locator->exterior_list);
 
+#if defined(PLE_HAVE_MPI)
+    if (this_locator->graph_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(this_locator->graph_comm));
+#endif
+
     PLE_FREE(this_locator);
   }
 
@@ -3011,6 +3353,187 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
   this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update location of previously located points which may have moved.
+ *
+ * Current coordinates of points located by the previous calls to
+ * ple_locator_set_mesh() or ple_locator_extend_search() are sent to the
+ * ranks on which they were located, where the relocation function is
+ * called, using the previous location of each point as a starting point.
+ * Points for which this function does not return a location are marked
+ * as lost.
+ *
+ * This function must be called by all ranks of the locator's communicator.
+ * It returns the global number of points which were lost or not previously
+ * located; if this number is nonzero, ple_locator_extend_search() must be
+ * called with the same point set as that used for the previous location,
+ * so as to search only for those points, before any variable exchange.
+ *
+ * If point tags are used, a point is kept only if it is relocated in
+ * the same element.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ *                                     used by mesh_relocate_f
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      point_coords        current coordinates of points
+ *                                     (dimension: dim * n_points)
+ * \param[in]      mesh_relocate_f     pointer to function updating the
+ *                                     location of points starting from their
+ *                                     previous location
+ *
+ * \return global number of points which need to be searched for
+ */
+/*----------------------------------------------------------------------------*/
+
+ple_lnum_t
+ple_locator_relocate(ple_locator_t                 *this_locator,
+                     const void                    *mesh,
+                     float                          tolerance_base,
+                     float                          tolerance_fraction,
+                     const ple_coord_t              point_coords[],
+                     ple_mesh_elements_relocate_t  *mesh_relocate_f)
+{
+  ple_lnum_t i, n_dist_points = 0, n_search = 0;
+  int j;
+  double w_start, w_end, cpu_start, cpu_end;
+
+  ple_coord_t *send_coords = NULL;
+  ple_lnum_t *prev_location = NULL;
+  float *distance = NULL, *dist_located = NULL, *located = NULL;
+
+  const int dim = this_locator->dim;
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t n_interior = this_locator->n_interior;
+
+  /* Communication times of exchanges are counted as relocation times */
+
+  const double e_wtime = this_locator->exchange_wtime[1];
+  const double e_cpu_time = this_locator->exchange_cpu_time[1];
+
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+  if (this_locator->n_intersects > 0)
+    n_dist_points
+      = this_locator->distant_points_idx[this_locator->n_intersects];
+
+  /* Send current coordinates of located points */
+
+  PLE_MALLOC(send_coords, n_interior*dim, ple_coord_t);
+
+  for (i = 0; i < n_interior; i++) {
+    const ple_lnum_t k = this_locator->interior_list[i] - idb;
+    for (j = 0; j < dim; j++)
+      send_coords[i*dim + j] = point_coords[k*dim + j];
+  }
+
+  _exchange_point_var(this_locator,
+                      this_locator->distant_point_coords,
+                      send_coords,
+                      NULL,
+                      sizeof(ple_coord_t),
+                      dim,
+                      1);
+
+  PLE_FREE(send_coords);
+
+  /* Relocate distant points */
+
+  PLE_MALLOC(dist_located, n_dist_points, float);
+
+  if (n_dist_points > 0) {
+
+    ple_lnum_t *location = this_locator->distant_point_location;
+
+    PLE_MALLOC(distance, n_dist_points, float);
+
+    if (this_locator->have_tags) {
+      PLE_MALLOC(prev_location, n_dist_points, ple_lnum_t);
+      for (i = 0; i < n_dist_points; i++)
+        prev_location[i] = location[i];
+    }
+
+    mesh_relocate_f(mesh,
+                    tolerance_base,
+                    tolerance_fraction,
+                    n_dist_points,
+                    this_locator->distant_point_coords,
+                    location,
+                    distance);
+
+    if (prev_location != NULL) {
+      for (i = 0; i < n_dist_points; i++) {
+        if (location[i] != prev_location[i])
+          location[i] = -1;
+      }
+      PLE_FREE(prev_location);
+    }
+
+    for (i = 0; i < n_dist_points; i++)
+      dist_located[i] = (location[i] > -1) ? 1 : 0;
+
+    PLE_FREE(distance);
+
+  }
+
+  /* Return status to points' owners */
+
+  PLE_MALLOC(located, n_interior, float);
+
+  _exchange_point_var(this_locator,
+                      dist_located,
+                      located,
+                      NULL,
+                      sizeof(float),
+                      1,
+                      0);
+
+  PLE_FREE(dist_located);
+
+  n_search = this_locator->n_exterior;
+  for (i = 0; i < n_interior; i++) {
+    if (located[i] < 0.5)
+      n_search += 1;
+  }
+
+  PLE_FREE(located);
+
+#if defined(PLE_HAVE_MPI)
+  {
+    int mpi_flag = 0;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && this_locator->comm != MPI_COMM_NULL) {
+      ple_lnum_t n_search_loc = n_search;
+      MPI_Allreduce(&n_search_loc, &n_search, 1, PLE_MPI_LNUM, MPI_SUM,
+                    this_locator->comm);
+    }
+  }
+#endif
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->relocate_wtime[0] += (w_end - w_start);
+  this_locator->relocate_cpu_time[0] += (cpu_end - cpu_start);
+
+  this_locator->relocate_wtime[1] += this_locator->exchange_wtime[1] - e_wtime;
+  this_locator->relocate_cpu_time[1]
+    += this_locator->exchange_cpu_time[1] - e_cpu_time;
+
+  this_locator->exchange_wtime[1] = e_wtime;
+  this_locator->exchange_cpu_time[1] = e_cpu_time;
+
+  return n_search;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Shift location ids for located points after locator initialization.
@@ -3239,66 +3762,18 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
 {
   double w_start, w_end, cpu_start, cpu_end;
 
-  int mpi_flag = 0;
-  _Bool _reverse = reverse;
-
   /* Initialize timing */
 
   w_start = ple_timer_wtime();
   cpu_start = ple_timer_cpu_time();
 
-#if defined(PLE_HAVE_MPI)
-
-  MPI_Initialized(&mpi_flag);
-
-  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
-    mpi_flag = 0;
-
-  if (mpi_flag) {
-
-    MPI_Datatype datatype = MPI_DATATYPE_NULL;
-
-    if (type_size == sizeof(double))
-      datatype = MPI_DOUBLE;
-    else if (type_size == sizeof(float))
-      datatype = MPI_FLOAT;
-    else
-      ple_error(__FILE__, __LINE__, 0,
-                _("type_size passed to ple_locator_exchange_point_var() does\n"
-                  "not correspond to double or float."));
-
-    assert (datatype != MPI_DATATYPE_NULL);
-
-    if (this_locator->exchange_algorithm == _EXCHANGE_SENDRECV)
-      _exchange_point_var_distant(this_locator,
-                                  distant_var,
-                                  local_var,
-                                  local_list,
-                                  datatype,
-                                  stride,
-                                  _reverse);
-
-    else if (this_locator->exchange_algorithm == _EXCHANGE_ISEND_IRECV)
-      _exchange_point_var_distant_asyn(this_locator,
-                                       distant_var,
-                                       local_var,
-                                       local_list,
-                                       datatype,
-                                       stride,
-                                       _reverse);
-
-  }
-
-#endif /* defined(PLE_HAVE_MPI) */
-
-  if (!mpi_flag)
-    _exchange_point_var_local(this_locator,
-                              distant_var,
-                              local_var,
-                              local_list,
-                              type_size,
-                              stride,
-                              _reverse);
+  _exchange_point_var(this_locator,
+                      distant_var,
+                      local_var,
+                      local_list,
+                      type_size,
+                      stride,
+                      reverse);
 
   /* Finalize timing */
 
@@ -3374,6 +3849,36 @@ ple_locator_get_comm_times(const ple_locator_t  *this_locator,
              exchange_wtime, exchange_cpu_time);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return relocation timing information.
+ *
+ * Times of calls to ple_locator_relocate() are not included in location
+ * times, so as to distinguish incremental and full location costs.
+ *
+ * \param[in]  this_locator      pointer to locator structure
+ * \param[out] relocate_wtime    Relocation Wall-clock time, then associated
+ *                               communication time (size: 2 or NULL)
+ * \param[out] relocate_cpu_time Relocation CPU time, then associated
+ *                               communication time (size: 2 or NULL)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_get_relocate_times(const ple_locator_t  *this_locator,
+                               double               *relocate_wtime,
+                               double               *relocate_cpu_time)
+{
+  for (int i = 0; i < 2; i++) {
+    if (relocate_wtime != NULL)
+      relocate_wtime[i]
+        = (this_locator != NULL) ? this_locator->relocate_wtime[i] : 0.;
+    if (relocate_cpu_time != NULL)
+      relocate_cpu_time[i]
+        = (this_locator != NULL) ? this_locator->relocate_cpu_time[i] : 0.;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump printout of a locator structure.
@@ -3567,6 +4072,45 @@ ple_locator_set_async_threshold(int threshold)
   _ple_locator_async_threshold = threshold;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the exchange algorithm type used by locators set up
+ * subsequently.
+ *
+ * \return exchange algorithm type
+ */
+/*----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t
+ple_locator_get_exchange_type(void)
+{
+  return _ple_locator_exchange_type;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the exchange algorithm type used by locators set up
+ * subsequently.
+ *
+ * The type is applied when location is done (by ple_locator_set_mesh() or
+ * ple_locator_extend_search()). With PLE_LOCATOR_EXCHANGE_NEIGHBOR, a
+ * distributed graph communicator based on intersecting ranks is built
+ * at that stage, and each exchange then uses neighborhood collectives.
+ *
+ * Neighborhood collectives are used only if this type was set on all ranks
+ * of a locator's communicator (i.e. by all coupled codes), and require
+ * MPI 3; otherwise, point-to-point exchanges are used.
+ *
+ * \param[in] type exchange algorithm type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_set_exchange_type(ple_locator_exchange_t  type)
+{
+  _ple_locator_exchange_type = type;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Register communication logging functions for locator instrumentation.
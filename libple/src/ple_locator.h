@@ -70,6 +70,19 @@ typedef enum {
 
 } ple_locator_option_t;
 
+/* Exchange algorithm types */
+
+typedef enum {
+
+  PLE_LOCATOR_EXCHANGE_P2P,       /* Point-to-point exchanges (MPI_Sendrecv
+                                     or MPI_Isend/MPI_Irecv, based on the
+                                     asynchronous exchange threshold) */
+  PLE_LOCATOR_EXCHANGE_NEIGHBOR   /* MPI-3 neighborhood collectives on a
+                                     distributed graph communicator built
+                                     once location is done */
+
+} ple_locator_exchange_t;
+
 /*----------------------------------------------------------------------------
  * Query number of extents and compute extents of a mesh representation.
  *
@@ -145,6 +158,41 @@ typedef void
                               ple_lnum_t          location[],
                               float               distance[]);
 
+/*----------------------------------------------------------------------------
+ * Update the location of points in a given local mesh, starting from
+ * their previous location.
+ *
+ * On input, location[] contains the number of the element in which each
+ * point was previously located. On output, it contains the number of the
+ * element containing the point, or -1 if the point could not be located
+ * reliably from this starting point (in which case it will be searched
+ * for again, possibly on other ranks).
+ *
+ * parameters:
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   n_points           <-- number of points to relocate
+ *   point_coords       <-- point coordinates (interleaved)
+ *   location           <-> number of element containing each point,
+ *                          or -1 (size: n_points)
+ *   distance           --> distance from point to element indicated by
+ *                          location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                          and > 1 if outside a volume element, or absolute
+ *                          distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(ple_mesh_elements_relocate_t) (const void         *mesh,
+                                float               tolerance_base,
+                                float               tolerance_fraction,
+                                ple_lnum_t          n_points,
+                                const ple_coord_t   point_coords[],
+                                ple_lnum_t          location[],
+                                float               distance[]);
+
 /*----------------------------------------------------------------------------
  * Function pointer type for user definable logging/profiling type functions
  *----------------------------------------------------------------------------*/
@@ -301,6 +349,49 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f);
 
+/*----------------------------------------------------------------------------
+ * Update location of previously located points which may have moved.
+ *
+ * Current coordinates of points located by the previous calls to
+ * ple_locator_set_mesh() or ple_locator_extend_search() are sent to the
+ * ranks on which they were located, where the relocation function is
+ * called, using the previous location of each point as a starting point.
+ * Points for which this function does not return a location are marked
+ * as lost.
+ *
+ * This function must be called by all ranks of the locator's communicator.
+ * It returns the global number of points which were lost or not previously
+ * located; if this number is nonzero, ple_locator_extend_search() must be
+ * called with the same point set as that used for the previous location,
+ * so as to search only for those points, before any variable exchange.
+ *
+ * If point tags are used, a point is kept only if it is relocated in
+ * the same element.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *                          used by mesh_relocate_f
+ *   tolerance_base     <-- associated base tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   point_coords       <-- current coordinates of points
+ *                          (dimension: dim * n_points)
+ *   mesh_relocate_f    <-- pointer to function updating the location of
+ *                          points starting from their previous location
+ *
+ * returns:
+ *   global number of points which need to be searched for
+ *----------------------------------------------------------------------------*/
+
+ple_lnum_t
+ple_locator_relocate(ple_locator_t                 *this_locator,
+                     const void                    *mesh,
+                     float                          tolerance_base,
+                     float                          tolerance_fraction,
+                     const ple_coord_t              point_coords[],
+                     ple_mesh_elements_relocate_t  *mesh_relocate_f);
+
 /*----------------------------------------------------------------------------
  * Shift location ids for located points after locator initialization.
  *
@@ -503,6 +594,25 @@ ple_locator_get_comm_times(const ple_locator_t  *this_locator,
                            double               *exchange_wtime,
                            double               *exchange_cpu_time);
 
+/*----------------------------------------------------------------------------
+ * Return relocation timing information.
+ *
+ * Times of calls to ple_locator_relocate() are not included in location
+ * times, so as to distinguish incremental and full location costs.
+ *
+ * parameters:
+ *   this_locator      <-- pointer to locator structure
+ *   relocate_wtime    --> Relocation Wall-clock time, then associated
+ *                         communication time (size: 2 or NULL)
+ *   relocate_cpu_time --> Relocation CPU time, then associated
+ *                         communication time (size: 2 or NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_get_relocate_times(const ple_locator_t  *this_locator,
+                               double               *relocate_wtime,
+                               double               *relocate_cpu_time);
+
 /*----------------------------------------------------------------------------
  * Dump printout of a locator structure.
  *
@@ -543,6 +653,38 @@ ple_locator_set_async_threshold(int threshold);
 
 #endif /* defined(PLE_HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Get the exchange algorithm type used by locators set up subsequently.
+ *
+ * returns:
+ *   exchange algorithm type
+ *----------------------------------------------------------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+ple_locator_exchange_t
+ple_locator_get_exchange_type(void);
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Set the exchange algorithm type used by locators set up subsequently.
+ *
+ * Neighborhood collectives are used only if this type was set on all ranks
+ * of a locator's communicator (i.e. by all coupled codes), and require
+ * MPI 3; otherwise, point-to-point exchanges are used.
+ *
+ * parameters:
+ *   type  <-- exchange algorithm type
+ *----------------------------------------------------------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+void
+ple_locator_set_exchange_type(ple_locator_exchange_t  type);
+
+#endif /* defined(PLE_HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Register communication logging functions for locator instrumentation.
  *
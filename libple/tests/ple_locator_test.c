@@ -0,0 +1,276 @@
+/*============================================================================
+ * Unit test for ple_locator.c exchange algorithms;
+ *============================================================================*/
+
+/*
+  This file is part of the "Distributed Projection and Exchange" library,
+  intended to provide mesh or particle-based code coupling services.
+
+  Copyright (C) 2005-2018  EDF S.A.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ple_config_defs.h"
+#include "ple_defs.h"
+
+#if defined(PLE_HAVE_MPI)
+#include <mpi.h>
+#endif
+
+#include "ple_locator.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Simple mesh: row of unit cubes [i, i+1]x[0, 1]x[0, 1],
+   with cubes [start, start + n_elts[ on the local rank */
+
+typedef struct {
+
+  ple_lnum_t  start;
+  ple_lnum_t  n_elts;
+
+} _box_row_t;
+
+/*---------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Compute extents of a row of cubes (ple_mesh_extents_t function).
+ *----------------------------------------------------------------------------*/
+
+static ple_lnum_t
+_box_row_extents(const void  *mesh,
+                 ple_lnum_t   n_max_extents,
+                 double       tolerance,
+                 double       extents[])
+{
+  const _box_row_t *m = mesh;
+
+  if (n_max_extents < 0)
+    return 1;
+
+  extents[0] = m->start - tolerance;
+  extents[1] = - tolerance;
+  extents[2] = - tolerance;
+  extents[3] = m->start + m->n_elts + tolerance;
+  extents[4] = 1 + tolerance;
+  extents[5] = 1 + tolerance;
+
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Locate points in a row of cubes (ple_mesh_elements_locate_t function).
+ *----------------------------------------------------------------------------*/
+
+static void
+_box_row_locate(const void         *mesh,
+                float               tolerance_base,
+                float               tolerance_fraction,
+                ple_lnum_t          n_points,
+                const ple_coord_t   point_coords[],
+                const int           point_tag[],
+                ple_lnum_t          location[],
+                float               distance[])
+{
+  const _box_row_t *m = mesh;
+
+  PLE_UNUSED(tolerance_base);
+  PLE_UNUSED(tolerance_fraction);
+  PLE_UNUSED(point_tag);
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+    const ple_coord_t *c = point_coords + 3*i;
+    ple_lnum_t elt_id = (ple_lnum_t)(c[0]) - m->start;
+    if (elt_id < 0 || elt_id >= m->n_elts)
+      continue;
+    if (c[1] < 0 || c[1] > 1 || c[2] < 0 || c[2] > 1)
+      continue;
+    if (distance[i] < 0 || distance[i] > 0.5) {
+      location[i] = elt_id + 1;
+      distance[i] = 0.5;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Locate points with a given exchange type, and exchange element centers
+ * (forward) and point abscissas (reverse).
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+#if defined(PLE_HAVE_MPI)
+
+static int
+_locate_and_exchange(ple_locator_exchange_t   type,
+                     const _box_row_t        *m,
+                     ple_lnum_t               n_points,
+                     const ple_coord_t        coords[],
+                     double                   elt_x[],
+                     double                   pt_x[])
+{
+  int n_errors = 0;
+  int comm_size;
+  int options[PLE_LOCATOR_N_OPTIONS];
+
+  options[PLE_LOCATOR_NUMBERING] = 1;
+
+  MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+  ple_locator_set_exchange_type(type);
+
+  ple_locator_t *l = ple_locator_create(MPI_COMM_WORLD, comm_size, 0);
+
+  ple_locator_set_mesh(l,
+                       m,
+                       options,
+                       0.,
+                       0.1,
+                       3,
+                       n_points,
+                       NULL,
+                       NULL,
+                       coords,
+                       NULL,
+                       _box_row_extents,
+                       _box_row_locate);
+
+  if (ple_locator_get_n_exterior(l) != 0)
+    n_errors += 1;
+
+  /* Forward exchange: located points receive the center of their element */
+
+  ple_lnum_t n_dist = ple_locator_get_n_dist_points(l);
+  const ple_lnum_t *dist_loc = ple_locator_get_dist_locations(l);
+  const ple_coord_t *dist_coords = ple_locator_get_dist_coords(l);
+
+  double *dist_var = NULL;
+  PLE_MALLOC(dist_var, n_dist, double);
+
+  for (ple_lnum_t i = 0; i < n_dist; i++)
+    dist_var[i] = m->start + dist_loc[i] - 0.5;
+
+  ple_locator_exchange_point_var(l, dist_var, elt_x, NULL,
+                                 sizeof(double), 1, 0);
+
+  /* Reverse exchange: elements receive the abscissa of distant points */
+
+  for (ple_lnum_t i = 0; i < n_points; i++)
+    pt_x[i] = coords[3*i];
+
+  ple_locator_exchange_point_var(l, dist_var, pt_x, NULL,
+                                 sizeof(double), 1, 1);
+
+  for (ple_lnum_t i = 0; i < n_dist; i++) {
+    if (dist_var[i] != dist_coords[3*i])
+      n_errors += 1;
+  }
+
+  PLE_FREE(dist_var);
+
+  l = ple_locator_destroy(l);
+
+  return n_errors;
+}
+
+#endif /* (PLE_HAVE_MPI) */
+
+/*---------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = EXIT_SUCCESS;
+
+#if defined(PLE_HAVE_MPI)
+
+  int rank, comm_size;
+  int n_errors[3] = {0, 0, 0}, n_errors_g[3];
+
+  const ple_lnum_t n_elts = 10, n_points = 25;
+
+  MPI_Init(&argc, &argv);
+
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+  _box_row_t m = {.start = rank*n_elts, .n_elts = n_elts};
+
+  /* Points at cell centers, shifted so most are located on other ranks */
+
+  ple_coord_t *coords = NULL;
+  double *elt_x[2], *pt_x[2];
+
+  PLE_MALLOC(coords, n_points*3, ple_coord_t);
+
+  for (int j = 0; j < 2; j++) {
+    PLE_MALLOC(elt_x[j], n_points, double);
+    PLE_MALLOC(pt_x[j], n_points, double);
+  }
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+    ple_lnum_t elt_id = ((rank + 1)*n_elts + 3*i) % (comm_size*n_elts);
+    coords[i*3]     = elt_id + 0.5;
+    coords[i*3 + 1] = 0.5;
+    coords[i*3 + 2] = 0.5;
+  }
+
+  n_errors[0] = _locate_and_exchange(PLE_LOCATOR_EXCHANGE_P2P,
+                                     &m, n_points, coords,
+                                     elt_x[0], pt_x[0]);
+
+  n_errors[1] = _locate_and_exchange(PLE_LOCATOR_EXCHANGE_NEIGHBOR,
+                                     &m, n_points, coords,
+                                     elt_x[1], pt_x[1]);
+
+  ple_locator_set_exchange_type(PLE_LOCATOR_EXCHANGE_P2P);
+
+  /* Both algorithms must return the same (exact) values */
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+    if (   elt_x[0][i] != coords[i*3] || elt_x[1][i] != elt_x[0][i]
+        || pt_x[1][i] != pt_x[0][i])
+      n_errors[2] += 1;
+  }
+
+  MPI_Allreduce(n_errors, n_errors_g, 3, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+  ple_printf("\nLocator exchange test on %d ranks:\n"
+             "  point-to-point errors:          %d\n"
+             "  neighborhood collective errors: %d\n"
+             "  mismatches:                     %d\n",
+             comm_size, n_errors_g[0], n_errors_g[1], n_errors_g[2]);
+
+  if (n_errors_g[0] + n_errors_g[1] + n_errors_g[2] > 0)
+    retval = EXIT_FAILURE;
+
+  for (int j = 0; j < 2; j++) {
+    PLE_FREE(elt_x[j]);
+    PLE_FREE(pt_x[j]);
+  }
+  PLE_FREE(coords);
+
+  MPI_Finalize();
+
+#endif /* (PLE_HAVE_MPI) */
+
+  exit (retval);
+}
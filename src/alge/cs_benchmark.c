@@ -30,6 +30,7 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -76,18 +77,26 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
+#include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_connect.h"
 #include "cs_mesh_quantities.h"
 #include "cs_matrix.h"
 #include "cs_matrix_assembler.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_tuning.h"
+#include "cs_multigrid.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 
+#include "fvm_nodal.h"
+#include "fvm_writer.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -117,6 +126,18 @@ BEGIN_C_DECLS
  *  Global variables
  *============================================================================*/
 
+/* JSON output (rank 0 only) */
+
+static FILE  *_json_file = NULL;
+static int    _json_n_records = 0;
+
+/* Short gradient type names for benchmark output */
+
+static const char *_gradient_type_b_name[] = {"iter",
+                                              "lsq",
+                                              "lsq_iter",
+                                              "iter_old"};
+
 static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
   = {{N_("y <- A.x"),
       N_("y <- (A-D).x")},
@@ -135,22 +156,138 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add a result record to the JSON benchmark output.
+ *
+ * This function is collective, as values are summed over all ranks;
+ * only rank 0 writes to the output file.
+ *
+ * parameters:
+ *   category <-- benchmark category
+ *   name     <-- benchmark name
+ *   n_runs   <-- local number of runs
+ *   n_elts   <-- local number of elements handled per run, or 0
+ *   n_ops    <-- local number of floating-point operations per run, or 0
+ *   n_bytes  <-- estimated local memory or message traffic per run, or 0
+ *   wt       <-- wall-clock time
+ *----------------------------------------------------------------------------*/
+
+static void
+_json_record(const char  *category,
+             const char  *name,
+             long         n_runs,
+             double       n_elts,
+             double       n_ops,
+             double       n_bytes,
+             double       wt)
+{
+  double v_sum[4] = {n_elts, n_ops, n_bytes, wt};
+  double t_min = wt, t_max = wt;
+
+  cs_parall_sum(4, CS_DOUBLE, v_sum);
+  cs_parall_min(1, CS_DOUBLE, &t_min);
+  cs_parall_max(1, CS_DOUBLE, &t_max);
+
+  if (_json_file == NULL)
+    return;
+
+  const char *rate_name[] = {"elements_per_s", "gflops", "gbytes_per_s"};
+  const double rate_scale[] = {1., 1.e-9, 1.e-9};
+
+  int n_threads = 1;
+#if defined(HAVE_OPENMP)
+  n_threads = omp_get_max_threads();
+#endif
+
+  double r_runs = 1. / CS_MAX(n_runs, 1);
+
+  fprintf(_json_file,
+          "%s\n    {\"category\": \"%s\", \"name\": \"%s\",\n"
+          "     \"n_ranks\": %d, \"n_threads\": %d, \"n_calls\": %ld,\n"
+          "     \"time_per_call\": {\"mean\": %.6e, \"min\": %.6e,"
+          " \"max\": %.6e}",
+          (_json_n_records > 0) ? "," : "",
+          category, name, cs_glob_n_ranks, n_threads, n_runs,
+          v_sum[3]*r_runs/cs_glob_n_ranks, t_min*r_runs, t_max*r_runs);
+
+  /* Rates are based on the slowest rank */
+
+  for (int i = 0; i < 3; i++) {
+    if (v_sum[i] > 0 && t_max > 0)
+      fprintf(_json_file, ",\n     \"%s\": %.6e",
+              rate_name[i], v_sum[i]*rate_scale[i]*n_runs/t_max);
+    else
+      fprintf(_json_file, ",\n     \"%s\": null", rate_name[i]);
+  }
+
+  fprintf(_json_file, "}");
+  fflush(_json_file);
+
+  _json_n_records++;
+}
+
+/*----------------------------------------------------------------------------
+ * Log wall-clock time per call and bandwidth.
+ *
+ * parameters:
+ *   n_runs  <-- local number of runs
+ *   n_bytes <-- estimated local memory or message traffic per run, or 0
+ *   wt      <-- wall-clock time
+ *----------------------------------------------------------------------------*/
+
+static void
+_print_time_stats(long    n_runs,
+                  double  n_bytes,
+                  double  wt)
+{
+  double t[3] = {wt/n_runs, wt/n_runs, wt/n_runs};
+  double t_max = wt;
+
+  cs_parall_sum(1, CS_DOUBLE, t);
+  cs_parall_min(1, CS_DOUBLE, t+1);
+  cs_parall_max(1, CS_DOUBLE, t+2);
+  cs_parall_sum(1, CS_DOUBLE, &n_bytes);
+  cs_parall_max(1, CS_DOUBLE, &t_max);
+
+  if (cs_glob_n_ranks == 1)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Wall clock:  %12.5e\n"), t[0]);
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("               Mean         Min          Max\n"
+                    "  Wall clock:  %12.5e %12.5e %12.5e\n"),
+                  t[0]/cs_glob_n_ranks, t[1], t[2]);
+
+  if (n_bytes > 0 && t_max > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  GB/s:        %12.5e\n"),
+                  n_bytes*n_runs/(1.e9*t_max));
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+}
+
 /*----------------------------------------------------------------------------
  * Count number of operations.
  *
  * parameters:
+ *   category     <-- benchmark category (for JSON output)
+ *   name         <-- benchmark name (for JSON output)
  *   n_runs       <-- Local number of runs
  *   n_ops        <-- Local number of operations
  *   n_ops_single <-- Single-processor equivalent number of operations
  *                    (without ghosts); ignored if 0
+ *   n_bytes      <-- Local estimated memory traffic; ignored if 0
  *   wt           <-- wall-clock time
  *----------------------------------------------------------------------------*/
 
 static void
-_print_stats(long    n_runs,
-             long    n_ops,
-             long    n_ops_single,
-             double  wt)
+_print_stats(const char  *category,
+             const char  *name,
+             long         n_runs,
+             long         n_ops,
+             long         n_ops_single,
+             double       n_bytes,
+             double       wt)
 {
   double fm = 1.0 * n_runs / (1.e9 * (CS_MAX(wt, 1)));
 
@@ -220,7 +357,18 @@ _print_stats(long    n_runs,
 
 #endif
 
+  if (n_bytes > 0) {
+    double bytes_tot = n_bytes, wt_max = wt;
+    cs_parall_sum(1, CS_DOUBLE, &bytes_tot);
+    cs_parall_max(1, CS_DOUBLE, &wt_max);
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  GB/s:        %12.5e\n"),
+                  bytes_tot*n_runs/(1.e9*CS_MAX(wt_max, 1.e-12)));
+  }
+
   cs_log_printf_flush(CS_LOG_PERFORMANCE);
+
+  _json_record(category, name, n_runs, 0, n_ops, n_bytes, wt);
 }
 
 /*----------------------------------------------------------------------------
@@ -262,6 +410,8 @@ _matrix_vector_test(double                 t_measure,
   double wt0, wt1;
   int    run_id, n_runs;
   long   n_ops, n_ops_glob;
+  double n_bytes;
+  char   name[64];
 
   double test_sum = 0.0;
   cs_matrix_structure_t *ms = NULL;
@@ -278,6 +428,12 @@ _matrix_vector_test(double                 t_measure,
   else
     n_ops_glob = (cs_glob_mesh->n_g_cells + cs_glob_mesh->n_g_i_faces*4);
 
+  /* Minimum memory traffic: coefficients, column ids, x and y */
+
+  n_bytes =   (n_cells + n_faces*2) * sizeof(cs_real_t)
+            + n_faces*2 * sizeof(cs_lnum_t)
+            + n_cells*2 * sizeof(cs_real_t);
+
   ms = cs_matrix_structure_create(m_type,
                                   true,
                                   n_cells,
@@ -339,7 +495,11 @@ _matrix_vector_test(double                 t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  snprintf(name, 63, "A.x%s (%s)",
+           (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+  name[63] = '\0';
+
+  _print_stats("matrix", name, n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
   /* Local timing in parallel mode */
 
@@ -379,7 +539,12 @@ _matrix_vector_test(double                 t_measure,
                   _("  (calls: %d;  test sum: %12.5f)\n"),
                   n_runs, test_sum);
 
-    _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+    snprintf(name, 63, "A.x local%s (%s)",
+             (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+    name[63] = '\0';
+
+    _print_stats("matrix", name,
+                 n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
   }
 
@@ -395,6 +560,8 @@ _matrix_vector_test(double                 t_measure,
   else
     n_ops_glob = (cs_glob_mesh->n_g_i_faces*4 - cs_glob_mesh->n_g_cells);
 
+  n_bytes -= n_cells * sizeof(cs_real_t);
+
   test_sum = 0.0;
   wt0 = cs_timer_wtime(), wt1 = wt0;
   if (t_measure > 0)
@@ -431,7 +598,11 @@ _matrix_vector_test(double                 t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  snprintf(name, 63, "(A-D).x%s (%s)",
+           (sym_coeffs) ? " symm coeffs" : "", cs_matrix_type_name[m_type]);
+  name[63] = '\0';
+
+  _print_stats("matrix", name, n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
   cs_matrix_destroy(&m);
   cs_matrix_structure_destroy(&ms);
@@ -613,6 +784,7 @@ _sub_matrix_vector_test(double               t_measure,
   double wt0, wt1;
   int    run_id, n_runs;
   long   n_ops, n_ops_glob;
+  double n_bytes;
   double *ya = NULL;
 
   double test_sum = 0.0;
@@ -627,6 +799,12 @@ _sub_matrix_vector_test(double               t_measure,
   else
     n_ops_glob = (cs_glob_mesh->n_g_i_faces*4 - cs_glob_mesh->n_g_cells);
 
+  /* Minimum memory traffic: coefficients, face->cells, x and y */
+
+  n_bytes =   n_faces * sizeof(cs_real_t)
+            + n_faces*2 * sizeof(cs_lnum_t)
+            + n_cells*2 * sizeof(cs_real_t);
+
   for (jj = 0; jj < n_cells_ext; jj++)
     y[jj] = 0.0;
 
@@ -660,7 +838,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("matrix", "exdiag native v0",
+               n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
   for (jj = 0; jj < n_cells_ext; jj++)
     y[jj] = 0.0;
@@ -697,7 +876,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("matrix", "exdiag native v1",
+               n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
   /* Matrix.vector product, contribute to faces only */
 
@@ -710,6 +890,13 @@ _sub_matrix_vector_test(double               t_measure,
   else
     n_ops_glob = (cs_glob_mesh->n_g_i_faces*2);
 
+  /* coefficients, face->cells, x, and face values (read and written) */
+
+  n_bytes =   n_faces * sizeof(cs_real_t)
+            + n_faces*2 * sizeof(cs_lnum_t)
+            + n_cells * sizeof(cs_real_t)
+            + n_faces*2 * sizeof(cs_real_t);
+
   BFT_MALLOC(ya, n_faces, cs_real_t);
   for (jj = 0; jj < n_faces; jj++)
     ya[jj] = 0.0;
@@ -744,7 +931,8 @@ _sub_matrix_vector_test(double               t_measure,
                 _("  (calls: %d;  test sum: %12.5f)\n"),
                 n_runs, test_sum);
 
-  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_stats("matrix", "face values only",
+               n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
 
 }
 
@@ -1148,6 +1336,634 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
   BFT_FREE(da);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure scalar gradient computation performance.
+ *
+ * Cell cocg arrays for both iterative and least-squares gradients must
+ * have been computed.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   n_types   <-- number of gradient types to test
+ *   types     <-- gradient types to test
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_test(double                    t_measure,
+               int                       n_types,
+               const cs_gradient_type_t  types[])
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  char   name[64];
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+
+  /* Extended neighborhood variants require the cell -> cells connectivity */
+
+  int n_halo_types = (m->cell_cells_idx != NULL) ? 2 : 1;
+  const cs_halo_type_t halo_type[] = {CS_HALO_STANDARD, CS_HALO_EXTENDED};
+
+  cs_real_t *var, *coefa, *coefb;
+  cs_real_3_t *grad;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(coefa, n_b_faces, cs_real_t);
+  BFT_MALLOC(coefb, n_b_faces, cs_real_t);
+
+  /* Non-linear field, so that reconstruction sweeps are not trivial */
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+    var[ii] = cell_cen[ii][0] + 0.5*cell_cen[ii][1]*cell_cen[ii][1];
+
+  /* Homogeneous Neumann boundary conditions */
+
+  for (cs_lnum_t ii = 0; ii < n_b_faces; ii++) {
+    coefa[ii] = 0.;
+    coefb[ii] = 1.;
+  }
+
+  for (int h_id = 0; h_id < n_halo_types; h_id++) {
+
+    for (int t_id = 0; t_id < n_types; t_id++) {
+
+      cs_gradient_type_t g_type = types[t_id];
+
+      snprintf(name, 63, "benchmark_%s%s",
+               _gradient_type_b_name[g_type], (h_id > 0) ? "_ext" : "");
+      name[63] = '\0';
+
+      double test_sum = 0.0;
+      wt0 = cs_timer_wtime(), wt1 = wt0;
+      if (t_measure > 0)
+        n_runs = 8;
+      else
+        n_runs = 1;
+      run_id = 0;
+      while (run_id < n_runs) {
+        double test_sum_mult = 1.0/n_runs;
+        while (run_id < n_runs) {
+          cs_gradient_scalar(name,
+                             g_type,
+                             halo_type[h_id],
+                             1,       /* inc */
+                             false,   /* recompute_cocg */
+                             100,     /* n_r_sweeps */
+                             0,       /* tr_dim */
+                             0,       /* hyd_p_flag */
+                             1,       /* w_stride */
+                             0,       /* verbosity */
+                             -1,      /* clip_mode */
+                             1.e-5,   /* epsilon */
+                             0.,      /* extrap */
+                             1.5,     /* clip_coeff */
+                             NULL,    /* f_ext */
+                             coefa,
+                             coefb,
+                             var,
+                             NULL,    /* c_weight */
+                             NULL,    /* cpl */
+                             grad);
+          test_sum += grad[n_cells-1][0]*test_sum_mult;
+          run_id++;
+        }
+        wt1 = cs_timer_wtime();
+        if (wt1 - wt0 < t_measure)
+          n_runs *= 2;
+      }
+
+      snprintf(name, 63, "%s, %s halo",
+               _gradient_type_b_name[g_type],
+               (h_id > 0) ? "extended" : "standard");
+      name[63] = '\0';
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "Scalar gradient (%s)\n"
+                      "---------------\n"),
+                    name);
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  (calls: %d;  test sum: %12.5f)\n"),
+                    n_runs, test_sum);
+
+      _print_time_stats(n_runs, 0, wt1 - wt0);
+
+      _json_record("gradient", name, n_runs, n_cells, 0, 0, wt1 - wt0);
+
+    }
+
+  }
+
+  BFT_FREE(coefb);
+  BFT_FREE(coefa);
+  BFT_FREE(grad);
+  BFT_FREE(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Convection-diffusion balance contribution of interior faces,
+ * using an upwind scheme for convection.
+ *
+ * This follows the structure of the interior face loops of
+ * cs_convection_diffusion_scalar, without the slope tests and
+ * options handling.
+ *
+ * parameters:
+ *   reconstruct <-- use reconstruction of values at I' and J'
+ *   i_massflux  <-- interior faces mass flux
+ *   i_visc      <-- interior faces diffusion coefficient
+ *   pvar        <-- variable values
+ *   grad        <-- variable gradient
+ *   rhs         <-> right-hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_conv_diff_i_faces(bool                          reconstruct,
+                   const cs_real_t     *restrict i_massflux,
+                   const cs_real_t     *restrict i_visc,
+                   const cs_real_t     *restrict pvar,
+                   const cs_real_3_t   *restrict grad,
+                   cs_real_t           *restrict rhs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)mq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)mq->djjpf;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t pip = pvar[ii], pjp = pvar[jj];
+
+        if (reconstruct) {
+          pip += cs_math_3_dot_product(diipf[face_id], grad[ii]);
+          pjp += cs_math_3_dot_product(djjpf[face_id], grad[jj]);
+        }
+
+        cs_real_t flui = 0.5*(i_massflux[face_id] + fabs(i_massflux[face_id]));
+        cs_real_t fluj = 0.5*(i_massflux[face_id] - fabs(i_massflux[face_id]));
+
+        cs_real_t flux =   flui*pvar[ii] + fluj*pvar[jj]
+                         + i_visc[face_id]*(pip - pjp);
+
+        rhs[ii] -= flux;
+        rhs[jj] += flux;
+
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Measure convection-diffusion interior face loop performance.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_conv_diff_test(double  t_measure)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob;
+  double n_bytes;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
+
+  cs_real_t *i_massflux, *i_visc, *pvar, *rhs;
+  cs_real_3_t *grad;
+
+  BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
+  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+  BFT_MALLOC(pvar, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    i_massflux[face_id] = i_face_normal[face_id][0]
+                          - 0.5*i_face_normal[face_id][1];
+    i_visc[face_id] = mq->i_face_surf[face_id] / mq->i_dist[face_id];
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++) {
+    pvar[ii] = cell_cen[ii][0];
+    grad[ii][0] = 1.;
+    grad[ii][1] = 0.;
+    grad[ii][2] = 0.;
+    rhs[ii] = 0.;
+  }
+
+  for (int r_id = 0; r_id < 2; r_id++) {
+
+    bool reconstruct = (r_id > 0) ? true : false;
+
+    /* upwind fluxes: 12 flops per face, and 12 more for reconstruction;
+       face->cells, mass flux, diffusion coefficient, pvar and rhs traffic,
+       plus gradient and II', JJ' vectors for reconstruction */
+
+    n_ops = n_i_faces * ((reconstruct) ? 24 : 12);
+
+    if (cs_glob_n_ranks == 1)
+      n_ops_glob = n_ops;
+    else
+      n_ops_glob = cs_glob_mesh->n_g_i_faces * ((reconstruct) ? 24 : 12);
+
+    n_bytes =   n_i_faces * 2 * sizeof(cs_lnum_t)
+              + n_i_faces * 2 * sizeof(cs_real_t)
+              + n_cells * 3 * sizeof(cs_real_t);
+    if (reconstruct)
+      n_bytes += n_i_faces * 6 * sizeof(cs_real_t)
+                 + n_cells * 3 * sizeof(cs_real_t);
+
+    double test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        _conv_diff_i_faces(reconstruct,
+                           i_massflux, i_visc, pvar,
+                           (const cs_real_3_t *)grad, rhs);
+        test_sum += rhs[n_cells-1]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (wt1 - wt0 < t_measure)
+        n_runs *= 2;
+    }
+
+    const char *name = (reconstruct) ? "upwind, reconstructed" : "upwind";
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Convection-diffusion interior faces (%s)\n"
+                    "-----------------------------------\n"),
+                  name);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d;  test sum: %12.5f)\n"),
+                  n_runs, test_sum);
+
+    _print_stats("convection_diffusion", name,
+                 n_runs, n_ops, n_ops_glob, n_bytes, wt1 - wt0);
+
+  }
+
+  BFT_FREE(rhs);
+  BFT_FREE(grad);
+  BFT_FREE(pvar);
+  BFT_FREE(i_visc);
+  BFT_FREE(i_massflux);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure halo exchange performance for various strides.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_test(double  t_measure)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  char   name[64];
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_halo_t *halo = m->halo;
+
+  const int n_strides = 4;
+  const int strides[] = {1, 3, 6, 9};
+
+  if (halo == NULL)
+    return;
+
+  int n_halo_types = (m->halo_type == CS_HALO_EXTENDED) ? 2 : 1;
+  const cs_halo_type_t halo_type[] = {CS_HALO_STANDARD, CS_HALO_EXTENDED};
+
+  const cs_lnum_t n_vals_max = m->n_cells_with_ghosts*strides[n_strides-1];
+
+  cs_real_t *var;
+  BFT_MALLOC(var, n_vals_max, cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_vals_max; ii++)
+    var[ii] = ii;
+
+  for (int h_id = 0; h_id < n_halo_types; h_id++) {
+
+    for (int s_id = 0; s_id < n_strides; s_id++) {
+
+      const int stride = strides[s_id];
+
+      /* Sent values, each received by one neighbor */
+
+      double n_vals = halo->n_send_elts[h_id] * stride;
+
+      wt0 = cs_timer_wtime(), wt1 = wt0;
+      if (t_measure > 0)
+        n_runs = 8;
+      else
+        n_runs = 1;
+      run_id = 0;
+      while (run_id < n_runs) {
+        while (run_id < n_runs) {
+          cs_halo_sync_var_strided(halo, halo_type[h_id], var, stride);
+          run_id++;
+        }
+        wt1 = cs_timer_wtime();
+        if (wt1 - wt0 < t_measure)
+          n_runs *= 2;
+      }
+
+      snprintf(name, 63, "%s halo, stride %d",
+               (h_id > 0) ? "extended" : "standard", stride);
+      name[63] = '\0';
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "Halo synchronization (%s)\n"
+                      "--------------------\n"
+                      "  (calls: %d)\n"),
+                    name, n_runs);
+
+      _print_time_stats(n_runs, n_vals*sizeof(cs_real_t), wt1 - wt0);
+
+      _json_record("halo", name, n_runs,
+                   n_vals, 0, n_vals*sizeof(cs_real_t), wt1 - wt0);
+
+    }
+
+  }
+
+  BFT_FREE(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure multigrid setup and solve performance, for a diffusion matrix.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_test(double  t_measure)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  int    n_iter = 0;
+  double residue = 0.;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  cs_real_t *da, *xa, *rhs, *vx;
+
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, n_i_faces, cs_real_t);
+  BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+  BFT_MALLOC(vx, n_cells_ext, cs_real_t);
+
+  /* Diffusion matrix, with Dirichlet conditions on boundary faces */
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++) {
+    da[ii] = 0.;
+    rhs[ii] = mq->cell_vol[ii];
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_real_t visc = mq->i_face_surf[face_id] / mq->i_dist[face_id];
+    xa[face_id] = -visc;
+    da[i_face_cells[face_id][0]] += visc;
+    da[i_face_cells[face_id][1]] += visc;
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < m->n_b_faces; face_id++)
+    da[m->b_face_cells[face_id]]
+      += mq->b_face_surf[face_id] / mq->b_dist[face_id];
+
+  cs_matrix_t *a = cs_matrix_msr(true, NULL, NULL);
+
+  cs_matrix_set_coefficients(a, true, NULL, NULL,
+                             n_i_faces, i_face_cells, da, xa);
+
+  double r_norm = sqrt(cs_gdot(n_cells, rhs, rhs));
+
+  cs_multigrid_t *mg = cs_multigrid_create();
+
+  /* Setup */
+
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 2;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      cs_multigrid_setup(mg, "benchmark", a, 0);
+      cs_multigrid_free(mg);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Multigrid setup (diffusion matrix)\n"
+                  "---------------\n"
+                  "  (calls: %d)\n"),
+                n_runs);
+
+  _print_time_stats(n_runs, 0, wt1 - wt0);
+
+  _json_record("multigrid", "setup", n_runs, n_cells, 0, 0, wt1 - wt0);
+
+  /* Solve (with a single setup) */
+
+  cs_multigrid_setup(mg, "benchmark", a, 0);
+
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 2;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++)
+        vx[ii] = 0.;
+      cs_multigrid_solve(mg, "benchmark", a, 0, CS_HALO_ROTATION_COPY,
+                         1.e-5, r_norm, &n_iter, &residue, rhs, vx,
+                         0, NULL);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Multigrid solve (diffusion matrix)\n"
+                  "---------------\n"
+                  "  (calls: %d;  cycles: %d;  residue: %12.5e)\n"),
+                n_runs, n_iter, residue);
+
+  _print_time_stats(n_runs, 0, wt1 - wt0);
+
+  _json_record("multigrid", "solve", n_runs, n_cells, 0, 0, wt1 - wt0);
+
+  cs_multigrid_free(mg);
+
+  void *mg_p = mg;
+  cs_multigrid_destroy(&mg_p);
+
+  BFT_FREE(vx);
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure postprocessing output performance.
+ *
+ * Output is written in EnSight Gold format, in the "benchmark" directory.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_postprocess_test(double  t_measure)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  /* Limit the number of output time steps */
+
+  const int n_runs_max = 16;
+
+  fvm_nodal_t *nm = cs_mesh_connect_cells_to_nodal(m,
+                                                   "benchmark",
+                                                   false,
+                                                   n_cells,
+                                                   NULL);
+
+  fvm_writer_t *w = fvm_writer_init("benchmark",
+                                    "benchmark",
+                                    "EnSight Gold",
+                                    "",
+                                    FVM_WRITER_FIXED_MESH);
+
+  /* Mesh output */
+
+  wt0 = cs_timer_wtime();
+  fvm_writer_export_nodal(w, nm);
+  wt1 = cs_timer_wtime();
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Postprocessing output (EnSight Gold, mesh)\n"
+                  "---------------------\n"));
+
+  _print_time_stats(1, 0, wt1 - wt0);
+
+  _json_record("postprocessing", "mesh", 1, n_cells, 0, 0, wt1 - wt0);
+
+  /* Cell-based scalar and vector fields output */
+
+  const cs_lnum_t parent_num_shift[] = {0};
+  const void *s_vals[1] = {mq->cell_vol};
+  const void *v_vals[1] = {mq->cell_cen};
+
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 2;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      fvm_writer_set_mesh_time(w, run_id, run_id);
+      fvm_writer_export_field(w, nm, "scalar", FVM_WRITER_PER_ELEMENT,
+                              1, CS_INTERLACE, 1, parent_num_shift,
+                              CS_REAL_TYPE, run_id, run_id, s_vals);
+      fvm_writer_export_field(w, nm, "vector", FVM_WRITER_PER_ELEMENT,
+                              3, CS_INTERLACE, 1, parent_num_shift,
+                              CS_REAL_TYPE, run_id, run_id, v_vals);
+      fvm_writer_flush(w);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure && n_runs < n_runs_max)
+      n_runs *= 2;
+  }
+
+  /* EnSight Gold output uses single precision */
+
+  double n_bytes = n_cells * 4 * sizeof(float);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Postprocessing output (EnSight Gold, fields)\n"
+                  "---------------------\n"
+                  "  (time steps: %d)\n"),
+                n_runs);
+
+  _print_time_stats(n_runs, n_bytes, wt1 - wt0);
+
+  _json_record("postprocessing", "scalar and vector fields",
+               n_runs, n_cells, 0, n_bytes, wt1 - wt0);
+
+  w = fvm_writer_finalize(w);
+  nm = fvm_nodal_destroy(nm);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1157,6 +1973,9 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
+ * Results are logged in the performance log, and also written in
+ * JSON format to the "benchmark.json" file.
+ *
  * parameters:
  *   mpi_trace_mode <-- indicates if timing mode (0) or MPI trace-friendly
  *                      mode (1) is to be used
@@ -1196,6 +2015,45 @@ cs_benchmark(int  mpi_trace_mode)
   double                 fill_weights_nsym[] = {0.5, 0.3, 0.1, 0.1};
   double                 fill_weights_sym[] = {0.8, 0.2};
 
+  const cs_gradient_type_t  g_types[] = {CS_GRADIENT_ITER,
+                                         CS_GRADIENT_LSQ,
+                                         CS_GRADIENT_LSQ_ITER,
+                                         CS_GRADIENT_ITER_OLD};
+
+  /* Open JSON output */
+
+  if (cs_glob_rank_id < 1) {
+
+    const char json_name[] = "benchmark.json";
+
+    _json_file = fopen(json_name, "w");
+    if (_json_file == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error opening file \"%s\":\n\n"
+                  "  %s"), json_name, strerror(errno));
+
+    int n_threads = 1;
+#if defined(HAVE_OPENMP)
+    n_threads = omp_get_max_threads();
+#endif
+
+    fprintf(_json_file,
+            "{\n"
+            "  \"n_ranks\": %d,\n"
+            "  \"n_threads\": %d,\n"
+            "  \"mpi_trace_mode\": %s,\n"
+            "  \"mesh\": {\"n_g_cells\": %llu, \"n_g_i_faces\": %llu,"
+            " \"n_g_b_faces\": %llu},\n"
+            "  \"results\": [",
+            cs_glob_n_ranks, n_threads,
+            (mpi_trace_mode) ? "true" : "false",
+            (unsigned long long)mesh->n_g_cells,
+            (unsigned long long)mesh->n_g_i_faces,
+            (unsigned long long)mesh->n_g_b_faces);
+
+    _json_n_records = 0;
+  }
+
   cs_mesh_adjacencies_initialize();
   cs_mesh_adjacencies_update_mesh();
 
@@ -1305,8 +2163,6 @@ cs_benchmark(int  mpi_trace_mode)
                       i_face_cells, mesh->halo,
                       mesh->i_face_numbering, da, xa, x, y);
 
-  cs_matrix_variant_destroy(&mv);
-
   _sub_matrix_vector_test(t_measure,
                           n_cells,
                           n_cells_ext,
@@ -1316,12 +2172,92 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  /* Other operators */
+  /*-----------------*/
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Other operators\n"
+                  "===============\n"));
+
+  _conv_diff_test(t_measure);
+
+  /* Ensure cocg arrays are available for all gradient types */
+
+  cs_mesh_quantities_set_cocg_options(16);
+  cs_mesh_quantities_compute(mesh, cs_glob_mesh_quantities);
+
+  cs_gradient_initialize();
+
+  _gradient_test(t_measure, 4, g_types);
+
+  _halo_test(t_measure);
+
+  _multigrid_test(t_measure);
+
+  _postprocess_test(t_measure);
+
+  /* Thread scaling (the maximum number of threads was used above) */
+
+#if defined(HAVE_OPENMP)
+
+  if (cs_glob_n_threads > 1) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n"
+                    "Thread scaling\n"
+                    "==============\n"));
+
+    for (int n_threads = 1; n_threads < cs_glob_n_threads; n_threads *= 2) {
+
+      omp_set_num_threads(n_threads);
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "  Number of threads: %d\n"),
+                    n_threads);
+
+      _matrix_vector_test(t_measure,
+                          mv, true,
+                          n_cells, n_cells_ext, n_faces,
+                          i_face_cells, mesh->halo,
+                          mesh->i_face_numbering, da, xa, x, y);
+
+      _conv_diff_test(t_measure);
+
+      _gradient_test(t_measure, 1, g_types + 1);
+
+    }
+
+    omp_set_num_threads(cs_glob_n_threads);
+
+  }
+
+#endif
+
+  cs_matrix_variant_destroy(&mv);
+
+  cs_gradient_finalize();
+
+  cs_multigrid_finalize();
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
 
   cs_log_separator(CS_LOG_PERFORMANCE);
 
+  /* Close JSON output */
+
+  if (_json_file != NULL) {
+    fprintf(_json_file, "\n  ]\n}\n");
+    if (fclose(_json_file) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error closing file \"%s\":\n\n"
+                  "  %s"), "benchmark.json", strerror(errno));
+    _json_file = NULL;
+  }
+
   /* Free working arrays */
   /*---------------------*/
 
@@ -52,6 +52,9 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
+ * Results are logged in the performance log, and also written in
+ * JSON format to the "benchmark.json" file.
+ *
  * parameters:
  *   mpi_trace_mode  --> indicates if timing mode (0) or MPI trace-friendly
  *                       mode (1) is to be used
@@ -119,6 +119,30 @@ typedef struct _cs_gradient_info_t {
 
 } cs_gradient_info_t;
 
+/* Precomputed least-squares gradient stencil */
+/*--------------------------------------------*/
+
+/* For each cell, entries match the neighbors of that cell through each
+   interior face (and the extended neighborhood if required). Weights
+   for cells not adjacent to the boundary include the inverse cocg matrix,
+   so that their gradient is a sparse matrix-vector product; for boundary
+   cells, they are purely geometric, as their cocg matrix and right-hand
+   side also depend on boundary conditions. */
+
+typedef struct {
+
+  int                 fvq_count;     /* Mesh quantities computation count
+                                        at build */
+  const cs_real_t    *cocg;          /* Associated cocg array */
+
+  cs_lnum_t           n_cells;       /* Number of rows */
+  cs_lnum_t          *cell_idx;      /* Row index (size: n_cells + 1) */
+  cs_lnum_t          *cell_ids;      /* Neighbor cell ids */
+  cs_real_3_t        *w;             /* Weights */
+  char               *b_cell_flag;   /* 1 for boundary cells, 0 otherwise */
+
+} cs_gradient_lsq_stencil_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -143,6 +167,15 @@ const char *cs_gradient_type_name[]
 
 static int _gradient_stat_id = -1;
 
+/* Precomputed least-squares stencils (standard and extended) */
+
+static bool _lsq_precompute = false;
+static cs_gradient_lsq_stencil_t  *_lsq_stencil[2] = {NULL, NULL};
+
+/* Memory arena for work arrays */
+
+static bft_mem_arena_t  *_gradient_arena = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -181,6 +214,22 @@ _thread_range(cs_lnum_t   n,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Return memory arena used for gradient work arrays.
+ *
+ * returns:
+ *   pointer to memory arena
+ *----------------------------------------------------------------------------*/
+
+static inline bft_mem_arena_t *
+_get_arena(void)
+{
+  if (_gradient_arena == NULL)
+    _gradient_arena = bft_mem_arena_get("gradients");
+
+  return _gradient_arena;
+}
+
 /*----------------------------------------------------------------------------
  * Factorize dense p*p symmetric matrices.
  * Only the lower triangular part is stored and the factorization is performed
@@ -2384,6 +2433,329 @@ _iterative_scalar_gradient_old(const cs_mesh_t             *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy a least-squares gradient stencil.
+ *
+ * parameters:
+ *   stencil <-> pointer to stencil pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_stencil_destroy(cs_gradient_lsq_stencil_t  **stencil)
+{
+  cs_gradient_lsq_stencil_t *s = *stencil;
+
+  if (s == NULL)
+    return;
+
+  BFT_FREE(s->cell_idx);
+  BFT_FREE(s->cell_ids);
+  BFT_FREE(s->w);
+  BFT_FREE(s->b_cell_flag);
+
+  BFT_FREE(*stencil);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a least-squares gradient stencil.
+ *
+ * parameters:
+ *   m         <-- pointer to associated mesh structure
+ *   fvq       <-- pointer to associated finite volume quantities
+ *   halo_type <-- halo type (extended or not)
+ *
+ * returns:
+ *   pointer to new stencil
+ *----------------------------------------------------------------------------*/
+
+static cs_gradient_lsq_stencil_t *
+_lsq_stencil_create(const cs_mesh_t              *m,
+                    const cs_mesh_quantities_t   *fvq,
+                    cs_halo_type_t                halo_type)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_33_t *restrict cocg
+    = (const cs_real_33_t *restrict)fvq->cocg_lsq;
+
+  const bool use_ext = (   halo_type == CS_HALO_EXTENDED
+                        && cell_cells_idx != NULL);
+
+  cs_lnum_t *count;
+  cs_gradient_lsq_stencil_t *s;
+
+  BFT_MALLOC(s, 1, cs_gradient_lsq_stencil_t);
+
+  s->fvq_count = cs_mesh_quantities_compute_count();
+  s->cocg = (const cs_real_t *)fvq->cocg_lsq;
+  s->n_cells = n_cells;
+
+  BFT_MALLOC(s->cell_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells + 1; i++)
+    s->cell_idx[i] = 0;
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+    if (ii < n_cells)
+      s->cell_idx[ii + 1] += 1;
+    if (jj < n_cells)
+      s->cell_idx[jj + 1] += 1;
+  }
+
+  if (use_ext) {
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+      s->cell_idx[ii + 1] += cell_cells_idx[ii+1] - cell_cells_idx[ii];
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    s->cell_idx[ii + 1] += s->cell_idx[ii];
+    count[ii] = s->cell_idx[ii];
+  }
+
+  BFT_MALLOC(s->cell_ids, s->cell_idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(s->w, s->cell_idx[n_cells], cs_real_3_t);
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+    if (ii < n_cells)
+      s->cell_ids[count[ii]++] = jj;
+    if (jj < n_cells)
+      s->cell_ids[count[jj]++] = ii;
+  }
+
+  if (use_ext) {
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++)
+        s->cell_ids[count[ii]++] = cell_cells_lst[cidx];
+    }
+  }
+
+  BFT_FREE(count);
+
+  /* Flag boundary cells */
+
+  BFT_MALLOC(s->b_cell_flag, n_cells, char);
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+    s->b_cell_flag[ii] = 0;
+
+  for (cs_lnum_t i = 0; i < m->n_b_cells; i++)
+    s->b_cell_flag[m->b_cells[i]] = 1;
+
+  /* Compute weights */
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+    for (cs_lnum_t e_id = s->cell_idx[ii]; e_id < s->cell_idx[ii+1]; e_id++) {
+
+      cs_lnum_t jj = s->cell_ids[e_id];
+
+      cs_real_3_t dc;
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+      cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      if (s->b_cell_flag[ii]) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          s->w[e_id][ll] = dc[ll]*ddc;
+      }
+      else {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          s->w[e_id][ll] = (  cocg[ii][ll][0]*dc[0]
+                            + cocg[ii][ll][1]*dc[1]
+                            + cocg[ii][ll][2]*dc[2]) * ddc;
+      }
+
+    }
+
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Return precomputed least-squares gradient stencil, building or
+ * rebuilding it if needed.
+ *
+ * parameters:
+ *   m         <-- pointer to associated mesh structure
+ *   fvq       <-- pointer to associated finite volume quantities
+ *   halo_type <-- halo type (extended or not)
+ *
+ * returns:
+ *   pointer to stencil, or NULL if stencils are not precomputed
+ *----------------------------------------------------------------------------*/
+
+static const cs_gradient_lsq_stencil_t *
+_get_lsq_stencil(const cs_mesh_t              *m,
+                 const cs_mesh_quantities_t   *fvq,
+                 cs_halo_type_t                halo_type)
+{
+  if (_lsq_precompute == false || fvq->cocg_lsq == NULL)
+    return NULL;
+
+  int h_id = (halo_type == CS_HALO_EXTENDED) ? 1 : 0;
+
+  cs_gradient_lsq_stencil_t *s = _lsq_stencil[h_id];
+
+  if (s != NULL) {
+    if (   s->fvq_count != cs_mesh_quantities_compute_count()
+        || s->cocg != (const cs_real_t *)fvq->cocg_lsq
+        || s->n_cells != m->n_cells)
+      _lsq_stencil_destroy(&(_lsq_stencil[h_id]));
+  }
+
+  if (_lsq_stencil[h_id] == NULL)
+    _lsq_stencil[h_id] = _lsq_stencil_create(m, fvq, halo_type);
+
+  return _lsq_stencil[h_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Apply least-squares gradient stencil to a scalar.
+ *
+ * The gradient is computed directly for cells not adjacent to the
+ * boundary; for boundary cells, the interior contribution to the
+ * right-hand side is computed instead.
+ *
+ * parameters:
+ *   s     <-- pointer to stencil
+ *   pvar  <-- variable (with synchronized halo)
+ *   grad  --> gradient of pvar (for cells not adjacent to the boundary)
+ *   rhsv  <-> right-hand side (updated for boundary cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_stencil_scalar(const cs_gradient_lsq_stencil_t  *s,
+                    const cs_real_t                  *restrict pvar,
+                    cs_real_3_t                      *restrict grad,
+                    cs_real_4_t                      *restrict rhsv)
+{
+  const cs_lnum_t *restrict cell_idx = s->cell_idx;
+  const cs_lnum_t *restrict cell_ids = s->cell_ids;
+  const cs_real_3_t *restrict w = (const cs_real_3_t *restrict)s->w;
+
+# pragma omp parallel if (s->n_cells > CS_THR_MIN)
+  {
+    cs_timer_stats_thread_start(_gradient_stat_id);
+
+#   pragma omp for nowait
+    for (cs_lnum_t ii = 0; ii < s->n_cells; ii++) {
+
+      cs_real_t g[3] = {0., 0., 0.};
+      const cs_real_t p_i = pvar[ii];
+
+      for (cs_lnum_t e_id = cell_idx[ii]; e_id < cell_idx[ii+1]; e_id++) {
+        cs_real_t dp = pvar[cell_ids[e_id]] - p_i;
+        g[0] += w[e_id][0] * dp;
+        g[1] += w[e_id][1] * dp;
+        g[2] += w[e_id][2] * dp;
+      }
+
+      if (s->b_cell_flag[ii]) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhsv[ii][ll] += g[ll];
+      }
+      else {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          grad[ii][ll] = g[ll];
+      }
+
+    }
+
+    cs_timer_stats_thread_stop(_gradient_stat_id);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Apply least-squares gradient stencil to a vector or tensor.
+ *
+ * The gradient is computed directly for cells not adjacent to the
+ * boundary; for boundary cells, the interior contribution to the
+ * right-hand side is computed instead.
+ *
+ * parameters:
+ *   s      <-- pointer to stencil
+ *   stride <-- number of variable components (3 or 6)
+ *   pvar   <-- variable (with synchronized halo)
+ *   grad   --> gradient of pvar (for cells not adjacent to the boundary)
+ *   rhs    <-> right-hand side (updated for boundary cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_stencil_strided(const cs_gradient_lsq_stencil_t  *s,
+                     int                               stride,
+                     const cs_real_t                  *restrict pvar,
+                     cs_real_t                        *restrict grad,
+                     cs_real_t                        *restrict rhs)
+{
+  const cs_lnum_t *restrict cell_idx = s->cell_idx;
+  const cs_lnum_t *restrict cell_ids = s->cell_ids;
+  const cs_real_3_t *restrict w = (const cs_real_3_t *restrict)s->w;
+
+# pragma omp parallel if (s->n_cells > CS_THR_MIN)
+  {
+    cs_timer_stats_thread_start(_gradient_stat_id);
+
+#   pragma omp for nowait
+    for (cs_lnum_t ii = 0; ii < s->n_cells; ii++) {
+
+      cs_real_t g[6][3];
+      const cs_real_t *p_i = pvar + ii*stride;
+
+      for (int kk = 0; kk < stride; kk++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          g[kk][ll] = 0.;
+      }
+
+      for (cs_lnum_t e_id = cell_idx[ii]; e_id < cell_idx[ii+1]; e_id++) {
+        const cs_real_t *p_j = pvar + cell_ids[e_id]*stride;
+        for (int kk = 0; kk < stride; kk++) {
+          cs_real_t dp = p_j[kk] - p_i[kk];
+          g[kk][0] += w[e_id][0] * dp;
+          g[kk][1] += w[e_id][1] * dp;
+          g[kk][2] += w[e_id][2] * dp;
+        }
+      }
+
+      if (s->b_cell_flag[ii]) {
+        cs_real_t *_rhs = rhs + ii*stride*3;
+        for (int kk = 0; kk < stride; kk++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            _rhs[kk*3 + ll] += g[kk][ll];
+        }
+      }
+      else {
+        cs_real_t *_grad = grad + ii*stride*3;
+        for (int kk = 0; kk < stride; kk++) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            _grad[kk*3 + ll] = g[kk][ll];
+        }
+      }
+
+    }
+
+    cs_timer_stats_thread_stop(_gradient_stat_id);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1).
@@ -2514,6 +2886,13 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   bool  *coupled_faces = (cpl == NULL) ?
     NULL : (bool *)cpl->coupled_faces;
 
+  /* Precomputed stencil (only in the standard, unweighted case) */
+
+  const cs_gradient_lsq_stencil_t *stencil = NULL;
+  if (   nswrgp > 1 && cpl == NULL && c_weight == NULL
+      && (hyd_p_flag == 0 || hyd_p_flag == 2))
+    stencil = _get_lsq_stencil(m, fvq, halo_type);
+
   /* Remark:
 
      for 2D calculations, if we extrapolate the pressure gradient,
@@ -2625,12 +3004,28 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   /* Compute Right-Hand Side */
   /*-------------------------*/
 
-# pragma omp parallel for
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
-    rhsv[cell_id][0] = 0.0;
-    rhsv[cell_id][1] = 0.0;
-    rhsv[cell_id][2] = 0.0;
-    rhsv[cell_id][3] = pvar[cell_id];
+  /* With a precomputed stencil, the right-hand side is only
+     needed for boundary cells */
+
+  if (stencil != NULL) {
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+      cs_lnum_t cell_id = m->b_cells[ii];
+      rhsv[cell_id][0] = 0.0;
+      rhsv[cell_id][1] = 0.0;
+      rhsv[cell_id][2] = 0.0;
+      rhsv[cell_id][3] = pvar[cell_id];
+    }
+  }
+
+  else {
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+      rhsv[cell_id][0] = 0.0;
+      rhsv[cell_id][1] = 0.0;
+      rhsv[cell_id][2] = 0.0;
+      rhsv[cell_id][3] = pvar[cell_id];
+    }
   }
 
   /* Standard case, without hydrostatic pressure */
@@ -2638,37 +3033,62 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   if (hyd_p_flag == 0 || hyd_p_flag == 2) {
 
-    /* Contribution from interior faces */
+    if (stencil != NULL)
+      _lsq_stencil_scalar(stencil, pvar, grad, rhsv);
 
-    for (g_id = 0; g_id < n_i_groups; g_id++) {
+    else {
 
-#     pragma omp parallel for private(pfac, dc, fctb)
-      for (t_id = 0; t_id < n_i_threads; t_id++) {
+      /* Contribution from interior faces */
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+      for (g_id = 0; g_id < n_i_groups; g_id++) {
 
-          cs_lnum_t ii = i_face_cells[face_id][0];
-          cs_lnum_t jj = i_face_cells[face_id][1];
+#       pragma omp parallel for private(pfac, dc, fctb)
+        for (t_id = 0; t_id < n_i_threads; t_id++) {
 
-          cs_real_t pond = weight[face_id];
+          cs_timer_stats_thread_start(_gradient_stat_id);
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+               face_id++) {
 
-          if (c_weight != NULL) {
-            if (w_stride == 6) {
-              /* (P_j - P_i)*/
-              cs_real_t p_diff = (rhsv[jj][3] - rhsv[ii][3]);
-
-              _compute_ani_weighting(&c_weight[ii*6],
-                                     &c_weight[jj*6],
-                                     p_diff,
-                                     dc,
-                                     pond,
-                                     &rhsv[ii][0],
-                                     &rhsv[jj][0]);
+            cs_lnum_t ii = i_face_cells[face_id][0];
+            cs_lnum_t jj = i_face_cells[face_id][1];
+
+            cs_real_t pond = weight[face_id];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+            if (c_weight != NULL) {
+              if (w_stride == 6) {
+                /* (P_j - P_i)*/
+                cs_real_t p_diff = (rhsv[jj][3] - rhsv[ii][3]);
+
+                _compute_ani_weighting(&c_weight[ii*6],
+                                       &c_weight[jj*6],
+                                       p_diff,
+                                       dc,
+                                       pond,
+                                       &rhsv[ii][0],
+                                       &rhsv[jj][0]);
+              }
+              else {
+                /* (P_j - P_i) / ||d||^2 */
+                pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+                for (cs_lnum_t ll = 0; ll < 3; ll++)
+                  fctb[ll] = dc[ll] * pfac;
+
+                cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                        + (1. - pond)*c_weight[jj]);
+
+                for (cs_lnum_t ll = 0; ll < 3; ll++)
+                  rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+
+                for (cs_lnum_t ll = 0; ll < 3; ll++)
+                  rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+              }
             }
             else {
               /* (P_j - P_i) / ||d||^2 */
@@ -2678,20 +3098,38 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
               for (cs_lnum_t ll = 0; ll < 3; ll++)
                 fctb[ll] = dc[ll] * pfac;
 
-              cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                      + (1. - pond)*c_weight[jj]);
-
               for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+                rhsv[ii][ll] += fctb[ll];
 
               for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+                rhsv[jj][ll] += fctb[ll];
             }
-          }
-          else {
-            /* (P_j - P_i) / ||d||^2 */
+
+          } /* loop on faces */
+
+          cs_timer_stats_thread_stop(_gradient_stat_id);
+
+        } /* loop on threads */
+
+      } /* loop on thread groups */
+
+      /* Contribution from extended neighborhood */
+
+      if (halo_type == CS_HALO_EXTENDED) {
+
+#       pragma omp parallel for private(dc, fctb, pfac)
+        for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+          for (cs_lnum_t cidx = cell_cells_idx[ii];
+               cidx < cell_cells_idx[ii+1];
+               cidx++) {
+
+            cs_lnum_t jj = cell_cells_lst[cidx];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
             pfac =   (rhsv[jj][3] - rhsv[ii][3])
-              / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
             for (cs_lnum_t ll = 0; ll < 3; ll++)
               fctb[ll] = dc[ll] * pfac;
@@ -2699,33 +3137,161 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
             for (cs_lnum_t ll = 0; ll < 3; ll++)
               rhsv[ii][ll] += fctb[ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
           }
+        }
 
-        } /* loop on faces */
+      } /* End for extended neighborhood */
 
-      } /* loop on threads */
+    }
 
-    } /* loop on thread groups */
+    /* Contribution from coupled faces */
 
-    /* Contribution from extended neighborhood */
+    if (cpl != NULL)
+      cs_internal_coupling_lsq_scalar_gradient
+        (cpl, c_weight, w_stride, rhsv);
 
-    if (halo_type == CS_HALO_EXTENDED) {
+    /* Contribution from boundary faces */
 
-#     pragma omp parallel for private(dc, fctb, pfac)
-      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
-        for (cs_lnum_t cidx = cell_cells_idx[ii];
-             cidx < cell_cells_idx[ii+1];
-             cidx++) {
+    for (g_id = 0; g_id < n_b_groups; g_id++) {
 
-          cs_lnum_t jj = cell_cells_lst[cidx];
+#     pragma omp parallel for private(extrab, \
+                                      unddij, udbfs, umcbdd, pfac, dsij)
+      for (t_id = 0; t_id < n_b_threads; t_id++) {
+
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+
+          if (cpl == NULL || !coupled_faces[face_id]) {
+
+            cs_lnum_t ii = b_face_cells[face_id];
+
+            extrab = pow((1. - isympa[face_id]*extrap*coefbp[face_id]), 2.0);
+            unddij = 1. / b_dist[face_id];
+            udbfs = 1. / b_face_surf[face_id];
+            umcbdd = (1. - coefbp[face_id]) * unddij;
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dsij[ll] =   udbfs * b_face_normal[face_id][ll]
+                       + umcbdd*diipb[face_id][ll];
+
+            pfac =   (coefap[face_id]*inc + (coefbp[face_id] -1.)*rhsv[ii][3])
+                 * unddij * extrab;
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] += dsij[ll] * pfac;
+
+          } /* face without internal coupling */
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+  }
+
+  /* Case with hydrostatic pressure */
+  /*--------------------------------*/
+
+  else {  /* if hyd_p_flag == 1 */
+
+    /* Contribution from interior faces */
+
+    for (g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for private(dc, pfac, fctb)
+      for (t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = i_face_cells[face_id][0];
+          cs_lnum_t jj = i_face_cells[face_id][1];
+
+          cs_real_2_t poro = {
+            i_poro_duq_0[is_porous*face_id],
+            i_poro_duq_1[is_porous*face_id]
+          };
+
+          cs_real_t pond = weight[face_id];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+          pfac =   (  rhsv[jj][3] - rhsv[ii][3]
+                    + (cell_cen[ii][0] - i_face_cog[face_id][0]) * f_ext[ii][0]
+                    + (cell_cen[ii][1] - i_face_cog[face_id][1]) * f_ext[ii][1]
+                    + (cell_cen[ii][2] - i_face_cog[face_id][2]) * f_ext[ii][2]
+                    + poro[0]
+                    - (cell_cen[jj][0] - i_face_cog[face_id][0]) * f_ext[jj][0]
+                    - (cell_cen[jj][1] - i_face_cog[face_id][1]) * f_ext[jj][1]
+                    - (cell_cen[jj][2] - i_face_cog[face_id][2]) * f_ext[jj][2]
+                    - poro[1])
+                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            fctb[ll] = dc[ll] * pfac;
+
+          if (c_weight != NULL) {
+              cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                      + (1. - pond)*c_weight[jj]);
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += c_weight[jj] * denom * fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += c_weight[ii] * denom * fctb[ll];
+          }
+          else { // no cell weightening
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] += fctb[ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[jj][ll] += fctb[ll];
+          }
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+    /* Contribution from extended neighborhood;
+       We assume that the middle of the segment joining cell centers
+       may replace the center of gravity of a fictitious face. */
+
+    if (halo_type == CS_HALO_EXTENDED) {
+
+#     pragma omp parallel for private(dc, fctb, pfac)
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        for (cs_lnum_t cidx = cell_cells_idx[ii];
+             cidx < cell_cells_idx[ii+1];
+             cidx++) {
+
+          cs_lnum_t jj = cell_cells_lst[cidx];
+
+          /* Note: replaced the expressions:
+           *  a) ptmid = 0.5 * (cell_cen[jj] - cell_cen[ii])
+           *  b)   (cell_cen[ii] - ptmid) * f_ext[ii]
+           *  c) - (cell_cen[jj] - ptmid) * f_ext[jj]
+           * with:
+           *  a) dc = cell_cen[jj] - cell_cen[ii]
+           *  b) - 0.5 * dc * f_ext[ii]
+           *  c) - 0.5 * dc * f_ext[jj]
+           */
 
           for (cs_lnum_t ll = 0; ll < 3; ll++)
             dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          pfac =   (  rhsv[jj][3] - rhsv[ii][3]
+                    - 0.5 * dc[0] * f_ext[ii][0]
+                    - 0.5 * dc[1] * f_ext[ii][1]
+                    - 0.5 * dc[2] * f_ext[ii][2]
+                    - 0.5 * dc[0] * f_ext[jj][0]
+                    - 0.5 * dc[1] * f_ext[jj][1]
+                    - 0.5 * dc[2] * f_ext[jj][2])
+                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
           for (cs_lnum_t ll = 0; ll < 3; ll++)
             fctb[ll] = dc[ll] * pfac;
@@ -2738,12 +3304,6 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
     } /* End for extended neighborhood */
 
-    /* Contribution from coupled faces */
-
-    if (cpl != NULL)
-      cs_internal_coupling_lsq_scalar_gradient
-        (cpl, c_weight, w_stride, rhsv);
-
     /* Contribution from boundary faces */
 
     for (g_id = 0; g_id < n_b_groups; g_id++) {
@@ -2752,189 +3312,832 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                                       unddij, udbfs, umcbdd, pfac, dsij)
       for (t_id = 0; t_id < n_b_threads; t_id++) {
 
-        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             face_id++) {
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = b_face_cells[face_id];
+
+          cs_real_t poro = b_poro_duq[is_porous*face_id];
+
+          extrab = pow((1. - isympa[face_id]*extrap*coefbp[face_id]), 2.0);
+          unddij = 1. / b_dist[face_id];
+          udbfs = 1. / b_face_surf[face_id];
+          umcbdd = (1. - coefbp[face_id]) * unddij;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dsij[ll] =   udbfs * b_face_normal[face_id][ll]
+                       + umcbdd*diipb[face_id][ll];
+
+          pfac
+            =   (coefap[face_id]*inc
+              + (  (coefbp[face_id] -1.)
+                 * (  rhsv[ii][3]
+                    + (b_face_cog[face_id][0] - cell_cen[ii][0]) * f_ext[ii][0]
+                    + (b_face_cog[face_id][1] - cell_cen[ii][1]) * f_ext[ii][1]
+                    + (b_face_cog[face_id][2] - cell_cen[ii][2]) * f_ext[ii][2]
+                    + poro)))
+              * unddij * extrab;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii][ll] += dsij[ll] * pfac;
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+  } /* End of test on hydrostatic pressure */
+
+  /* Compute gradient */
+  /*------------------*/
+
+  if (hyd_p_flag == 1) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      grad[cell_id][0] =   cocg[cell_id][0][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][0][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][0][2] *rhsv[cell_id][2]
+                         + f_ext[cell_id][0];
+      grad[cell_id][1] =   cocg[cell_id][1][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][1][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][1][2] *rhsv[cell_id][2]
+                         + f_ext[cell_id][1];
+      grad[cell_id][2] =   cocg[cell_id][2][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][2][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][2][2] *rhsv[cell_id][2]
+                         + f_ext[cell_id][2];
+    }
+
+  }
+  else if (stencil != NULL) {
+
+    /* Gradient was already computed for cells not adjacent to the boundary */
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+      cs_lnum_t cell_id = m->b_cells[ii];
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[cell_id][ll] =   cocg[cell_id][ll][0] *rhsv[cell_id][0]
+                            + cocg[cell_id][ll][1] *rhsv[cell_id][1]
+                            + cocg[cell_id][ll][2] *rhsv[cell_id][2];
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      grad[cell_id][0] =   cocg[cell_id][0][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][0][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][0][2] *rhsv[cell_id][2];
+      grad[cell_id][1] =   cocg[cell_id][1][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][1][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][1][2] *rhsv[cell_id][2];
+      grad[cell_id][2] =   cocg[cell_id][2][0] *rhsv[cell_id][0]
+                         + cocg[cell_id][2][1] *rhsv[cell_id][1]
+                         + cocg[cell_id][2][2] *rhsv[cell_id][2];
+    }
+
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+
+   if (c_weight != NULL) {
+     if (w_stride == 6) {
+       BFT_FREE(_cocgb);
+       BFT_FREE(_cocg);
+     }
+   }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalars together using least-squares
+ * reconstruction for non-orthogonal meshes (nswrgp > 1).
+ *
+ * This is equivalent to calling _lsq_scalar_gradient for each variable
+ * in the standard case (no internal coupling, hydrostatic pressure, or
+ * weighting), but mesh geometry is traversed once for all variables.
+ *
+ * If cocg is recomputed, the values for boundary cells in the mesh
+ * quantities structure match the last variable, as if gradients were
+ * computed in sequence.
+ *
+ * If a precomputed stencil is given, it is used for the interior
+ * contribution (see _lsq_stencil_scalar).
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   madj           <-- pointer to mesh adjacencies structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   stencil        <-- precomputed stencil, or NULL
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   n_vars         <-- number of variables
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   extrap         <-- gradient extrapolation coefficient
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   pvar           <-- interleaved variables (with synchronized halo)
+ *   grad           --> interleaved gradients, without halo
+ *                      (size: n_cells_ext*n_vars)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradients(const cs_mesh_t                  *m,
+                      const cs_mesh_adjacencies_t      *madj,
+                      cs_mesh_quantities_t             *fvq,
+                      const cs_gradient_lsq_stencil_t  *stencil,
+                      cs_halo_type_t                    halo_type,
+                      bool                              recompute_cocg,
+                      int                               n_vars,
+                      cs_real_t                         inc,
+                      cs_real_t                         extrap,
+                      const cs_real_t                  *coefap[],
+                      const cs_real_t                  *coefbp[],
+                      const cs_real_t         *restrict pvar,
+                      cs_real_3_t             *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+  const cs_lnum_t *restrict cell_b_faces_idx
+    = (const cs_lnum_t *restrict)madj->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces
+    = (const cs_lnum_t *restrict)madj->cell_b_faces;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_int_t *isympa = fvq->b_sym_flag;
+
+  cs_real_33_t   *restrict cocgb = fvq->cocgb_s_lsq;
+  cs_real_33_t   *restrict cocg = fvq->cocg_lsq;
+
+  /* Compute Right-Hand Side (stored in grad) */
+  /*------------------------------------------*/
+
+  /* With a precomputed stencil, gradients of cells not adjacent to
+     the boundary are final, and other cells hold the interior part
+     of their right-hand side */
+
+  if (stencil != NULL) {
+
+    const cs_lnum_t *restrict s_cell_idx = stencil->cell_idx;
+    const cs_lnum_t *restrict s_cell_ids = stencil->cell_ids;
+    const cs_real_3_t *restrict s_w = (const cs_real_3_t *restrict)stencil->w;
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+      const cs_real_t *p_i = pvar + ii*n_vars;
+      cs_real_3_t *g_i = grad + ii*n_vars;
+
+      for (int v_id = 0; v_id < n_vars; v_id++) {
+        g_i[v_id][0] = 0.;
+        g_i[v_id][1] = 0.;
+        g_i[v_id][2] = 0.;
+      }
+
+      for (cs_lnum_t e_id = s_cell_idx[ii]; e_id < s_cell_idx[ii+1]; e_id++) {
+        const cs_real_t *p_j = pvar + s_cell_ids[e_id]*n_vars;
+        for (int v_id = 0; v_id < n_vars; v_id++) {
+          cs_real_t dp = p_j[v_id] - p_i[v_id];
+          g_i[v_id][0] += s_w[e_id][0] * dp;
+          g_i[v_id][1] += s_w[e_id][1] * dp;
+          g_i[v_id][2] += s_w[e_id][2] * dp;
+        }
+      }
+
+    }
+
+  }
+
+  else {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells_ext*n_vars; ii++) {
+      grad[ii][0] = 0.;
+      grad[ii][1] = 0.;
+      grad[ii][2] = 0.;
+    }
+
+    /* Contribution from interior faces */
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = i_face_cells[face_id][0];
+          cs_lnum_t jj = i_face_cells[face_id][1];
+
+          cs_real_3_t dc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+          cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          const cs_real_t *p_i = pvar + ii*n_vars;
+          const cs_real_t *p_j = pvar + jj*n_vars;
+          cs_real_3_t *rhs_i = grad + ii*n_vars;
+          cs_real_3_t *rhs_j = grad + jj*n_vars;
+
+          for (int v_id = 0; v_id < n_vars; v_id++) {
+            cs_real_t pfac = (p_j[v_id] - p_i[v_id]) * ddc;
+            for (cs_lnum_t ll = 0; ll < 3; ll++) {
+              rhs_i[v_id][ll] += dc[ll] * pfac;
+              rhs_j[v_id][ll] += dc[ll] * pfac;
+            }
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+    /* Contribution from extended neighborhood */
+
+    if (halo_type == CS_HALO_EXTENDED) {
+
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+        for (cs_lnum_t cidx = cell_cells_idx[ii];
+             cidx < cell_cells_idx[ii+1];
+             cidx++) {
+
+          cs_lnum_t jj = cell_cells_lst[cidx];
+
+          cs_real_3_t dc;
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+          cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+          for (int v_id = 0; v_id < n_vars; v_id++) {
+            cs_real_t pfac = (pvar[jj*n_vars + v_id] - pvar[ii*n_vars + v_id])
+                             * ddc;
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              grad[ii*n_vars + v_id][ll] += dc[ll] * pfac;
+          }
+
+        }
+      }
+
+    } /* End for extended neighborhood */
+
+  }
+
+  /* Compute gradient on boundary cells, accounting for boundary faces
+     (and recomputing cocg if required) */
+  /*------------------------------------------------------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t b_c_id = 0; b_c_id < m->n_b_cells; b_c_id++) {
+
+    cs_lnum_t ii = m->b_cells[b_c_id];
+    cs_lnum_t s_id = cell_b_faces_idx[ii];
+    cs_lnum_t e_id = cell_b_faces_idx[ii+1];
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+
+      const cs_real_t *restrict _coefap = coefap[v_id];
+      const cs_real_t *restrict _coefbp = coefbp[v_id];
+      const cs_real_t p_i = pvar[ii*n_vars + v_id];
+
+      cs_real_t *rhs = grad[ii*n_vars + v_id];
+      cs_real_t _cocg[3][3];
+
+      if (recompute_cocg) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            _cocg[ll][mm] = cocgb[b_c_id][ll][mm];
+        }
+      }
+      else {
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          for (cs_lnum_t mm = 0; mm < 3; mm++)
+            _cocg[ll][mm] = cocg[ii][ll][mm];
+        }
+      }
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+        cs_lnum_t face_id = cell_b_faces[i];
+        cs_real_3_t dsij;
+
+        if (recompute_cocg) {
+
+          cs_real_t extrab = 1. - isympa[face_id]*extrap*_coefbp[face_id];
+          cs_real_t umcbdd =   extrab * (1. - _coefbp[face_id])
+                             / b_dist[face_id];
+          cs_real_t udbfs = extrab / b_face_surf[face_id];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            dsij[ll] =   udbfs * b_face_normal[face_id][ll]
+                       + umcbdd * diipb[face_id][ll];
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              _cocg[ll][mm] += dsij[ll]*dsij[mm];
+          }
+
+        }
+
+        cs_real_t extrab
+          = pow((1. - isympa[face_id]*extrap*_coefbp[face_id]), 2.0);
+        cs_real_t unddij = 1. / b_dist[face_id];
+        cs_real_t udbfs = 1. / b_face_surf[face_id];
+        cs_real_t umcbdd = (1. - _coefbp[face_id]) * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dsij[ll] =   udbfs * b_face_normal[face_id][ll]
+                     + umcbdd*diipb[face_id][ll];
+
+        cs_real_t pfac =   (_coefap[face_id]*inc + (_coefbp[face_id] -1.)*p_i)
+                         * unddij * extrab;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs[ll] += dsij[ll] * pfac;
+
+      }
+
+      if (recompute_cocg) {
+        cs_math_33_inv_cramer_sym_in_place(_cocg);
+        if (v_id == n_vars - 1) {
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            for (cs_lnum_t mm = 0; mm < 3; mm++)
+              cocg[ii][ll][mm] = _cocg[ll][mm];
+          }
+        }
+      }
+
+      cs_real_t _rhs[3] = {rhs[0], rhs[1], rhs[2]};
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] =   _cocg[ll][0] * _rhs[0]
+                  + _cocg[ll][1] * _rhs[1]
+                  + _cocg[ll][2] * _rhs[2];
+
+    }
+
+  }
+
+  /* Compute gradient on other cells */
+  /*---------------------------------*/
+
+  if (stencil != NULL)
+    return;
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+    if (cell_b_faces_idx[ii+1] > cell_b_faces_idx[ii])
+      continue;
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+
+      cs_real_t *rhs = grad[ii*n_vars + v_id];
+      cs_real_t _rhs[3] = {rhs[0], rhs[1], rhs[2]};
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] =   cocg[ii][ll][0] * _rhs[0]
+                  + cocg[ii][ll][1] * _rhs[1]
+                  + cocg[ii][ll][2] * _rhs[2];
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute non-reconstructed cell gradients of multiple scalars together.
+ *
+ * This is equivalent to calling _initialize_scalar_gradient for each
+ * variable in the standard case (no internal coupling, hydrostatic
+ * pressure, or weighting), but mesh geometry is traversed once for all
+ * variables.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   n_vars         <-- number of variables
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   pvar           <-- interleaved variables (with synchronized halo)
+ *   grad           --> interleaved gradients, with synchronized
+ *                      extended halo (size: n_cells_ext*n_vars)
+ *----------------------------------------------------------------------------*/
+
+static void
+_initialize_scalar_gradients(const cs_mesh_t               *m,
+                             cs_mesh_quantities_t          *fvq,
+                             int                            n_vars,
+                             cs_real_t                      inc,
+                             const cs_real_t               *coefap[],
+                             const cs_real_t               *coefbp[],
+                             const cs_real_t      *restrict pvar,
+                             cs_real_3_t          *restrict grad)
+{
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_int_t *restrict c_solid_flag = fvq->c_solid_flag;
+  int is_p = CS_MIN(cs_glob_porous_model, 1); /* is porous? */
+
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
+    cell_f_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict i_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
+  const cs_real_3_t *restrict b_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
+
+  /* Initialize gradient */
+  /*---------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells_ext*n_vars; ii++) {
+    for (int j = 0; j < 3; j++)
+      grad[ii][j] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t ktpond = weight[face_id];
+
+        const cs_real_t *p_i = pvar + ii*n_vars;
+        const cs_real_t *p_j = pvar + jj*n_vars;
+        cs_real_3_t *g_i = grad + ii*n_vars;
+        cs_real_3_t *g_j = grad + jj*n_vars;
+
+        for (int v_id = 0; v_id < n_vars; v_id++) {
+          cs_real_t pfaci = (1.0-ktpond) * (p_j[v_id] - p_i[v_id]);
+          cs_real_t pfacj = - ktpond * (p_j[v_id] - p_i[v_id]);
+          for (int j = 0; j < 3; j++) {
+            g_i[v_id][j] += pfaci * i_f_face_normal[face_id][j];
+            g_j[v_id][j] -= pfacj * i_f_face_normal[face_id][j];
+          }
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from boundary faces */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        for (int v_id = 0; v_id < n_vars; v_id++) {
+          cs_real_t pfac =   inc*coefap[v_id][face_id]
+                           + (coefbp[v_id][face_id]-1.0)*pvar[ii*n_vars + v_id];
+          for (int j = 0; j < 3; j++)
+            grad[ii*n_vars + v_id][j] += pfac * b_f_face_normal[face_id][j];
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    cs_real_t dvol;
+    /* Is the cell fully solid? */
+    if (c_solid_flag[is_p * cell_id] == 0)
+      dvol = 1. / cell_f_vol[cell_id];
+    else
+      dvol = 0.;
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      for (int j = 0; j < 3; j++)
+        grad[cell_id*n_vars + v_id][j] *= dvol;
+    }
+  }
+
+  /* Synchronize halos */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var_strided(m->halo, CS_HALO_EXTENDED,
+                             (cs_real_t *)grad, 3*n_vars);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute L2 norms of multiple interleaved cell vectors.
+ *
+ * parameters:
+ *   n_cells  <-- number of cells
+ *   n_vars   <-- number of variables
+ *   x        <-- interleaved vectors (size: n_cells*n_vars)
+ *   l2_norm  --> L2 norm for each variable
+ *----------------------------------------------------------------------------*/
+
+static void
+_l2_norms_interleaved(cs_lnum_t                     n_cells,
+                      int                           n_vars,
+                      const cs_real_3_t   *restrict x,
+                      cs_real_t                     l2_norm[])
+{
+  for (int v_id = 0; v_id < n_vars; v_id++)
+    l2_norm[v_id] = 0.;
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      const cs_real_t *_x = x[ii*n_vars + v_id];
+      l2_norm[v_id] += _x[0]*_x[0] + _x[1]*_x[1] + _x[2]*_x[2];
+    }
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+    cs_real_t *_s;
+    BFT_MALLOC(_s, n_vars, cs_real_t);
+    MPI_Allreduce(l2_norm, _s, n_vars, CS_MPI_REAL, MPI_SUM,
+                  cs_glob_mpi_comm);
+    for (int v_id = 0; v_id < n_vars; v_id++)
+      l2_norm[v_id] = _s[v_id];
+    BFT_FREE(_s);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  for (int v_id = 0; v_id < n_vars; v_id++)
+    l2_norm[v_id] = sqrt(l2_norm[v_id]);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalars together using iterative
+ * reconstruction for non-orthogonal meshes (nswrgp > 1).
+ *
+ * This is equivalent to calling _iterative_scalar_gradient for each
+ * variable in the standard case (no internal coupling, hydrostatic
+ * pressure, or weighting). Each sweep traverses mesh geometry and
+ * exchanges halos once for all variables not yet converged, and
+ * convergence norms of all variables are reduced together.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   var_name       <-- name for the group of variables
+ *   nswrgp         <-- number of sweeps for gradient reconstruction
+ *   verbosity      <-- verbosity level
+ *   n_vars         <-- number of variables
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   epsrgp         <-- relative precision for gradient reconstruction
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      per variable
+ *   pvar           <-- interleaved variables (with synchronized halo)
+ *   grad           <-> interleaved gradients (with synchronized halo)
+ *----------------------------------------------------------------------------*/
+
+static void
+_iterative_scalar_gradients(const cs_mesh_t               *m,
+                            cs_mesh_quantities_t          *fvq,
+                            const char                    *var_name,
+                            int                            nswrgp,
+                            int                            verbosity,
+                            int                            n_vars,
+                            cs_real_t                      inc,
+                            cs_real_t                      epsrgp,
+                            const cs_real_t               *coefap[],
+                            const cs_real_t               *coefbp[],
+                            const cs_real_t      *restrict pvar,
+                            cs_real_3_t          *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  const cs_int_t *restrict c_solid_flag = fvq->c_solid_flag;
+  int is_p = CS_MIN(cs_glob_porous_model, 1); /* is porous? */
+
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
+    cell_f_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict i_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
+  const cs_real_3_t *restrict b_f_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *restrict)fvq->dofij;
+
+  const cs_real_33_t *restrict cocg
+    = (const cs_real_33_t *restrict)fvq->cocg_it;
 
-          if (cpl == NULL || !coupled_faces[face_id]) {
+  if (nswrgp < 1) return;
 
-            cs_lnum_t ii = b_face_cells[face_id];
+  /* Compute normalization residuals; variables with a zero
+     non-reconstructed gradient are not iterated upon */
 
-            extrab = pow((1. - isympa[face_id]*extrap*coefbp[face_id]), 2.0);
-            unddij = 1. / b_dist[face_id];
-            udbfs = 1. / b_face_surf[face_id];
-            umcbdd = (1. - coefbp[face_id]) * unddij;
+  int n_active = 0;
+  bool *active;
+  cs_real_t *rnorm, *l2_residual;
+  cs_real_3_t *rhs;
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              dsij[ll] =   udbfs * b_face_normal[face_id][ll]
-                       + umcbdd*diipb[face_id][ll];
+  BFT_MALLOC(active, n_vars, bool);
+  BFT_MALLOC(rnorm, n_vars*2, cs_real_t);
+  l2_residual = rnorm + n_vars;
 
-            pfac =   (coefap[face_id]*inc + (coefbp[face_id] -1.)*rhsv[ii][3])
-                 * unddij * extrab;
+  _l2_norms_interleaved(n_cells, n_vars, (const cs_real_3_t *)grad, rnorm);
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += dsij[ll] * pfac;
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    l2_residual[v_id] = 0.;
+    active[v_id] = (rnorm[v_id] > cs_math_epzero) ? true : false;
+    if (active[v_id])
+      n_active++;
+  }
 
-          } /* face without internal coupling */
+  if (n_active == 0) {
+    BFT_FREE(rnorm);
+    BFT_FREE(active);
+    return;
+  }
 
-        } /* loop on faces */
+  BFT_MALLOC(rhs, n_cells_ext*n_vars, cs_real_3_t);
 
-      } /* loop on threads */
+  /* Start iterations */
+  /*------------------*/
 
-    } /* loop on thread groups */
+  int n_sweeps = 0;
 
-  }
+  for (n_sweeps = 1; n_sweeps < nswrgp && n_active > 0; n_sweeps++) {
 
-  /* Case with hydrostatic pressure */
-  /*--------------------------------*/
+    /* Compute right hand side */
 
-  else {  /* if hyd_p_flag == 1 */
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+      for (int v_id = 0; v_id < n_vars; v_id++) {
+        cs_lnum_t k = cell_id*n_vars + v_id;
+        rhs[k][0] = -grad[k][0] * cell_f_vol[cell_id];
+        rhs[k][1] = -grad[k][1] * cell_f_vol[cell_id];
+        rhs[k][2] = -grad[k][2] * cell_f_vol[cell_id];
+      }
+    }
 
     /* Contribution from interior faces */
 
-    for (g_id = 0; g_id < n_i_groups; g_id++) {
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-#     pragma omp parallel for private(dc, pfac, fctb)
-      for (t_id = 0; t_id < n_i_threads; t_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
         for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
              face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
              face_id++) {
 
-          cs_lnum_t ii = i_face_cells[face_id][0];
-          cs_lnum_t jj = i_face_cells[face_id][1];
+          cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+          cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
-          cs_real_2_t poro = {
-            i_poro_duq_0[is_porous*face_id],
-            i_poro_duq_1[is_porous*face_id]
-          };
+          cs_real_t ktpond = weight[face_id];
 
-          cs_real_t pond = weight[face_id];
+          for (int v_id = 0; v_id < n_vars; v_id++) {
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+            if (active[v_id] == false)
+              continue;
 
-          pfac =   (  rhsv[jj][3] - rhsv[ii][3]
-                    + (cell_cen[ii][0] - i_face_cog[face_id][0]) * f_ext[ii][0]
-                    + (cell_cen[ii][1] - i_face_cog[face_id][1]) * f_ext[ii][1]
-                    + (cell_cen[ii][2] - i_face_cog[face_id][2]) * f_ext[ii][2]
-                    + poro[0]
-                    - (cell_cen[jj][0] - i_face_cog[face_id][0]) * f_ext[jj][0]
-                    - (cell_cen[jj][1] - i_face_cog[face_id][1]) * f_ext[jj][1]
-                    - (cell_cen[jj][2] - i_face_cog[face_id][2]) * f_ext[jj][2]
-                    - poro[1])
-                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+            cs_lnum_t k1 = cell_id1*n_vars + v_id;
+            cs_lnum_t k2 = cell_id2*n_vars + v_id;
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+            /* Reconstruction part */
+            cs_real_t pfaci = 0.5 *
+                     (dofij[face_id][0]*(grad[k1][0]+grad[k2][0])
+                     +dofij[face_id][1]*(grad[k1][1]+grad[k2][1])
+                     +dofij[face_id][2]*(grad[k1][2]+grad[k2][2]));
+            cs_real_t pfacj = pfaci;
 
-          if (c_weight != NULL) {
-              cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                      + (1. - pond)*c_weight[jj]);
+            pfaci += (1.0-ktpond) * (pvar[k2] - pvar[k1]);
+            pfacj -=      ktpond  * (pvar[k2] - pvar[k1]);
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[ii][ll] += c_weight[jj] * denom * fctb[ll];
+            for (int j = 0; j < 3; j++) {
+              rhs[k1][j] += pfaci * i_f_face_normal[face_id][j];
+              rhs[k2][j] -= pfacj * i_f_face_normal[face_id][j];
+            }
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[jj][ll] += c_weight[ii] * denom * fctb[ll];
           }
-          else { // no cell weightening
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[ii][ll] += fctb[ll];
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              rhsv[jj][ll] += fctb[ll];
-          }
         } /* loop on faces */
 
       } /* loop on threads */
 
     } /* loop on thread groups */
 
-    /* Contribution from extended neighborhood;
-       We assume that the middle of the segment joining cell centers
-       may replace the center of gravity of a fictitious face. */
-
-    if (halo_type == CS_HALO_EXTENDED) {
-
-#     pragma omp parallel for private(dc, fctb, pfac)
-      for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
-        for (cs_lnum_t cidx = cell_cells_idx[ii];
-             cidx < cell_cells_idx[ii+1];
-             cidx++) {
-
-          cs_lnum_t jj = cell_cells_lst[cidx];
-
-          /* Note: replaced the expressions:
-           *  a) ptmid = 0.5 * (cell_cen[jj] - cell_cen[ii])
-           *  b)   (cell_cen[ii] - ptmid) * f_ext[ii]
-           *  c) - (cell_cen[jj] - ptmid) * f_ext[jj]
-           * with:
-           *  a) dc = cell_cen[jj] - cell_cen[ii]
-           *  b) - 0.5 * dc * f_ext[ii]
-           *  c) - 0.5 * dc * f_ext[jj]
-           */
-
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
-
-          pfac =   (  rhsv[jj][3] - rhsv[ii][3]
-                    - 0.5 * dc[0] * f_ext[ii][0]
-                    - 0.5 * dc[1] * f_ext[ii][1]
-                    - 0.5 * dc[2] * f_ext[ii][2]
-                    - 0.5 * dc[0] * f_ext[jj][0]
-                    - 0.5 * dc[1] * f_ext[jj][1]
-                    - 0.5 * dc[2] * f_ext[jj][2])
-                  / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
-
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
-
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += fctb[ll];
-
-        }
-      }
-
-    } /* End for extended neighborhood */
-
     /* Contribution from boundary faces */
 
-    for (g_id = 0; g_id < n_b_groups; g_id++) {
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-#     pragma omp parallel for private(extrab, \
-                                      unddij, udbfs, umcbdd, pfac, dsij)
-      for (t_id = 0; t_id < n_b_threads; t_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
         for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
              face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
              face_id++) {
 
-          cs_lnum_t ii = b_face_cells[face_id];
+          cs_lnum_t cell_id = b_face_cells[face_id];
 
-          cs_real_t poro = b_poro_duq[is_porous*face_id];
+          for (int v_id = 0; v_id < n_vars; v_id++) {
 
-          extrab = pow((1. - isympa[face_id]*extrap*coefbp[face_id]), 2.0);
-          unddij = 1. / b_dist[face_id];
-          udbfs = 1. / b_face_surf[face_id];
-          umcbdd = (1. - coefbp[face_id]) * unddij;
+            if (active[v_id] == false)
+              continue;
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            dsij[ll] =   udbfs * b_face_normal[face_id][ll]
-                       + umcbdd*diipb[face_id][ll];
+            cs_lnum_t k = cell_id*n_vars + v_id;
 
-          pfac
-            =   (coefap[face_id]*inc
-              + (  (coefbp[face_id] -1.)
-                 * (  rhsv[ii][3]
-                    + (b_face_cog[face_id][0] - cell_cen[ii][0]) * f_ext[ii][0]
-                    + (b_face_cog[face_id][1] - cell_cen[ii][1]) * f_ext[ii][1]
-                    + (b_face_cog[face_id][2] - cell_cen[ii][2]) * f_ext[ii][2]
-                    + poro)))
-              * unddij * extrab;
+            /* Reconstruction part */
+            cs_real_t
+            pfac = coefap[v_id][face_id] * inc
+                 + coefbp[v_id][face_id]
+                   * (  diipb[face_id][0] * grad[k][0]
+                      + diipb[face_id][1] * grad[k][1]
+                      + diipb[face_id][2] * grad[k][2]);
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += dsij[ll] * pfac;
+            pfac += (coefbp[v_id][face_id] -1.0) * pvar[k];
+
+            rhs[k][0] += pfac * b_f_face_normal[face_id][0];
+            rhs[k][1] += pfac * b_f_face_normal[face_id][1];
+            rhs[k][2] += pfac * b_f_face_normal[face_id][2];
+
+          }
 
         } /* loop on faces */
 
@@ -2942,57 +4145,82 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
     } /* loop on thread groups */
 
-  } /* End of test on hydrostatic pressure */
-
-  /* Compute gradient */
-  /*------------------*/
-
-  if (hyd_p_flag == 1) {
+    /* Increment gradient */
+    /*--------------------*/
 
 #   pragma omp parallel for
     for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      grad[cell_id][0] =   cocg[cell_id][0][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][0][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][0][2] *rhsv[cell_id][2]
-                         + f_ext[cell_id][0];
-      grad[cell_id][1] =   cocg[cell_id][1][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][1][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][1][2] *rhsv[cell_id][2]
-                         + f_ext[cell_id][1];
-      grad[cell_id][2] =   cocg[cell_id][2][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][2][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][2][2] *rhsv[cell_id][2]
-                         + f_ext[cell_id][2];
-    }
+      cs_real_t dvol;
+      /* Is the cell fully solid? */
+      if (c_solid_flag[is_p * cell_id] == 0)
+        dvol = 1. / cell_f_vol[cell_id];
+      else
+        dvol = 0.;
 
-  }
-  else {
+      for (int v_id = 0; v_id < n_vars; v_id++) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      grad[cell_id][0] =   cocg[cell_id][0][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][0][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][0][2] *rhsv[cell_id][2];
-      grad[cell_id][1] =   cocg[cell_id][1][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][1][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][1][2] *rhsv[cell_id][2];
-      grad[cell_id][2] =   cocg[cell_id][2][0] *rhsv[cell_id][0]
-                         + cocg[cell_id][2][1] *rhsv[cell_id][1]
-                         + cocg[cell_id][2][2] *rhsv[cell_id][2];
+        cs_lnum_t k = cell_id*n_vars + v_id;
+
+        rhs[k][0] *= dvol;
+        rhs[k][1] *= dvol;
+        rhs[k][2] *= dvol;
+
+        if (active[v_id] == false)
+          continue;
+
+        grad[k][0] +=   rhs[k][0] * cocg[cell_id][0][0]
+                      + rhs[k][1] * cocg[cell_id][1][0]
+                      + rhs[k][2] * cocg[cell_id][2][0];
+        grad[k][1] +=   rhs[k][0] * cocg[cell_id][0][1]
+                      + rhs[k][1] * cocg[cell_id][1][1]
+                      + rhs[k][2] * cocg[cell_id][2][1];
+        grad[k][2] +=   rhs[k][0] * cocg[cell_id][0][2]
+                      + rhs[k][1] * cocg[cell_id][1][2]
+                      + rhs[k][2] * cocg[cell_id][2][2];
+      }
     }
 
-  }
+    /* Synchronize halos */
 
-  /* Synchronize halos */
+    if (m->halo != NULL)
+      cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)grad, 3*n_vars);
 
-  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+    /* Convergence test */
 
-   if (c_weight != NULL) {
-     if (w_stride == 6) {
-       BFT_FREE(_cocgb);
-       BFT_FREE(_cocg);
-     }
-   }
+    _l2_norms_interleaved(n_cells, n_vars, (const cs_real_3_t *)rhs,
+                          l2_residual);
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      if (active[v_id] && l2_residual[v_id] < epsrgp*rnorm[v_id]) {
+        active[v_id] = false;
+        n_active--;
+        if (verbosity >= 2)
+          bft_printf(_(" %s; variable: %s (%d); converged in %d sweeps\n"
+                       " %*s  normed residual: %11.4e; norm: %11.4e\n"),
+                     __func__, var_name, v_id, n_sweeps,
+                     (int)(strlen(__func__)), " ",
+                     l2_residual[v_id]/rnorm[v_id], rnorm[v_id]);
+      }
+    }
+
+  } /* Loop on sweeps */
+
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    if (   active[v_id] && l2_residual[v_id] >= epsrgp*rnorm[v_id]
+        && verbosity > -1)
+      bft_printf(_(" Warning:\n"
+                   " --------\n"
+                   "   %s; variable: %s (%d); sweeps: %d\n"
+                   "   %*s  normed residual: %11.4e; norm: %11.4e\n"),
+                 __func__, var_name, v_id, n_sweeps,
+                 (int)(strlen(__func__)), " ",
+                 l2_residual[v_id]/rnorm[v_id], rnorm[v_id]);
+  }
+
+  BFT_FREE(rhs);
+  BFT_FREE(rnorm);
+  BFT_FREE(active);
 }
 
 /*----------------------------------------------------------------------------
@@ -4628,7 +5856,16 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
 
   cs_real_33_t *rhs;
 
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_33_t);
+  bft_mem_arena_t *arena = _get_arena();
+  bft_mem_arena_mark_t mark = bft_mem_arena_mark(arena);
+
+  BFT_ARENA_ALLOC(rhs, arena, n_cells_ext, cs_real_33_t);
+
+  /* Precomputed stencil (only in the unweighted case) */
+
+  const cs_gradient_lsq_stencil_t *stencil = NULL;
+  if (cpl == NULL && c_weight == NULL)
+    stencil = _get_lsq_stencil(m, fvq, halo_type);
 
   bool  *coupled_faces = (cpl == NULL) ?
     NULL : (bool *)cpl->coupled_faces;
@@ -4652,88 +5889,99 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
         rhs[cell_id][i][j] = 0.0;
   }
 
-  /* Contribution from interior faces */
+  if (stencil != NULL)
+    _lsq_stencil_strided(stencil,
+                         3,
+                         (const cs_real_t *)pvar,
+                         (cs_real_t *)gradv,
+                         (cs_real_t *)rhs);
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  else {
 
-#   pragma omp parallel for private(cell_id1, cell_id2,\
-                                    i, j, pfac, dc, fctb, ddc)
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    /* Contribution from interior faces */
 
-      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           face_id++) {
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for private(cell_id1, cell_id2,\
+                                      i, j, pfac, dc, fctb, ddc)
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
 
-        cell_id1 = i_face_cells[face_id][0];
-        cell_id2 = i_face_cells[face_id][1];
+          cell_id1 = i_face_cells[face_id][0];
+          cell_id2 = i_face_cells[face_id][1];
 
-        for (i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+          for (i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
 
-        ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[face_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[cell_id1]
-                                  + (1. - pond)*c_weight[cell_id2]);
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[face_id];
+            cs_real_t denom = 1. / (  pond       *c_weight[cell_id1]
+                                    + (1. - pond)*c_weight[cell_id2]);
 
-          for (i = 0; i < 3; i++) {
-            pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+            for (i = 0; i < 3; i++) {
+              pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
 
-            for (j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[cell_id1][i][j] += c_weight[cell_id2] * denom * fctb[j];
-              rhs[cell_id2][i][j] += c_weight[cell_id1] * denom * fctb[j];
+              for (j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[cell_id1][i][j] += c_weight[cell_id2] * denom * fctb[j];
+                rhs[cell_id2][i][j] += c_weight[cell_id1] * denom * fctb[j];
+              }
             }
           }
-        }
-        else {
-          for (i = 0; i < 3; i++) {
-            pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+          else {
+            for (i = 0; i < 3; i++) {
+              pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
 
-            for (j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[cell_id1][i][j] += fctb[j];
-              rhs[cell_id2][i][j] += fctb[j];
+              for (j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[cell_id1][i][j] += fctb[j];
+                rhs[cell_id2][i][j] += fctb[j];
+              }
             }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Contribution from extended neighborhood */
+    /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED) {
+    if (halo_type == CS_HALO_EXTENDED) {
 
-#   pragma omp parallel for private(cell_id2, dc, pfac, ddc, i, j)
-    for (cell_id1 = 0; cell_id1 < n_cells; cell_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[cell_id1];
-           cidx < cell_cells_idx[cell_id1+1];
-           cidx++) {
+#     pragma omp parallel for private(cell_id2, dc, pfac, ddc, i, j)
+      for (cell_id1 = 0; cell_id1 < n_cells; cell_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[cell_id1];
+             cidx < cell_cells_idx[cell_id1+1];
+             cidx++) {
 
-        cell_id2 = cell_cells_lst[cidx];
+          cell_id2 = cell_cells_lst[cidx];
 
-        for (i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+          for (i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
 
-        ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (i = 0; i < 3; i++) {
+          for (i = 0; i < 3; i++) {
 
-          pfac = (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+            pfac = (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
 
-          for (j = 0; j < 3; j++) {
-            rhs[cell_id1][i][j] += dc[j] * pfac;
+            for (j = 0; j < 3; j++) {
+              rhs[cell_id1][i][j] += dc[j] * pfac;
+            }
           }
         }
       }
-    }
 
-  } /* End for extended neighborhood */
+    } /* End for extended neighborhood */
+
+  }
 
   /* Contribution from coupled faces */
 
@@ -4790,17 +6038,24 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
   /* Compute gradient */
   /*------------------*/
 
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-    for (j = 0; j < 3; j++) {
-      for (i = 0; i < 3; i++) {
+  /* Already done for cells not adjacent to the boundary if the
+     stencil is precomputed, and boundary cells are handled below */
+
+  if (stencil == NULL) {
 
-        gradv[cell_id][i][j] = 0.0;
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      for (j = 0; j < 3; j++) {
+        for (i = 0; i < 3; i++) {
 
-        for (k = 0; k < 3; k++)
-          gradv[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
+          gradv[cell_id][i][j] = 0.0;
 
+          for (k = 0; k < 3; k++)
+            gradv[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
+
+        }
       }
     }
+
   }
 
   /* Compute gradient on boundary cells */
@@ -4867,7 +6122,7 @@ _lsq_vector_gradient(const cs_mesh_t              *m,
       cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)gradv);
   }
 
-  BFT_FREE(rhs);
+  bft_mem_arena_release(arena, mark);
 }
 
 /*----------------------------------------------------------------------------
@@ -4927,7 +6182,16 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
 
   cs_real_63_t *rhs;
 
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_63_t);
+  bft_mem_arena_t *arena = _get_arena();
+  bft_mem_arena_mark_t mark = bft_mem_arena_mark(arena);
+
+  BFT_ARENA_ALLOC(rhs, arena, n_cells_ext, cs_real_63_t);
+
+  /* Precomputed stencil (only in the unweighted case) */
+
+  const cs_gradient_lsq_stencil_t *stencil = NULL;
+  if (c_weight == NULL)
+    stencil = _get_lsq_stencil(m, fvq, halo_type);
 
   /* Compute Right-Hand Side */
   /*-------------------------*/
@@ -4939,89 +6203,100 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
         rhs[cell_id][i][j] = 0.0;
   }
 
-  /* Contribution from interior faces */
+  if (stencil != NULL)
+    _lsq_stencil_strided(stencil,
+                         6,
+                         (const cs_real_t *)pvar,
+                         (cs_real_t *)gradt,
+                         (cs_real_t *)rhs);
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  else {
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    /* Contribution from interior faces */
 
-      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           face_id++) {
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-        cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-        cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-        cs_real_3_t dc, fctb;
-        for (int i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+          cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[face_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[cell_id1]
-                                  + (1. - pond)*c_weight[cell_id2]);
+          cs_real_3_t dc, fctb;
+          for (int i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
 
-          for (int i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-            for (int j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[cell_id1][i][j] += c_weight[cell_id2] * denom * fctb[j];
-              rhs[cell_id2][i][j] += c_weight[cell_id1] * denom * fctb[j];
+          if (c_weight != NULL) {
+            cs_real_t pond = weight[face_id];
+            cs_real_t denom = 1. / (  pond       *c_weight[cell_id1]
+                                    + (1. - pond)*c_weight[cell_id2]);
+
+            for (int i = 0; i < 6; i++) {
+              cs_real_t pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+
+              for (int j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[cell_id1][i][j] += c_weight[cell_id2] * denom * fctb[j];
+                rhs[cell_id2][i][j] += c_weight[cell_id1] * denom * fctb[j];
+              }
             }
           }
-        }
-        else {
-          for (int i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+          else {
+            for (int i = 0; i < 6; i++) {
+              cs_real_t pfac =  (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
 
-            for (int j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[cell_id1][i][j] += fctb[j];
-              rhs[cell_id2][i][j] += fctb[j];
+              for (int j = 0; j < 3; j++) {
+                fctb[j] = dc[j] * pfac;
+                rhs[cell_id1][i][j] += fctb[j];
+                rhs[cell_id2][i][j] += fctb[j];
+              }
             }
           }
-        }
 
-      } /* loop on faces */
+        } /* loop on faces */
 
-    } /* loop on threads */
+      } /* loop on threads */
 
-  } /* loop on thread groups */
+    } /* loop on thread groups */
 
-  /* Contribution from extended neighborhood */
+    /* Contribution from extended neighborhood */
 
-  if (halo_type == CS_HALO_EXTENDED) {
+    if (halo_type == CS_HALO_EXTENDED) {
 
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id1 = 0; cell_id1 < n_cells; cell_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[cell_id1];
-           cidx < cell_cells_idx[cell_id1+1];
-           cidx++) {
+#     pragma omp parallel for
+      for (cs_lnum_t cell_id1 = 0; cell_id1 < n_cells; cell_id1++) {
+        for (cs_lnum_t cidx = cell_cells_idx[cell_id1];
+             cidx < cell_cells_idx[cell_id1+1];
+             cidx++) {
 
-        cs_lnum_t cell_id2 = cell_cells_lst[cidx];
+          cs_lnum_t cell_id2 = cell_cells_lst[cidx];
 
-        cs_real_3_t dc;
-        for (int i = 0; i < 3; i++)
-          dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
+          cs_real_3_t dc;
+          for (int i = 0; i < 3; i++)
+            dc[i] = cell_cen[cell_id2][i] - cell_cen[cell_id1][i];
 
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (int i = 0; i < 6; i++) {
+          for (int i = 0; i < 6; i++) {
 
-          cs_real_t pfac = (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
+            cs_real_t pfac = (pvar[cell_id2][i] - pvar[cell_id1][i]) * ddc;
 
-          for (int j = 0; j < 3; j++) {
-            rhs[cell_id1][i][j] += dc[j] * pfac;
+            for (int j = 0; j < 3; j++) {
+              rhs[cell_id1][i][j] += dc[j] * pfac;
+            }
           }
         }
       }
-    }
 
-  } /* End for extended neighborhood */
+    } /* End for extended neighborhood */
+
+  }
 
   /* Contribution from boundary faces */
 
@@ -5066,17 +6341,24 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
   /* Compute gradient */
   /*------------------*/
 
-  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-    for (int j = 0; j < 3; j++) {
-      for (int i = 0; i < 6; i++) {
+  /* Already done for cells not adjacent to the boundary if the
+     stencil is precomputed, and boundary cells are handled below */
+
+  if (stencil == NULL) {
 
-        gradt[cell_id][i][j] = 0.0;
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      for (int j = 0; j < 3; j++) {
+        for (int i = 0; i < 6; i++) {
 
-        for (int k = 0; k < 3; k++)
-          gradt[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
+          gradt[cell_id][i][j] = 0.0;
+
+          for (int k = 0; k < 3; k++)
+            gradt[cell_id][i][j] += rhs[cell_id][i][k] * cocg[cell_id][k][j];
 
+        }
       }
     }
+
   }
 
   /* Compute gradient on boundary cells */
@@ -5143,7 +6425,7 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
       cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)gradt);
   }
 
-  BFT_FREE(rhs);
+  bft_mem_arena_release(arena, mark);
 }
 
 /*----------------------------------------------------------------------------
@@ -6371,7 +7653,10 @@ _gradient_scalar(const char                    *var_name,
 
   /* Allocate work arrays */
 
-  BFT_MALLOC(rhsv, n_cells_ext, cs_real_4_t);
+  bft_mem_arena_t *arena = _get_arena();
+  bft_mem_arena_mark_t mark = bft_mem_arena_mark(arena);
+
+  BFT_ARENA_ALLOC(rhsv, arena, n_cells_ext, cs_real_4_t);
 
   /* Compute gradient */
 
@@ -6466,7 +7751,7 @@ _gradient_scalar(const char                    *var_name,
     const cs_real_t _climin = 1.5;
 
     cs_real_3_t  *restrict r_grad;
-    BFT_MALLOC(r_grad, n_cells_ext, cs_real_3_t);
+    BFT_ARENA_ALLOC(r_grad, arena, n_cells_ext, cs_real_3_t);
 
     _lsq_scalar_gradient(mesh,
                          fvq,
@@ -6513,8 +7798,6 @@ _gradient_scalar(const char                    *var_name,
                                  r_grad,
                                  grad);
 
-    BFT_FREE(r_grad);
-
   }
 
   _scalar_gradient_clipping(halo_type, clip_mode, verbosity, tr_dim, clip_coeff,
@@ -6523,7 +7806,7 @@ _gradient_scalar(const char                    *var_name,
   if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
     cs_bad_cells_regularisation_vector(grad, 0);
 
-  BFT_FREE(rhsv);
+  bft_mem_arena_release(arena, mark);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7197,8 +8480,53 @@ cs_gradient_finalize(void)
 
   BFT_FREE(cs_glob_gradient_systems);
 
+  _gradient_arena = NULL;
+
   cs_glob_gradient_n_systems = 0;
   cs_glob_gradient_n_max_systems = 0;
+
+  for (int h_id = 0; h_id < 2; h_id++)
+    _lsq_stencil_destroy(&(_lsq_stencil[h_id]));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set option for precomputation of least-squares gradient stencils.
+ *
+ * When activated, geometric weights of least-squares gradients (including
+ * the inverse cocg matrix for cells not adjacent to the boundary) are
+ * computed once per mesh and reused, so that the interior contribution
+ * to the gradient of unweighted scalar, vector, or tensor fields is a
+ * simple sparse matrix-vector product. This requires additional memory
+ * (about 4 values per interior face and extended neighbor).
+ *
+ * \param[in]  precompute  true to precompute stencils, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_precompute(bool  precompute)
+{
+  _lsq_precompute = precompute;
+
+  if (precompute == false) {
+    for (int h_id = 0; h_id < 2; h_id++)
+      _lsq_stencil_destroy(&(_lsq_stencil[h_id]));
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Query option for precomputation of least-squares gradient stencils.
+ *
+ * \return  true if stencils are precomputed, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_precompute(void)
+{
+  return _lsq_precompute;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7327,6 +8655,230 @@ cs_gradient_scalar(const char                *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of multiple scalar fields together.
+ *
+ * For iterative and least-squares gradients, values of all variables
+ * are interleaved so that their halos are synchronized with a single
+ * exchange, and mesh geometry is traversed once for all variables
+ * (once per sweep for iterative gradients). Least-squares gradients use
+ * precomputed stencils if enabled (see
+ * \ref cs_gradient_set_lsq_precompute). In other cases, or with
+ * periodicity of rotation, gradients are computed one by one.
+ *
+ * Weighting, hydrostatic pressure, internal coupling and periodicity of
+ * rotation of components are not handled here, so
+ * \ref cs_gradient_scalar should be used for such variables.
+ *
+ * \param[in]       var_name        name for the group of variables
+ *                                  (for logging)
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[in]       n_r_sweeps      if > 1, number of reconstruction sweeps
+ * \param[in]       verbosity       verbosity level
+ * \param[in]       clip_mode       clipping mode
+ * \param[in]       epsilon         precision for iterative gradient calculation
+ * \param[in]       extrap          boundary gradient extrapolation coefficient
+ * \param[in]       clip_coeff      clipping coefficient
+ * \param[in]       n_vars          number of variables
+ * \param[in]       bc_coeff_a      boundary condition term a, per variable
+ * \param[in]       bc_coeff_b      boundary condition term b, per variable
+ * \param[in, out]  var             gradients' base variables
+ * \param[out]      grad            gradients, per variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalars(const char                *var_name,
+                    cs_gradient_type_t         gradient_type,
+                    cs_halo_type_t             halo_type,
+                    int                        inc,
+                    bool                       recompute_cocg,
+                    int                        n_r_sweeps,
+                    int                        verbosity,
+                    int                        clip_mode,
+                    double                     epsilon,
+                    double                     extrap,
+                    double                     clip_coeff,
+                    int                        n_vars,
+                    const cs_real_t           *bc_coeff_a[],
+                    const cs_real_t           *bc_coeff_b[],
+                    cs_real_t                 *var[],
+                    cs_real_3_t               *grad[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  /* Compute gradients one by one if they cannot be grouped */
+
+  bool group = (n_vars > 1 && mesh->have_rotation_perio == 0) ? true : false;
+
+  if (gradient_type == CS_GRADIENT_LSQ) {
+    if (n_r_sweeps > 1 && cs_glob_mesh_adjacencies == NULL)
+      group = false;
+  }
+  else if (gradient_type != CS_GRADIENT_ITER)
+    group = false;
+
+  if (group == false) {
+
+    for (int v_id = 0; v_id < n_vars; v_id++)
+      cs_gradient_scalar(var_name,
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         recompute_cocg,
+                         n_r_sweeps,
+                         0,             /* tr_dim */
+                         0,             /* hyd_p_flag */
+                         1,             /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         extrap,
+                         clip_coeff,
+                         NULL,          /* f_ext */
+                         bc_coeff_a[v_id],
+                         bc_coeff_b[v_id],
+                         var[v_id],
+                         NULL,          /* c_weight */
+                         NULL,          /* cpl */
+                         grad[v_id]);
+
+    return;
+  }
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
+  cs_gradient_info_t *gradient_info = NULL;
+  cs_timer_t t0, t1;
+
+  cs_real_t *pvar;
+  cs_real_3_t *_grad;
+
+  static int last_fvm_count = 0;
+
+  int prev_fvq_count = last_fvm_count;
+  last_fvm_count = cs_mesh_quantities_compute_count();
+  if (last_fvm_count != prev_fvq_count)
+    recompute_cocg = true;
+
+  t0 = cs_timer_time();
+
+  gradient_info = _find_or_add_system(var_name, gradient_type);
+
+  /* Interleave and synchronize variables */
+
+  BFT_MALLOC(pvar, n_cells_ext*n_vars, cs_real_t);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    for (int v_id = 0; v_id < n_vars; v_id++)
+      pvar[ii*n_vars + v_id] = var[v_id][ii];
+  }
+
+  if (mesh->halo != NULL) {
+
+    cs_halo_sync_var_strided(mesh->halo, halo_type, pvar, n_vars);
+
+    /* Update halo of base variables, as for cs_gradient_scalar */
+
+    cs_lnum_t n_ghosts = mesh->halo->n_elts[halo_type];
+
+    for (cs_lnum_t ii = n_cells; ii < n_cells + n_ghosts; ii++) {
+      for (int v_id = 0; v_id < n_vars; v_id++)
+        var[v_id][ii] = pvar[ii*n_vars + v_id];
+    }
+
+  }
+
+  /* Compute gradients */
+
+  BFT_MALLOC(_grad, n_cells_ext*n_vars, cs_real_3_t);
+
+  if (gradient_type == CS_GRADIENT_ITER || n_r_sweeps <= 1) {
+
+    _initialize_scalar_gradients(mesh,
+                                 fvq,
+                                 n_vars,
+                                 inc,
+                                 bc_coeff_a,
+                                 bc_coeff_b,
+                                 pvar,
+                                 _grad);
+
+    if (gradient_type == CS_GRADIENT_ITER)
+      _iterative_scalar_gradients(mesh,
+                                  fvq,
+                                  var_name,
+                                  n_r_sweeps,
+                                  verbosity,
+                                  n_vars,
+                                  inc,
+                                  epsilon,
+                                  bc_coeff_a,
+                                  bc_coeff_b,
+                                  pvar,
+                                  _grad);
+
+  }
+  else {
+
+    _lsq_scalar_gradients(mesh,
+                          cs_glob_mesh_adjacencies,
+                          fvq,
+                          _get_lsq_stencil(mesh, fvq, halo_type),
+                          halo_type,
+                          recompute_cocg,
+                          n_vars,
+                          inc,
+                          extrap,
+                          bc_coeff_a,
+                          bc_coeff_b,
+                          pvar,
+                          _grad);
+
+    if (mesh->halo != NULL)
+      cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)_grad, 3*n_vars);
+
+  }
+
+  BFT_FREE(pvar);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++) {
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[v_id][ii][ll] = _grad[ii*n_vars + v_id][ll];
+    }
+  }
+
+  BFT_FREE(_grad);
+
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+
+    _scalar_gradient_clipping(halo_type, clip_mode, verbosity, 0, clip_coeff,
+                              var[v_id], grad[v_id]);
+
+    if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+      cs_bad_cells_regularisation_vector(grad[v_id], 0);
+
+  }
+
+  t1 = cs_timer_time();
+
+  gradient_info->n_calls += n_vars;
+  cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -176,6 +176,30 @@ cs_gradient_initialize(void);
 void
 cs_gradient_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Set option for precomputation of least-squares gradient stencils.
+ *
+ * When activated, geometric weights of least-squares gradients are
+ * computed once per mesh and reused, so that the interior contribution
+ * to the gradient of unweighted fields is a sparse matrix-vector product.
+ *
+ * parameters:
+ *   precompute <-- true to precompute stencils, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_lsq_precompute(bool  precompute);
+
+/*----------------------------------------------------------------------------
+ * Query option for precomputation of least-squares gradient stencils.
+ *
+ * returns:
+ *   true if stencils are precomputed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_gradient_get_lsq_precompute(void);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -228,6 +252,55 @@ cs_gradient_scalar(const char                *var_name,
                    cs_internal_coupling_t    *cpl,
                    cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields together.
+ *
+ * For iterative and least-squares gradients, values of all variables
+ * are interleaved so that their halos are synchronized with a single
+ * exchange, and mesh geometry is traversed once for all variables
+ * (once per sweep for iterative gradients). In other cases, or with
+ * periodicity of rotation, gradients are computed one by one.
+ *
+ * Weighting, hydrostatic pressure, internal coupling and periodicity of
+ * rotation of components are not handled here.
+ *
+ * parameters:
+ *   var_name        <-- name for the group of variables (for logging)
+ *   gradient_type   <-- gradient type
+ *   halo_type       <-- halo type
+ *   inc             <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg  <-- should COCG FV quantities be recomputed ?
+ *   n_r_sweeps      <-- if > 1, number of reconstruction sweeps
+ *   verbosity       <-- verbosity level
+ *   clip_mode       <-- clipping mode
+ *   epsilon         <-- precision for iterative gradient calculation
+ *   extrap          <-- boundary gradient extrapolation coefficient
+ *   clip_coeff      <-- clipping coefficient
+ *   n_vars          <-- number of variables
+ *   bc_coeff_a      <-- boundary condition term a, per variable
+ *   bc_coeff_b      <-- boundary condition term b, per variable
+ *   var             <-> gradients' base variables
+ *   grad            --> gradients, per variable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalars(const char                *var_name,
+                    cs_gradient_type_t         gradient_type,
+                    cs_halo_type_t             halo_type,
+                    int                        inc,
+                    bool                       recompute_cocg,
+                    int                        n_r_sweeps,
+                    int                        verbosity,
+                    int                        clip_mode,
+                    double                     epsilon,
+                    double                     extrap,
+                    double                     clip_coeff,
+                    int                        n_vars,
+                    const cs_real_t           *bc_coeff_a[],
+                    const cs_real_t           *bc_coeff_b[],
+                    cs_real_t                 *var[],
+                    cs_real_3_t               *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -150,6 +150,14 @@ struct _cs_grid_t {
                                        < 0 orientation opposite as parent);
                                        size: parent n_faces */
 
+  cs_lnum_t          *prolong_index; /* Smoothed prolongation row index
+                                        (size: parent n_cells + 1),
+                                        or NULL for piecewise-constant
+                                        prolongation */
+  cs_lnum_t          *prolong_col;   /* Smoothed prolongation coarse cell
+                                        ids (0 to n-1) */
+  cs_real_t          *prolong_val;   /* Smoothed prolongation coefficients */
+
   /* Geometric data */
 
   const cs_real_t  *cell_cen;       /* Cell center (shared) */
@@ -195,6 +203,19 @@ struct _cs_grid_t {
   const cs_matrix_t       *matrix;         /* Associated matrix (shared) */
   cs_matrix_t             *_matrix;        /* Associated matrix (private) */
 
+  /* Optional direct solver data (matrix gathered on a single rank) */
+
+  bool              direct_solve;   /* true if direct solver is set up */
+  cs_lnum_t         n_direct_rows;  /* Number of rows of gathered matrix
+                                       (on root rank only, 0 elsewhere) */
+  cs_real_t        *direct_lu;      /* LU factors of gathered dense matrix,
+                                       row-major (root rank only) */
+  cs_lnum_t        *direct_piv;     /* LU row pivots (root rank only) */
+  int              *direct_count;   /* Number of rows gathered from each
+                                       rank (root rank only) */
+  int              *direct_displ;   /* Displacement of rows gathered from
+                                       each rank (root rank only) */
+
 #if defined(HAVE_MPI)
 
   /* Additional fields to allow merging grids */
@@ -246,6 +267,12 @@ const char *cs_grid_coarsening_type_name[]
      N_("algebraic, face traveral by criteria"),
      N_("algebraic, face traversal by Hilbert SFC")};
 
+/* Names for prolongation options */
+
+const char *cs_grid_prolong_type_name[]
+  = {N_("piecewise constant (P0/P1 coarse matrix)"),
+     N_("smoothed aggregation (Galerkin coarse matrix)")};
+
 /* Select tuning options */
 
 static int _grid_tune_max_level = 0;
@@ -301,6 +328,17 @@ _create_grid(void)
   g->coarse_cell = NULL;
   g->coarse_face = NULL;
 
+  g->prolong_index = NULL;
+  g->prolong_col = NULL;
+  g->prolong_val = NULL;
+
+  g->direct_solve = false;
+  g->n_direct_rows = 0;
+  g->direct_lu = NULL;
+  g->direct_piv = NULL;
+  g->direct_count = NULL;
+  g->direct_displ = NULL;
+
   g->cell_cen = NULL;
   g->_cell_cen = NULL;
   g->cell_vol = NULL;
@@ -2079,6 +2117,11 @@ _append_face_data(cs_grid_t   *g,
 
   static const int tag = 'a'+'p'+'p'+'e'+'n'+'d'+'_'+'f';
 
+  /* Extra-diagonal values per face */
+
+  const cs_lnum_t xa_stride
+    = ((g->symmetric == true) ? 1 : 2) * g->extra_diag_block_size[3];
+
   /* Exchange counters needed for concatenation */
 
   if (g->merge_sub_rank == 0) {
@@ -2108,10 +2151,7 @@ _append_face_data(cs_grid_t   *g,
 
     BFT_REALLOC(g->_face_normal, n_faces_tot*3, cs_real_t);
 
-    if (g->symmetric == true)
-      BFT_REALLOC(g->_xa, n_faces_tot, cs_real_t);
-    else
-      BFT_REALLOC(g->_xa, n_faces_tot*2, cs_real_t);
+    BFT_REALLOC(g->_xa, n_faces_tot*xa_stride, cs_real_t);
 
     BFT_REALLOC(g->_xa0, n_faces_tot, cs_real_t);
     BFT_REALLOC(g->xa0ij, n_faces_tot*3, cs_real_t);
@@ -2129,12 +2169,8 @@ _append_face_data(cs_grid_t   *g,
       MPI_Recv(g->_face_normal + g->n_faces*3, n_recv*3,
                CS_MPI_REAL, dist_rank, tag, comm, &status);
 
-      if (g->symmetric == true)
-        MPI_Recv(g->_xa + g->n_faces, n_recv,
-                 CS_MPI_REAL, dist_rank, tag, comm, &status);
-      else
-        MPI_Recv(g->_xa + g->n_faces*2, n_recv*2,
-                 CS_MPI_REAL, dist_rank, tag, comm, &status);
+      MPI_Recv(g->_xa + g->n_faces*xa_stride, n_recv*xa_stride,
+               CS_MPI_REAL, dist_rank, tag, comm, &status);
 
       MPI_Recv(g->_xa0 + g->n_faces, n_recv,
                CS_MPI_REAL, dist_rank, tag, comm, &status);
@@ -2161,12 +2197,8 @@ _append_face_data(cs_grid_t   *g,
       g->_face_normal[face_id*3] = g->_face_normal[p_face_id*3];
       g->_face_normal[face_id*3 + 1] = g->_face_normal[p_face_id*3 + 1];
       g->_face_normal[face_id*3 + 2] = g->_face_normal[p_face_id*3 + 2];
-      if (g->symmetric == true)
-        g->_xa[face_id] = g->_xa[p_face_id];
-      else {
-        g->_xa[face_id*2] = g->_xa[p_face_id*2];
-        g->_xa[face_id*2+1] = g->_xa[p_face_id*2+1];
-      }
+      for (cs_lnum_t k = 0; k < xa_stride; k++)
+        g->_xa[face_id*xa_stride + k] = g->_xa[p_face_id*xa_stride + k];
       g->_xa0[face_id] = g->_xa0[p_face_id];
       g->xa0ij[face_id*3] = g->xa0ij[p_face_id*3];
       g->xa0ij[face_id*3 + 1] = g->xa0ij[p_face_id*3 + 1];
@@ -2181,12 +2213,8 @@ _append_face_data(cs_grid_t   *g,
              g->merge_sub_root, tag, comm);
     BFT_FREE(g->_face_normal);
 
-    if (g->symmetric == true)
-      MPI_Send(g->_xa, n_faces, CS_MPI_REAL,
-               g->merge_sub_root, tag, comm);
-    else
-      MPI_Send(g->_xa, n_faces*2, CS_MPI_REAL,
-               g->merge_sub_root, tag, comm);
+    MPI_Send(g->_xa, n_faces*xa_stride, CS_MPI_REAL,
+             g->merge_sub_root, tag, comm);
     BFT_FREE(g->_xa);
 
     MPI_Send(g->_xa0, n_faces, CS_MPI_REAL,
@@ -2578,6 +2606,7 @@ _automatic_aggregation(const cs_grid_t  *fine_grid,
   cs_real_t *aggr_crit = NULL;
 
   const cs_lnum_t *db_size = fine_grid->diag_block_size;
+  const cs_lnum_t *eb_size = fine_grid->extra_diag_block_size;
   const cs_lnum_2_t *f_face_cells = fine_grid->face_cell;
   const cs_real_t *f_da = fine_grid->da;
   const cs_real_t *f_xa = fine_grid->xa;
@@ -2706,8 +2735,24 @@ _automatic_aggregation(const cs_grid_t  *fine_grid,
         /* the communication pattern and require a more complex algorithm). */
 
         if (ii < f_n_cells && jj < f_n_cells) {
-          f_xa1 = f_xa[c_face*isym];//TODO if f_xa1 is a block
-          f_xa2 = f_xa[(c_face +1)*isym -1];
+          if (eb_size[0] == 1) {
+            f_xa1 = f_xa[c_face*isym];
+            f_xa2 = f_xa[(c_face +1)*isym -1];
+          }
+          else {
+            /* Use mean of block diagonal terms so that the criterion
+               matches that of the scalar case for isotropic blocks */
+            const cs_real_t *b_xa1 = f_xa + c_face*isym*eb_size[3];
+            const cs_real_t *b_xa2 = b_xa1 + (isym - 1)*eb_size[3];
+            f_xa1 = 0.;
+            f_xa2 = 0.;
+            for (kk = 0; kk < eb_size[0]; kk++) {
+              f_xa1 += b_xa1[eb_size[2]*kk + kk];
+              f_xa2 += b_xa2[eb_size[2]*kk + kk];
+            }
+            f_xa1 /= eb_size[0];
+            f_xa2 /= eb_size[0];
+          }
           /* TODO: remove these tests, or adimensionalize them */
           f_xa1 = CS_MAX(-f_xa1, 1.e-15);
           f_xa2 = CS_MAX(-f_xa2, 1.e-15);
@@ -3785,209 +3830,1065 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 
 }
 
-/*============================================================================
- * Semi-private function definitions
- *
- * The following functions are intended to be used by the multigrid layer
- * (cs_multigrid.c), not directly by the user, so they are no more
- * documented than private static functions)
- *============================================================================*/
-
 /*----------------------------------------------------------------------------
- * Create base grid by mapping from shared mesh values.
+ * Build a coarse level from a finer level with extra-diagonal blocks.
  *
- * Note that as arrays given as arguments are shared by the created grid
- * (which can only access them, not modify them), the grid should be
- * destroyed before those arrays.
+ * Coarse matrix coefficients are obtained by Galerkin P0 restriction
+ * and prolongation, keeping the full diagonal and extra-diagonal blocks
+ * (so the coupling between components is preserved on coarse levels).
+ * The P1 correction is not applied in this case, as it is based
+ * on a scalar geometric interpolation.
  *
  * parameters:
- *   n_cells               <-- Local number of cells
- *   n_cells_ext           <-- Local number of cells + ghost cells
- *   n_faces               <-- Local number of faces
- *   symmetric             <-- True if xam is symmetric, false otherwise
- *   diag_block_size       <-- Block sizes for diagonal, or NULL
- *   extra_diag_block_size <-- Block sizes for diagonal, or NULL
- *   face_cell             <-- Face -> cells connectivity
- *   halo                  <-- Halo structure associated with this level,
- *                             or NULL.
- *   cell_cen              <-- Cell center (size: 3.n_cells_ext)
- *   cell_vol              <-- Cell volume (size: n_cells_ext)
- *   face_normal           <-- Internal face normals (size: 3.n_faces)
- *   a                     <-- Associated matrix
- *   a_conv                <-- Associated matrix (convection)
- *   a_diff                <-- Associated matrix (diffusion)
- *
- * returns:
- *   base grid structure
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
  *----------------------------------------------------------------------------*/
 
-cs_grid_t *
-cs_grid_create_from_shared(cs_lnum_t              n_cells,
-                           cs_lnum_t              n_cells_ext,
-                           cs_lnum_t              n_faces,
-                           bool                   symmetric,
-                           const cs_lnum_t       *diag_block_size,
-                           const cs_lnum_t       *extra_diag_block_size,
-                           const cs_lnum_2_t     *face_cell,
-                           const cs_halo_t       *halo,
-                           const cs_real_t       *cell_cen,
-                           const cs_real_t       *cell_vol,
-                           const cs_real_t       *face_normal,
-                           const cs_matrix_t     *a,
-                           const cs_matrix_t     *a_conv,
-                           const cs_matrix_t     *a_diff)
+static void
+_compute_coarse_quantities_block(const cs_grid_t  *fine_grid,
+                                 cs_grid_t        *coarse_grid)
 {
-  cs_lnum_t ii, jj, kk, face_id;
+  cs_lnum_t ic, jc, ii, jj, kk, ll, c_face, face_id;
 
-  cs_grid_t *g = NULL;
+  int isym = 2;
 
-  const cs_real_t *da      = cs_matrix_get_diagonal(a);
-  const cs_real_t *xa      = cs_matrix_get_extra_diagonal(a);
-  const cs_real_t *da_conv = NULL, *da_diff = NULL;
-  const cs_real_t *xa_conv = NULL, *xa_diff = NULL;
+  cs_lnum_t f_n_cells = fine_grid->n_cells;
+  cs_lnum_t f_n_cells_ext = fine_grid->n_cells_ext;
+  cs_lnum_t f_n_faces = fine_grid->n_faces;
 
-  /* Create empty structure and map base data */
+  cs_lnum_t c_n_cells_ext = coarse_grid->n_cells_ext;
+  cs_lnum_t c_n_faces = coarse_grid->n_faces;
 
-  g = _create_grid();
+  cs_lnum_t *c_coarse_cell = coarse_grid->coarse_cell;
+  cs_lnum_t *c_coarse_face = coarse_grid->coarse_face;
 
-  g->level = 0;
-  g->conv_diff = false;
-  g->symmetric = symmetric;
+  cs_real_t *f_xa0ij = fine_grid->xa0ij;
 
-  if (a_conv != NULL || a_diff != NULL) {
-    g->conv_diff = true;
-    da_conv = cs_matrix_get_diagonal(a_conv);
-    da_diff = cs_matrix_get_diagonal(a_diff);
-    xa_conv = cs_matrix_get_extra_diagonal(a_conv);
-    xa_diff = cs_matrix_get_extra_diagonal(a_diff);
-  }
+  cs_real_t *c_face_normal = coarse_grid->_face_normal;
 
-  if (diag_block_size != NULL) {
-    for (ii = 0; ii < 4; ii++)
-      g->diag_block_size[ii] = diag_block_size[ii];
-  }
-  else {
-    for (ii = 0; ii < 4; ii++)
-      g->diag_block_size[ii] = 1;
-  }
+  cs_real_t *c_xa0 = coarse_grid->_xa0;
+  cs_real_t *c_xa0ij = coarse_grid->xa0ij;
+  cs_real_t *c_da = coarse_grid->_da;
+  cs_real_t *c_xa = coarse_grid->_xa;
 
-  if (extra_diag_block_size != NULL) {
-    for (ii = 0; ii < 4; ii++)
-      g->extra_diag_block_size[ii] = extra_diag_block_size[ii];
-  }
-  else {
-    for (ii = 0; ii < 4; ii++)
-      g->extra_diag_block_size[ii] = 1;
-  }
+  cs_real_t *w1 = NULL;
 
+  const cs_lnum_t *db_size = fine_grid->diag_block_size;
+  const cs_lnum_t *eb_size = fine_grid->extra_diag_block_size;
 
-  g->n_cells = n_cells;
-  g->n_cells_ext = n_cells_ext;
-  g->n_faces = n_faces;
-  g->n_g_cells = n_cells;
+  const cs_lnum_2_t *f_face_cell = fine_grid->face_cell;
+  const cs_lnum_2_t *c_face_cell = coarse_grid->face_cell;
 
-#if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1) {
-    cs_gnum_t _n_cells = n_cells;
-    MPI_Allreduce(&_n_cells, &(g->n_g_cells), 1, CS_MPI_GNUM, MPI_SUM,
-                  cs_glob_mpi_comm);
-  }
-#endif
+  const cs_real_t *f_face_normal = fine_grid->face_normal;
+  const cs_real_t *f_xa0 = fine_grid->xa0;
+  const cs_real_t *f_da = fine_grid->da;
+  const cs_real_t *f_xa = fine_grid->xa;
 
-  g->face_cell = face_cell;
+  assert(eb_size[0] == db_size[0]);
 
-  g->cell_cen = cell_cen;
-  g->cell_vol = cell_vol;
-  g->face_normal = face_normal;
+  BFT_MALLOC(w1, f_n_cells_ext*db_size[3], cs_real_t);
 
-  g->halo = halo;
+  if (fine_grid->symmetric == true)
+    isym = 1;
 
-  /* Set shared matrix coefficients */
+  const cs_lnum_t eb_stride = isym*eb_size[3];
 
-  g->da = da;
-  g->_da = NULL;
+  /* P0 restriction of geometric quantities and extra-diagonal blocks */
 
-  if (g->conv_diff) {
-    g->da_conv = da_conv;
-    g->_da_conv = NULL;
-    g->da_diff = da_diff;
-    g->_da_diff = NULL;
+# pragma omp parallel for private(kk) if(c_n_faces*6 > CS_THR_MIN)
+  for (c_face = 0; c_face < c_n_faces; c_face++) {
+    c_xa0[c_face] = 0.;
+    c_face_normal[3*c_face]    = 0.;
+    c_face_normal[3*c_face +1] = 0.;
+    c_face_normal[3*c_face +2] = 0.;
+    c_xa0ij[3*c_face]    = 0.;
+    c_xa0ij[3*c_face +1] = 0.;
+    c_xa0ij[3*c_face +2] = 0.;
+    for (kk = 0; kk < eb_stride; kk++)
+      c_xa[c_face*eb_stride + kk] = 0.;
   }
 
-  g->xa = xa;
-  g->_xa = NULL;
+  for (face_id = 0; face_id < f_n_faces; face_id++) {
 
-  if (g->conv_diff) {
-    g->xa_conv = xa_conv;
-    g->_xa_conv = NULL;
-    g->xa_diff = xa_diff;
-    g->_xa_diff = NULL;
-  }
+    const cs_real_t *f_b_xa = f_xa + face_id*eb_stride;
 
-  /* Build symmetrized extra-diagonal terms if necessary,
-     or point to existing terms if already symmetric */
+    if (c_coarse_face[face_id] > 0 ) {
+      c_face = c_coarse_face[face_id] -1;
+
+      cs_real_t *c_b_xa = c_xa + c_face*eb_stride;
+      for (kk = 0; kk < eb_stride; kk++)
+        c_b_xa[kk] += f_b_xa[kk];
+
+      c_xa0[c_face] += f_xa0[face_id];
+      c_face_normal[3*c_face]    += f_face_normal[3*face_id];
+      c_face_normal[3*c_face +1] += f_face_normal[3*face_id +1];
+      c_face_normal[3*c_face +2] += f_face_normal[3*face_id +2];
+      c_xa0ij[3*c_face]    += f_xa0ij[3*face_id];
+      c_xa0ij[3*c_face +1] += f_xa0ij[3*face_id +1];
+      c_xa0ij[3*c_face +2] += f_xa0ij[3*face_id +2];
+    }
+    else if (c_coarse_face[face_id] < 0) {
+      c_face = -c_coarse_face[face_id] -1;
+
+      /* Opposite orientation: (i, j) and (j, i) blocks are swapped */
+
+      cs_real_t *c_b_xa = c_xa + c_face*eb_stride;
+      for (kk = 0; kk < eb_size[3]; kk++) {
+        c_b_xa[kk] += f_b_xa[(isym-1)*eb_size[3] + kk];
+        if (isym == 2)
+          c_b_xa[eb_size[3] + kk] += f_b_xa[kk];
+      }
+
+      c_xa0[c_face] += f_xa0[face_id];
+      c_face_normal[3*c_face]    -= f_face_normal[3*face_id];
+      c_face_normal[3*c_face +1] -= f_face_normal[3*face_id +1];
+      c_face_normal[3*c_face +2] -= f_face_normal[3*face_id +2];
+      c_xa0ij[3*c_face]    -= f_xa0ij[3*face_id];
+      c_xa0ij[3*c_face +1] -= f_xa0ij[3*face_id +1];
+      c_xa0ij[3*c_face +2] -= f_xa0ij[3*face_id +2];
+    }
 
-  if (symmetric == true) {
-    g->xa0 = g->xa;
-    g->_xa0 = NULL;
   }
-  else if (g->conv_diff) {
-    g->xa0  = g->xa;
-    g->_xa0 = NULL;
-    g->xa0_diff = g->xa_diff;
-    g->_xa0_diff = NULL;
+
+  /* Fine diagonal blocks plus sum of row extra-diagonal blocks, saved in w1;
+     extra-diagonal blocks of faces which remain on the coarse grid are
+     removed below, so only blocks of faces interior to a coarse cell
+     contribute to the coarse diagonal. */
+
+# pragma omp parallel for private(kk) if(f_n_cells > CS_THR_MIN)
+  for (ii = 0; ii < f_n_cells; ii++) {
+    for (kk = 0; kk < db_size[3]; kk++)
+      w1[ii*db_size[3] + kk] = f_da[ii*db_size[3] + kk];
   }
-  else {
-    BFT_MALLOC(g->_xa0, n_faces, cs_real_t);
-    for (face_id = 0; face_id < n_faces; face_id++)
-      g->_xa0[face_id] = 0.5 * (xa[face_id*2] + xa[face_id*2+1]);
-    g->xa0 = g->_xa0;
+# pragma omp parallel for if(f_n_cells_ext - f_n_cells > CS_THR_MIN)
+  for (ii = f_n_cells*db_size[3]; ii < f_n_cells_ext*db_size[3]; ii++)
+    w1[ii] = 0.;
+
+  for (face_id = 0; face_id < f_n_faces; face_id++) {
+    const cs_real_t *b_ij = f_xa + face_id*eb_stride;
+    const cs_real_t *b_ji = b_ij + (isym-1)*eb_size[3];
+    ii = f_face_cell[face_id][0];
+    jj = f_face_cell[face_id][1];
+    for (kk = 0; kk < eb_size[0]; kk++) {
+      for (ll = 0; ll < eb_size[0]; ll++) {
+        w1[ii*db_size[3] + db_size[2]*kk + ll] += b_ij[eb_size[2]*kk + ll];
+        w1[jj*db_size[3] + db_size[2]*kk + ll] += b_ji[eb_size[2]*kk + ll];
+      }
+    }
   }
 
-  /* Compute multigrid-specific terms */
+  /* Diagonal term */
 
-  BFT_MALLOC(g->xa0ij, n_faces*3, cs_real_t);
+# pragma omp parallel for if(c_n_cells_ext > CS_THR_MIN)
+  for (ic = 0; ic < c_n_cells_ext*db_size[3]; ic++)
+    c_da[ic] = 0.;
 
-  const cs_real_t *restrict g_xa0 = g->xa0;
-  if (g->conv_diff)
-    g_xa0 = g->xa0_diff;
+  for (ii = 0; ii < f_n_cells; ii++) {
+    ic = c_coarse_cell[ii] -1;
+    for (kk = 0; kk < db_size[3]; kk++)
+      c_da[ic*db_size[3] + kk] += w1[ii*db_size[3] + kk];
+  }
 
-# pragma omp parallel for private(ii, jj, kk) if(n_faces > CS_THR_MIN)
-  for (face_id = 0; face_id < n_faces; face_id++) {
-    ii = face_cell[face_id][0];
-    jj = face_cell[face_id][1];
-    for (kk = 0; kk < 3; kk++) {
-      g->xa0ij[face_id*3 + kk] =   g_xa0[face_id]
-                                 * (cell_cen[jj*3 + kk] - cell_cen[ii*3 + kk]);
+  for (c_face = 0; c_face < c_n_faces; c_face++) {
+    const cs_real_t *b_ij = c_xa + c_face*eb_stride;
+    const cs_real_t *b_ji = b_ij + (isym-1)*eb_size[3];
+    ic = c_face_cell[c_face][0];
+    jc = c_face_cell[c_face][1];
+    for (kk = 0; kk < eb_size[0]; kk++) {
+      for (ll = 0; ll < eb_size[0]; ll++) {
+        c_da[ic*db_size[3] + db_size[2]*kk + ll] -= b_ij[eb_size[2]*kk + ll];
+        c_da[jc*db_size[3] + db_size[2]*kk + ll] -= b_ji[eb_size[2]*kk + ll];
+      }
     }
   }
 
-  g->matrix_struct = NULL;
-  g->matrix = a;
-  g->_matrix = NULL;
-
-  return g;
+  BFT_FREE(w1);
 }
 
 /*----------------------------------------------------------------------------
- * Destroy a grid structure.
+ * Compute the product of two local CSR matrices (C = A.B).
+ *
+ * Row-wise (Gustavson) product, with a symbolic pass counting nonzeros
+ * followed by a numeric pass. Each thread uses a private marker array
+ * of size n_cols, and rows are distributed statically, so that positions
+ * marked for previous rows of a given thread are always lower than the
+ * start of the current row.
  *
  * parameters:
- *   grid <-> Pointer to grid structure pointer
+ *   n_rows  <-- number of rows of A (and C)
+ *   n_cols  <-- number of columns of B (and C)
+ *   a_index <-- A row index (size: n_rows + 1)
+ *   a_col   <-- A column ids
+ *   a_val   <-- A values
+ *   b_index <-- B row index
+ *   b_col   <-- B column ids
+ *   b_val   <-- B values
+ *   c_index --> C row index (size: n_rows + 1)
+ *   c_col   --> C column ids
+ *   c_val   --> C values
  *----------------------------------------------------------------------------*/
 
-void
-cs_grid_destroy(cs_grid_t **grid)
+static void
+_csr_spgemm(cs_lnum_t          n_rows,
+            cs_lnum_t          n_cols,
+            const cs_lnum_t    a_index[],
+            const cs_lnum_t    a_col[],
+            const cs_real_t    a_val[],
+            const cs_lnum_t    b_index[],
+            const cs_lnum_t    b_col[],
+            const cs_real_t    b_val[],
+            cs_lnum_t        **c_index,
+            cs_lnum_t        **c_col,
+            cs_real_t        **c_val)
 {
-  if (grid != NULL && *grid != NULL) {
+  cs_lnum_t *_c_index = NULL, *_c_col = NULL;
+  cs_real_t *_c_val = NULL;
 
-    cs_grid_t *g = *grid;
+  BFT_MALLOC(_c_index, n_rows + 1, cs_lnum_t);
+  _c_index[0] = 0;
 
-    BFT_FREE(g->_face_cell);
+  /* Symbolic pass: count nonzeros per row */
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t *marker = NULL;
+    BFT_MALLOC(marker, n_cols, cs_lnum_t);
+    for (cs_lnum_t kk = 0; kk < n_cols; kk++)
+      marker[kk] = -1;
+
+#   pragma omp for schedule(static)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_lnum_t n_row_cols = 0;
+      for (cs_lnum_t k = a_index[ii]; k < a_index[ii+1]; k++) {
+        cs_lnum_t jj = a_col[k];
+        for (cs_lnum_t l = b_index[jj]; l < b_index[jj+1]; l++) {
+          cs_lnum_t kk = b_col[l];
+          if (marker[kk] != ii) {
+            marker[kk] = ii;
+            n_row_cols++;
+          }
+        }
+      }
+      _c_index[ii+1] = n_row_cols;
+    }
+
+    BFT_FREE(marker);
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    _c_index[ii+1] += _c_index[ii];
+
+  BFT_MALLOC(_c_col, _c_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(_c_val, _c_index[n_rows], cs_real_t);
+
+  /* Numeric pass; marker now contains positions in C */
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    cs_lnum_t *marker = NULL;
+    BFT_MALLOC(marker, n_cols, cs_lnum_t);
+    for (cs_lnum_t kk = 0; kk < n_cols; kk++)
+      marker[kk] = -1;
+
+#   pragma omp for schedule(static)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const cs_lnum_t s_id = _c_index[ii];
+      cs_lnum_t e_id = s_id;
+      for (cs_lnum_t k = a_index[ii]; k < a_index[ii+1]; k++) {
+        cs_lnum_t jj = a_col[k];
+        for (cs_lnum_t l = b_index[jj]; l < b_index[jj+1]; l++) {
+          cs_lnum_t kk = b_col[l];
+          cs_real_t v = a_val[k]*b_val[l];
+          if (marker[kk] < s_id) {
+            marker[kk] = e_id;
+            _c_col[e_id] = kk;
+            _c_val[e_id] = v;
+            e_id++;
+          }
+          else
+            _c_val[marker[kk]] += v;
+        }
+      }
+    }
+
+    BFT_FREE(marker);
+  }
+
+  *c_index = _c_index;
+  *c_col = _c_col;
+  *c_val = _c_val;
+}
+
+/*----------------------------------------------------------------------------
+ * Transpose a local CSR matrix.
+ *
+ * parameters:
+ *   n_rows  <-- number of rows of A
+ *   n_cols  <-- number of columns of A
+ *   a_index <-- A row index (size: n_rows + 1)
+ *   a_col   <-- A column ids
+ *   a_val   <-- A values
+ *   t_index --> transposed row index (size: n_cols + 1)
+ *   t_col   --> transposed column ids
+ *   t_val   --> transposed values
+ *----------------------------------------------------------------------------*/
+
+static void
+_csr_transpose(cs_lnum_t          n_rows,
+               cs_lnum_t          n_cols,
+               const cs_lnum_t    a_index[],
+               const cs_lnum_t    a_col[],
+               const cs_real_t    a_val[],
+               cs_lnum_t        **t_index,
+               cs_lnum_t        **t_col,
+               cs_real_t        **t_val)
+{
+  cs_lnum_t *_t_index = NULL, *_t_col = NULL, *t_count = NULL;
+  cs_real_t *_t_val = NULL;
+
+  BFT_MALLOC(_t_index, n_cols + 1, cs_lnum_t);
+  BFT_MALLOC(t_count, n_cols, cs_lnum_t);
+
+  for (cs_lnum_t jj = 0; jj < n_cols + 1; jj++)
+    _t_index[jj] = 0;
+
+  for (cs_lnum_t k = 0; k < a_index[n_rows]; k++)
+    _t_index[a_col[k] + 1] += 1;
+
+  for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+    _t_index[jj+1] += _t_index[jj];
+    t_count[jj] = _t_index[jj];
+  }
+
+  BFT_MALLOC(_t_col, a_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(_t_val, a_index[n_rows], cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t k = a_index[ii]; k < a_index[ii+1]; k++) {
+      cs_lnum_t l = t_count[a_col[k]]++;
+      _t_col[l] = ii;
+      _t_val[l] = a_val[k];
+    }
+  }
+
+  BFT_FREE(t_count);
+
+  *t_index = _t_index;
+  *t_col = _t_col;
+  *t_val = _t_val;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a smoothed aggregation prolongation and the associated Galerkin
+ * coarse matrix.
+ *
+ * The tentative (piecewise-constant) prolongation P0 defined by the
+ * aggregation is smoothed by one damped Jacobi step, P = (I - w.D^-1.A).P0,
+ * and the coarse matrix is computed as P^T.A.P. Only the local part of A
+ * is used for smoothing; rows of fine cells adjacent to ghost cells keep
+ * the tentative prolongation, so that coarse faces on parallel or
+ * periodic boundaries are obtained by simple summation of fine
+ * coefficients, as for the P0 coarse matrix.
+ *
+ * The coarse face -> cells connectivity built by _coarsen is replaced
+ * by that of the Galerkin product, and coarse_face is freed, as it does
+ * not describe the coarse matrix anymore. The coarse matrix diagonal
+ * and extra-diagonal coefficients are allocated and computed here.
+ *
+ * Only scalar matrices are handled.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *   relax_param <-- Jacobi smoother relaxation parameter
+ *----------------------------------------------------------------------------*/
+
+static void
+_smoothed_aggregation(const cs_grid_t  *fine_grid,
+                      cs_grid_t        *coarse_grid,
+                      cs_real_t         relax_param)
+{
+  int isym = 2;
+
+  const cs_lnum_t f_n_cells = fine_grid->n_cells;
+  const cs_lnum_t f_n_faces = fine_grid->n_faces;
+  const cs_lnum_t c_n_cells = coarse_grid->n_cells;
+  const cs_lnum_t c_n_cells_ext = coarse_grid->n_cells_ext;
+  const cs_lnum_t c_n_faces_0 = coarse_grid->n_faces;
+
+  const cs_lnum_t *c_coarse_cell = coarse_grid->coarse_cell;
+  const cs_lnum_t *c_coarse_face = coarse_grid->coarse_face;
+
+  const cs_lnum_2_t *f_face_cell = fine_grid->face_cell;
+  const cs_lnum_2_t *c_face_cell_0 = coarse_grid->face_cell;
+
+  const cs_real_t *f_da = fine_grid->da;
+  const cs_real_t *f_xa = fine_grid->xa;
+
+  assert(fine_grid->diag_block_size[0] == 1);
+
+  if (fine_grid->symmetric == true)
+    isym = 1;
+
+  /* Local fine matrix in CSR form (diagonal first in each row);
+     cells adjacent to ghost cells are flagged */
+
+  cs_lnum_t *a_index = NULL, *a_col = NULL, *a_count = NULL;
+  cs_real_t *a_val = NULL;
+  bool *on_halo = NULL;
+
+  BFT_MALLOC(a_index, f_n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(a_count, f_n_cells, cs_lnum_t);
+  BFT_MALLOC(on_halo, f_n_cells, bool);
+
+  for (cs_lnum_t ii = 0; ii < f_n_cells; ii++) {
+    a_index[ii+1] = 1;
+    on_halo[ii] = false;
+  }
+  a_index[0] = 0;
+
+  for (cs_lnum_t face_id = 0; face_id < f_n_faces; face_id++) {
+    cs_lnum_t ii = f_face_cell[face_id][0];
+    cs_lnum_t jj = f_face_cell[face_id][1];
+    if (ii < f_n_cells && jj < f_n_cells) {
+      a_index[ii+1] += 1;
+      a_index[jj+1] += 1;
+    }
+    else if (ii < f_n_cells)
+      on_halo[ii] = true;
+    else if (jj < f_n_cells)
+      on_halo[jj] = true;
+  }
+
+  for (cs_lnum_t ii = 0; ii < f_n_cells; ii++)
+    a_index[ii+1] += a_index[ii];
+
+  BFT_MALLOC(a_col, a_index[f_n_cells], cs_lnum_t);
+  BFT_MALLOC(a_val, a_index[f_n_cells], cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < f_n_cells; ii++) {
+    a_col[a_index[ii]] = ii;
+    a_val[a_index[ii]] = f_da[ii];
+    a_count[ii] = a_index[ii] + 1;
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < f_n_faces; face_id++) {
+    cs_lnum_t ii = f_face_cell[face_id][0];
+    cs_lnum_t jj = f_face_cell[face_id][1];
+    if (ii < f_n_cells && jj < f_n_cells) {
+      cs_lnum_t k = a_count[ii]++;
+      a_col[k] = jj;
+      a_val[k] = f_xa[face_id*isym];
+      k = a_count[jj]++;
+      a_col[k] = ii;
+      a_val[k] = f_xa[(face_id+1)*isym - 1];
+    }
+  }
+
+  BFT_FREE(a_count);
+
+  /* Smoothed prolongation; each row has at most as many entries
+     as the matching row of A, so that row is used as a work area
+     before compacting */
+
+  cs_lnum_t *p_index = NULL, *p_col = NULL;
+  cs_real_t *p_val = NULL;
+
+  BFT_MALLOC(p_index, f_n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(p_col, a_index[f_n_cells], cs_lnum_t);
+  BFT_MALLOC(p_val, a_index[f_n_cells], cs_real_t);
+
+  p_index[0] = 0;
+
+# pragma omp parallel for if(f_n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < f_n_cells; ii++) {
+
+    const cs_lnum_t s_id = a_index[ii];
+    cs_lnum_t e_id = s_id + 1;
+    const cs_real_t d = a_val[s_id];
+
+    p_col[s_id] = c_coarse_cell[ii] - 1;
+    p_val[s_id] = 1.;
+
+    if (on_halo[ii] == false && d > 0) {
+      const cs_real_t wd = relax_param / d;
+      p_val[s_id] -= relax_param;
+      for (cs_lnum_t k = s_id + 1; k < a_index[ii+1]; k++) {
+        cs_lnum_t ic = c_coarse_cell[a_col[k]] - 1;
+        cs_real_t v = - wd * a_val[k];
+        cs_lnum_t l = s_id;
+        while (l < e_id && p_col[l] != ic)
+          l++;
+        if (l < e_id)
+          p_val[l] += v;
+        else {
+          p_col[e_id] = ic;
+          p_val[e_id] = v;
+          e_id++;
+        }
+      }
+    }
+
+    p_index[ii+1] = e_id - s_id;
+  }
+
+  BFT_FREE(on_halo);
+
+  for (cs_lnum_t ii = 0; ii < f_n_cells; ii++) {
+    cs_lnum_t s_id = a_index[ii];
+    cs_lnum_t n = p_index[ii+1];
+    p_index[ii+1] = p_index[ii] + n;
+    for (cs_lnum_t k = 0; k < n; k++) {
+      p_col[p_index[ii] + k] = p_col[s_id + k];
+      p_val[p_index[ii] + k] = p_val[s_id + k];
+    }
+  }
+
+  BFT_REALLOC(p_col, p_index[f_n_cells], cs_lnum_t);
+  BFT_REALLOC(p_val, p_index[f_n_cells], cs_real_t);
+
+  /* Galerkin product R.A.P, with R = P^T */
+
+  cs_lnum_t *ap_index = NULL, *ap_col = NULL;
+  cs_lnum_t *r_index = NULL, *r_col = NULL;
+  cs_lnum_t *rap_index = NULL, *rap_col = NULL;
+  cs_real_t *ap_val = NULL, *r_val = NULL, *rap_val = NULL;
+
+  _csr_spgemm(f_n_cells, c_n_cells,
+              a_index, a_col, a_val,
+              p_index, p_col, p_val,
+              &ap_index, &ap_col, &ap_val);
+
+  BFT_FREE(a_index);
+  BFT_FREE(a_col);
+  BFT_FREE(a_val);
+
+  _csr_transpose(f_n_cells, c_n_cells,
+                 p_index, p_col, p_val,
+                 &r_index, &r_col, &r_val);
+
+  _csr_spgemm(c_n_cells, c_n_cells,
+              r_index, r_col, r_val,
+              ap_index, ap_col, ap_val,
+              &rap_index, &rap_col, &rap_val);
+
+  BFT_FREE(r_index);
+  BFT_FREE(r_col);
+  BFT_FREE(r_val);
+  BFT_FREE(ap_index);
+  BFT_FREE(ap_col);
+  BFT_FREE(ap_val);
+
+  coarse_grid->prolong_index = p_index;
+  coarse_grid->prolong_col = p_col;
+  coarse_grid->prolong_val = p_val;
+
+  /* Count coarse faces: upper part of the (structurally symmetric)
+     Galerkin product, and initial coarse faces adjacent to ghost cells */
+
+  cs_lnum_t c_n_faces = 0;
+
+  for (cs_lnum_t ic = 0; ic < c_n_cells; ic++) {
+    for (cs_lnum_t k = rap_index[ic]; k < rap_index[ic+1]; k++) {
+      if (rap_col[k] > ic)
+        c_n_faces++;
+    }
+  }
+
+  cs_lnum_t *halo_face_id = NULL;
+  BFT_MALLOC(halo_face_id, c_n_faces_0, cs_lnum_t);
+
+  for (cs_lnum_t c_face = 0; c_face < c_n_faces_0; c_face++) {
+    if (   c_face_cell_0[c_face][0] >= c_n_cells
+        || c_face_cell_0[c_face][1] >= c_n_cells)
+      halo_face_id[c_face] = c_n_faces++;
+    else
+      halo_face_id[c_face] = -1;
+  }
+
+  /* Build new coarse face -> cells connectivity and coefficients */
+
+  cs_lnum_2_t *c_face_cell = NULL;
+  cs_real_t *c_da = NULL, *c_xa = NULL;
+
+  BFT_MALLOC(c_face_cell, c_n_faces, cs_lnum_2_t);
+  BFT_MALLOC(c_da, c_n_cells_ext, cs_real_t);
+  BFT_MALLOC(c_xa, c_n_faces*isym, cs_real_t);
+
+  c_n_faces = 0;
+
+  for (cs_lnum_t ic = 0; ic < c_n_cells; ic++) {
+    c_da[ic] = 0.;
+    for (cs_lnum_t k = rap_index[ic]; k < rap_index[ic+1]; k++) {
+      cs_lnum_t jc = rap_col[k];
+      if (jc == ic)
+        c_da[ic] += rap_val[k];
+      else if (jc > ic) {
+        c_face_cell[c_n_faces][0] = ic;
+        c_face_cell[c_n_faces][1] = jc;
+        c_xa[c_n_faces*isym] = rap_val[k];
+        if (isym == 2) {
+          cs_lnum_t l = rap_index[jc];
+          while (l < rap_index[jc+1] && rap_col[l] != ic)
+            l++;
+          c_xa[c_n_faces*2 + 1] = (l < rap_index[jc+1]) ? rap_val[l] : 0.;
+        }
+        c_n_faces++;
+      }
+    }
+  }
+
+  for (cs_lnum_t ic = c_n_cells; ic < c_n_cells_ext; ic++)
+    c_da[ic] = 0.;
+
+  BFT_FREE(rap_index);
+  BFT_FREE(rap_col);
+  BFT_FREE(rap_val);
+
+  for (cs_lnum_t c_face = 0; c_face < c_n_faces_0; c_face++) {
+    cs_lnum_t n_face_id = halo_face_id[c_face];
+    if (n_face_id > -1) {
+      c_face_cell[n_face_id][0] = c_face_cell_0[c_face][0];
+      c_face_cell[n_face_id][1] = c_face_cell_0[c_face][1];
+      for (int kk = 0; kk < isym; kk++)
+        c_xa[n_face_id*isym + kk] = 0.;
+    }
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < f_n_faces; face_id++) {
+    cs_lnum_t c_face = CS_ABS(c_coarse_face[face_id]) - 1;
+    if (c_face < 0)
+      continue;
+    cs_lnum_t n_face_id = halo_face_id[c_face];
+    if (n_face_id < 0)
+      continue;
+    if (c_coarse_face[face_id] > 0) {
+      for (int kk = 0; kk < isym; kk++)
+        c_xa[n_face_id*isym + kk] += f_xa[face_id*isym + kk];
+    }
+    else {
+      c_xa[n_face_id*isym] += f_xa[(face_id+1)*isym - 1];
+      if (isym == 2)
+        c_xa[n_face_id*2 + 1] += f_xa[face_id*2];
+    }
+  }
+
+  BFT_FREE(halo_face_id);
+
+  /* Replace initial coarse face structures */
+
+  BFT_FREE(coarse_grid->coarse_face);
+  BFT_FREE(coarse_grid->_face_cell);
+
+  coarse_grid->n_faces = c_n_faces;
+  coarse_grid->_face_cell = c_face_cell;
+  coarse_grid->face_cell = (const cs_lnum_2_t *)(coarse_grid->_face_cell);
+
+  coarse_grid->_da = c_da;
+  coarse_grid->da = c_da;
+  coarse_grid->_xa = c_xa;
+  coarse_grid->xa = c_xa;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute coarse grid geometric quantities associated with a Galerkin
+ * coarse matrix, as built by _smoothed_aggregation.
+ *
+ * Face normals have no meaning for such a matrix, and are set to 0;
+ * the xa0 and xa0ij arrays are based on the symmetrized coarse
+ * extra-diagonal coefficients and cell centers.
+ *
+ * parameters:
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_galerkin(cs_grid_t  *coarse_grid)
+{
+  const cs_lnum_t c_n_faces = coarse_grid->n_faces;
+  const cs_lnum_2_t *c_face_cell = coarse_grid->face_cell;
+  const cs_real_t *c_cell_cen = coarse_grid->cell_cen;
+  const cs_real_t *c_xa = coarse_grid->xa;
+
+  cs_real_t *c_face_normal = coarse_grid->_face_normal;
+  cs_real_t *c_xa0 = coarse_grid->_xa0;
+  cs_real_t *c_xa0ij = coarse_grid->xa0ij;
+
+  const int isym = (coarse_grid->symmetric == true) ? 1 : 2;
+
+# pragma omp parallel for if(c_n_faces*6 > CS_THR_MIN)
+  for (cs_lnum_t c_face = 0; c_face < c_n_faces; c_face++) {
+
+    cs_lnum_t ic = c_face_cell[c_face][0];
+    cs_lnum_t jc = c_face_cell[c_face][1];
+
+    cs_real_t xa0 = 0.5 * (c_xa[c_face*isym] + c_xa[(c_face+1)*isym - 1]);
+
+    c_xa0[c_face] = xa0;
+
+    for (cs_lnum_t kk = 0; kk < 3; kk++) {
+      c_face_normal[3*c_face + kk] = 0.;
+      c_xa0ij[3*c_face + kk]
+        = xa0 * (c_cell_cen[3*jc + kk] - c_cell_cen[3*ic + kk]);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * LU factorization of a dense matrix with partial pivoting.
+ *
+ * Rows are swapped in place, so that the permutation may be applied
+ * sequentially to a right-hand side. Zero pivots (such as those arising
+ * from matrices with a constant null space, for pure Neumann boundary
+ * conditions) are replaced by 1, which amounts to fixing the matching
+ * unknown to 0 for a compatible right-hand side.
+ *
+ * parameters:
+ *   n   <-- matrix size
+ *   a   <-> dense matrix (row-major) in, LU factors out
+ *   piv --> row pivots
+ *
+ * returns:
+ *   number of replaced zero pivots
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_dense_lu_factor(cs_lnum_t   n,
+                 cs_real_t   a[],
+                 cs_lnum_t   piv[])
+{
+  cs_lnum_t n_null_pivots = 0;
+  cs_real_t a_max = 0.;
+
+  for (cs_lnum_t ii = 0; ii < n*n; ii++)
+    a_max = CS_MAX(a_max, CS_ABS(a[ii]));
+
+  const cs_real_t eps = a_max * 1e-14;
+
+  for (cs_lnum_t kk = 0; kk < n; kk++) {
+
+    /* Select pivot */
+
+    cs_lnum_t p_id = kk;
+    cs_real_t p_max = CS_ABS(a[kk*n + kk]);
+    for (cs_lnum_t ii = kk+1; ii < n; ii++) {
+      if (CS_ABS(a[ii*n + kk]) > p_max) {
+        p_max = CS_ABS(a[ii*n + kk]);
+        p_id = ii;
+      }
+    }
+
+    piv[kk] = p_id;
+
+    if (p_id != kk) {
+      for (cs_lnum_t jj = 0; jj < n; jj++) {
+        cs_real_t t = a[kk*n + jj];
+        a[kk*n + jj] = a[p_id*n + jj];
+        a[p_id*n + jj] = t;
+      }
+    }
+
+    if (p_max <= eps) {
+      a[kk*n + kk] = 1.;
+      for (cs_lnum_t ii = kk+1; ii < n; ii++)
+        a[ii*n + kk] = 0.;
+      n_null_pivots++;
+      continue;
+    }
+
+    /* Eliminate */
+
+    const cs_real_t *restrict a_k = a + kk*n;
+    const cs_real_t d_inv = 1. / a_k[kk];
+
+#   pragma omp parallel for if((n-kk)*(n-kk) > CS_THR_MIN)
+    for (cs_lnum_t ii = kk+1; ii < n; ii++) {
+      cs_real_t *restrict a_i = a + ii*n;
+      cs_real_t l = a_i[kk] * d_inv;
+      a_i[kk] = l;
+      for (cs_lnum_t jj = kk+1; jj < n; jj++)
+        a_i[jj] -= l*a_k[jj];
+    }
+
+  }
+
+  return n_null_pivots;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a linear system using a dense LU factorization.
+ *
+ * parameters:
+ *   n   <-- matrix size
+ *   lu  <-- LU factors, as built by _dense_lu_factor
+ *   piv <-- row pivots, as built by _dense_lu_factor
+ *   x   <-> right-hand side in, solution out
+ *----------------------------------------------------------------------------*/
+
+static void
+_dense_lu_solve(cs_lnum_t         n,
+                const cs_real_t   lu[],
+                const cs_lnum_t   piv[],
+                cs_real_t         x[])
+{
+  for (cs_lnum_t kk = 0; kk < n; kk++) {
+    if (piv[kk] != kk) {
+      cs_real_t t = x[kk];
+      x[kk] = x[piv[kk]];
+      x[piv[kk]] = t;
+    }
+  }
+
+  for (cs_lnum_t ii = 1; ii < n; ii++) {
+    const cs_real_t *restrict lu_i = lu + ii*n;
+    cs_real_t s = x[ii];
+    for (cs_lnum_t jj = 0; jj < ii; jj++)
+      s -= lu_i[jj]*x[jj];
+    x[ii] = s;
+  }
+
+  for (cs_lnum_t ii = n-1; ii > -1; ii--) {
+    const cs_real_t *restrict lu_i = lu + ii*n;
+    cs_real_t s = x[ii];
+    for (cs_lnum_t jj = ii+1; jj < n; jj++)
+      s -= lu_i[jj]*x[jj];
+    x[ii] = s / lu_i[ii];
+  }
+}
+
+/*============================================================================
+ * Semi-private function definitions
+ *
+ * The following functions are intended to be used by the multigrid layer
+ * (cs_multigrid.c), not directly by the user, so they are no more
+ * documented than private static functions)
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create base grid by mapping from shared mesh values.
+ *
+ * Note that as arrays given as arguments are shared by the created grid
+ * (which can only access them, not modify them), the grid should be
+ * destroyed before those arrays.
+ *
+ * parameters:
+ *   n_cells               <-- Local number of cells
+ *   n_cells_ext           <-- Local number of cells + ghost cells
+ *   n_faces               <-- Local number of faces
+ *   symmetric             <-- True if xam is symmetric, false otherwise
+ *   diag_block_size       <-- Block sizes for diagonal, or NULL
+ *   extra_diag_block_size <-- Block sizes for diagonal, or NULL
+ *   face_cell             <-- Face -> cells connectivity
+ *   halo                  <-- Halo structure associated with this level,
+ *                             or NULL.
+ *   cell_cen              <-- Cell center (size: 3.n_cells_ext)
+ *   cell_vol              <-- Cell volume (size: n_cells_ext)
+ *   face_normal           <-- Internal face normals (size: 3.n_faces)
+ *   a                     <-- Associated matrix
+ *   a_conv                <-- Associated matrix (convection)
+ *   a_diff                <-- Associated matrix (diffusion)
+ *
+ * returns:
+ *   base grid structure
+ *----------------------------------------------------------------------------*/
+
+cs_grid_t *
+cs_grid_create_from_shared(cs_lnum_t              n_cells,
+                           cs_lnum_t              n_cells_ext,
+                           cs_lnum_t              n_faces,
+                           bool                   symmetric,
+                           const cs_lnum_t       *diag_block_size,
+                           const cs_lnum_t       *extra_diag_block_size,
+                           const cs_lnum_2_t     *face_cell,
+                           const cs_halo_t       *halo,
+                           const cs_real_t       *cell_cen,
+                           const cs_real_t       *cell_vol,
+                           const cs_real_t       *face_normal,
+                           const cs_matrix_t     *a,
+                           const cs_matrix_t     *a_conv,
+                           const cs_matrix_t     *a_diff)
+{
+  cs_lnum_t ii, jj, kk, face_id;
+
+  cs_grid_t *g = NULL;
+
+  const cs_real_t *da      = cs_matrix_get_diagonal(a);
+  const cs_real_t *xa      = cs_matrix_get_extra_diagonal(a);
+  const cs_real_t *da_conv = NULL, *da_diff = NULL;
+  const cs_real_t *xa_conv = NULL, *xa_diff = NULL;
+
+  /* Create empty structure and map base data */
+
+  g = _create_grid();
+
+  g->level = 0;
+  g->conv_diff = false;
+  g->symmetric = symmetric;
+
+  if (a_conv != NULL || a_diff != NULL) {
+    g->conv_diff = true;
+    da_conv = cs_matrix_get_diagonal(a_conv);
+    da_diff = cs_matrix_get_diagonal(a_diff);
+    xa_conv = cs_matrix_get_extra_diagonal(a_conv);
+    xa_diff = cs_matrix_get_extra_diagonal(a_diff);
+  }
+
+  if (diag_block_size != NULL) {
+    for (ii = 0; ii < 4; ii++)
+      g->diag_block_size[ii] = diag_block_size[ii];
+  }
+  else {
+    for (ii = 0; ii < 4; ii++)
+      g->diag_block_size[ii] = 1;
+  }
+
+  if (extra_diag_block_size != NULL) {
+    for (ii = 0; ii < 4; ii++)
+      g->extra_diag_block_size[ii] = extra_diag_block_size[ii];
+  }
+  else {
+    for (ii = 0; ii < 4; ii++)
+      g->extra_diag_block_size[ii] = 1;
+  }
+
+
+  g->n_cells = n_cells;
+  g->n_cells_ext = n_cells_ext;
+  g->n_faces = n_faces;
+  g->n_g_cells = n_cells;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t _n_cells = n_cells;
+    MPI_Allreduce(&_n_cells, &(g->n_g_cells), 1, CS_MPI_GNUM, MPI_SUM,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  g->face_cell = face_cell;
+
+  g->cell_cen = cell_cen;
+  g->cell_vol = cell_vol;
+  g->face_normal = face_normal;
+
+  g->halo = halo;
+
+  /* Set shared matrix coefficients */
+
+  g->da = da;
+  g->_da = NULL;
+
+  if (g->conv_diff) {
+    g->da_conv = da_conv;
+    g->_da_conv = NULL;
+    g->da_diff = da_diff;
+    g->_da_diff = NULL;
+  }
+
+  g->xa = xa;
+  g->_xa = NULL;
+
+  if (g->conv_diff) {
+    g->xa_conv = xa_conv;
+    g->_xa_conv = NULL;
+    g->xa_diff = xa_diff;
+    g->_xa_diff = NULL;
+  }
+
+  /* Build symmetrized extra-diagonal terms if necessary,
+     or point to existing terms if already symmetric;
+     with extra-diagonal blocks, use the mean of block diagonal terms */
+
+  if (g->extra_diag_block_size[0] > 1) {
+    const cs_lnum_t *eb_size = g->extra_diag_block_size;
+    const cs_lnum_t isym = (symmetric) ? 1 : 2;
+    if (g->conv_diff)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: convection/diffusion coarsening is not available\n"
+                  "for matrices with extra-diagonal blocks."), __func__);
+    BFT_MALLOC(g->_xa0, n_faces, cs_real_t);
+#   pragma omp parallel for private(kk) if(n_faces > CS_THR_MIN)
+    for (face_id = 0; face_id < n_faces; face_id++) {
+      const cs_real_t *b_xa1 = xa + face_id*isym*eb_size[3];
+      const cs_real_t *b_xa2 = b_xa1 + (isym-1)*eb_size[3];
+      cs_real_t s_xa = 0.;
+      for (kk = 0; kk < eb_size[0]; kk++)
+        s_xa += b_xa1[eb_size[2]*kk + kk] + b_xa2[eb_size[2]*kk + kk];
+      g->_xa0[face_id] = 0.5 * s_xa / eb_size[0];
+    }
+    g->xa0 = g->_xa0;
+  }
+  else if (symmetric == true) {
+    g->xa0 = g->xa;
+    g->_xa0 = NULL;
+  }
+  else if (g->conv_diff) {
+    g->xa0  = g->xa;
+    g->_xa0 = NULL;
+    g->xa0_diff = g->xa_diff;
+    g->_xa0_diff = NULL;
+  }
+  else {
+    BFT_MALLOC(g->_xa0, n_faces, cs_real_t);
+    for (face_id = 0; face_id < n_faces; face_id++)
+      g->_xa0[face_id] = 0.5 * (xa[face_id*2] + xa[face_id*2+1]);
+    g->xa0 = g->_xa0;
+  }
+
+  /* Compute multigrid-specific terms */
+
+  BFT_MALLOC(g->xa0ij, n_faces*3, cs_real_t);
+
+  const cs_real_t *restrict g_xa0 = g->xa0;
+  if (g->conv_diff)
+    g_xa0 = g->xa0_diff;
+
+# pragma omp parallel for private(ii, jj, kk) if(n_faces > CS_THR_MIN)
+  for (face_id = 0; face_id < n_faces; face_id++) {
+    ii = face_cell[face_id][0];
+    jj = face_cell[face_id][1];
+    for (kk = 0; kk < 3; kk++) {
+      g->xa0ij[face_id*3 + kk] =   g_xa0[face_id]
+                                 * (cell_cen[jj*3 + kk] - cell_cen[ii*3 + kk]);
+    }
+  }
+
+  g->matrix_struct = NULL;
+  g->matrix = a;
+  g->_matrix = NULL;
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a grid structure.
+ *
+ * parameters:
+ *   grid <-> Pointer to grid structure pointer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_destroy(cs_grid_t **grid)
+{
+  if (grid != NULL && *grid != NULL) {
+
+    cs_grid_t *g = *grid;
+
+    BFT_FREE(g->_face_cell);
 
     BFT_FREE(g->coarse_cell);
     BFT_FREE(g->coarse_face);
 
+    BFT_FREE(g->prolong_index);
+    BFT_FREE(g->prolong_col);
+    BFT_FREE(g->prolong_val);
+
+    BFT_FREE(g->direct_lu);
+    BFT_FREE(g->direct_piv);
+    BFT_FREE(g->direct_count);
+    BFT_FREE(g->direct_displ);
+
     if (g->_cell_cen != NULL)
       BFT_FREE(g->_cell_cen);
     if (g->_cell_vol != NULL)
@@ -4241,6 +5142,12 @@ cs_grid_get_comm(const cs_grid_t  *g)
  *                              2: algebraic with Hilbert face traversal
  *   aggregation_limit    <-- Maximum allowed fine cells per coarse cell
  *   relaxation_parameter <-- P0/P1 relaxation factor
+ *   prolong_type         <-- Prolongation type:
+ *                              0: piecewise constant (P0/P1 coarse matrix);
+ *                              1: smoothed aggregation (Galerkin coarse
+ *                                 matrix, scalar matrices without
+ *                                 convection/diffusion splitting only)
+ *   prolong_relax        <-- Smoothed prolongation Jacobi relaxation factor
  *
  * returns:
  *   coarse grid structure
@@ -4251,11 +5158,22 @@ cs_grid_coarsen(const cs_grid_t   *f,
                 int                verbosity,
                 int                coarsening_type,
                 int                aggregation_limit,
-                double             relaxation_parameter)
+                double             relaxation_parameter,
+                int                prolong_type,
+                double             prolong_relax)
 {
   cs_lnum_t isym = 2;
   bool conv_diff = f->conv_diff;
 
+  /* Smoothed aggregation is only handled for scalar matrices,
+     otherwise fall back to piecewise constant prolongation */
+
+  bool smoothed = false;
+  if (   prolong_type == 1
+      && conv_diff == false
+      && f->diag_block_size[0] == 1)
+    smoothed = true;
+
   /* By default, always use MSR structure, as it often seems to provide the
      best performance, and is required for the hybrid Gauss-Seidel-Jacobi
      smoothers. In multithreaded case, we also prefer to use a matrix
@@ -4291,6 +5209,12 @@ cs_grid_coarsen(const cs_grid_t   *f,
 
   _coarsen(f, c);
 
+  /* Replace coarse connectivity and compute coarse matrix coefficients
+     in the smoothed aggregation case */
+
+  if (smoothed)
+    _smoothed_aggregation(f, c, prolong_relax);
+
   /* Allocate permanent arrays in coarse grid */
 
   BFT_MALLOC(c->_cell_cen, c->n_cells_ext*3, cs_real_t);
@@ -4302,8 +5226,10 @@ cs_grid_coarsen(const cs_grid_t   *f,
   BFT_MALLOC(c->_face_normal, c->n_faces*3, cs_real_t);
   c->face_normal = c->_face_normal;
 
-  BFT_MALLOC(c->_da, c->n_cells_ext * c->diag_block_size[3], cs_real_t);
-  c->da = c->_da;
+  if (c->_da == NULL) {
+    BFT_MALLOC(c->_da, c->n_cells_ext * c->diag_block_size[3], cs_real_t);
+    c->da = c->_da;
+  }
 
   if (conv_diff) {
     BFT_MALLOC(c->_da_conv, c->n_cells_ext * c->diag_block_size[3], cs_real_t);
@@ -4312,8 +5238,10 @@ cs_grid_coarsen(const cs_grid_t   *f,
     c->da_diff = c->_da_diff;
   }
 
-  BFT_MALLOC(c->_xa, c->n_faces*isym, cs_real_t);
-  c->xa = c->_xa;
+  if (c->_xa == NULL) {
+    BFT_MALLOC(c->_xa, c->n_faces*isym*c->extra_diag_block_size[3], cs_real_t);
+    c->xa = c->_xa;
+  }
 
   if (conv_diff) {
     BFT_MALLOC(c->_xa_conv, c->n_faces*2, cs_real_t);
@@ -4353,6 +5281,10 @@ cs_grid_coarsen(const cs_grid_t   *f,
 
   if (conv_diff)
     _compute_coarse_quantities_conv_diff(f, c, relaxation_parameter, verbosity);
+  else if (f->extra_diag_block_size[0] > 1)
+    _compute_coarse_quantities_block(f, c);
+  else if (smoothed)
+    _compute_coarse_quantities_galerkin(c);
   else
     _compute_coarse_quantities(f, c, relaxation_parameter, verbosity);
 
@@ -4471,6 +5403,113 @@ cs_grid_coarsen(const cs_grid_t   *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Indicate if a coarse grid's matrix coefficients may be updated from
+ * its parent grid's, keeping the coarsening unchanged.
+ *
+ * This is not possible for grids built using smoothed aggregation (whose
+ * connectivity depends on coefficients), or for grids merged over ranks
+ * (for which the pre-merge data is not kept).
+ *
+ * parameters:
+ *   c <-- Coarse grid structure
+ *
+ * returns:
+ *   true if cs_grid_update_from_parent may be used to update coefficients
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_coarse_values_updatable(const cs_grid_t  *c)
+{
+  bool retval = true;
+
+  assert(c != NULL);
+
+  if (c->parent == NULL || c->prolong_index != NULL)
+    retval = false;
+
+#if defined(HAVE_MPI)
+  if (c->merge_sub_size != 1)
+    retval = false;
+#endif
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a coarse grid after its parent grid was rebuilt.
+ *
+ * The coarsening (fine -> coarse mappings, coarse connectivity and halo)
+ * is kept. The parent pointer is always updated; if update_coeffs is
+ * true, coarse geometric quantities and matrix coefficients are also
+ * recomputed from the parent grid, which must have the same structure
+ * as the one from which the coarse grid was built.
+ *
+ * parameters:
+ *   f                    <-- Fine grid structure
+ *   c                    <-> Coarse grid structure
+ *   update_coeffs        <-- Recompute coarse matrix coefficients if true
+ *   relaxation_parameter <-- P0/P1 relaxation factor
+ *   verbosity            <-- Verbosity level
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_from_parent(const cs_grid_t  *f,
+                           cs_grid_t        *c,
+                           bool              update_coeffs,
+                           double            relaxation_parameter,
+                           int               verbosity)
+{
+  assert(f != NULL && c != NULL);
+  assert(f->level + 1 == c->level);
+
+  c->parent = f;
+
+  if (update_coeffs == false)
+    return;
+
+  assert(cs_grid_coarse_values_updatable(c));
+
+  /* Geometric quantities (may change with mesh displacement) */
+
+  _compute_coarse_cell_quantities(f, c);
+
+  if (c->halo != NULL) {
+
+    cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_cell_cen, 3);
+    if (c->halo->n_transforms > 0)
+      cs_halo_perio_sync_coords(c->halo, CS_HALO_STANDARD, c->_cell_cen);
+
+    cs_halo_sync_var(c->halo, CS_HALO_STANDARD, c->_cell_vol);
+
+  }
+
+  /* Matrix coefficients */
+
+  if (f->conv_diff)
+    _compute_coarse_quantities_conv_diff(f, c, relaxation_parameter, verbosity);
+  else if (f->extra_diag_block_size[0] > 1)
+    _compute_coarse_quantities_block(f, c);
+  else
+    _compute_coarse_quantities(f, c, relaxation_parameter, verbosity);
+
+  if (c->halo != NULL)
+    cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_da,
+                             c->diag_block_size[3]);
+
+  cs_matrix_set_coefficients(c->_matrix,
+                             c->symmetric,
+                             c->diag_block_size,
+                             c->extra_diag_block_size,
+                             c->n_faces,
+                             c->face_cell,
+                             c->da,
+                             c->xa);
+
+  if (verbosity > 3)
+    _verify_matrix(c);
+}
+
 /*----------------------------------------------------------------------------
  * Compute coarse cell variable values from fine cell values
  *
@@ -4511,9 +5550,27 @@ cs_grid_restrict_cell_var(const cs_grid_t  *f,
     for (i = 0; i < db_size[0]; i++)
       c_var[ii*db_size[1]+i] = 0.;
 
-  for (ii = 0; ii < f_n_cells; ii++)
-    for (i = 0; i < db_size[0]; i++)
-      c_var[(coarse_cell[ii]-1)*db_size[1]+i] += f_var[ii*db_size[1]+i];
+  if (c->prolong_index != NULL) {
+
+    /* Smoothed aggregation: restriction is the transposed prolongation */
+
+    const cs_lnum_t *p_index = c->prolong_index;
+    const cs_lnum_t *p_col = c->prolong_col;
+    const cs_real_t *p_val = c->prolong_val;
+
+    for (ii = 0; ii < f_n_cells; ii++) {
+      for (cs_lnum_t k = p_index[ii]; k < p_index[ii+1]; k++) {
+        for (i = 0; i < db_size[0]; i++)
+          c_var[p_col[k]*db_size[1]+i] += p_val[k]*f_var[ii*db_size[1]+i];
+      }
+    }
+
+  }
+  else {
+    for (ii = 0; ii < f_n_cells; ii++)
+      for (i = 0; i < db_size[0]; i++)
+        c_var[(coarse_cell[ii]-1)*db_size[1]+i] += f_var[ii*db_size[1]+i];
+  }
 
 #if defined(HAVE_MPI)
 
@@ -4653,10 +5710,347 @@ cs_grid_prolong_cell_var(const cs_grid_t  *c,
 
   coarse_cell = c->coarse_cell;
 
-# pragma omp parallel for private(i) if(f_n_cells > CS_THR_MIN)
-  for (ii = 0; ii < f_n_cells; ii++)
-    for (i = 0; i < db_size[0]; i++)
-      f_var[ii*db_size[1]+i] = _c_var[(coarse_cell[ii]-1)*db_size[1]+i];
+  if (c->prolong_index != NULL) {
+
+    const cs_lnum_t *p_index = c->prolong_index;
+    const cs_lnum_t *p_col = c->prolong_col;
+    const cs_real_t *p_val = c->prolong_val;
+
+#   pragma omp parallel for private(i) if(f_n_cells > CS_THR_MIN)
+    for (ii = 0; ii < f_n_cells; ii++) {
+      for (i = 0; i < db_size[0]; i++)
+        f_var[ii*db_size[1]+i] = 0.;
+      for (cs_lnum_t k = p_index[ii]; k < p_index[ii+1]; k++) {
+        for (i = 0; i < db_size[0]; i++)
+          f_var[ii*db_size[1]+i] += p_val[k]*_c_var[p_col[k]*db_size[1]+i];
+      }
+    }
+
+  }
+  else {
+#   pragma omp parallel for private(i) if(f_n_cells > CS_THR_MIN)
+    for (ii = 0; ii < f_n_cells; ii++)
+      for (i = 0; i < db_size[0]; i++)
+        f_var[ii*db_size[1]+i] = _c_var[(coarse_cell[ii]-1)*db_size[1]+i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set up a direct solver for a grid.
+ *
+ * The grid's matrix is gathered on the first rank of the grid's
+ * communicator, expanded to a dense matrix, and its LU factorization is
+ * kept with the grid, so it may be reused for all following solves
+ * (calling this function again recomputes the factorization, for example
+ * when matrix coefficients have been updated).
+ *
+ * This is intended for the coarsest level of a multigrid hierarchy, and
+ * is not done if the global number of rows is larger than the given
+ * maximum.
+ *
+ * parameters:
+ *   g            <-> Grid structure
+ *   n_g_rows_max <-- Maximum global number of rows (cells * block size)
+ *   verbosity    <-- Verbosity level
+ *
+ * returns:
+ *   true if the direct solver is set up, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_setup_direct_solve(cs_grid_t  *g,
+                           cs_gnum_t   n_g_rows_max,
+                           int         verbosity)
+{
+  assert(g != NULL);
+
+  const cs_lnum_t *db_size = g->diag_block_size;
+  const cs_lnum_t *eb_size = g->extra_diag_block_size;
+  const cs_lnum_t n_cells = g->n_cells;
+  const cs_lnum_t n_faces = g->n_faces;
+  const cs_gnum_t n_g_rows = g->n_g_cells * db_size[0];
+  const int isym = (g->symmetric == true) ? 1 : 2;
+
+  const cs_lnum_t eb_n = (eb_size[0] > 1) ? eb_size[0]*eb_size[0] : db_size[0];
+
+  BFT_FREE(g->direct_lu);
+  BFT_FREE(g->direct_piv);
+  BFT_FREE(g->direct_count);
+  BFT_FREE(g->direct_displ);
+
+  g->direct_solve = false;
+  g->n_direct_rows = 0;
+
+  if (n_g_rows > n_g_rows_max)
+    return false;
+
+  g->direct_solve = true;
+
+  int n_ranks = 1, rank_id = 0;
+
+#if defined(HAVE_MPI)
+  MPI_Comm comm = MPI_COMM_NULL;
+  if (cs_glob_n_ranks > 1) {
+    comm = cs_grid_get_comm(g);
+    if (comm == MPI_COMM_NULL) /* Rank inactive on this grid */
+      return true;
+    MPI_Comm_size(comm, &n_ranks);
+    MPI_Comm_rank(comm, &rank_id);
+  }
+#endif
+
+  /* Global row ids of local and ghost cells (cells numbered by rank) */
+
+  cs_gnum_t *g_cell_id = NULL;
+  BFT_MALLOC(g_cell_id, g->n_cells_ext, cs_gnum_t);
+
+  cs_gnum_t g_id_shift = 0;
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1) {
+    cs_gnum_t _n_cells = n_cells;
+    MPI_Scan(&_n_cells, &g_id_shift, 1, CS_MPI_GNUM, MPI_SUM, comm);
+    g_id_shift -= _n_cells;
+  }
+#endif
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+    g_cell_id[ii] = g_id_shift + ii;
+
+  if (g->halo != NULL)
+    cs_halo_sync_untyped(g->halo, CS_HALO_STANDARD, sizeof(cs_gnum_t),
+                         g_cell_id);
+
+  /* Local matrix entries (only rows of local cells are handled) */
+
+  cs_lnum_t n_entries = 0;
+  cs_gnum_t *e_ids = NULL;
+  cs_real_t *e_val = NULL;
+
+  BFT_MALLOC(e_ids, (n_cells*db_size[0]*db_size[0] + 2*n_faces*eb_n)*2,
+             cs_gnum_t);
+  BFT_MALLOC(e_val, n_cells*db_size[0]*db_size[0] + 2*n_faces*eb_n,
+             cs_real_t);
+
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+      for (cs_lnum_t ll = 0; ll < db_size[0]; ll++) {
+        e_ids[n_entries*2]     = g_cell_id[ii]*db_size[0] + kk;
+        e_ids[n_entries*2 + 1] = g_cell_id[ii]*db_size[0] + ll;
+        e_val[n_entries] = g->da[ii*db_size[3] + kk*db_size[2] + ll];
+        n_entries++;
+      }
+    }
+  }
+
+  for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
+    cs_lnum_t c_id[2] = {g->face_cell[face_id][0], g->face_cell[face_id][1]};
+    const cs_real_t *x_b[2];
+    x_b[0] = g->xa + face_id*isym*eb_size[3];
+    x_b[1] = x_b[0] + (isym-1)*eb_size[3];
+    for (int side = 0; side < 2; side++) {
+      cs_lnum_t ii = c_id[side], jj = c_id[1-side];
+      if (ii >= n_cells)
+        continue;
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+        for (cs_lnum_t ll = 0; ll < db_size[0]; ll++) {
+          cs_real_t v;
+          if (eb_size[0] > 1)
+            v = x_b[side][kk*eb_size[2] + ll];
+          else if (kk == ll)
+            v = x_b[side][0];
+          else
+            continue;
+          e_ids[n_entries*2]     = g_cell_id[ii]*db_size[0] + kk;
+          e_ids[n_entries*2 + 1] = g_cell_id[jj]*db_size[0] + ll;
+          e_val[n_entries] = v;
+          n_entries++;
+        }
+      }
+    }
+  }
+
+  BFT_FREE(g_cell_id);
+
+  /* Gather entries on root rank */
+
+  if (rank_id == 0) {
+    BFT_MALLOC(g->direct_count, n_ranks, int);
+    BFT_MALLOC(g->direct_displ, n_ranks, int);
+    g->direct_count[0] = n_cells*db_size[0];
+    g->direct_displ[0] = 0;
+  }
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    int *e_count = NULL, *e_displ = NULL;
+    int n_rows = n_cells*db_size[0];
+    int _n_entries = n_entries;
+    cs_lnum_t n_g_entries = n_entries;
+
+    MPI_Gather(&n_rows, 1, MPI_INT, g->direct_count, 1, MPI_INT, 0, comm);
+
+    if (rank_id == 0) {
+      BFT_MALLOC(e_count, n_ranks, int);
+      BFT_MALLOC(e_displ, n_ranks, int);
+    }
+
+    MPI_Gather(&_n_entries, 1, MPI_INT, e_count, 1, MPI_INT, 0, comm);
+
+    cs_gnum_t *g_e_ids = NULL;
+    cs_real_t *g_e_val = NULL;
+
+    if (rank_id == 0) {
+      g->direct_displ[0] = 0;
+      e_displ[0] = 0;
+      for (int i = 1; i < n_ranks; i++) {
+        g->direct_displ[i] = g->direct_displ[i-1] + g->direct_count[i-1];
+        e_displ[i] = e_displ[i-1] + e_count[i-1];
+      }
+      n_g_entries = e_displ[n_ranks-1] + e_count[n_ranks-1];
+      BFT_MALLOC(g_e_val, n_g_entries, cs_real_t);
+    }
+
+    MPI_Gatherv(e_val, n_entries, CS_MPI_REAL,
+                g_e_val, e_count, e_displ, CS_MPI_REAL, 0, comm);
+
+    if (rank_id == 0) {
+      for (int i = 0; i < n_ranks; i++) {
+        e_count[i] *= 2;
+        e_displ[i] *= 2;
+      }
+      BFT_MALLOC(g_e_ids, n_g_entries*2, cs_gnum_t);
+    }
+
+    MPI_Gatherv(e_ids, n_entries*2, CS_MPI_GNUM,
+                g_e_ids, e_count, e_displ, CS_MPI_GNUM, 0, comm);
+
+    BFT_FREE(e_count);
+    BFT_FREE(e_displ);
+
+    BFT_FREE(e_ids);
+    BFT_FREE(e_val);
+
+    e_ids = g_e_ids;
+    e_val = g_e_val;
+    n_entries = n_g_entries;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Build and factor dense matrix on root rank */
+
+  if (rank_id == 0) {
+
+    const cs_lnum_t n = n_g_rows;
+    cs_real_t *a = NULL;
+
+    BFT_MALLOC(a, (size_t)n*n, cs_real_t);
+    BFT_MALLOC(g->direct_piv, n, cs_lnum_t);
+
+#   pragma omp parallel for if(n*n > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n*n; ii++)
+      a[ii] = 0.;
+
+    for (cs_lnum_t e_id = 0; e_id < n_entries; e_id++)
+      a[e_ids[e_id*2]*n + e_ids[e_id*2+1]] += e_val[e_id];
+
+    cs_lnum_t n_null_pivots = _dense_lu_factor(n, a, g->direct_piv);
+
+    if (verbosity > 1)
+      bft_printf(_("   direct solver for level %d grid: %ld rows "
+                   "(%ld null pivots)\n"),
+                 g->level, (long)n, (long)n_null_pivots);
+
+    g->direct_lu = a;
+    g->n_direct_rows = n;
+
+  }
+
+  BFT_FREE(e_ids);
+  BFT_FREE(e_val);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a linear system using a grid's direct solver.
+ *
+ * The right-hand side is gathered on the root rank, the system solved
+ * using the LU factors computed by cs_grid_setup_direct_solve, and the
+ * solution scattered back to the ranks.
+ *
+ * parameters:
+ *   g   <-- Grid structure
+ *   rhs <-- Right-hand side
+ *   vx  --> System solution
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_direct_solve(const cs_grid_t  *g,
+                     const cs_real_t  *rhs,
+                     cs_real_t        *vx)
+{
+  assert(g != NULL && g->direct_solve);
+
+  const cs_lnum_t *db_size = g->diag_block_size;
+  const cs_lnum_t n_rows = g->n_cells*db_size[0];
+
+  cs_real_t *x = NULL;
+
+  BFT_MALLOC(x, CS_MAX(n_rows, g->n_direct_rows), cs_real_t);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < g->n_cells; ii++) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+      x[ii*db_size[0] + kk] = rhs[ii*db_size[1] + kk];
+  }
+
+#if defined(HAVE_MPI)
+
+  MPI_Comm comm = MPI_COMM_NULL;
+  if (cs_glob_n_ranks > 1)
+    comm = cs_grid_get_comm(g);
+
+  if (comm != MPI_COMM_NULL) {
+
+    cs_real_t *g_x = NULL;
+    if (g->direct_lu != NULL)
+      BFT_MALLOC(g_x, g->n_direct_rows, cs_real_t);
+
+    MPI_Gatherv(x, n_rows, CS_MPI_REAL,
+                g_x, g->direct_count, g->direct_displ, CS_MPI_REAL,
+                0, comm);
+
+    if (g->direct_lu != NULL)
+      _dense_lu_solve(g->n_direct_rows, g->direct_lu, g->direct_piv, g_x);
+
+    MPI_Scatterv(g_x, g->direct_count, g->direct_displ, CS_MPI_REAL,
+                 x, n_rows, CS_MPI_REAL, 0, comm);
+
+    BFT_FREE(g_x);
+
+  }
+  else if (g->direct_lu != NULL)
+    _dense_lu_solve(g->n_direct_rows, g->direct_lu, g->direct_piv, x);
+
+#else
+
+  if (g->direct_lu != NULL)
+    _dense_lu_solve(g->n_direct_rows, g->direct_lu, g->direct_piv, x);
+
+#endif /* defined(HAVE_MPI) */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < g->n_cells; ii++) {
+    for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+      vx[ii*db_size[1] + kk] = x[ii*db_size[0] + kk];
+  }
+
+  BFT_FREE(x);
 }
 
 /*----------------------------------------------------------------------------
@@ -61,6 +61,10 @@ typedef struct _cs_grid_t cs_grid_t;
 
 extern const char *cs_grid_coarsening_type_name[];
 
+/* Names for prolongation options */
+
+extern const char *cs_grid_prolong_type_name[];
+
 /*============================================================================
  * Semi-private function prototypes
  *
@@ -247,6 +251,12 @@ cs_grid_get_comm(const cs_grid_t  *g);
  *                              2: algebraic with Hilbert face traversal
  *   aggregation_limit    <-- Maximum allowed fine cells per coarse cell
  *   relaxation_parameter <-- P0/P1 relaxation factor
+ *   prolong_type         <-- Prolongation type:
+ *                              0: piecewise constant (P0/P1 coarse matrix);
+ *                              1: smoothed aggregation (Galerkin coarse
+ *                                 matrix, scalar matrices without
+ *                                 convection/diffusion splitting only)
+ *   prolong_relax        <-- Smoothed prolongation Jacobi relaxation factor
  *
  * returns:
  *   coarse grid structure
@@ -257,7 +267,49 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 int               verbosity,
                 int               coarsening_type,
                 int               aggregation_limit,
-                double            relaxation_parameter);
+                double            relaxation_parameter,
+                int               prolong_type,
+                double            prolong_relax);
+
+/*----------------------------------------------------------------------------
+ * Indicate if a coarse grid's matrix coefficients may be updated from
+ * its parent grid's, keeping the coarsening unchanged.
+ *
+ * This is not possible for grids built using smoothed aggregation, or for
+ * grids merged over ranks.
+ *
+ * parameters:
+ *   c <-- Coarse grid structure
+ *
+ * returns:
+ *   true if cs_grid_update_from_parent may be used to update coefficients
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_coarse_values_updatable(const cs_grid_t  *c);
+
+/*----------------------------------------------------------------------------
+ * Update a coarse grid after its parent grid was rebuilt.
+ *
+ * The coarsening (fine -> coarse mappings, coarse connectivity and halo)
+ * is kept. The parent pointer is always updated; if update_coeffs is
+ * true, coarse geometric quantities and matrix coefficients are also
+ * recomputed from the parent grid.
+ *
+ * parameters:
+ *   f                    <-- Fine grid structure
+ *   c                    <-> Coarse grid structure
+ *   update_coeffs        <-- Recompute coarse matrix coefficients if true
+ *   relaxation_parameter <-- P0/P1 relaxation factor
+ *   verbosity            <-- Verbosity level
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_update_from_parent(const cs_grid_t  *f,
+                           cs_grid_t        *c,
+                           bool              update_coeffs,
+                           double            relaxation_parameter,
+                           int               verbosity);
 
 /*----------------------------------------------------------------------------
  * Compute coarse cell variable values from fine cell values
@@ -310,6 +362,42 @@ cs_grid_prolong_cell_var(const cs_grid_t  *c,
                          cs_real_t        *c_var,
                          cs_real_t        *f_var);
 
+/*----------------------------------------------------------------------------
+ * Set up a direct solver for a grid.
+ *
+ * The grid's matrix is gathered on the first rank of the grid's
+ * communicator, expanded to a dense matrix, and its LU factorization is
+ * kept with the grid, so it may be reused for all following solves
+ * (calling this function again recomputes the factorization).
+ *
+ * parameters:
+ *   g            <-> Grid structure
+ *   n_g_rows_max <-- Maximum global number of rows (cells * block size)
+ *   verbosity    <-- Verbosity level
+ *
+ * returns:
+ *   true if the direct solver is set up, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_setup_direct_solve(cs_grid_t  *g,
+                           cs_gnum_t   n_g_rows_max,
+                           int         verbosity);
+
+/*----------------------------------------------------------------------------
+ * Solve a linear system using a grid's direct solver.
+ *
+ * parameters:
+ *   g   <-- Grid structure
+ *   rhs <-- Right-hand side
+ *   vx  --> System solution
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_direct_solve(const cs_grid_t  *g,
+                     const cs_real_t  *rhs,
+                     cs_real_t        *vx);
+
 /*----------------------------------------------------------------------------
  * Project coarse grid cell numbers to base grid.
  *
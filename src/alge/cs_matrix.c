@@ -1667,6 +1667,178 @@ _mat_vec_p_l_native_vector(bool                exclude_diag,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create an empty row coloring structure.
+ *
+ * returns:
+ *   pointer to allocated row coloring structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_row_coloring_t *
+_create_row_coloring(void)
+{
+  cs_matrix_row_coloring_t  *rc;
+
+  BFT_MALLOC(rc, 1, cs_matrix_row_coloring_t);
+
+  rc->n_colors = 0;
+  rc->color_index = NULL;
+  rc->color_rows = NULL;
+
+  return rc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a row coloring structure.
+ *
+ * parameters:
+ *   rc  <->  pointer to row coloring structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_row_coloring(cs_matrix_row_coloring_t  **rc)
+{
+  if (rc != NULL && *rc != NULL) {
+
+    BFT_FREE((*rc)->color_index);
+    BFT_FREE((*rc)->color_rows);
+
+    BFT_FREE(*rc);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build a row coloring for a CSR matrix structure.
+ *
+ * A greedy (first fit) distance-1 coloring of the symmetrized graph is
+ * used, in row order, so that no two rows of a same color are coupled by
+ * a local extra-diagonal term. Ghost columns are ignored, as their values
+ * are not updated locally. The resulting coloring is thus independent
+ * of the number of threads.
+ *
+ * parameters:
+ *   ms  <-- pointer to CSR matrix structure
+ *   rc  <-> pointer to row coloring structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_row_coloring(const cs_matrix_struct_csr_t  *ms,
+                    cs_matrix_row_coloring_t      *rc)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  int n_colors = 0, n_colors_max = 8;
+  int *row_color, *color_mark;
+  cs_lnum_t *color_count;
+
+  /* Build adjacency to lower-numbered rows, in both directions,
+     so that non-symmetric structures are handled */
+
+  cs_lnum_t *l_index, *l_ids;
+  BFT_MALLOC(l_index, n_rows + 1, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows + 1; ii++)
+    l_index[ii] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++) {
+      cs_lnum_t col_id = ms->col_id[jj];
+      if (col_id < ii)
+        l_index[ii+1] += 1;
+      else if (col_id > ii && col_id < n_rows)
+        l_index[col_id+1] += 1;
+    }
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    l_index[ii+1] += l_index[ii];
+
+  BFT_MALLOC(l_ids, l_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(color_count, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    color_count[ii] = l_index[ii];
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (cs_lnum_t jj = ms->row_index[ii]; jj < ms->row_index[ii+1]; jj++) {
+      cs_lnum_t col_id = ms->col_id[jj];
+      if (col_id < ii)
+        l_ids[color_count[ii]++] = col_id;
+      else if (col_id > ii && col_id < n_rows)
+        l_ids[color_count[col_id]++] = ii;
+    }
+  }
+
+  BFT_FREE(color_count);
+
+  /* Greedy coloring */
+
+  BFT_MALLOC(row_color, n_rows, int);
+  BFT_MALLOC(color_mark, n_colors_max, int);
+  BFT_MALLOC(color_count, n_colors_max, cs_lnum_t);
+
+  for (int c_id = 0; c_id < n_colors_max; c_id++) {
+    color_mark[c_id] = -1;
+    color_count[c_id] = 0;
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    /* Mark colors of already colored neighbors (rows with lower id) */
+
+    for (cs_lnum_t jj = l_index[ii]; jj < l_index[ii+1]; jj++)
+      color_mark[row_color[l_ids[jj]]] = ii;
+
+    int c_id = 0;
+    while (c_id < n_colors && color_mark[c_id] == ii)
+      c_id++;
+
+    if (c_id == n_colors) {
+      if (n_colors == n_colors_max) {
+        n_colors_max *= 2;
+        BFT_REALLOC(color_mark, n_colors_max, int);
+        BFT_REALLOC(color_count, n_colors_max, cs_lnum_t);
+        for (int k = n_colors; k < n_colors_max; k++) {
+          color_mark[k] = -1;
+          color_count[k] = 0;
+        }
+      }
+      n_colors++;
+    }
+
+    row_color[ii] = c_id;
+    color_count[c_id] += 1;
+
+  }
+
+  BFT_FREE(color_mark);
+  BFT_FREE(l_ids);
+  BFT_FREE(l_index);
+
+  /* Build index and list of rows by color */
+
+  BFT_REALLOC(rc->color_index, n_colors + 1, cs_lnum_t);
+  BFT_REALLOC(rc->color_rows, n_rows, cs_lnum_t);
+
+  rc->color_index[0] = 0;
+  for (int c_id = 0; c_id < n_colors; c_id++) {
+    rc->color_index[c_id+1] = rc->color_index[c_id] + color_count[c_id];
+    color_count[c_id] = rc->color_index[c_id];
+  }
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    int c_id = row_color[ii];
+    rc->color_rows[color_count[c_id]] = ii;
+    color_count[c_id] += 1;
+  }
+
+  rc->n_colors = n_colors;
+
+  BFT_FREE(color_count);
+  BFT_FREE(row_color);
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a CSR matrix structure.
  *
@@ -1685,6 +1857,8 @@ _destroy_struct_csr(cs_matrix_struct_csr_t  **matrix)
 
     BFT_FREE(ms->_col_id);
 
+    _destroy_row_coloring(&(ms->coloring));
+
     BFT_FREE(ms);
 
     *matrix = NULL;
@@ -1843,6 +2017,8 @@ _create_struct_csr(bool                have_diag,
   ms->row_index = ms->_row_index;
   ms->col_id = ms->_col_id;
 
+  ms->coloring = _create_row_coloring();
+
   return ms;
 }
 
@@ -1911,6 +2087,8 @@ _create_struct_csr_from_csr(bool         have_diag,
 
   }
 
+  ms->coloring = _create_row_coloring();
+
   return ms;
 }
 
@@ -1956,6 +2134,8 @@ _create_struct_csr_from_shared(bool              have_diag,
   ms->_row_index = NULL;
   ms->_col_id = NULL;
 
+  ms->coloring = _create_row_coloring();
+
   return ms;
 }
 
@@ -3272,6 +3452,76 @@ _zero_x_coeffs_msr(cs_matrix_t  *matrix)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Set MSR extradiagonal block matrix coefficients.
+ *
+ * Each extradiagonal coefficient is a dense block of size eb_size[3].
+ * For incremental assembly, the matrix coefficients should have been
+ * initialized (i.e. set to 0) some before using this function.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   increment   <-- add to existing values if true, assign otherwise
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_b_coeffs_msr(cs_matrix_t        *matrix,
+                     bool                symmetric,
+                     bool                increment,
+                     cs_lnum_t           n_edges,
+                     const cs_lnum_2_t  *edges,
+                     const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+  const cs_lnum_t  b_stride = eb_size[3];
+  const cs_lnum_t  xa_stride = (symmetric) ? 1 : 2;
+
+  for (cs_lnum_t face_id = 0; face_id < n_edges; face_id++) {
+
+    cs_lnum_t ii = edges[face_id][0];
+    cs_lnum_t jj = edges[face_id][1];
+
+    const cs_real_t *restrict b_ij = xa + face_id*xa_stride*b_stride;
+    const cs_real_t *restrict b_ji = b_ij + (xa_stride - 1)*b_stride;
+
+    if (ii < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[ii]; ms->col_id[kk] != jj; kk++);
+      cs_real_t *restrict m_b = mc->_x_val + kk*b_stride;
+      if (increment) {
+        for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+          m_b[ll] += b_ij[ll];
+      }
+      else {
+        for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+          m_b[ll] = b_ij[ll];
+      }
+    }
+
+    if (jj < ms->n_rows) {
+      cs_lnum_t kk;
+      for (kk = ms->row_index[jj]; ms->col_id[kk] != ii; kk++);
+      cs_real_t *restrict m_b = mc->_x_val + kk*b_stride;
+      if (increment) {
+        for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+          m_b[ll] += b_ji[ll];
+      }
+      else {
+        for (cs_lnum_t ll = 0; ll < b_stride; ll++)
+          m_b[ll] = b_ji[ll];
+      }
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Set MSR extradiagonal matrix coefficients for the case where direct
  * assignment is possible (i.e. when there are no multiple contributions
@@ -3301,6 +3551,11 @@ _set_xa_coeffs_msr_direct(cs_matrix_t        *matrix,
 
   assert(edges != NULL);
 
+  if (matrix->eb_size[0] > 1) {
+    _set_xa_b_coeffs_msr(matrix, symmetric, false, n_edges, edges, xa);
+    return;
+  }
+
   if (symmetric == false) {
 
     const cs_lnum_t *restrict edges_p
@@ -3376,6 +3631,11 @@ _set_xa_coeffs_msr_increment(cs_matrix_t        *matrix,
 
   assert(edges != NULL);
 
+  if (matrix->eb_size[0] > 1) {
+    _set_xa_b_coeffs_msr(matrix, symmetric, true, n_edges, edges, xa);
+    return;
+  }
+
   if (symmetric == false) {
 
     const cs_lnum_t *restrict edges_p
@@ -3492,7 +3752,7 @@ _map_or_copy_xa_coeffs_msr(cs_matrix_t      *matrix,
 
     /* Ensure allocation */
     if (mc->_x_val == NULL || mc->max_eb_size < eb_size[3]) {
-      BFT_REALLOC(mc->_d_val,
+      BFT_REALLOC(mc->_x_val,
                   eb_size[3]*ms->row_index[ms->n_rows],
                   cs_real_t);
       mc->max_eb_size = eb_size[3];
@@ -3573,8 +3833,12 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   /* Extradiagonal values */
 
-  if (mc->_x_val == NULL)
-    BFT_MALLOC(mc->_x_val, ms->row_index[ms->n_rows], cs_real_t);
+  if (mc->_x_val == NULL || mc->max_eb_size < matrix->eb_size[3]) {
+    BFT_REALLOC(mc->_x_val,
+                matrix->eb_size[3]*ms->row_index[ms->n_rows],
+                cs_real_t);
+    mc->max_eb_size = matrix->eb_size[3];
+  }
   mc->x_val = mc->_x_val;
 
   /* Copy extra-diagonal values if assembly is direct */
@@ -4428,6 +4692,73 @@ _b_mat_vec_p_l_msr(bool                exclude_diag,
     _b_mat_vec_p_l_msr_generic(exclude_diag, matrix, x, y);
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using blocks for
+ * both diagonal and extradiagonal terms.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_msr(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t     x[restrict],
+                    cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t *db_size = matrix->db_size;
+  const cs_lnum_t *eb_size = matrix->eb_size;
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_lnum_t  s_id = ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      _dense_b_ax(ii, db_size, mc->d_val, x, y);
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        _dense_eb_ax_add(ii, col_id[jj], s_id + jj, eb_size,
+                         mc->x_val, x, y);
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const cs_lnum_t  s_id = ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[ii*db_size[1] + kk] = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        _dense_eb_ax_add(ii, col_id[jj], s_id + jj, eb_size,
+                         mc->x_val, x, y);
+
+    }
+  }
+
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with MSR matrix, using MKL
  *
@@ -4912,7 +5243,7 @@ _variant_add(const char                        *name,
  *     standard
  *     mkl             (with MKL)
  *
- *   CS_MATRIX_MSR     (all fill types except CS_MATRIX_33_BLOCK)
+ *   CS_MATRIX_MSR     (all fill types)
  *     standard
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
@@ -5127,6 +5458,10 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[0] = _b_mat_vec_p_l_msr;
         spmv[1] = _b_mat_vec_p_l_msr;
         break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_msr;
+        spmv[1] = _bb_mat_vec_p_l_msr;
+        break;
       default:
         break;
       }
@@ -7013,6 +7348,46 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get a row coloring for a matrix in CSR or MSR format.
+ *
+ * Rows of a same color are not coupled by local extra-diagonal terms,
+ * so that they may be updated concurrently by multicolor algorithms
+ * (such as thread-parallel Gauss-Seidel).
+ *
+ * The coloring is built on first query and stored with the matrix
+ * structure, so it is shared by all matrices using that structure.
+ * For other matrix types, the number of colors returned is 0.
+ *
+ * \param[in]   matrix       pointer to matrix structure
+ * \param[out]  n_colors     number of colors
+ * \param[out]  color_index  index of rows by color (size: n_colors + 1)
+ * \param[out]  color_rows   row ids, grouped by color
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_row_coloring(const cs_matrix_t   *matrix,
+                           int                 *n_colors,
+                           const cs_lnum_t    **color_index,
+                           const cs_lnum_t    **color_rows)
+{
+  *n_colors = 0;
+  *color_index = NULL;
+  *color_rows = NULL;
+
+  if (matrix->type == CS_MATRIX_CSR || matrix->type == CS_MATRIX_MSR) {
+    const cs_matrix_struct_csr_t  *ms = matrix->structure;
+    cs_matrix_row_coloring_t  *rc = ms->coloring;
+    if (rc->n_colors == 0 && ms->n_rows > 0)
+      _build_row_coloring(ms, rc);
+    *n_colors = rc->n_colors;
+    *color_index = rc->color_index;
+    *color_rows = rc->color_rows;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -7123,6 +7498,107 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Multiple matrix.vector products y_k = A_k.x_k
+ *
+ * Vectors are interleaved, so that value j of vector k is stored at
+ * index j*n_vecs + k. Either a single matrix is used for all vectors
+ * (n_matrices = 1), or one matrix is given per vector
+ * (n_matrices = n_vecs), in which case all matrices must share the
+ * same structure. The structure is then traversed only once for all
+ * products, and a single halo update is done for all vectors.
+ *
+ * This function includes a halo update of x prior to multiplication.
+ *
+ * Only scalar MSR matrices are handled currently.
+ *
+ * \param[in]       n_vecs      number of interleaved vectors
+ * \param[in]       n_matrices  number of matrices (1 or n_vecs)
+ * \param[in]       matrices    pointers to matrix structures
+ * \param[in, out]  x           multipliying vector values
+ *                              (ghost values updated)
+ * \param[out]      y           resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(int                        n_vecs,
+                                int                        n_matrices,
+                                const cs_matrix_t  *const  matrices[],
+                                cs_real_t                 *restrict x,
+                                cs_real_t                 *restrict y)
+{
+  assert(n_matrices == 1 || n_matrices == n_vecs);
+
+  const cs_matrix_t *m0 = matrices[0];
+
+  for (int m_id = 0; m_id < n_matrices; m_id++) {
+    const cs_matrix_t *m = matrices[m_id];
+    if (m->type != CS_MATRIX_MSR || m->db_size[0] != 1 || m->eb_size[0] != 1)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         _("%s: only scalar matrices in %s format are handled."),
+         __func__, _(cs_matrix_type_name[CS_MATRIX_MSR]));
+    if (m->structure != m0->structure)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         _("%s: matrices do not share the same structure."), __func__);
+  }
+
+  const cs_matrix_struct_csr_t *ms = m0->structure;
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  if (m0->halo != NULL)
+    cs_halo_sync_var_strided(m0->halo, CS_HALO_STANDARD, x, n_vecs);
+
+  const cs_real_t **d_val, **x_val;
+  BFT_MALLOC(d_val, n_matrices, const cs_real_t *);
+  BFT_MALLOC(x_val, n_matrices, const cs_real_t *);
+
+  for (int m_id = 0; m_id < n_matrices; m_id++) {
+    const cs_matrix_coeff_msr_t *mc = matrices[m_id]->coeffs;
+    d_val[m_id] = mc->d_val;
+    x_val[m_id] = mc->x_val;
+  }
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t s_id = ms->row_index[ii];
+    const cs_lnum_t n_cols = ms->row_index[ii+1] - s_id;
+    const cs_lnum_t *restrict col_id = ms->col_id + s_id;
+
+    const cs_real_t *restrict _x = x + ii*n_vecs;
+    cs_real_t *restrict _y = y + ii*n_vecs;
+
+    if (n_matrices == 1) {
+      const cs_real_t *restrict m_row = x_val[0] + s_id;
+      const cs_real_t d = (d_val[0] != NULL) ? d_val[0][ii] : 0.;
+      for (int kk = 0; kk < n_vecs; kk++)
+        _y[kk] = d * _x[kk];
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _xc = x + col_id[jj]*n_vecs;
+        for (int kk = 0; kk < n_vecs; kk++)
+          _y[kk] += m_row[jj] * _xc[kk];
+      }
+    }
+    else {
+      for (int kk = 0; kk < n_vecs; kk++)
+        _y[kk] = (d_val[kk] != NULL) ? d_val[kk][ii] * _x[kk] : 0.;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t *restrict _xc = x + col_id[jj]*n_vecs;
+        for (int kk = 0; kk < n_vecs; kk++)
+          _y[kk] += x_val[kk][s_id + jj] * _xc[kk];
+      }
+    }
+
+  }
+
+  BFT_FREE(x_val);
+  BFT_FREE(d_val);
+}
+
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -7458,7 +7934,7 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv)
  *     standard
  *     mkl             (with MKL)
  *
- *   CS_MATRIX_MSR     (all fill types except CS_MATRIX_33_BLOCK)
+ *   CS_MATRIX_MSR     (all fill types)
  *     standard
  *     fixed           (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
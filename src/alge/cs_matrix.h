@@ -771,6 +771,30 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------
+ * Get a row coloring for a matrix in CSR or MSR format.
+ *
+ * Rows of a same color are not coupled by local extra-diagonal terms,
+ * so that they may be updated concurrently by multicolor algorithms
+ * (such as thread-parallel Gauss-Seidel).
+ *
+ * The coloring is built on first query and stored with the matrix
+ * structure, so it is shared by all matrices using that structure.
+ * For other matrix types, the number of colors returned is 0.
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   n_colors    --> number of colors
+ *   color_index --> index of rows by color (size: n_colors + 1)
+ *   color_rows  --> row ids, grouped by color
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_row_coloring(const cs_matrix_t   *matrix,
+                           int                 *n_colors,
+                           const cs_lnum_t    **color_index,
+                           const cs_lnum_t    **color_rows);
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x
  *
@@ -826,6 +850,32 @@ cs_matrix_exdiag_vector_multiply(cs_halo_rotation_t   rotation_mode,
                                  cs_real_t           *restrict x,
                                  cs_real_t           *restrict y);
 
+/*----------------------------------------------------------------------------
+ * Multiple matrix.vector products y_k = A_k.x_k
+ *
+ * Vectors are interleaved, so that value j of vector k is stored at
+ * index j*n_vecs + k. Either a single matrix is used for all vectors
+ * (n_matrices = 1), or one matrix is given per vector
+ * (n_matrices = n_vecs), in which case all matrices must share the
+ * same structure.
+ *
+ * This function includes a halo update of x prior to multiplication.
+ *
+ * parameters:
+ *   n_vecs     <-- number of interleaved vectors
+ *   n_matrices <-- number of matrices (1 or n_vecs)
+ *   matrices   <-- pointers to matrix structures
+ *   x          <-> multipliying vector values (ghost values updated)
+ *   y          --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(int                        n_vecs,
+                                int                        n_matrices,
+                                const cs_matrix_t  *const  matrices[],
+                                cs_real_t                 *restrict x,
+                                cs_real_t                 *restrict y);
+
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -130,6 +130,20 @@ typedef struct _cs_matrix_coeff_native_t {
 
 } cs_matrix_coeff_native_t;
 
+/* Row coloring (for thread-parallel multicolor algorithms) */
+/*----------------------------------------------------------*/
+
+typedef struct _cs_matrix_row_coloring_t {
+
+  int               n_colors;         /* Number of colors (0 until built) */
+
+  cs_lnum_t        *color_index;      /* Index of rows by color
+                                         (size: n_colors + 1) */
+  cs_lnum_t        *color_rows;       /* Row ids, grouped by color
+                                         (size: n_rows) */
+
+} cs_matrix_row_coloring_t;
+
 /* CSR (Compressed Sparse Row) matrix structure representation */
 /*-------------------------------------------------------------*/
 
@@ -152,6 +166,8 @@ typedef struct _cs_matrix_struct_csr_t {
   cs_lnum_t        *_row_index;       /* Row index (0 to n-1), if owner */
   cs_lnum_t        *_col_id;          /* Column id (0 to n-1), if owner */
 
+  cs_matrix_row_coloring_t  *coloring;  /* Row coloring, built on demand */
+
 } cs_matrix_struct_csr_t;
 
 /* CSR matrix coefficients representation */
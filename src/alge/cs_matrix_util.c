@@ -635,6 +635,53 @@ _b_diag_dom_msr(const cs_matrix_t  *matrix,
   _b_diag_dom_diag_normalize(mc->d_val, dd, ms->n_rows, db_size);
 }
 
+/*----------------------------------------------------------------------------
+ * Measure Diagonal dominance of MSR block matrix.
+ *
+ * parameters:
+ *   matrix <-- Pointer to matrix structure
+ *   dd     --> Resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_diag_dom_msr(const cs_matrix_t  *matrix,
+                 cs_real_t          *restrict dd)
+{
+  cs_lnum_t  ii, jj, kk, ll, n_cols;
+  const cs_real_t  *restrict m_row;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const int *db_size = matrix->db_size;
+  const int *eb_size = matrix->eb_size;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  /* diagonal contribution */
+
+  _b_diag_dom_diag_contrib(mc->d_val, dd, ms->n_rows, ms->n_cols_ext, db_size);
+
+  /* extra-diagonal contribution */
+
+  if (mc->x_val != NULL) {
+
+#   pragma omp parallel for private(jj, kk, ll, m_row, n_cols)
+    for (ii = 0; ii < n_rows; ii++) {
+      m_row = mc->x_val + ms->row_index[ii]*eb_size[3];
+      n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      for (jj = 0; jj < n_cols; jj++) {
+        for (kk = 0; kk < eb_size[0]; kk++) {
+          for (ll = 0; ll < eb_size[0]; ll++)
+            dd[ii*db_size[1] + kk]
+              -= fabs(m_row[jj*eb_size[3] + kk*eb_size[2] + ll]);
+        }
+      }
+    }
+
+  }
+
+  _b_diag_dom_diag_normalize(mc->d_val, dd, ms->n_rows, db_size);
+}
+
 /*----------------------------------------------------------------------------
  * Diagonal contribution to matrix dump.
  *
@@ -1931,8 +1978,10 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
   case CS_MATRIX_MSR:
     if (matrix->db_size[3] == 1)
       _diag_dom_msr(matrix, dd);
-    else
+    else if (matrix->eb_size[3] == 1)
       _b_diag_dom_msr(matrix, dd);
+    else
+      _bb_diag_dom_msr(matrix, dd);
     break;
     break;
   default:
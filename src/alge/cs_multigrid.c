@@ -214,6 +214,22 @@ typedef struct _cs_multigrid_setup_data_t {
   cs_real_t    **rhs_vx;                /* Coarse grid "right hand sides"
                                            and corrections */
 
+  bool           coarse_direct;         /* Use direct solver for coarsest
+                                           level */
+
+  /* Hierarchy reuse state */
+
+  bool           kept;                  /* true if coarse levels were kept
+                                           by last free for reuse (base
+                                           grid and solvers are freed) */
+  bool           conv_diff;             /* true if built with convection
+                                           and diffusion matrices */
+  int            n_reuse;               /* Number of reuses since build */
+  cs_gnum_t      n_g_cells_0;           /* Base grid global cells */
+  unsigned       n_cycles_ref;          /* Cycles of first solve after
+                                           build (0 if unknown) */
+  unsigned       n_cycles_last;         /* Cycles of last solve */
+
   /* Options used only when used as a preconditioner */
 
   char          *pc_name;               /* name of preconditioning system */
@@ -248,6 +264,28 @@ struct _cs_multigrid_t {
 
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
 
+  int        prolong_type;       /* Prolongation type:
+                                    0: piecewise constant;
+                                    1: smoothed aggregation */
+  double     prolong_relax;      /* Smoothed prolongation Jacobi
+                                    relaxation parameter */
+
+  cs_gnum_t  coarse_direct_max;  /* If > 0, maximum global number of rows
+                                    for which the coarsest level is
+                                    gathered on a single rank and solved
+                                    with a direct solver */
+
+  int        reuse_type;         /* Hierarchy reuse between setups:
+                                    0: none (rebuild at each setup);
+                                    1: keep coarsening, update coarse
+                                       matrix coefficients;
+                                    2: keep whole coarse hierarchy */
+  int        reuse_n_max;        /* Maximum number of successive reuses
+                                    (< 1 for no limit) */
+  double     reuse_cycle_ratio;  /* Rebuild if cycles of last solve exceed
+                                    this ratio times those of the first
+                                    solve after rebuild (< 1 to ignore) */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -400,6 +438,29 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_cells_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  cs_log_printf(CS_LOG_SETUP,
+                _("  Prolongation type:                 %s\n"),
+                _(cs_grid_prolong_type_name[mg->prolong_type]));
+  if (mg->prolong_type == 1)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    Jacobi relaxation parameter:     %g\n"),
+                  mg->prolong_relax);
+  if (mg->coarse_direct_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsest level direct solve up to: %llu rows\n"),
+                  (unsigned long long)(mg->coarse_direct_max));
+  if (mg->reuse_type > 0) {
+    const char *reuse_name[] = {N_("none"),
+                                N_("update coarse coefficients"),
+                                N_("keep coarse matrices")};
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Hierarchy reuse:                   %s\n"
+                    "    Maximum successive reuses:       %d\n"
+                    "    Rebuild cycles ratio:            %g\n"),
+                  _(reuse_name[mg->reuse_type]),
+                  mg->reuse_n_max, mg->reuse_cycle_ratio);
+  }
+
   const char *stage_name[] = {"Descent smoother",
                               "Ascent smoother",
                               "Coarsest level solver"};
@@ -672,6 +733,15 @@ _multigrid_setup_data_create(void)
   mgd->rhs_vx_buf = NULL;
   mgd->rhs_vx = NULL;
 
+  mgd->coarse_direct = false;
+
+  mgd->kept = false;
+  mgd->conv_diff = false;
+  mgd->n_reuse = 0;
+  mgd->n_g_cells_0 = 0;
+  mgd->n_cycles_ref = 0;
+  mgd->n_cycles_last = 0;
+
   mgd->pc_name = NULL;
   mgd->pc_aux = NULL;
   mgd->pc_verbosity = 0;
@@ -1137,6 +1207,14 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
     cs_sles_it_setup(mgd->sles_hierarchy[i*2], "", m, verbosity - 2);
     mgd->sles_hierarchy[i*2+1] = NULL;
 
+    /* Optional direct solver (factorization kept until free) */
+
+    if (mg->coarse_direct_max > 0)
+      mgd->coarse_direct
+        = cs_grid_setup_direct_solve(mgd->grid_hierarchy[i],
+                                     mg->coarse_direct_max,
+                                     verbosity);
+
     /* Diagonal block size is the same for all levels */
 
     const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(m);
@@ -1182,6 +1260,230 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Free multigrid setup data.
+ *
+ * If coarse levels are kept (for reuse by the next setup), only the base
+ * grid (which shares the matrix coefficients), the solver contexts and
+ * the work arrays are freed.
+ *
+ * parameters:
+ *   mg          <-> pointer to multigrid structure
+ *   keep_coarse <-- if true, keep coarse grids for reuse
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_setup_data_free(cs_multigrid_t  *mg,
+                           bool             keep_coarse)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  if (mgd == NULL)
+    return;
+
+  /* Free coarse solution data */
+
+  BFT_FREE(mgd->rhs_vx);
+  BFT_FREE(mgd->rhs_vx_buf);
+
+  /* Destroy solver hierarchy */
+
+  for (int i = mgd->n_levels - 1; i > -1; i--) {
+    for (int j = 0; j < 2; j++) {
+      if (mgd->sles_hierarchy[i*2+j] != NULL) {
+        void *sles_it = mgd->sles_hierarchy[i*2 + j];
+        cs_sles_it_destroy(&sles_it);
+        mgd->sles_hierarchy[i*2 + j] = NULL;
+      }
+    }
+  }
+
+  /* Destroy peconditioning-only arrays */
+
+  BFT_FREE(mgd->pc_name);
+  BFT_FREE(mgd->pc_aux);
+
+  mgd->coarse_direct = false;
+
+  if (keep_coarse) {
+    cs_grid_destroy(mgd->grid_hierarchy);
+    mgd->kept = true;
+    return;
+  }
+
+  BFT_FREE(mgd->sles_hierarchy);
+
+  /* Destroy grid hierarchy */
+
+  for (int i = mgd->n_levels - 1; i > -1; i--)
+    cs_grid_destroy(mgd->grid_hierarchy + i);
+  BFT_FREE(mgd->grid_hierarchy);
+
+  BFT_FREE(mg->setup_data);
+}
+
+/*----------------------------------------------------------------------------
+ * Create base grid for a given matrix.
+ *
+ * parameters:
+ *   a      <-- associated matrix
+ *   a_conv <-- associated matrix (convection), or NULL
+ *   a_diff <-- associated matrix (diffusion), or NULL
+ *
+ * returns:
+ *   pointer to base grid
+ *----------------------------------------------------------------------------*/
+
+static cs_grid_t *
+_multigrid_base_grid(const cs_matrix_t  *a,
+                     const cs_matrix_t  *a_conv,
+                     const cs_matrix_t  *a_diff)
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
+
+  bool symmetric = cs_matrix_is_symmetric(a);
+  const int *diag_block_size = cs_matrix_get_diag_block_size(a);
+  const int *extra_diag_block_size = cs_matrix_get_extra_diag_block_size(a);
+
+  cs_grid_t *g
+    = cs_grid_create_from_shared(mesh->n_cells,
+                                 mesh->n_cells_with_ghosts,
+                                 mesh->n_i_faces,
+                                 symmetric,
+                                 diag_block_size,
+                                 extra_diag_block_size,
+                                 (const cs_lnum_2_t *)(mesh->i_face_cells),
+                                 mesh->halo,
+                                 mq->cell_cen,
+                                 mq->cell_vol,
+                                 mq->i_face_normal,
+                                 a,
+                                 a_conv,
+                                 a_diff);
+
+  return g;
+}
+
+/*----------------------------------------------------------------------------
+ * Try to reuse a grid hierarchy kept by the previous free operation.
+ *
+ * The hierarchy is not reused (and should be rebuilt) if the maximum
+ * number of successive reuses is reached, if convergence of the last
+ * solve degraded beyond the allowed ratio, if the matrix type or mesh
+ * size changed, or if coarse coefficients need to be updated but some
+ * levels do not allow it.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid structure
+ *   name      <-- name of linear system
+ *   a         <-- associated matrix
+ *   a_conv    <-- associated matrix (convection), or NULL
+ *   a_diff    <-- associated matrix (diffusion), or NULL
+ *   verbosity <-- verbosity level
+ *
+ * returns:
+ *   true if the hierarchy was reused, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_reuse_hierarchy(cs_multigrid_t     *mg,
+                           const char         *name,
+                           const cs_matrix_t  *a,
+                           const cs_matrix_t  *a_conv,
+                           const cs_matrix_t  *a_diff,
+                           int                 verbosity)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  if (mgd->kept == false || mg->reuse_type < 1)
+    return false;
+
+  /* Rebuild triggers */
+
+  bool rebuild = false;
+
+  if (mg->reuse_n_max > 0 && mgd->n_reuse >= mg->reuse_n_max)
+    rebuild = true;
+
+  if (   mg->reuse_cycle_ratio >= 1 && mgd->n_cycles_ref > 0
+      && mgd->n_cycles_last > mg->reuse_cycle_ratio*mgd->n_cycles_ref)
+    rebuild = true;
+
+  if (   cs_glob_mesh->n_g_cells != mgd->n_g_cells_0
+      || mgd->conv_diff != (a_conv != NULL || a_diff != NULL))
+    rebuild = true;
+
+  if (rebuild == false) {
+    bool symmetric;
+    cs_lnum_t db_size[4], eb_size[4];
+    cs_grid_get_info(mgd->grid_hierarchy[1], NULL, &symmetric,
+                     db_size, eb_size, NULL, NULL, NULL, NULL, NULL);
+    const int *a_db_size = cs_matrix_get_diag_block_size(a);
+    const int *a_eb_size = cs_matrix_get_extra_diag_block_size(a);
+    if (   symmetric != cs_matrix_is_symmetric(a)
+        || db_size[0] != a_db_size[0] || eb_size[0] != a_eb_size[0])
+      rebuild = true;
+  }
+
+  if (rebuild == false && mg->reuse_type == 1) {
+    int updatable = 1;
+    for (unsigned i = 1; i < mgd->n_levels; i++) {
+      if (cs_grid_coarse_values_updatable(mgd->grid_hierarchy[i]) == false)
+        updatable = 0;
+    }
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1) {
+      int _updatable = updatable;
+      MPI_Allreduce(&_updatable, &updatable, 1, MPI_INT, MPI_MIN,
+                    cs_glob_mpi_comm);
+    }
+#endif
+    if (updatable == 0)
+      rebuild = true;
+  }
+
+  if (rebuild)
+    return false;
+
+  /* Reuse hierarchy */
+
+  cs_timer_t t0 = cs_timer_time();
+
+  if (verbosity > 1)
+    bft_printf(_("\n Reuse of grid hierarchy for \"%s\" (%d)\n"),
+               name, mgd->n_reuse + 1);
+
+  mgd->grid_hierarchy[0] = _multigrid_base_grid(a, a_conv, a_diff);
+
+  for (unsigned i = 1; i < mgd->n_levels; i++) {
+
+    cs_timer_t t1 = cs_timer_time();
+
+    cs_grid_update_from_parent(mgd->grid_hierarchy[i-1],
+                               mgd->grid_hierarchy[i],
+                               (mg->reuse_type == 1) ? true : false,
+                               mg->p0p1_relax,
+                               verbosity);
+
+    cs_timer_t t2 = cs_timer_time();
+    cs_timer_counter_add_diff(&(mg->lv_info[i].t_tot[0]), &t1, &t2);
+
+  }
+
+  mgd->kept = false;
+  mgd->n_reuse += 1;
+
+  /* Setup solvers */
+
+  _multigrid_setup_sles_it(mg, name, verbosity);
+
+  cs_timer_t t3 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t3);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -1726,19 +2028,29 @@ _multigrid_cycle(cs_multigrid_t       *mg,
 
     t0 = cs_timer_time();
 
-    c_cvg = cs_sles_it_solve(mgd->sles_hierarchy[level*2],
-                             lv_names[level*2],
-                             _matrix,
-                             verbosity - 2,
-                             rotation_mode,
-                             precision*mg->info.precision_mult[2],
-                             r_norm_l,
-                             &n_iter,
-                             &_residue,
-                             rhs_lv,
-                             vx_lv,
-                             _aux_r_size*sizeof(cs_real_t),
-                             _aux_vectors);
+    if (mgd->coarse_direct) {
+
+      cs_grid_direct_solve(c, rhs_lv, vx_lv);
+
+      n_iter = 1;
+      _residue = 0.;
+      c_cvg = CS_SLES_CONVERGED;
+
+    }
+    else
+      c_cvg = cs_sles_it_solve(mgd->sles_hierarchy[level*2],
+                               lv_names[level*2],
+                               _matrix,
+                               verbosity - 2,
+                               rotation_mode,
+                               precision*mg->info.precision_mult[2],
+                               r_norm_l,
+                               &n_iter,
+                               &_residue,
+                               rhs_lv,
+                               vx_lv,
+                               _aux_r_size*sizeof(cs_real_t),
+                               _aux_vectors);
 
     t1 = cs_timer_time();
     cs_timer_counter_add_diff(&(lv_info->t_tot[1]), &t0, &t1);
@@ -1748,8 +2060,9 @@ _multigrid_cycle(cs_multigrid_t       *mg,
     if (mg->plot_time_stamp > -1)
       mg->plot_time_stamp += n_iter + 1;
 
-    _initial_residue
-      = cs_sles_it_get_last_initial_residue(mgd->sles_hierarchy[level*2]);
+    if (mgd->coarse_direct == false)
+      _initial_residue
+        = cs_sles_it_get_last_initial_residue(mgd->sles_hierarchy[level*2]);
 
     *n_equiv_iter += n_iter * n_g_cells * denom_n_g_cells_0;
 
@@ -2187,6 +2500,15 @@ cs_multigrid_create(void)
 
   mg->p0p1_relax = 0.95;
 
+  mg->prolong_type = 0;
+  mg->prolong_relax = 2./3.;
+
+  mg->coarse_direct_max = 0;
+
+  mg->reuse_type = 0;
+  mg->reuse_n_max = 10;
+  mg->reuse_cycle_ratio = 1.5;
+
   _multigrid_info_init(&(mg->info));
 
   mg->pc_precision = 0.0;
@@ -2230,6 +2552,10 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  /* Free hierarchy kept for reuse, if present */
+
+  _multigrid_setup_data_free(mg, false);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_cell_num != NULL) {
@@ -2362,6 +2688,128 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->p0p1_relax = p0p1_relax;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid prolongation parameters.
+ *
+ * With smoothed aggregation, the piecewise-constant prolongation defined
+ * by the aggregation is smoothed by one damped Jacobi step, and coarse
+ * matrices are built by a Galerkin product. This usually reduces the
+ * number of cycles for diffusion-dominated systems, at the cost of
+ * denser coarse matrices. It is only available for scalar matrices
+ * without separate convection and diffusion parts; other systems use
+ * piecewise-constant prolongation.
+ *
+ * \param[in, out]  mg             pointer to multigrid info and context
+ * \param[in]       prolong_type   prolongation type:
+ *                                  0: piecewise constant (P0/P1 coarse
+ *                                     matrix, default);
+ *                                  1: smoothed aggregation
+ * \param[in]       prolong_relax  Jacobi relaxation parameter for
+ *                                 smoothed aggregation (default: 2/3)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_prolongation_options(cs_multigrid_t  *mg,
+                                      int              prolong_type,
+                                      double           prolong_relax)
+{
+  if (mg == NULL)
+    return;
+
+  if (prolong_type < 0 || prolong_type > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid prolongation type (%d)."),
+              __func__, prolong_type);
+
+  mg->prolong_type = prolong_type;
+  mg->prolong_relax = prolong_relax;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsest level solver parameters.
+ *
+ * When the global number of rows (cells times diagonal block size) of
+ * the coarsest grid is at most \p direct_max_g_rows, its matrix is
+ * gathered on a single rank and factored once per hierarchy setup,
+ * and the coarsest level is solved by forward and backward substitution
+ * instead of the iterative coarse solver. This replaces a number of
+ * latency-bound iterations over all active ranks by one gather and one
+ * scatter per cycle.
+ *
+ * As the factorization uses a dense matrix, this should be combined
+ * with a moderate minimum number of coarse cells (see
+ * \ref cs_multigrid_set_coarsening_options), such as a few hundred
+ * to a few thousand cells.
+ *
+ * \param[in, out]  mg                 pointer to multigrid info and context
+ * \param[in]       direct_max_g_rows  maximum global number of rows for
+ *                                     a direct solve (0 to disable,
+ *                                     the default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_solve_options(cs_multigrid_t  *mg,
+                                      cs_gnum_t        direct_max_g_rows)
+{
+  if (mg == NULL)
+    return;
+
+  mg->coarse_direct_max = direct_max_g_rows;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid hierarchy reuse parameters.
+ *
+ * By default, the grid hierarchy is rebuilt at each setup (i.e. for each
+ * new matrix). When only matrix coefficients change between solves, as
+ * for the pressure equation on a fixed mesh, the hierarchy may be kept
+ * when setup data is freed, and reused by the next setup:
+ *
+ * - with \p reuse_type 1, the coarsening (aggregation, coarse
+ *   connectivity and halos) is kept and only coarse matrix coefficients
+ *   are recomputed; levels built with smoothed aggregation or merged over
+ *   ranks do not allow this, in which case the hierarchy is rebuilt;
+ * - with \p reuse_type 2, coarse matrices are also kept, so only the
+ *   finest level uses the new coefficients.
+ *
+ * The hierarchy is rebuilt after \p n_max_reuse successive reuses, or if
+ * the number of cycles of the last solve exceeds \p cycle_ratio times
+ * that of the first solve following the last rebuild.
+ *
+ * \param[in, out]  mg           pointer to multigrid info and context
+ * \param[in]       reuse_type   0: no reuse (default); 1: update coarse
+ *                               coefficients; 2: keep coarse matrices
+ * \param[in]       n_max_reuse  maximum number of successive reuses
+ *                               (< 1 for no limit; default: 10)
+ * \param[in]       cycle_ratio  rebuild trigger on cycles ratio
+ *                               (< 1 to ignore; default: 1.5)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              reuse_type,
+                               int              n_max_reuse,
+                               double           cycle_ratio)
+{
+  if (mg == NULL)
+    return;
+
+  if (reuse_type < 0 || reuse_type > 2)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid reuse type (%d)."),
+              __func__, reuse_type);
+
+  mg->reuse_type = reuse_type;
+  mg->reuse_n_max = n_max_reuse;
+  mg->reuse_cycle_ratio = cycle_ratio;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -2531,14 +2979,16 @@ cs_multigrid_setup_conv_diff(void               *context,
   cs_multigrid_level_info_t *mg_lv_info = NULL;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
-  const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
 
   cs_grid_t *g = NULL;
 
-  /* Destroy previous hierarchy if necessary */
+  /* Reuse or destroy previous hierarchy if necessary */
 
-  if (mg->setup_data != NULL)
-    cs_multigrid_free(mg);
+  if (mg->setup_data != NULL) {
+    if (_multigrid_reuse_hierarchy(mg, name, a, a_conv, a_diff, verbosity))
+      return;
+    _multigrid_setup_data_free(mg, false);
+  }
 
   /* Initialization */
 
@@ -2550,27 +3000,15 @@ cs_multigrid_setup_conv_diff(void               *context,
 
   mg->setup_data = _multigrid_setup_data_create();
 
+  mg->setup_data->conv_diff = (a_conv != NULL || a_diff != NULL);
+  mg->setup_data->n_g_cells_0 = mesh->n_g_cells;
+
   /* Build coarse grids hierarchy */
   /*------------------------------*/
 
   bool symmetric = cs_matrix_is_symmetric(a);
-  const int *diag_block_size = cs_matrix_get_diag_block_size(a);
-  const int *extra_diag_block_size = cs_matrix_get_extra_diag_block_size(a);
 
-  g = cs_grid_create_from_shared(mesh->n_cells,
-                                 mesh->n_cells_with_ghosts,
-                                 mesh->n_i_faces,
-                                 symmetric,
-                                 diag_block_size,
-                                 extra_diag_block_size,
-                                 (const cs_lnum_2_t *)(mesh->i_face_cells),
-                                 mesh->halo,
-                                 mq->cell_cen,
-                                 mq->cell_vol,
-                                 mq->i_face_normal,
-                                 a,
-                                 a_conv,
-                                 a_diff);
+  g = _multigrid_base_grid(a, a_conv, a_diff);
 
   _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
@@ -2607,7 +3045,9 @@ cs_multigrid_setup_conv_diff(void               *context,
                         verbosity,
                         mg->coarsening_type,
                         mg->aggregation_limit,
-                        mg->p0p1_relax);
+                        mg->p0p1_relax,
+                        mg->prolong_type,
+                        mg->prolong_relax);
 
     cs_grid_get_info(g,
                      &grid_lv,
@@ -2826,7 +3266,7 @@ cs_multigrid_solve(void                *context,
   *n_iter = 0;
   unsigned n_cycles = 0;
 
-  if (mg->setup_data == NULL) {
+  if (mg->setup_data == NULL || mg->setup_data->kept) {
     /* Stop solve timer to switch to setup timer */
     t1 = cs_timer_time();
     cs_timer_counter_add_diff(&(mg->info.t_tot[1]), &t0, &t1);
@@ -2908,6 +3348,12 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Update info used for hierarchy reuse */
+
+  mg->setup_data->n_cycles_last = n_cycles;
+  if (mg->setup_data->n_cycles_ref == 0)
+    mg->setup_data->n_cycles_ref = n_cycles;
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -2941,38 +3387,9 @@ cs_multigrid_free(void  *context)
   t0 = cs_timer_time();
 
   if (mg->setup_data != NULL) {
-
-    cs_multigrid_setup_data_t *mgd = mg->setup_data;
-
-    /* Free coarse solution data */
-
-    BFT_FREE(mgd->rhs_vx);
-    BFT_FREE(mgd->rhs_vx_buf);
-
-    /* Destroy solver hierarchy */
-
-    for (int i = mgd->n_levels - 1; i > -1; i--) {
-      for (int j = 0; j < 2; j++) {
-        if (mgd->sles_hierarchy[i*2+j] != NULL) {
-          void *sles_it = mgd->sles_hierarchy[i*2 + j];
-          cs_sles_it_destroy(&sles_it);
-        }
-      }
-    }
-    BFT_FREE(mgd->sles_hierarchy);
-
-    /* Destroy grid hierarchy */
-
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
-    BFT_FREE(mgd->grid_hierarchy);
-
-    /* Destroy peconditioning-only arrays */
-
-    BFT_FREE(mgd->pc_name);
-    BFT_FREE(mgd->pc_aux);
-
-    BFT_FREE(mg->setup_data);
+    bool keep_coarse = (   mg->reuse_type > 0
+                        && mg->setup_data->n_levels > 1) ? true : false;
+    _multigrid_setup_data_free(mg, keep_coarse);
   }
 
   /* Update timers */
@@ -3043,7 +3460,7 @@ cs_multigrid_error_post_and_abort(cs_sles_t                    *sles,
   const char *name = cs_sles_get_name(sles);
 
   cs_multigrid_setup_data_t *mgd = mg->setup_data;
-  if (mgd == NULL)
+  if (mgd == NULL || mgd->kept)
     return false;
 
   int level = mgd->exit_level;
@@ -181,6 +181,72 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
                                     double           p0p1_relax,
                                     int              postprocess_block_size);
 
+/*----------------------------------------------------------------------------
+ * Set multigrid prolongation parameters.
+ *
+ * Smoothed aggregation is only available for scalar matrices without
+ * separate convection and diffusion parts; other systems use
+ * piecewise-constant prolongation.
+ *
+ * parameters:
+ *   mg            <-> pointer to multigrid info and context
+ *   prolong_type  <-- prolongation type:
+ *                     0: piecewise constant (P0/P1 coarse matrix, default);
+ *                     1: smoothed aggregation (Galerkin coarse matrix)
+ *   prolong_relax <-- Jacobi relaxation parameter for smoothed
+ *                     aggregation (default: 2/3)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_prolongation_options(cs_multigrid_t  *mg,
+                                      int              prolong_type,
+                                      double           prolong_relax);
+
+/*----------------------------------------------------------------------------
+ * Set multigrid coarsest level solver parameters.
+ *
+ * When the global number of rows (cells times diagonal block size) of
+ * the coarsest grid is at most direct_max_g_rows, its matrix is gathered
+ * on a single rank and factored once per hierarchy setup, and the
+ * coarsest level is solved directly instead of iteratively.
+ *
+ * parameters:
+ *   mg                <-> pointer to multigrid info and context
+ *   direct_max_g_rows <-- maximum global number of rows for a direct
+ *                         solve (0 to disable, the default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_solve_options(cs_multigrid_t  *mg,
+                                      cs_gnum_t        direct_max_g_rows);
+
+/*----------------------------------------------------------------------------
+ * Set multigrid hierarchy reuse parameters.
+ *
+ * When only matrix coefficients change between solves, the grid hierarchy
+ * may be kept when setup data is freed, and reused by the next setup,
+ * either updating coarse matrix coefficients (reuse_type 1) or keeping
+ * coarse matrices unchanged (reuse_type 2). The hierarchy is rebuilt after
+ * n_max_reuse successive reuses, or if the number of cycles of the last
+ * solve exceeds cycle_ratio times that of the first solve following the
+ * last rebuild.
+ *
+ * parameters:
+ *   mg          <-> pointer to multigrid info and context
+ *   reuse_type  <-- 0: no reuse (default); 1: update coarse coefficients;
+ *                   2: keep coarse matrices
+ *   n_max_reuse <-- maximum number of successive reuses
+ *                   (< 1 for no limit; default: 10)
+ *   cycle_ratio <-- rebuild trigger on cycles ratio
+ *                   (< 1 to ignore; default: 1.5)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_reuse_options(cs_multigrid_t  *mg,
+                               int              reuse_type,
+                               int              n_max_reuse,
+                               double           cycle_ratio);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
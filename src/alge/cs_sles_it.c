@@ -146,6 +146,10 @@ BEGIN_C_DECLS
 
 #define DB_SIZE_MAX 8
 
+/* Block size for sums in an order independent of the number of threads */
+
+#define CS_SLES_IT_SUM_BLOCK_SIZE 256
+
 /* SIMD unit size to ensure SIMD alignement (2 to 8 required on most
  * current architectures, so 16 should be enough on most architectures) */
 
@@ -2261,6 +2265,50 @@ _fw_and_bw_lu_gs(const cs_real_t  mat[],
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Block Gauss-Seidel utilities.
+ * Subtract extradiagonal contributions of an MSR matrix row from a block.
+ *
+ * Extradiagonal terms may be scalar (applied to each component) or
+ * dense blocks coupling components, depending on eb_size.
+ *
+ * parameters:
+ *   n_cols  <-- number of extradiagonal terms in row
+ *   col_id  <-- column ids for row
+ *   m_row   <-- extradiagonal values for row
+ *   db_size <-- diagonal block sizes
+ *   eb_size <-- extradiagonal block sizes
+ *   x       <-- vector values
+ *   y       <-> block values, from which contributions are subtracted
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_b_msr_row_sub(cs_lnum_t                 n_cols,
+               const cs_lnum_t *restrict col_id,
+               const cs_real_t *restrict m_row,
+               const int                 db_size[4],
+               const int                 eb_size[4],
+               const cs_real_t *restrict x,
+               cs_real_t        y[restrict])
+{
+  if (eb_size[0] == 1) {
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+        y[kk] -= (m_row[jj]*x[col_id[jj]*db_size[1] + kk]);
+    }
+  }
+  else {
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict m_b = m_row + jj*eb_size[3];
+      const cs_real_t *restrict _x = x + col_id[jj]*db_size[1];
+      for (cs_lnum_t kk = 0; kk < eb_size[0]; kk++) {
+        for (cs_lnum_t ll = 0; ll < eb_size[0]; ll++)
+          y[kk] -= m_b[kk*eb_size[2] + ll]*_x[ll];
+      }
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using block Jacobi.
  *
@@ -3428,6 +3476,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *a_d_val, *a_x_val;
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   const cs_lnum_t  *order = c->add_data->order;
@@ -3487,7 +3536,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
         cs_lnum_t ii = order[ll];
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii]*eb_size[3];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3497,10 +3546,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
           vx0[kk] = rhs[ii*db_size[1] + kk];
         }
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-            vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
-        }
+        _b_msr_row_sub(n_cols, col_id, m_row, db_size, eb_size, vx, vx0);
 
         _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
                          db_size[0],
@@ -3587,6 +3633,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *a_d_val, *a_x_val;
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   cvg = CS_SLES_ITERATING;
@@ -3639,7 +3686,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii]*eb_size[3];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3649,10 +3696,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
           vx0[kk] = rhs[ii*db_size[1] + kk];
         }
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-            vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
-        }
+        _b_msr_row_sub(n_cols, col_id, m_row, db_size, eb_size, vx, vx0);
 
         _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
                          db_size[0],
@@ -3750,6 +3794,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *a_d_val, *a_x_val;
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   cvg = CS_SLES_ITERATING;
@@ -3793,7 +3838,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii]*eb_size[3];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3801,10 +3846,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
         for (cs_lnum_t kk = 0; kk < diag_block_size; kk++)
           vx0[kk] = rhs[ii*db_size[1] + kk];
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-          for (cs_lnum_t kk = 0; kk < diag_block_size; kk++)
-            vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
-        }
+        _b_msr_row_sub(n_cols, col_id, m_row, db_size, eb_size, vx, vx0);
 
         _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
                          db_size[0],
@@ -3859,7 +3901,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii]*eb_size[3];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3869,10 +3911,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
           vx0[kk] = rhs[ii*db_size[1] + kk];
         }
 
-        for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
-          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
-            vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
-        }
+        _b_msr_row_sub(n_cols, col_id, m_row, db_size, eb_size, vx, vx0);
 
         _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
                          db_size[0],
@@ -3924,6 +3963,360 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether the multicolor Gauss-Seidel variant should be used.
+ *
+ * This is the case when running with multiple threads, as rows of a
+ * same color may then be updated concurrently, with results independent
+ * of the number of threads.
+ *
+ * parameters:
+ *   a <-- linear equation matrix
+ *
+ * returns:
+ *   true if the multicolor variant should be used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_use_colored_gauss_seidel(const cs_matrix_t  *a)
+{
+  bool retval = false;
+
+  if (   cs_glob_n_threads > 1 && !_thread_debug
+      && cs_matrix_get_n_rows(a) > CS_THR_MIN)
+    retval = true;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Multicolor Gauss-Seidel sweep with MSR matrix.
+ *
+ * Colors are handled in increasing order for a forward sweep, and
+ * in decreasing order for a backward sweep. Rows of a same color are
+ * independent, so they are distributed among threads.
+ *
+ * The contribution of each row to the residue is stored separately,
+ * so that it may be summed in an order independent of the number
+ * of threads.
+ *
+ * parameters:
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   ad_inv          <-- inverse of diagonal (or of diagonal blocks)
+ *   ad              <-- diagonal
+ *   n_colors        <-- number of colors
+ *   color_index     <-- index of rows by color
+ *   color_rows      <-- row ids, grouped by color
+ *   forward         <-- true for forward sweep, false for backward sweep
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   row_res2        --> square of residue (weighted by diagonal) of
+ *                       previous iterate, per row
+ *----------------------------------------------------------------------------*/
+
+static void
+_p_gauss_seidel_msr_color_sweep(const cs_matrix_t  *a,
+                                int                 diag_block_size,
+                                const cs_real_t    *restrict ad_inv,
+                                const cs_real_t    *restrict ad,
+                                int                 n_colors,
+                                const cs_lnum_t    *color_index,
+                                const cs_lnum_t    *color_rows,
+                                bool                forward,
+                                const cs_real_t    *rhs,
+                                cs_real_t          *restrict vx,
+                                cs_real_t          *restrict row_res2)
+{
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  const int *eb_size = cs_matrix_get_extra_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  if (diag_block_size == 1) {
+
+#   pragma omp parallel
+    {
+      for (int cc = 0; cc < n_colors; cc++) {
+
+        const int c_id = (forward) ? cc : n_colors - 1 - cc;
+
+#       pragma omp for
+        for (cs_lnum_t ll = color_index[c_id];
+             ll < color_index[c_id+1];
+             ll++) {
+
+          cs_lnum_t ii = color_rows[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vxm1 = vx[ii];
+          cs_real_t vx0 = rhs[ii];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+          vx0 *= ad_inv[ii];
+
+          register double r = ad[ii] * (vx0-vxm1);
+          row_res2[ii] = (r*r);
+
+          vx[ii] = vx0;
+        }
+
+      }
+    }
+
+  }
+  else {
+
+#   pragma omp parallel
+    {
+      for (int cc = 0; cc < n_colors; cc++) {
+
+        const int c_id = (forward) ? cc : n_colors - 1 - cc;
+
+#       pragma omp for
+        for (cs_lnum_t ll = color_index[c_id];
+             ll < color_index[c_id+1];
+             ll++) {
+
+          cs_lnum_t ii = color_rows[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row
+            = a_x_val + a_row_index[ii]*eb_size[3];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            vxm1[kk] = vx[ii*db_size[1] + kk];
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+          }
+
+          _b_msr_row_sub(n_cols, col_id, m_row, db_size, eb_size, vx, vx0);
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          double rr = 0;
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            register double r = ad[ii*db_size[1] + kk] * (_vx[kk]-vxm1[kk]);
+            rr += (r*r);
+            vx[ii*db_size[1] + kk] = _vx[kk];
+          }
+          row_res2[ii] = rr;
+        }
+
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Sum array values in an order independent of the number of threads.
+ *
+ * Values are summed by blocks of fixed size, and block sums are then
+ * added in increasing block order.
+ *
+ * parameters:
+ *   n          <-- number of values
+ *   x          <-- values
+ *   block_sum  --- work array (size: n / CS_SLES_IT_SUM_BLOCK_SIZE + 1)
+ *
+ * returns:
+ *   sum of values
+ *----------------------------------------------------------------------------*/
+
+static double
+_fixed_order_sum(cs_lnum_t           n,
+                 const cs_real_t    *restrict x,
+                 double             *restrict block_sum)
+{
+  const cs_lnum_t n_blocks
+    = (n + CS_SLES_IT_SUM_BLOCK_SIZE - 1) / CS_SLES_IT_SUM_BLOCK_SIZE;
+
+# pragma omp parallel for if(n > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_lnum_t s_id = b_id*CS_SLES_IT_SUM_BLOCK_SIZE;
+    cs_lnum_t e_id = CS_MIN(s_id + CS_SLES_IT_SUM_BLOCK_SIZE, n);
+    double s = 0.;
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++)
+      s += x[ii];
+    block_sum[b_id] = s;
+  }
+
+  double sum = 0.;
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++)
+    sum += block_sum[b_id];
+
+  return sum;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using thread-parallel multicolor Gauss-Seidel.
+ *
+ * Rows are visited color by color, using the row coloring associated
+ * with the matrix structure, and the residue is summed in a fixed order,
+ * so the result does not depend on the number of threads. In the
+ * symmetric case, a forward sweep is followed by a backward sweep
+ * (colors in reverse order).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   symmetric       <-- use symmetric (forward and backward) sweeps
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_colored_gauss_seidel_msr(cs_sles_it_t              *c,
+                            const cs_matrix_t         *a,
+                            int                        diag_block_size,
+                            cs_halo_rotation_t         rotation_mode,
+                            bool                       symmetric,
+                            cs_sles_it_convergence_t  *convergence,
+                            const cs_real_t           *rhs,
+                            cs_real_t                 *restrict vx)
+{
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+
+  /* Check matrix storage type */
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Multicolor Gauss-Seidel solver only supported with a\n"
+         "matrix using %s (%s) storage."),
+       cs_matrix_type_name[CS_MATRIX_MSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_MSR]));
+
+  unsigned n_iter = 0;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  int n_colors;
+  const cs_lnum_t  *color_index, *color_rows;
+
+  cs_matrix_get_row_coloring(a, &n_colors, &color_index, &color_rows);
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  cs_real_t *row_res2;
+  double *block_sum;
+  BFT_MALLOC(row_res2, n_rows, cs_real_t);
+  BFT_MALLOC(block_sum, n_rows/CS_SLES_IT_SUM_BLOCK_SIZE + 1, double);
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residue: forward step */
+
+    _p_gauss_seidel_msr_color_sweep(a,
+                                    diag_block_size,
+                                    ad_inv,
+                                    ad,
+                                    n_colors,
+                                    color_index,
+                                    color_rows,
+                                    true,
+                                    rhs,
+                                    vx,
+                                    row_res2);
+
+    /* Backward step for symmetric variant */
+
+    if (symmetric) {
+
+      if (halo != NULL)
+        cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+      _p_gauss_seidel_msr_color_sweep(a,
+                                      diag_block_size,
+                                      ad_inv,
+                                      ad,
+                                      n_colors,
+                                      color_index,
+                                      color_rows,
+                                      false,
+                                      rhs,
+                                      vx,
+                                      row_res2);
+
+    }
+
+    if (   symmetric == false
+        || convergence->precision > 0. || c->plot != NULL) {
+
+      res2 = _fixed_order_sum(n_rows, row_res2, block_sum);
+
+#if defined(HAVE_MPI)
+
+      if (c->comm != MPI_COMM_NULL) {
+        double _sum;
+        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM,
+                      c->comm);
+        res2 = _sum;
+      }
+
+#endif /* defined(HAVE_MPI) */
+
+      residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+      /* Convergence test */
+
+      if (n_iter == 1)
+        c->setup_data->initial_residue = residue;
+
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    }
+    else if (n_iter >= convergence->n_iterations_max) {
+      convergence->n_iterations = n_iter;
+      cvg = CS_SLES_MAX_ITERATION;
+    }
+
+  }
+
+  BFT_FREE(block_sum);
+  BFT_FREE(row_res2);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel.
  *
@@ -3984,6 +4377,16 @@ _p_gauss_seidel(cs_sles_it_t              *c,
                                       rhs,
                                       vx);
 
+  else if (_use_colored_gauss_seidel(a))
+    cvg = _p_colored_gauss_seidel_msr(c,
+                                      a,
+                                      diag_block_size,
+                                      rotation_mode,
+                                      false,
+                                      convergence,
+                                      rhs,
+                                      vx);
+
   else
     cvg = _p_gauss_seidel_msr(c,
                               a,
@@ -4082,6 +4485,267 @@ _fallback(cs_sles_it_t                    *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute dot products x_k.x_k of interleaved vectors, summing results
+ * over all ranks with a single reduction.
+ *
+ * As in _fixed_order_sum, values are summed by blocks of fixed size,
+ * and block sums are then added in increasing block order, so results
+ * do not depend on the number of threads.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   n_rows <-- number of rows
+ *   n_vecs <-- number of interleaved vectors
+ *   x      <-- interleaved vectors
+ *   s      --> resulting dot products (size: n_vecs)
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_xx_multi(const cs_sles_it_t  *c,
+              cs_lnum_t            n_rows,
+              int                  n_vecs,
+              const cs_real_t     *x,
+              double               s[])
+{
+  const cs_lnum_t n_blocks
+    = (n_rows + CS_SLES_IT_SUM_BLOCK_SIZE - 1) / CS_SLES_IT_SUM_BLOCK_SIZE;
+
+  double *block_sum;
+  BFT_MALLOC(block_sum, n_blocks*n_vecs, double);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    cs_lnum_t s_id = b_id*CS_SLES_IT_SUM_BLOCK_SIZE;
+    cs_lnum_t e_id = CS_MIN(s_id + CS_SLES_IT_SUM_BLOCK_SIZE, n_rows);
+    double *restrict _s = block_sum + b_id*n_vecs;
+    for (int kk = 0; kk < n_vecs; kk++)
+      _s[kk] = 0.;
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      const cs_real_t *restrict _x = x + ii*n_vecs;
+      for (int kk = 0; kk < n_vecs; kk++)
+        _s[kk] += _x[kk]*_x[kk];
+    }
+  }
+
+  for (int kk = 0; kk < n_vecs; kk++)
+    s[kk] = 0.;
+
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+    for (int kk = 0; kk < n_vecs; kk++)
+      s[kk] += block_sum[b_id*n_vecs + kk];
+  }
+
+  BFT_FREE(block_sum);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    double *_sum;
+    BFT_MALLOC(_sum, n_vecs, double);
+    MPI_Allreduce(s, _sum, n_vecs, MPI_DOUBLE, MPI_SUM, c->comm);
+    for (int kk = 0; kk < n_vecs; kk++)
+      s[kk] = _sum[kk];
+    BFT_FREE(_sum);
+  }
+
+#else
+
+  CS_UNUSED(c);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Jacobi iteration for several interleaved systems.
+ *
+ * On exit, w contains the residual of each system prior to the update.
+ *
+ * parameters:
+ *   n_vecs     <-- number of interleaved vectors
+ *   n_matrices <-- number of matrices (1 or n_vecs)
+ *   a          <-- linear equation matrices
+ *   ad_inv     <-- interleaved inverse of diagonals
+ *   rhs        <-- interleaved right hand sides
+ *   vx         <-> interleaved system solutions
+ *   w          --- interleaved work array
+ *----------------------------------------------------------------------------*/
+
+static void
+_jacobi_multi(int                        n_vecs,
+              int                        n_matrices,
+              const cs_matrix_t  *const  a[],
+              const cs_real_t           *restrict ad_inv,
+              const cs_real_t           *restrict rhs,
+              cs_real_t                 *restrict vx,
+              cs_real_t                 *restrict w)
+{
+  const cs_lnum_t n = cs_matrix_get_n_rows(a[0]) * n_vecs;
+
+  cs_matrix_vector_multiply_multi(n_vecs, n_matrices, a, vx, w);
+
+# pragma omp parallel for if(n > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    w[ii] = rhs[ii] - w[ii];
+    vx[ii] += ad_inv[ii] * w[ii];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Gauss-Seidel update of a given row for several interleaved systems
+ * sharing the same MSR structure.
+ *
+ * parameters:
+ *   ii         <-- row id
+ *   n_vecs     <-- number of interleaved vectors
+ *   n_matrices <-- number of matrices (1 or n_vecs)
+ *   row_index  <-- MSR row index
+ *   col_id     <-- MSR column ids
+ *   d_val      <-- diagonal values for each matrix
+ *   x_val      <-- extra-diagonal values for each matrix
+ *   ad_inv     <-- interleaved inverse of diagonals
+ *   rhs        <-- interleaved right hand sides
+ *   vx         <-> interleaved system solutions
+ *   w          --> interleaved residuals
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_p_gauss_seidel_msr_multi_row(cs_lnum_t                 ii,
+                              int                       n_vecs,
+                              int                       n_matrices,
+                              const cs_lnum_t          *row_index,
+                              const cs_lnum_t          *col_id,
+                              const cs_real_t  *const   d_val[],
+                              const cs_real_t  *const   x_val[],
+                              const cs_real_t          *restrict ad_inv,
+                              const cs_real_t          *restrict rhs,
+                              cs_real_t                *restrict vx,
+                              cs_real_t                *restrict w)
+{
+  const cs_lnum_t s_id = row_index[ii];
+  const cs_lnum_t n_cols = row_index[ii+1] - s_id;
+  const cs_lnum_t *restrict _col_id = col_id + s_id;
+
+  cs_real_t *restrict _vx = vx + ii*n_vecs;
+  cs_real_t *restrict _w = w + ii*n_vecs;
+
+  for (int kk = 0; kk < n_vecs; kk++)
+    _w[kk] = rhs[ii*n_vecs + kk];
+
+  if (n_matrices == 1) {
+    const cs_real_t *restrict m_row = x_val[0] + s_id;
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict _vc = vx + _col_id[jj]*n_vecs;
+      for (int kk = 0; kk < n_vecs; kk++)
+        _w[kk] -= m_row[jj] * _vc[kk];
+    }
+  }
+  else {
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t *restrict _vc = vx + _col_id[jj]*n_vecs;
+      for (int kk = 0; kk < n_vecs; kk++)
+        _w[kk] -= x_val[kk][s_id + jj] * _vc[kk];
+    }
+  }
+
+  for (int kk = 0; kk < n_vecs; kk++) {
+    const cs_real_t d = d_val[(n_matrices == 1) ? 0 : kk][ii];
+    const cs_real_t vx0 = _w[kk] * ad_inv[ii*n_vecs + kk];
+    _w[kk] -= d * _vx[kk];
+    _vx[kk] = vx0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Process-local Gauss-Seidel sweep for several interleaved systems
+ * sharing the same MSR structure.
+ *
+ * Each row is visited once for all systems, so the matrix structure
+ * is traversed only once.
+ *
+ * If a row coloring is given, colors are handled in increasing order
+ * for a forward sweep and in decreasing order for a backward sweep,
+ * and rows of a same color are distributed among threads. Otherwise,
+ * rows are visited sequentially (in the given order, if present).
+ *
+ * On exit, w contains the residual of each system prior to the update
+ * of each row.
+ *
+ * parameters:
+ *   n_rows      <-- number of rows
+ *   n_vecs      <-- number of interleaved vectors
+ *   n_matrices  <-- number of matrices (1 or n_vecs)
+ *   row_index   <-- MSR row index
+ *   col_id      <-- MSR column ids
+ *   d_val       <-- diagonal values for each matrix
+ *   x_val       <-- extra-diagonal values for each matrix
+ *   ad_inv      <-- interleaved inverse of diagonals
+ *   order       <-- row ordering, or NULL (ignored if colored)
+ *   n_colors    <-- number of colors, or 0 for a sequential sweep
+ *   color_index <-- index of rows by color, or NULL
+ *   color_rows  <-- row ids, grouped by color, or NULL
+ *   forward     <-- true for forward sweep, false for backward sweep
+ *   rhs         <-- interleaved right hand sides
+ *   vx          <-> interleaved system solutions
+ *   w           --> interleaved residuals
+ *----------------------------------------------------------------------------*/
+
+static void
+_p_gauss_seidel_msr_multi_sweep(cs_lnum_t                 n_rows,
+                                int                       n_vecs,
+                                int                       n_matrices,
+                                const cs_lnum_t          *row_index,
+                                const cs_lnum_t          *col_id,
+                                const cs_real_t  *const   d_val[],
+                                const cs_real_t  *const   x_val[],
+                                const cs_real_t          *restrict ad_inv,
+                                const cs_lnum_t          *order,
+                                int                       n_colors,
+                                const cs_lnum_t          *color_index,
+                                const cs_lnum_t          *color_rows,
+                                bool                      forward,
+                                const cs_real_t          *restrict rhs,
+                                cs_real_t                *restrict vx,
+                                cs_real_t                *restrict w)
+{
+  if (n_colors > 0) {
+
+#   pragma omp parallel
+    {
+      for (int cc = 0; cc < n_colors; cc++) {
+
+        const int c_id = (forward) ? cc : n_colors - 1 - cc;
+
+#       pragma omp for
+        for (cs_lnum_t ll = color_index[c_id];
+             ll < color_index[c_id+1];
+             ll++)
+          _p_gauss_seidel_msr_multi_row(color_rows[ll],
+                                        n_vecs, n_matrices,
+                                        row_index, col_id, d_val, x_val,
+                                        ad_inv, rhs, vx, w);
+
+      }
+    }
+
+  }
+  else {
+
+    for (cs_lnum_t ll = 0; ll < n_rows; ll++) {
+
+      cs_lnum_t ii = (forward) ? ll : n_rows - 1 - ll;
+      if (order != NULL)
+        ii = order[ii];
+
+      _p_gauss_seidel_msr_multi_row(ii, n_vecs, n_matrices,
+                                    row_index, col_id, d_val, x_val,
+                                    ad_inv, rhs, vx, w);
+
+    }
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -4721,13 +5385,23 @@ cs_sles_it_solve(void                *context,
                             vx);
       break;
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
-      cvg = _p_sym_gauss_seidel_msr(c,
-                                    a,
-                                    _diag_block_size,
-                                    rotation_mode,
-                                    &convergence,
-                                    rhs,
-                                    vx);
+      if (_use_colored_gauss_seidel(a))
+        cvg = _p_colored_gauss_seidel_msr(c,
+                                          a,
+                                          _diag_block_size,
+                                          rotation_mode,
+                                          true,
+                                          &convergence,
+                                          rhs,
+                                          vx);
+      else
+        cvg = _p_sym_gauss_seidel_msr(c,
+                                      a,
+                                      _diag_block_size,
+                                      rotation_mode,
+                                      &convergence,
+                                      rhs,
+                                      vx);
       break;
     default:
       bft_error
@@ -4806,6 +5480,276 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for several systems
+ *        at once.
+ *
+ * Right hand sides and solutions are interleaved, so that value j of
+ * system k is stored at index j*n_vecs + k. Either a single matrix is
+ * used for all systems (n_matrices = 1), or one matrix is given per
+ * system (n_matrices = n_vecs), in which case all matrices must share
+ * the same MSR structure.
+ *
+ * Each iteration traverses the matrix structure once for all systems,
+ * and requires a single halo exchange and a single reduction for all
+ * systems. Iterations continue until all systems have converged (or the
+ * maximum number of iterations is reached).
+ *
+ * Only Jacobi and process-local Gauss-Seidel (possibly ordered or
+ * symmetric) solvers are handled, with scalar MSR matrices. Solver
+ * setup data is not used, so the context does not need to be set up.
+ *
+ * \param[in, out]  context     pointer to iterative solver info and context
+ * \param[in]       name        pointer to system name
+ * \param[in]       n_vecs      number of systems
+ * \param[in]       n_matrices  number of matrices (1 or n_vecs)
+ * \param[in]       a           matrices
+ * \param[in]       verbosity   associated verbosity
+ * \param[in]       precision   solver precision
+ * \param[in]       r_norm      residue normalization for each system
+ * \param[out]      n_iter      number of iterations for each system
+ * \param[out]      residue     residue for each system
+ * \param[in]       rhs         interleaved right hand sides
+ * \param[in, out]  vx          interleaved system solutions
+ *
+ * \return  convergence state (worst over all systems)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(cs_sles_it_t              *context,
+                       const char                *name,
+                       int                        n_vecs,
+                       int                        n_matrices,
+                       const cs_matrix_t  *const  a[],
+                       int                        verbosity,
+                       double                     precision,
+                       const double               r_norm[],
+                       int                        n_iter[],
+                       double                     residue[],
+                       const cs_real_t           *rhs,
+                       cs_real_t                 *vx)
+{
+  cs_sles_it_t  *c = context;
+
+  cs_timer_t t0, t1;
+
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  if (n_matrices != 1 && n_matrices != n_vecs)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s [%s]: %d matrices given for %d systems."),
+              __func__, name, n_matrices, n_vecs);
+
+  if (   c->type != CS_SLES_JACOBI
+      && c->type != CS_SLES_P_GAUSS_SEIDEL
+      && c->type != CS_SLES_P_SYM_GAUSS_SEIDEL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s [%s]:\n"
+                "solver type %s is not handled for multiple systems."),
+              __func__, name, _(cs_sles_it_type_name[c->type]));
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a[0]);
+  const cs_halo_t *halo = cs_matrix_get_halo(a[0]);
+
+  /* Matrix arrays; checks on structure are done in the
+     matrix-vector product for Jacobi, so only check type here */
+
+  const cs_lnum_t  *row_index = NULL, *col_id = NULL;
+  const cs_real_t  **d_val, **x_val;
+  BFT_MALLOC(d_val, n_matrices, const cs_real_t *);
+  BFT_MALLOC(x_val, n_matrices, const cs_real_t *);
+
+  for (int m_id = 0; m_id < n_matrices; m_id++) {
+    const cs_lnum_t  *_row_index, *_col_id;
+    if (   cs_matrix_get_type(a[m_id]) != CS_MATRIX_MSR
+        || (cs_matrix_get_diag_block_size(a[m_id]))[0] != 1)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s [%s]:\n"
+                  "only scalar matrices in MSR format are handled."),
+                __func__, name);
+    cs_matrix_get_msr_arrays(a[m_id], &_row_index, &_col_id,
+                             d_val + m_id, x_val + m_id);
+    if (m_id == 0) {
+      row_index = _row_index;
+      col_id = _col_id;
+    }
+    else if (_row_index != row_index || _col_id != col_id)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s [%s]: matrices do not share the same structure."),
+                __func__, name);
+    if (d_val[m_id] == NULL)
+      d_val[m_id] = cs_matrix_get_diagonal(a[m_id]);
+  }
+
+  /* Interleaved diagonal inverse */
+
+  cs_real_t *ad_inv, *w;
+  BFT_MALLOC(ad_inv, n_rows*n_vecs, cs_real_t);
+  BFT_MALLOC(w, n_rows*n_vecs, cs_real_t);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    for (int kk = 0; kk < n_vecs; kk++)
+      ad_inv[ii*n_vecs + kk] = 1.0 / d_val[(n_matrices == 1) ? 0 : kk][ii];
+  }
+
+  const cs_lnum_t *order = NULL;
+  if (c->type == CS_SLES_P_GAUSS_SEIDEL && c->add_data != NULL)
+    order = c->add_data->order;
+
+  /* Without a given ordering, rows of a same color are updated
+     concurrently when using threads; otherwise, sweeps are sequential
+     (as an ordering adapted to the systems usually leads to convergence
+     in very few iterations) */
+
+  int n_colors = 0;
+  const cs_lnum_t *color_index = NULL, *color_rows = NULL;
+
+  if (   c->type != CS_SLES_JACOBI && order == NULL
+      && _use_colored_gauss_seidel(a[0]))
+    cs_matrix_get_row_coloring(a[0], &n_colors, &color_index, &color_rows);
+
+  /* Iterate until all systems have converged */
+
+  cs_sles_convergence_state_t *cvg;
+  double *res2, *initial_residue;
+  BFT_MALLOC(cvg, n_vecs, cs_sles_convergence_state_t);
+  BFT_MALLOC(res2, n_vecs, double);
+  BFT_MALLOC(initial_residue, n_vecs, double);
+
+  for (int kk = 0; kk < n_vecs; kk++) {
+    cvg[kk] = CS_SLES_ITERATING;
+    n_iter[kk] = 0;
+    residue[kk] = HUGE_VAL;
+  }
+
+  unsigned _n_iter = 0;
+  int n_active = n_vecs;
+
+  while (n_active > 0) {
+
+    _n_iter += 1;
+
+    if (c->type == CS_SLES_JACOBI)
+      _jacobi_multi(n_vecs, n_matrices, a, ad_inv, rhs, vx, w);
+
+    else {
+
+      if (halo != NULL)
+        cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, vx, n_vecs);
+
+      _p_gauss_seidel_msr_multi_sweep(n_rows, n_vecs, n_matrices,
+                                      row_index, col_id, d_val, x_val,
+                                      ad_inv, order,
+                                      n_colors, color_index, color_rows,
+                                      true, rhs, vx, w);
+
+      if (c->type == CS_SLES_P_SYM_GAUSS_SEIDEL) {
+
+        if (halo != NULL)
+          cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, vx, n_vecs);
+
+        _p_gauss_seidel_msr_multi_sweep(n_rows, n_vecs, n_matrices,
+                                        row_index, col_id, d_val, x_val,
+                                        ad_inv, order,
+                                        n_colors, color_index, color_rows,
+                                        false, rhs, vx, w);
+
+      }
+
+    }
+
+    _dot_xx_multi(c, n_rows, n_vecs, w, res2);
+
+    /* Convergence test for each system still iterating */
+
+    n_active = 0;
+
+    for (int kk = 0; kk < n_vecs; kk++) {
+
+      if (cvg[kk] != CS_SLES_ITERATING)
+        continue;
+
+      residue[kk] = sqrt(res2[kk]);
+      n_iter[kk] = _n_iter;
+
+      if (_n_iter == 1)
+        initial_residue[kk] = residue[kk];
+
+      if (residue[kk] < precision * r_norm[kk])
+        cvg[kk] = CS_SLES_CONVERGED;
+      else if (_n_iter >= (unsigned)(c->n_max_iter))
+        cvg[kk] = CS_SLES_MAX_ITERATION;
+      else if (   (   residue[kk] > initial_residue[kk] * 10000.0
+                   && residue[kk] > 100.)
+               || isnan(residue[kk]) || isinf(residue[kk]))
+        cvg[kk] = CS_SLES_DIVERGED;
+      else
+        n_active += 1;
+
+    }
+
+  }
+
+  /* Log and reduce convergence state */
+
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+  unsigned long long n_iter_sum = 0;
+
+  for (int kk = 0; kk < n_vecs; kk++) {
+
+    if (verbosity > 1 || (verbosity > 0 && cvg[kk] != CS_SLES_CONVERGED))
+      bft_printf(_("%s [%s, %d/%d]:\n"
+                   "  n_iter: %5d, res_abs: %11.4e, norm: %11.4e\n"),
+                 cs_sles_it_type_name[c->type], name, kk+1, n_vecs,
+                 n_iter[kk], residue[kk], r_norm[kk]);
+
+    if (cvg[kk] == CS_SLES_MAX_ITERATION && verbosity > 0 && precision > 0.)
+      bft_printf(_(" @@ Warning: non convergence\n"));
+    else if (cvg[kk] == CS_SLES_DIVERGED)
+      bft_printf(_("\n\n"
+                   "%s [%s, %d/%d]: divergence after %d iterations:\n"
+                   "  initial residual: %11.4e; current residual: %11.4e\n"),
+                 cs_sles_it_type_name[c->type], name, kk+1, n_vecs,
+                 n_iter[kk], initial_residue[kk], residue[kk]);
+
+    if (cvg[kk] < state)
+      state = cvg[kk];
+    n_iter_sum += n_iter[kk];
+
+  }
+
+  BFT_FREE(initial_residue);
+  BFT_FREE(res2);
+  BFT_FREE(cvg);
+  BFT_FREE(w);
+  BFT_FREE(ad_inv);
+  BFT_FREE(x_val);
+  BFT_FREE(d_val);
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    if (c->n_iterations_tot == 0 || c->n_iterations_min > _n_iter)
+      c->n_iterations_min = _n_iter;
+    if (c->n_iterations_max < _n_iter)
+      c->n_iterations_max = _n_iter;
+
+    c->n_solves += n_vecs;
+    c->n_iterations_last = _n_iter;
+    c->n_iterations_tot += n_iter_sum;
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  return state;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
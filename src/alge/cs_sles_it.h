@@ -222,6 +222,50 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for several systems at once.
+ *
+ * Right hand sides and solutions are interleaved, so that value j of
+ * system k is stored at index j*n_vecs + k. Either a single matrix is
+ * used for all systems (n_matrices = 1), or one matrix is given per
+ * system (n_matrices = n_vecs), in which case all matrices must share
+ * the same MSR structure.
+ *
+ * Only Jacobi and process-local Gauss-Seidel (possibly ordered or
+ * symmetric) solvers are handled, with scalar MSR matrices.
+ *
+ * parameters:
+ *   context    <-> pointer to iterative sparse linear solver info
+ *   name       <-- pointer to system name
+ *   n_vecs     <-- number of systems
+ *   n_matrices <-- number of matrices (1 or n_vecs)
+ *   a          <-- matrices
+ *   verbosity  <-- associated verbosity
+ *   precision  <-- solver precision
+ *   r_norm     <-- residue normalization for each system
+ *   n_iter     --> number of iterations for each system
+ *   residue    --> residue for each system
+ *   rhs        <-- interleaved right hand sides
+ *   vx         <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence state (worst over all systems)
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(cs_sles_it_t              *context,
+                       const char                *name,
+                       int                        n_vecs,
+                       int                        n_matrices,
+                       const cs_matrix_t  *const  a[],
+                       int                        verbosity,
+                       double                     precision,
+                       const double               r_norm[],
+                       int                        n_iter[],
+                       double                     residue[],
+                       const cs_real_t           *rhs,
+                       cs_real_t                 *vx);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
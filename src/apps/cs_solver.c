@@ -58,6 +58,7 @@
 #include "cs_domain_setup.h"
 #include "cs_fan.h"
 #include "cs_field.h"
+#include "cs_field_operator.h"
 #include "cs_field_pointer.h"
 #include "cs_file.h"
 #include "cs_fp_exception.h"
@@ -523,6 +524,7 @@ cs_run(void)
   cs_gui_radiative_transfers_finalize();
   cs_gui_finalize();
 
+  cs_field_operator_finalize();
   cs_field_pointer_destroy_all();
   cs_field_destroy_all();
   cs_field_destroy_all_keys();
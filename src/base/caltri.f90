@@ -786,6 +786,7 @@ call timer_stats_stop(post_stats_id)
 if (inpdt0.eq.0 .and. itrale.gt.0) then
   ntcabs = ntcabs + 1
   call timer_stats_increment_time_step
+  call mem_arena_reset_all
   if(idtvar.eq.0.or.idtvar.eq.1) then
     ttcabs = ttcabs + dt(1)
   else
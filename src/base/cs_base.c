@@ -1526,9 +1526,56 @@ cs_base_mem_finalize(void)
 
   }
 
+  /* Memory arenas summary (maximum over ranks, as arenas are usually
+     defined in the same order on all ranks) */
+
+  int n_arenas = bft_mem_arena_n_arenas();
+  int n_arenas_min = n_arenas, n_arenas_max = n_arenas;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(&n_arenas, &n_arenas_min, 1, MPI_INT, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&n_arenas, &n_arenas_max, 1, MPI_INT, MPI_MAX,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  if (n_arenas_max > 0 && n_arenas_min == n_arenas_max) {
+
+    double *arena_size;
+    BFT_MALLOC(arena_size, n_arenas, double);
+
+    for (int i = 0; i < n_arenas; i++)
+      arena_size[i] = bft_mem_arena_size_max(bft_mem_arena_by_id(i));
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1)
+      MPI_Allreduce(MPI_IN_PLACE, arena_size, n_arenas, MPI_DOUBLE, MPI_MAX,
+                    cs_glob_mpi_comm);
+#endif
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\n  Maximum work memory by arena (local maximum):\n\n"));
+
+    for (int i = 0; i < n_arenas; i++) {
+      for (itot = 0; arena_size[i] > 1024. && itot < 8; itot++)
+        arena_size[i] /= 1024.;
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "    %-38s %12.3f %ciB\n",
+                    bft_mem_arena_get_name(bft_mem_arena_by_id(i)),
+                    arena_size[i], unit[itot]);
+    }
+
+    BFT_FREE(arena_size);
+
+  }
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
+  bft_mem_arena_destroy_all();
+
   /* Finalize memory handling */
 
   if (cs_glob_base_bft_mem_init == true) {
@@ -517,6 +517,16 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    !> \brief  Reset all memory arenas used for work arrays.
+
+    subroutine mem_arena_reset_all()  &
+      bind(C, name='bft_mem_arena_reset_all')
+      use, intrinsic :: iso_c_binding
+      implicit none
+    end subroutine mem_arena_reset_all
+
+    !---------------------------------------------------------------------------
+
     !> \brief  Enable or disable plotting for a timer statistic.
 
     !> \param[in]  id    id of statistic
@@ -92,6 +92,9 @@ BEGIN_C_DECLS
        Explicit coefficient for convection
   \var cs_field_bc_coeffs_t::bc
        Implicit coefficient for convection
+  \var cs_field_bc_coeffs_t::ref_id
+       Id of field whose implicit coefficients (b, bf, bd, bc) are
+       shared, or -1 if those arrays are owned by this structure
 
   \struct cs_field_t
 
@@ -1740,6 +1743,129 @@ cs_field_map_values(cs_field_t   *f,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return id of field whose implicit boundary condition coefficient
+ * arrays should be shared by a given field, if any.
+ *
+ * The reference field is defined by the "bc_coeffs_ref" key. It must
+ * have the same dimension, coupling and optional coefficient arrays as
+ * the given field, and must not itself share another field's arrays.
+ *
+ * As implicit coefficients also depend on the diffusivity, both fields
+ * must also have the same diffusivity field or reference value, and
+ * the same turbulent Schmidt number (boundary condition types are
+ * checked at each time step with other boundary condition codes).
+ *
+ * parameters:
+ *   f            <-- pointer to field structure
+ *   have_flux_bc <-- are flux BC coefficients (af and bf) present ?
+ *   have_mom_bc  <-- are div BC coefficients (ad and bd) present ?
+ *   have_conv_bc <-- are convection BC coefficients (ac and bc) present ?
+ *
+ * returns:
+ *   id of reference field, or -1 if coefficients are not shared
+ *----------------------------------------------------------------------------*/
+
+static int
+_bc_coeffs_ref_id(const cs_field_t  *f,
+                  bool               have_flux_bc,
+                  bool               have_mom_bc,
+                  bool               have_conv_bc)
+{
+  int ref_id = -1;
+
+  if (f->type & CS_FIELD_VARIABLE) {
+    int ref_key_id = cs_field_key_id_try("bc_coeffs_ref");
+    if (ref_key_id > -1)
+      ref_id = cs_field_get_key_int(f, ref_key_id);
+  }
+
+  if (ref_id < 0)
+    return -1;
+
+  const cs_field_t *f_ref = cs_field_by_id(ref_id);
+  const cs_field_bc_coeffs_t *bc_ref = f_ref->bc_coeffs;
+
+  int coupled = 0, coupled_ref = 0;
+  int coupled_key_id = cs_field_key_id_try("coupled");
+  if (coupled_key_id > -1) {
+    coupled = cs_field_get_key_int(f, coupled_key_id);
+    if (f_ref->type & CS_FIELD_VARIABLE)
+      coupled_ref = cs_field_get_key_int(f_ref, coupled_key_id);
+  }
+
+  /* Diffusion-related keys (defined only for variables) */
+
+  bool same_diffusivity = true;
+
+  if (f_ref->type & CS_FIELD_VARIABLE) {
+    const char *dbl_keys[] = {"scalar_diffusivity_ref", "turbulent_schmidt"};
+    int k_id = cs_field_key_id_try("scalar_diffusivity_id");
+    if (k_id > -1) {
+      if (cs_field_get_key_int(f, k_id) != cs_field_get_key_int(f_ref, k_id))
+        same_diffusivity = false;
+    }
+    for (int i = 0; i < 2; i++) {
+      k_id = cs_field_key_id_try(dbl_keys[i]);
+      if (k_id > -1) {
+        if (CS_ABS(  cs_field_get_key_double(f, k_id)
+                   - cs_field_get_key_double(f_ref, k_id)) > 0.)
+          same_diffusivity = false;
+      }
+    }
+  }
+
+  if (   f_ref == f
+      || bc_ref == NULL
+      || bc_ref->ref_id > -1
+      || f_ref->location_id != f->location_id
+      || f_ref->dim != f->dim
+      || coupled_ref != coupled
+      || (bc_ref->bf != NULL) != have_flux_bc
+      || (bc_ref->bd != NULL) != have_mom_bc
+      || (bc_ref->bc != NULL) != have_conv_bc)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\"\n"
+                " can not share implicit BC coefficients with field \"%s\":\n"
+                " the latter must have allocated, non-shared BC coefficients\n"
+                " with the same dimension, coupling and coefficient types."),
+              f->name, f_ref->name);
+
+  if (same_diffusivity == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\"\n"
+                " can not share implicit BC coefficients with field \"%s\":\n"
+                " both must have the same diffusivity (\"scalar_diffusivity_id\"\n"
+                " and \"scalar_diffusivity_ref\" keys) and turbulent Schmidt\n"
+                " number (\"turbulent_schmidt\" key)."),
+              f->name, f_ref->name);
+
+  return ref_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Point implicit boundary condition coefficient arrays to those of
+ * a reference structure.
+ *
+ * parameters:
+ *   bc_coeffs <-> pointer to boundary condition coefficients structure
+ *   bc_ref    <-- pointer to reference structure
+ *   ref_id    <-- id of field owning reference structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_bc_coeffs_share_implicit(cs_field_bc_coeffs_t        *bc_coeffs,
+                          const cs_field_bc_coeffs_t  *bc_ref,
+                          int                          ref_id)
+{
+  bc_coeffs->b = bc_ref->b;
+  bc_coeffs->bf = bc_ref->bf;
+  bc_coeffs->bd = bc_ref->bd;
+  bc_coeffs->bc = bc_ref->bc;
+
+  bc_coeffs->ref_id = ref_id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate boundary condition coefficients arrays.
@@ -1755,6 +1881,14 @@ cs_field_map_values(cs_field_t   *f,
  * coefficient arrays are arrays of block matrices, not vectors, so the
  * number of entries for each boundary face is dim*dim instead of dim.
  *
+ * If the "bc_coeffs_ref" key is set for this field, its implicit
+ * coefficient arrays (b, bf, bd, and bc) are not allocated, but shared
+ * with those of the referenced field, whose coefficients must already
+ * be allocated. This saves memory when many variables (such as chemical
+ * species) have identical boundary condition types and exchange
+ * coefficients, so that only their explicit coefficients differ.
+ * Fields sharing coefficients of a reallocated field are updated.
+ *
  * \param[in, out]  f             pointer to field structure
  * \param[in]       have_flux_bc  if true, flux bc coefficients (af and bf)
  *                                are added
@@ -1794,11 +1928,31 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
     const int location_id = CS_MESH_LOCATION_BOUNDARY_FACES;
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(location_id);
 
+    const int ref_id
+      = _bc_coeffs_ref_id(f, have_flux_bc, have_mom_bc, have_conv_bc);
+    const cs_field_bc_coeffs_t *bc_ref
+      = (ref_id > -1) ? cs_field_by_id(ref_id)->bc_coeffs : NULL;
+
+    /* Implicit arrays previously shared are detached; when shared,
+       they are not allocated here (size 0 leads to NULL pointers). */
+
+    if (f->bc_coeffs != NULL && f->bc_coeffs->ref_id > -1) {
+      f->bc_coeffs->b = NULL;
+      f->bc_coeffs->bf = NULL;
+      f->bc_coeffs->bd = NULL;
+      f->bc_coeffs->bc = NULL;
+      f->bc_coeffs->ref_id = -1;
+    }
+
+    if (bc_ref != NULL)
+      b_mult = 0;
+
     if (f->bc_coeffs == NULL) {
 
       BFT_MALLOC(f->bc_coeffs, 1, cs_field_bc_coeffs_t);
 
       f->bc_coeffs->location_id = location_id;
+      f->bc_coeffs->ref_id = -1;
 
       BFT_MALLOC(f->bc_coeffs->a, n_elts[0]*a_mult, cs_real_t);
       BFT_MALLOC(f->bc_coeffs->b, n_elts[0]*b_mult, cs_real_t);
@@ -1868,6 +2022,19 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
 
     f->bc_coeffs->hint = NULL;
     f->bc_coeffs->hext = NULL;
+
+    if (bc_ref != NULL)
+      _bc_coeffs_share_implicit(f->bc_coeffs, bc_ref, ref_id);
+
+    /* Update fields sharing this field's implicit coefficients */
+
+    else {
+      for (int i = 0; i < _n_fields; i++) {
+        cs_field_bc_coeffs_t *bc_coeffs = _fields[i]->bc_coeffs;
+        if (bc_coeffs != NULL && bc_coeffs->ref_id == f->id)
+          _bc_coeffs_share_implicit(bc_coeffs, f->bc_coeffs, f->id);
+      }
+    }
   }
 
   else
@@ -2175,14 +2342,16 @@ cs_field_destroy_all(void)
     }
     BFT_FREE(f->vals);
     if (f->bc_coeffs != NULL) {
+      if (f->bc_coeffs->ref_id < 0) {
+        BFT_FREE(f->bc_coeffs->b);
+        BFT_FREE(f->bc_coeffs->bf);
+        BFT_FREE(f->bc_coeffs->bd);
+        BFT_FREE(f->bc_coeffs->bc);
+      }
       BFT_FREE(f->bc_coeffs->a);
-      BFT_FREE(f->bc_coeffs->b);
       BFT_FREE(f->bc_coeffs->af);
-      BFT_FREE(f->bc_coeffs->bf);
       BFT_FREE(f->bc_coeffs->ad);
-      BFT_FREE(f->bc_coeffs->bd);
       BFT_FREE(f->bc_coeffs->ac);
-      BFT_FREE(f->bc_coeffs->bc);
       BFT_FREE(f->bc_coeffs->hint);
       BFT_FREE(f->bc_coeffs->hext);
       BFT_FREE(f->bc_coeffs);
@@ -4165,6 +4334,7 @@ cs_field_log_all_key_vals(bool  log_defaults)
  *   "log"          (integer)
  *   "post_vis"     (integer)
  *   "coupled"      (integer, restricted to CS_FIELD_VARIABLE)
+ *   "bc_coeffs_ref" (integer, restricted to CS_FIELD_VARIABLE)
  *   "moment_id"    (integer, restricted to
  *                   CS_FIELD_ACCUMULATOR | CS_FIELD_POSTPROCESS);
  *
@@ -4182,6 +4352,7 @@ cs_field_define_keys_base(void)
   cs_field_define_key_int("log", 0, 0);
   cs_field_define_key_int("post_vis", 0, 0);
   cs_field_define_key_int("coupled", 0, CS_FIELD_VARIABLE);
+  cs_field_define_key_int("bc_coeffs_ref", -1, CS_FIELD_VARIABLE);
   cs_field_define_key_int("moment_id", -1,
                           CS_FIELD_ACCUMULATOR | CS_FIELD_POSTPROCESS);
 }
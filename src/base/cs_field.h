@@ -116,6 +116,9 @@ typedef struct {
   cs_real_t         *hint;         /* coefficient for internal coupling */
   cs_real_t         *hext;         /* coefficient for internal coupling */
 
+  int                ref_id;       /* Id of field whose implicit coefficients
+                                      (b, bf, bd, bc) are shared, or -1 */
+
 } cs_field_bc_coeffs_t;
 
 /* Field descriptor */
@@ -49,6 +49,7 @@
 #include "cs_gradient.h"
 #include "cs_gradient_perio.h"
 #include "cs_halo.h"
+#include "cs_halo_batch.h"
 #include "cs_halo_perio.h"
 #include "cs_mesh.h"
 #include "cs_log.h"
@@ -102,6 +103,13 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Halo batches used for field synchronization (by halo type), reused
+   from one call to the next; the associated halo is saved so as to
+   detect mesh modifications */
+
+static cs_halo_batch_t  *_field_sync_batch[CS_HALO_N_TYPES] = {NULL, NULL};
+static const cs_halo_t  *_field_sync_halo[CS_HALO_N_TYPES] = {NULL, NULL};
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -115,6 +123,15 @@ cs_f_field_gradient_scalar(int                    f_id,
                            int                    recompute_cocg,
                            cs_real_3_t  *restrict grad);
 
+void
+cs_f_field_gradient_scalars(int                    n_fields,
+                            const int              f_id[],
+                            int                    use_previous_t,
+                            int                    imrgra,
+                            int                    inc,
+                            int                    recompute_cocg,
+                            cs_real_3_t  *restrict grad);
+
 void
 cs_f_field_gradient_potential(int                    f_id,
                               int                    use_previous_t,
@@ -138,6 +155,10 @@ void cs_f_field_gradient_tensor(int                     f_id,
                                 int                     inc,
                                 cs_real_63_t  *restrict grad);
 
+void
+cs_f_field_synchronize_fields(int        n_fields,
+                              const int  f_id[]);
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -172,6 +193,63 @@ _field_interpolate_by_mean(const cs_field_t   *f,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields together.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f_id           <-- field ids
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   imrgra         <-- gradient reconstruction mode
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   grad           --> gradients (n_cells_ext values per field)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_field_gradient_scalars(int                    n_fields,
+                            const int              f_id[],
+                            int                    use_previous_t,
+                            int                    imrgra,
+                            int                    inc,
+                            int                    recompute_cocg,
+                            cs_real_3_t  *restrict grad)
+{
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_ITER;
+  bool _use_previous_t = use_previous_t ? true : false;
+  bool _recompute_cocg = recompute_cocg ? true : false;
+
+  const cs_lnum_t n_cells_ext = cs_glob_mesh->n_cells_with_ghosts;
+
+  const cs_field_t **f;
+  cs_real_3_t **_grad;
+
+  BFT_MALLOC(f, n_fields, const cs_field_t *);
+  BFT_MALLOC(_grad, n_fields, cs_real_3_t *);
+
+  for (int i = 0; i < n_fields; i++) {
+    f[i] = cs_field_by_id(f_id[i]);
+    _grad[i] = grad + i*n_cells_ext;
+  }
+
+  cs_gradient_type_by_imrgra(imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  cs_field_gradient_scalars(n_fields,
+                            f,
+                            _use_previous_t,
+                            gradient_type,
+                            halo_type,
+                            inc,
+                            _recompute_cocg,
+                            _grad);
+
+  BFT_FREE(_grad);
+  BFT_FREE(f);
+}
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points using gradient-corrected
  * interpolation.
@@ -525,6 +603,32 @@ void cs_f_field_gradient_tensor(int                     f_id,
                            inc,
                            grad);
 }
+
+/*----------------------------------------------------------------------------
+ * Synchronize current parallel and periodic values of several fields
+ * (standard halo).
+ *
+ * parameters:
+ *   n_fields <-- number of fields
+ *   f_id     <-- field ids
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_field_synchronize_fields(int        n_fields,
+                              const int  f_id[])
+{
+  cs_field_t **f;
+
+  BFT_MALLOC(f, n_fields, cs_field_t *);
+
+  for (int i = 0; i < n_fields; i++)
+    f[i] = cs_field_by_id(f_id[i]);
+
+  cs_field_synchronize_fields(n_fields, f, CS_HALO_STANDARD);
+
+  BFT_FREE(f);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -618,6 +722,140 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of multiple scalar fields together.
+ *
+ * Fields with weighted gradients, internal coupling, or periodicity of
+ * rotation, or whose gradient options differ from those of the first
+ * field, are handled separately, using \ref cs_field_gradient_scalar.
+ * Others are computed together using \ref cs_gradient_scalars.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       f               pointers to fields
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       gradient_type   gradient type
+ * \param[in]       halo_type       halo type
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[in]       recompute_cocg  should COCG FV quantities be recomputed ?
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalars(int                        n_fields,
+                          const cs_field_t          *f[],
+                          bool                       use_previous_t,
+                          cs_gradient_type_t         gradient_type,
+                          cs_halo_type_t             halo_type,
+                          int                        inc,
+                          bool                       recompute_cocg,
+                          cs_real_3_t               *grad[])
+{
+  int n_vars = 0;
+  const char *group_name = NULL;
+  int key_cal_opt_id = cs_field_key_id("var_cal_opt");
+  int key_cpl_id = cs_field_key_id_try("coupling_entity");
+  cs_var_cal_opt_t var_cal_opt, var_cal_opt_0;
+
+  const cs_real_t **bc_coeff_a, **bc_coeff_b;
+  cs_real_t **var;
+  cs_real_3_t **_grad;
+
+  memset(&var_cal_opt_0, 0, sizeof(cs_var_cal_opt_t));
+
+  BFT_MALLOC(bc_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(bc_coeff_b, n_fields, const cs_real_t *);
+  BFT_MALLOC(var, n_fields, cs_real_t *);
+  BFT_MALLOC(_grad, n_fields, cs_real_3_t *);
+
+  for (int i = 0; i < n_fields; i++) {
+
+    bool group = true;
+
+    cs_field_get_key_struct(f[i], key_cal_opt_id, &var_cal_opt);
+
+    /* Check for options requiring separate handling */
+
+    if (f[i]->type & CS_FIELD_VARIABLE && var_cal_opt.idiff > 0) {
+      if (var_cal_opt.iwgrec == 1)
+        group = false;
+      if (key_cpl_id > -1) {
+        if (cs_field_get_key_int(f[i], key_cpl_id) > -1)
+          group = false;
+      }
+    }
+
+    if (group) {
+      int tr_dim = 0;
+      cs_gradient_perio_init_rij(f[i], &tr_dim, grad[i]);
+      if (tr_dim > 0)
+        group = false;
+    }
+
+    if (group && n_vars > 0) {
+      if (   var_cal_opt.nswrgr != var_cal_opt_0.nswrgr
+          || var_cal_opt.imligr != var_cal_opt_0.imligr
+          || var_cal_opt.epsrgr < var_cal_opt_0.epsrgr
+          || var_cal_opt.epsrgr > var_cal_opt_0.epsrgr
+          || var_cal_opt.extrag < var_cal_opt_0.extrag
+          || var_cal_opt.extrag > var_cal_opt_0.extrag
+          || var_cal_opt.climgr < var_cal_opt_0.climgr
+          || var_cal_opt.climgr > var_cal_opt_0.climgr)
+        group = false;
+    }
+
+    if (group == false) {
+      cs_field_gradient_scalar(f[i],
+                               use_previous_t,
+                               gradient_type,
+                               halo_type,
+                               inc,
+                               recompute_cocg,
+                               grad[i]);
+      continue;
+    }
+
+    if (n_vars == 0) {
+      var_cal_opt_0 = var_cal_opt;
+      group_name = f[i]->name;
+    }
+    else
+      var_cal_opt_0.iwarni = CS_MAX(var_cal_opt_0.iwarni, var_cal_opt.iwarni);
+
+    bc_coeff_a[n_vars] = f[i]->bc_coeffs->a;
+    bc_coeff_b[n_vars] = f[i]->bc_coeffs->b;
+    var[n_vars] = (use_previous_t) ? f[i]->val_pre : f[i]->val;
+    _grad[n_vars] = grad[i];
+    n_vars++;
+
+  }
+
+  if (n_vars > 0)
+    cs_gradient_scalars(group_name,
+                        gradient_type,
+                        halo_type,
+                        inc,
+                        recompute_cocg,
+                        var_cal_opt_0.nswrgr,
+                        var_cal_opt_0.iwarni,
+                        var_cal_opt_0.imligr,
+                        var_cal_opt_0.epsrgr,
+                        var_cal_opt_0.extrag,
+                        var_cal_opt_0.climgr,
+                        n_vars,
+                        bc_coeff_a,
+                        bc_coeff_b,
+                        var,
+                        _grad);
+
+  BFT_FREE(_grad);
+  BFT_FREE(var);
+  BFT_FREE(bc_coeff_b);
+  BFT_FREE(bc_coeff_a);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -954,6 +1192,73 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize current parallel and periodic values of several fields.
+ *
+ * Values of all fields are exchanged together, with a single message per
+ * neighboring rank. As for \ref cs_field_synchronize, only fields based on
+ * CS_MESH_LOCATION_CELLS are updated; others are ignored.
+ *
+ * \param[in]       n_fields    number of fields
+ * \param[in, out]  f           pointers to fields
+ * \param[in]       halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_fields(int              n_fields,
+                            cs_field_t      *f[],
+                            cs_halo_type_t   halo_type)
+{
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+
+  if (halo == NULL)
+    return;
+
+  /* Reuse batch (and its buffers) from previous calls if possible */
+
+  if (_field_sync_halo[halo_type] != halo) {
+    cs_halo_batch_destroy(&(_field_sync_batch[halo_type]));
+    _field_sync_batch[halo_type] = cs_halo_batch_create(halo, halo_type);
+    _field_sync_halo[halo_type] = halo;
+  }
+  else
+    cs_halo_batch_clear(_field_sync_batch[halo_type]);
+
+  cs_halo_batch_t *batch = _field_sync_batch[halo_type];
+
+  /* Rotation is only applied to non-scalar fields, as in
+     cs_field_synchronize */
+
+  for (int i = 0; i < n_fields; i++) {
+    if (f[i]->location_id == CS_MESH_LOCATION_CELLS)
+      cs_halo_batch_add(batch,
+                        f[i]->val,
+                        f[i]->dim,
+                        (cs_glob_mesh->n_init_perio > 0 && f[i]->dim > 1));
+  }
+
+  cs_halo_batch_sync(batch);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures used by field operators.
+ *
+ * Halo batches kept for \ref cs_field_synchronize_fields are destroyed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_operator_finalize(void)
+{
+  for (int i = 0; i < CS_HALO_N_TYPES; i++) {
+    cs_halo_batch_destroy(&(_field_sync_batch[i]));
+    _field_sync_halo[i] = NULL;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
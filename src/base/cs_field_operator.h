@@ -85,6 +85,34 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          bool                       recompute_cocg,
                          cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of multiple scalar fields together.
+ *
+ * Fields with weighted gradients, internal coupling, or periodicity of
+ * rotation, or whose gradient options differ from those of the first
+ * field, are handled separately.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointers to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   gradient_type  <-- gradient type
+ *   halo_type      <-- halo type
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   recompute_cocg <-- should COCG FV quantities be recomputed ?
+ *   grad           --> gradient for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalars(int                        n_fields,
+                          const cs_field_t          *f[],
+                          bool                       use_previous_t,
+                          cs_gradient_type_t         gradient_type,
+                          cs_halo_type_t             halo_type,
+                          int                        inc,
+                          bool                       recompute_cocg,
+                          cs_real_3_t               *grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -209,6 +237,36 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize current parallel and periodic values of several fields.
+ *
+ * Values of all fields are exchanged together, with a single message per
+ * neighboring rank. As for \ref cs_field_synchronize, only fields based on
+ * CS_MESH_LOCATION_CELLS are updated; others are ignored.
+ *
+ * \param[in]       n_fields    number of fields
+ * \param[in, out]  f           pointers to fields
+ * \param[in]       halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_synchronize_fields(int              n_fields,
+                            cs_field_t      *f[],
+                            cs_halo_type_t   halo_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free structures used by field operators.
+ *
+ * Halo batches kept for \ref cs_field_synchronize_fields are destroyed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_operator_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
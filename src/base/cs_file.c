@@ -73,6 +73,10 @@
 #include <io.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 #if defined(HAVE_MPI_IO)
 #include <limits.h>
 #endif
@@ -189,6 +193,7 @@ struct _cs_file_t {
   int                rank;         /* MPI rank */
   int                n_ranks;      /* MPI rank */
   _Bool              swap_endian;  /* Swap big-endian and little-endian ? */
+  _Bool              async;        /* Are stdio writes asynchronous ? */
 
   FILE              *sh;           /* Serial file handle */
 
@@ -242,6 +247,38 @@ struct _cs_file_serializer_t {
 
 #endif /* defined(HAVE_MPI) */
 
+#if defined(HAVE_PTHREAD)
+
+/* Asynchronous write operation types */
+
+typedef enum {
+
+  CS_FILE_ASYNC_WRITE,
+  CS_FILE_ASYNC_SEEK,
+  CS_FILE_ASYNC_CLOSE
+
+} _cs_file_async_op_type_t;
+
+/* Asynchronous write operation (queued) */
+
+typedef struct _cs_file_async_op_t {
+
+  _cs_file_async_op_type_t     type;    /* Operation type */
+  FILE                        *sh;      /* Serial file handle */
+  char                        *name;    /* File name (for errors) */
+
+  void                        *buf;     /* Data to write */
+  size_t                       size;    /* Size of data in bytes */
+
+  cs_file_off_t                offset;  /* Offset for seek */
+  int                          whence;  /* stdio position for seek */
+
+  struct _cs_file_async_op_t  *next;    /* Next queued operation */
+
+} _cs_file_async_op_t;
+
+#endif /* defined(HAVE_PTHREAD) */
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -268,6 +305,30 @@ static MPI_Info _mpi_io_hints_w = MPI_INFO_NULL;
 
 #endif
 
+/* Asynchronous writes through a background thread; the queue and its
+   operations are only handled through malloc/free, as the memory
+   management instrumentation is not safe outside of OpenMP threads */
+
+static size_t _async_max_size = 0;
+
+#if defined(HAVE_PTHREAD)
+
+static bool                  _async_active = false;
+static bool                  _async_shutdown = false;
+static pthread_t             _async_thread;
+static pthread_mutex_t       _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t        _async_cond_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t        _async_cond_done = PTHREAD_COND_INITIALIZER;
+
+static _cs_file_async_op_t  *_async_head = NULL;  /* first (current) op */
+static _cs_file_async_op_t  *_async_tail = NULL;  /* last op */
+static size_t                _async_size = 0;     /* queued bytes */
+
+static int                   _async_errnum = 0;     /* first error number */
+static char                 *_async_err_name = NULL;  /* first error file */
+
+#endif /* defined(HAVE_PTHREAD) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -513,6 +574,245 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Execute an asynchronous operation (called by the background thread).
+ *
+ * parameters:
+ *   op <-- pointer to operation
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_async_execute(const _cs_file_async_op_t  *op)
+{
+  int errnum = 0;
+
+  switch (op->type) {
+
+  case CS_FILE_ASYNC_WRITE:
+    if (fwrite(op->buf, 1, op->size, op->sh) != op->size)
+      errnum = (ferror(op->sh) != 0) ? errno : EIO;
+    break;
+
+  case CS_FILE_ASYNC_SEEK:
+#if defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+    if (fseeko(op->sh, (off_t)(op->offset), op->whence) != 0)
+      errnum = errno;
+#else
+    if (fseek(op->sh, (long)(op->offset), op->whence) != 0)
+      errnum = errno;
+#endif
+    break;
+
+  case CS_FILE_ASYNC_CLOSE:
+    if (fclose(op->sh) != 0)
+      errnum = errno;
+    break;
+
+  }
+
+  return errnum;
+}
+
+/*----------------------------------------------------------------------------
+ * Main function of background writer thread.
+ *
+ * Operations remain at the head of the queue while being executed, so
+ * that files with pending operations may be detected.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_thread_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (true) {
+
+    while (_async_head == NULL && !_async_shutdown)
+      pthread_cond_wait(&_async_cond_queued, &_async_mutex);
+
+    if (_async_head == NULL)
+      break;
+
+    _cs_file_async_op_t *op = _async_head;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    int errnum = _async_execute(op);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    if (errnum != 0 && _async_errnum == 0) {
+      _async_errnum = errnum;
+      _async_err_name = op->name;
+      op->name = NULL;
+    }
+
+    _async_head = op->next;
+    if (_async_head == NULL)
+      _async_tail = NULL;
+    _async_size -= op->size;
+
+    free(op->buf);
+    free(op->name);
+    free(op);
+
+    pthread_cond_broadcast(&_async_cond_done);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Report an error which occured in the background writer thread, if any.
+ *
+ * Must be called with the queue mutex locked; it is unlocked in case
+ * of error.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_check_error(void)
+{
+  if (_async_errnum != 0) {
+    int errnum = _async_errnum;
+    char *name = _async_err_name;
+    _async_errnum = 0;
+    _async_err_name = NULL;
+    pthread_mutex_unlock(&_async_mutex);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error in asynchronous write of file \"%s\":\n\n  %s"),
+              name, strerror(errnum));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Queue an asynchronous operation on a file.
+ *
+ * If the size of queued data would exceed the allowed maximum, wait for
+ * previous operations to complete first.
+ *
+ * parameters:
+ *   f      <-- pointer to file handler
+ *   type   <-- operation type
+ *   buf    <-- data to write (copied), or NULL
+ *   size   <-- size of data to write in bytes
+ *   offset <-- offset for seek
+ *   whence <-- stdio position for seek
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_push(cs_file_t                 *f,
+            _cs_file_async_op_type_t  type,
+            const void                *buf,
+            size_t                     size,
+            cs_file_off_t              offset,
+            int                        whence)
+{
+  _cs_file_async_op_t *op = malloc(sizeof(_cs_file_async_op_t));
+  char *name = malloc(strlen(f->name) + 1);
+  void *_buf = (size > 0) ? malloc(size) : NULL;
+
+  if (op == NULL || name == NULL || (size > 0 && _buf == NULL))
+    bft_error(__FILE__, __LINE__, errno,
+              _("Failure to allocate asynchronous write buffer\n"
+                "for file \"%s\" (%lu bytes)"),
+              f->name, (unsigned long)size);
+
+  strcpy(name, f->name);
+  if (size > 0)
+    memcpy(_buf, buf, size);
+
+  op->type = type;
+  op->sh = f->sh;
+  op->name = name;
+  op->buf = _buf;
+  op->size = size;
+  op->offset = offset;
+  op->whence = whence;
+  op->next = NULL;
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (!_async_active) {
+    _async_shutdown = false;
+    if (pthread_create(&_async_thread, NULL, _async_thread_main, NULL) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Failure to create asynchronous file write thread."));
+    _async_active = true;
+  }
+
+  while (_async_head != NULL && _async_size + size > _async_max_size)
+    pthread_cond_wait(&_async_cond_done, &_async_mutex);
+
+  _async_check_error();
+
+  if (_async_tail != NULL)
+    _async_tail->next = op;
+  else
+    _async_head = op;
+  _async_tail = op;
+  _async_size += size;
+
+  pthread_cond_signal(&_async_cond_queued);
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of queued asynchronous operations.
+ *
+ * parameters:
+ *   name <-- if non-NULL, only wait for operations on the matching file
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(const char  *name)
+{
+#if defined(HAVE_PTHREAD)
+
+  if (!_async_active)
+    return;
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (true) {
+    const _cs_file_async_op_t *op = _async_head;
+    if (name != NULL) {
+      while (op != NULL && strcmp(op->name, name) != 0)
+        op = op->next;
+    }
+    if (op == NULL)
+      break;
+    pthread_cond_wait(&_async_cond_done, &_async_mutex);
+  }
+
+  _async_check_error();
+
+  pthread_mutex_unlock(&_async_mutex);
+
+#else
+
+  CS_UNUSED(name);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -533,6 +833,10 @@ _file_open(cs_file_t  *f)
   if (f->sh != NULL)
     return 0;
 
+  /* Complete pending asynchronous writes to the same file, if any */
+
+  _async_wait(f->name);
+
   /* The file handler exists and the corresponding file is closed */
 
   switch (f->mode) {
@@ -578,6 +882,13 @@ _file_close(cs_file_t  *f)
 {
   int retval = 0;
 
+#if defined(HAVE_PTHREAD)
+  if (f->async && f->sh != NULL) {
+    _async_push(f, CS_FILE_ASYNC_CLOSE, NULL, 0, 0, 0);
+    f->sh = NULL;
+  }
+#endif
+
   if (f->sh != NULL)
     retval = fclose(f->sh);
 
@@ -660,6 +971,14 @@ _file_write(cs_file_t   *f,
 
   assert(f->sh != NULL);
 
+#if defined(HAVE_PTHREAD)
+  if (f->async) {
+    if (ni != 0)
+      _async_push(f, CS_FILE_ASYNC_WRITE, buf, size*ni, 0, 0);
+    return ni;
+  }
+#endif
+
   if (ni != 0)
     retval = fwrite(buf, size, ni, f->sh);
 
@@ -716,6 +1035,13 @@ _file_seek(cs_file_t       *f,
 
   assert(f != NULL);
 
+#if defined(HAVE_PTHREAD)
+  if (f->async && f->sh != NULL) {
+    _async_push(f, CS_FILE_ASYNC_SEEK, NULL, 0, offset, _whence);
+    return 0;
+  }
+#endif
+
   if (f->sh != NULL) {
 
 #if (SIZEOF_LONG < 8)
@@ -787,6 +1113,9 @@ _file_tell(cs_file_t  *f)
 
   assert(f != NULL);
 
+  if (f->async)
+    _async_wait(f->name);
+
   if (f->sh != NULL) {
 
     /* For 32-bit systems, large file support may be necessary */
@@ -1826,6 +2155,7 @@ cs_file_open(const char        *name,
   f->n_ranks = 1;
 
   f->swap_endian = false; /* Use native endianness by default */
+  f->async = false;
 
   /* Set communicator */
 
@@ -1864,6 +2194,12 @@ cs_file_open(const char        *name,
      this is only useful with a non-default error handler,
      as the program is terminated by default */
 
+#if defined(HAVE_PTHREAD)
+  if (   f->method <= CS_FILE_STDIO_PARALLEL && f->mode != CS_FILE_MODE_READ
+      && _async_max_size > 0)
+    f->async = true;
+#endif
+
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
@@ -2836,6 +3172,22 @@ cs_file_dump(const cs_file_t  *f)
 void
 cs_file_free_defaults(void)
 {
+  /* Complete asynchronous writes and stop associated thread */
+
+#if defined(HAVE_PTHREAD)
+  if (_async_active) {
+    _async_wait(NULL);
+    pthread_mutex_lock(&_async_mutex);
+    _async_shutdown = true;
+    pthread_cond_signal(&_async_cond_queued);
+    pthread_mutex_unlock(&_async_mutex);
+    pthread_join(_async_thread, NULL);
+    _async_active = false;
+  }
+#endif
+
+  _async_max_size = 0;
+
   _mpi_io_positionning = CS_FILE_MPI_EXPLICIT_OFFSETS;
 
   _default_access_r = CS_FILE_DEFAULT;
@@ -3258,6 +3610,71 @@ cs_file_set_mpi_io_positionning(cs_file_mpi_positionning_t  positionning)
   _mpi_io_positionning = positionning;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get the maximum size of data queued for asynchronous writes.
+ *
+ * For details, see cs_file_set_async_write_size().
+ *
+ * \return  maximum size of queued data in bytes (0 if writes are
+ *          synchronous)
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_file_get_async_write_size(void)
+{
+  return _async_max_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of data queued for asynchronous writes.
+ *
+ * When nonzero, writing, positioning and closing of files opened
+ * afterwards in write or append mode with a standard IO access method
+ * (CS_FILE_STDIO_SERIAL or CS_FILE_STDIO_PARALLEL) are handed over to
+ * a background thread on each writing rank, so that the calling code
+ * (for example postprocessing output) may proceed while data reaches
+ * the file system. Data is copied when queued; if the queue already
+ * contains max_size bytes, the caller waits for previous writes to
+ * complete.
+ *
+ * Operations requiring the actual file state (opening the same file,
+ * querying the position, or reading) wait for pending writes first,
+ * and errors are reported at those points. MPI-IO based access methods
+ * are not affected, so this is useful mainly when combined with
+ * standard IO access for write mode.
+ *
+ * This setting requires POSIX threads support; otherwise, it is ignored.
+ *
+ * \param[in]  max_size  maximum size of queued data in bytes,
+ *                       or 0 for synchronous writes (default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_size(size_t  max_size)
+{
+#if defined(HAVE_PTHREAD)
+  _async_max_size = max_size;
+#else
+  CS_UNUSED(max_size);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of all pending asynchronous writes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_async_wait(void)
+{
+  _async_wait(NULL);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print information on default options for file access.
@@ -3336,6 +3753,13 @@ cs_file_defaults_info(void)
                     _("  I/O rank step:        %d\n"), block_rank_step);
   }
 
+  if (_async_max_size > 0) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O asynchronous stdio writes: %lu kB max. queued\n"),
+                    (unsigned long)(_async_max_size / 1024));
+  }
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -643,6 +643,53 @@ cs_file_get_mpi_io_positionning(void);
 void
 cs_file_set_mpi_io_positionning(cs_file_mpi_positionning_t  positionning);
 
+/*----------------------------------------------------------------------------
+ * Get the maximum size of data queued for asynchronous writes.
+ *
+ * For details, see cs_file_set_async_write_size().
+ *
+ * returns:
+ *   maximum size of queued data in bytes (0 if writes are synchronous)
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_file_get_async_write_size(void);
+
+/*----------------------------------------------------------------------------
+ * Set the maximum size of data queued for asynchronous writes.
+ *
+ * When nonzero, writing, positioning and closing of files opened
+ * afterwards in write or append mode with a standard IO access method
+ * (CS_FILE_STDIO_SERIAL or CS_FILE_STDIO_PARALLEL) are handed over to
+ * a background thread on each writing rank, so that the calling code
+ * (for example postprocessing output) may proceed while data reaches
+ * the file system. Data is copied when queued; if the queue already
+ * contains max_size bytes, the caller waits for previous writes to
+ * complete.
+ *
+ * Operations requiring the actual file state (opening the same file,
+ * querying the position, or reading) wait for pending writes first,
+ * and errors are reported at those points. MPI-IO based access methods
+ * are not affected, so this is useful mainly when combined with
+ * standard IO access for write mode.
+ *
+ * This setting requires POSIX threads support; otherwise, it is ignored.
+ *
+ * parameters:
+ *   max_size <-- maximum size of queued data in bytes,
+ *                or 0 for synchronous writes (default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_size(size_t  max_size);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of all pending asynchronous writes.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_async_wait(void);
+
 /*----------------------------------------------------------------------------
  * Print information on default options for file access.
  *----------------------------------------------------------------------------*/
@@ -47,6 +47,8 @@
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
 
 #include "fvm_periodicity.h"
 
@@ -84,6 +86,10 @@ static int           _cs_glob_halo_request_size = 0;
 static MPI_Request  *_cs_glob_halo_request = NULL;
 static MPI_Status   *_cs_glob_halo_status = NULL;
 
+/* Id of "mpi_wait" timer statistic (-2 if not looked up yet) */
+
+static int  _cs_glob_halo_wait_stat_id = -2;
+
 #endif
 
 /* Buffer to save rotation halo values */
@@ -99,6 +105,42 @@ static int _cs_glob_halo_use_barrier = false;
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of halo exchange requests.
+ *
+ * The waiting time is added to the "mpi_wait" timer statistic, if defined
+ * at the first call.
+ *
+ * parameters:
+ *   request_count <-- number of requests
+ *   request       <-> array of requests
+ *   status        --> array of statuses
+ *----------------------------------------------------------------------------*/
+
+static void
+_wait_all(int           request_count,
+          MPI_Request   request[],
+          MPI_Status    status[])
+{
+  if (_cs_glob_halo_wait_stat_id < -1)
+    _cs_glob_halo_wait_stat_id = cs_timer_stats_id_by_name("mpi_wait");
+
+  const int stat_id = _cs_glob_halo_wait_stat_id;
+
+  if (stat_id > -1) {
+    cs_timer_t t0 = cs_timer_time();
+    MPI_Waitall(request_count, request, status);
+    cs_timer_t t1 = cs_timer_time();
+    cs_timer_stats_add_diff(stat_id, &t0, &t1);
+  }
+  else
+    MPI_Waitall(request_count, request, status);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Save rotation terms of a halo to an internal buffer.
  *
@@ -1024,7 +1066,7 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _wait_all(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
 
   }
 
@@ -1216,7 +1258,7 @@ cs_halo_sync_untyped(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _wait_all(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1355,7 +1397,7 @@ cs_halo_sync_num(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _wait_all(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1485,7 +1527,7 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _wait_all(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1651,7 +1693,7 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    _wait_all(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -0,0 +1,535 @@
+/*============================================================================
+ * Aggregated halo synchronization of multiple arrays
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+#include "bft_printf.h"
+
+#include "cs_base.h"
+#include "cs_halo.h"
+#include "cs_halo_perio.h"
+#include "cs_timer.h"
+#include "cs_timer_stats.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_halo_batch.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+struct _cs_halo_batch_t {
+
+  const cs_halo_t  *halo;         /* Associated halo */
+  cs_halo_type_t    sync_mode;    /* Synchronization mode */
+
+  int               n_vars;       /* Number of registered arrays */
+  int               n_vars_max;   /* Allocated size for arrays */
+  int               stride_sum;   /* Sum of strides of registered arrays */
+
+  cs_real_t       **vars;         /* Pointers to registered arrays */
+  int              *strides;      /* Stride of each registered array */
+  bool             *rotate;       /* Apply rotation to each array ? */
+
+  size_t            send_size;    /* Allocated size of send buffer */
+  size_t            recv_size;    /* Allocated size of receive buffer */
+  cs_real_t        *send_buffer;  /* Send buffer (all arrays, by rank) */
+  cs_real_t        *recv_buffer;  /* Receive buffer (all arrays, by rank) */
+
+#if defined(HAVE_MPI)
+  int               request_size; /* Allocated size of request arrays */
+  MPI_Request      *request;      /* MPI requests */
+  MPI_Status       *status;       /* MPI status */
+#endif
+
+};
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Id of "mpi_wait" timer statistic (-2 if not looked up yet) */
+
+static int  _mpi_wait_stat_id = -2;
+
+#endif
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Copy local periodic values for all arrays of a halo batch.
+ *
+ * parameters:
+ *   b             <-> pointer to halo batch structure
+ *   end_shift     <-- 1 for standard halo, 2 for extended halo
+ *   local_rank_id <-- id of local rank in halo communicating ranks
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_local_values(cs_halo_batch_t  *b,
+                   cs_lnum_t         end_shift,
+                   int               local_rank_id)
+{
+  const cs_halo_t *halo = b->halo;
+
+  const cs_lnum_t start = halo->send_index[2*local_rank_id];
+  const cs_lnum_t length =   halo->send_index[2*local_rank_id + end_shift]
+                           - halo->send_index[2*local_rank_id];
+  const cs_lnum_t *send_list = halo->send_list + start;
+
+  for (int v_id = 0; v_id < b->n_vars; v_id++) {
+
+    const int stride = b->strides[v_id];
+    cs_real_t *var = b->vars[v_id];
+    cs_real_t *recv_var
+      = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+    for (cs_lnum_t i = 0; i < length; i++) {
+      for (int j = 0; j < stride; j++)
+        recv_var[i*stride + j] = var[send_list[i]*stride + j];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Apply periodicity of rotation to arrays of a halo batch.
+ *
+ * parameters:
+ *   b <-> pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_apply_rotation(cs_halo_batch_t  *b)
+{
+  for (int v_id = 0; v_id < b->n_vars; v_id++) {
+
+    if (b->rotate[v_id] == false)
+      continue;
+
+    switch(b->strides[v_id]) {
+    case 9:
+      cs_halo_perio_sync_var_tens(b->halo, b->sync_mode, b->vars[v_id]);
+      break;
+    case 6:
+      cs_halo_perio_sync_var_sym_tens(b->halo, b->sync_mode, b->vars[v_id]);
+      break;
+    case 3:
+      cs_halo_perio_sync_var_vect(b->halo, b->sync_mode, b->vars[v_id], 3);
+      break;
+    default:
+      break;
+    }
+
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a halo batch structure.
+ *
+ * A halo batch allows synchronizing several arrays sharing a same halo
+ * with a single message per communicating rank: values of all registered
+ * arrays are packed in a common buffer, exchanged, then unpacked.
+ *
+ * Arrays may have different strides. The same batch may be synchronized
+ * any number of times, so that the associated buffers are reused.
+ *
+ * parameters:
+ *   halo      <-- pointer to associated halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *
+ * returns:
+ *   pointer to created halo batch structure
+ *----------------------------------------------------------------------------*/
+
+cs_halo_batch_t *
+cs_halo_batch_create(const cs_halo_t  *halo,
+                     cs_halo_type_t    sync_mode)
+{
+  cs_halo_batch_t *b = NULL;
+
+  assert(halo != NULL);
+
+  BFT_MALLOC(b, 1, cs_halo_batch_t);
+
+  b->halo = halo;
+  b->sync_mode = sync_mode;
+
+  b->n_vars = 0;
+  b->n_vars_max = 0;
+  b->stride_sum = 0;
+
+  b->vars = NULL;
+  b->strides = NULL;
+  b->rotate = NULL;
+
+  b->send_size = 0;
+  b->recv_size = 0;
+  b->send_buffer = NULL;
+  b->recv_buffer = NULL;
+
+#if defined(HAVE_MPI)
+  b->request_size = halo->n_c_domains*2;
+  BFT_MALLOC(b->request, b->request_size, MPI_Request);
+  BFT_MALLOC(b->status, b->request_size, MPI_Status);
+#endif
+
+  return b;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a halo batch structure.
+ *
+ * parameters:
+ *   batch <-> pointer to pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_destroy(cs_halo_batch_t  **batch)
+{
+  if (batch == NULL)
+    return;
+
+  cs_halo_batch_t *b = *batch;
+
+  if (b == NULL)
+    return;
+
+#if defined(HAVE_MPI)
+  BFT_FREE(b->request);
+  BFT_FREE(b->status);
+#endif
+
+  BFT_FREE(b->send_buffer);
+  BFT_FREE(b->recv_buffer);
+
+  BFT_FREE(b->rotate);
+  BFT_FREE(b->strides);
+  BFT_FREE(b->vars);
+
+  BFT_FREE(*batch);
+}
+
+/*----------------------------------------------------------------------------
+ * Remove all arrays registered in a halo batch, keeping its buffers.
+ *
+ * parameters:
+ *   batch <-> pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_clear(cs_halo_batch_t  *batch)
+{
+  batch->n_vars = 0;
+  batch->stride_sum = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Register an array in a halo batch.
+ *
+ * If apply_rotation is true, periodicity of rotation is applied to ghost
+ * values after exchange, based on the stride: 3 for a vector, 6 for a
+ * symmetric tensor, 9 for a tensor (other strides are only copied).
+ *
+ * parameters:
+ *   batch          <-> pointer to halo batch structure
+ *   var            <-> pointer to variable value array
+ *   stride         <-- number of (interlaced) values by entity
+ *   apply_rotation <-- apply periodicity of rotation to ghost values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_add(cs_halo_batch_t  *batch,
+                  cs_real_t         var[],
+                  int               stride,
+                  bool              apply_rotation)
+{
+  cs_halo_batch_t *b = batch;
+
+  if (stride < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid stride (%d)."), __func__, stride);
+
+  if (b->n_vars >= b->n_vars_max) {
+    b->n_vars_max = (b->n_vars_max > 0) ? b->n_vars_max*2 : 4;
+    BFT_REALLOC(b->vars, b->n_vars_max, cs_real_t *);
+    BFT_REALLOC(b->strides, b->n_vars_max, int);
+    BFT_REALLOC(b->rotate, b->n_vars_max, bool);
+  }
+
+  b->vars[b->n_vars] = var;
+  b->strides[b->n_vars] = stride;
+  b->rotate[b->n_vars] = apply_rotation;
+
+  b->n_vars += 1;
+  b->stride_sum += stride;
+}
+
+/*----------------------------------------------------------------------------
+ * Update halo values of all arrays registered in a halo batch.
+ *
+ * This is equivalent to calling cs_halo_sync_var_strided() (followed by
+ * the matching cs_halo_perio_sync_var_* function when rotation is
+ * requested) for each array, using a single message per communicating
+ * rank instead of one per array.
+ *
+ * parameters:
+ *   batch <-> pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_sync(cs_halo_batch_t  *batch)
+{
+  cs_halo_batch_t *b = batch;
+
+  if (b->n_vars == 0)
+    return;
+
+  const cs_halo_t *halo = b->halo;
+  const cs_lnum_t end_shift = (b->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int request_count = 0;
+    const int local_rank = cs_glob_rank_id;
+    const size_t stride_sum = b->stride_sum;
+
+    /* Buffers are indexed as halo values, so their size is based on
+       the extended halo, whatever the synchronization mode */
+
+    size_t send_size = halo->send_index[2*halo->n_c_domains] * stride_sum;
+    size_t recv_size = halo->index[2*halo->n_c_domains] * stride_sum;
+
+    if (send_size > b->send_size) {
+      b->send_size = send_size;
+      BFT_REALLOC(b->send_buffer, b->send_size, cs_real_t);
+    }
+    if (recv_size > b->recv_size) {
+      b->recv_size = recv_size;
+      BFT_REALLOC(b->recv_buffer, b->recv_size, cs_real_t);
+    }
+
+    /* The halo may have been rebuilt with more communicating ranks
+       since the batch was created (e.g. with turbomachinery) */
+
+    if (halo->n_c_domains*2 > b->request_size) {
+      b->request_size = halo->n_c_domains*2;
+      BFT_REALLOC(b->request, b->request_size, MPI_Request);
+      BFT_REALLOC(b->status, b->request_size, MPI_Status);
+    }
+
+    /* Receive data from distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                          - halo->index[2*rank_id]) * stride_sum;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+        if (length > 0)
+          MPI_Irecv(b->recv_buffer + halo->index[2*rank_id]*stride_sum,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(b->request[request_count++]));
+      }
+      else
+        local_rank_id = rank_id;
+
+    }
+
+    /* Assemble buffers for halo exchange: for each rank, values of
+       successive arrays are contiguous */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        const cs_lnum_t start = halo->send_index[2*rank_id];
+        const cs_lnum_t length =   halo->send_index[2*rank_id + end_shift]
+                                 - halo->send_index[2*rank_id];
+        const cs_lnum_t *send_list = halo->send_list + start;
+
+        cs_real_t *build_buffer = b->send_buffer + start*stride_sum;
+
+        for (int v_id = 0; v_id < b->n_vars; v_id++) {
+
+          const int stride = b->strides[v_id];
+          const cs_real_t *var = b->vars[v_id];
+
+          if (stride == 1) {
+            for (cs_lnum_t i = 0; i < length; i++)
+              build_buffer[i] = var[send_list[i]];
+          }
+          else {
+            for (cs_lnum_t i = 0; i < length; i++) {
+              for (int j = 0; j < stride; j++)
+                build_buffer[i*stride + j] = var[send_list[i]*stride + j];
+            }
+          }
+
+          build_buffer += length*stride;
+
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (cs_halo_get_use_barrier())
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        cs_lnum_t start = halo->send_index[2*rank_id];
+        cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                            - halo->send_index[2*rank_id]) * stride_sum;
+
+        if (length > 0)
+          MPI_Isend(b->send_buffer + start*stride_sum,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(b->request[request_count++]));
+
+      }
+
+    }
+
+    /* Wait for all exchanges */
+
+    if (_mpi_wait_stat_id < -1)
+      _mpi_wait_stat_id = cs_timer_stats_id_by_name("mpi_wait");
+
+    if (_mpi_wait_stat_id > -1) {
+      cs_timer_t t0 = cs_timer_time();
+      MPI_Waitall(request_count, b->request, b->status);
+      cs_timer_t t1 = cs_timer_time();
+      cs_timer_stats_add_diff(_mpi_wait_stat_id, &t0, &t1);
+    }
+    else
+      MPI_Waitall(request_count, b->request, b->status);
+
+    /* Scatter received values to arrays */
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        const cs_lnum_t start = halo->index[2*rank_id];
+        const cs_lnum_t length =   halo->index[2*rank_id + end_shift]
+                                 - halo->index[2*rank_id];
+
+        const cs_real_t *recv_buffer = b->recv_buffer + start*stride_sum;
+
+        for (int v_id = 0; v_id < b->n_vars; v_id++) {
+
+          const int stride = b->strides[v_id];
+          cs_real_t *var = b->vars[v_id];
+
+          memcpy(var + (halo->n_local_elts + start)*stride,
+                 recv_buffer,
+                 length*stride*sizeof(cs_real_t));
+
+          recv_buffer += length*stride;
+
+        }
+
+      }
+
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0) {
+
+    if (local_rank_id > -1)
+      _copy_local_values(b, end_shift, local_rank_id);
+
+    if (halo->n_rotations > 0)
+      _apply_rotation(b);
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
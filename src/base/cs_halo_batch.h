@@ -0,0 +1,134 @@
+#ifndef __CS_HALO_BATCH_H__
+#define __CS_HALO_BATCH_H__
+
+/*============================================================================
+ * Aggregated halo synchronization of multiple arrays
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_base.h"
+#include "cs_halo.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Opaque halo batch structure */
+
+typedef struct _cs_halo_batch_t  cs_halo_batch_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a halo batch structure.
+ *
+ * A halo batch allows synchronizing several arrays sharing a same halo
+ * with a single message per communicating rank: values of all registered
+ * arrays are packed in a common buffer, exchanged, then unpacked.
+ *
+ * Arrays may have different strides. The same batch may be synchronized
+ * any number of times, so that the associated buffers are reused.
+ *
+ * parameters:
+ *   halo      <-- pointer to associated halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *
+ * returns:
+ *   pointer to created halo batch structure
+ *----------------------------------------------------------------------------*/
+
+cs_halo_batch_t *
+cs_halo_batch_create(const cs_halo_t  *halo,
+                     cs_halo_type_t    sync_mode);
+
+/*----------------------------------------------------------------------------
+ * Destroy a halo batch structure.
+ *
+ * parameters:
+ *   batch <-> pointer to pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_destroy(cs_halo_batch_t  **batch);
+
+/*----------------------------------------------------------------------------
+ * Remove all arrays registered in a halo batch, keeping its buffers.
+ *
+ * parameters:
+ *   batch <-> pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_clear(cs_halo_batch_t  *batch);
+
+/*----------------------------------------------------------------------------
+ * Register an array in a halo batch.
+ *
+ * If apply_rotation is true, periodicity of rotation is applied to ghost
+ * values after exchange, based on the stride: 3 for a vector, 6 for a
+ * symmetric tensor, 9 for a tensor (other strides are only copied).
+ *
+ * parameters:
+ *   batch          <-> pointer to halo batch structure
+ *   var            <-> pointer to variable value array
+ *   stride         <-- number of (interlaced) values by entity
+ *   apply_rotation <-- apply periodicity of rotation to ghost values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_add(cs_halo_batch_t  *batch,
+                  cs_real_t         var[],
+                  int               stride,
+                  bool              apply_rotation);
+
+/*----------------------------------------------------------------------------
+ * Update halo values of all arrays registered in a halo batch.
+ *
+ * This is equivalent to calling cs_halo_sync_var_strided() (followed by
+ * the matching cs_halo_perio_sync_var_* function when rotation is
+ * requested) for each array, using a single message per communicating
+ * rank instead of one per array.
+ *
+ * parameters:
+ *   batch <-> pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_batch_sync(cs_halo_batch_t  *batch);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_HALO_BATCH_H__ */
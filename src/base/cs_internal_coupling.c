@@ -85,10 +85,52 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum stride for which persistent communication requests are kept */
+
+#define _IC_EXCHANGE_MAX_STRIDE 9
+
 /*============================================================================
  * Local structure definitions
  *============================================================================*/
 
+/* Communication buffers and requests for a given stride */
+
+typedef struct {
+
+  cs_real_t    *send_buf;         /* Send buffer */
+  cs_real_t    *recv_buf;         /* Receive buffer */
+
+#if defined(HAVE_MPI)
+  MPI_Request  *request;          /* Receive then send requests */
+#endif
+
+} _ic_exchange_requests_t;
+
+/* Exchange pattern for coupled values */
+
+struct _cs_internal_coupling_exchange_t {
+
+  cs_lnum_t    n_local_pairs;     /* Number of local points whose value
+                                     comes from the same rank */
+  cs_lnum_t   *local_dest;        /* Local point ids for same-rank pairs */
+  cs_lnum_t   *local_src;         /* Matching distant point ids */
+
+  int          n_send_ranks;      /* Number of ranks to send values to */
+  int          n_recv_ranks;      /* Number of ranks to receive values from */
+  int         *send_rank;         /* Ranks to send values to */
+  int         *recv_rank;         /* Ranks to receive values from */
+  cs_lnum_t   *send_index;        /* Index on send_list (n_send_ranks + 1) */
+  cs_lnum_t   *send_list;         /* Distant point ids to send */
+  cs_lnum_t   *recv_index;        /* Index on recv_list (n_recv_ranks + 1) */
+  cs_lnum_t   *recv_list;         /* Local point ids to receive */
+
+  cs_lnum_t   *distant_cell_id;   /* Cell adjacent to each distant face */
+
+  /* Persistent requests, by stride */
+  _ic_exchange_requests_t  req[_IC_EXCHANGE_MAX_STRIDE + 1];
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -332,6 +374,414 @@ _create_locator(cs_internal_coupling_t  *cpl)
   return locator;
 }
 
+/*----------------------------------------------------------------------------
+ * Build exchange pattern for a coupling entity, based on its locator.
+ *
+ * Values of distant points located on the same rank are copied directly,
+ * and other values are exchanged using point-to-point communication with
+ * only the ranks actually involved.
+ *
+ * parameters:
+ *   cpl <-- pointer to coupling structure
+ *
+ * returns:
+ *   pointer to exchange structure, or NULL if some points were not
+ *   located (in which case the locator is used directly)
+ *----------------------------------------------------------------------------*/
+
+static cs_internal_coupling_exchange_t *
+_exchange_create(const cs_internal_coupling_t  *cpl)
+{
+  const cs_lnum_t n_local = cpl->n_local;
+  const cs_lnum_t n_distant = cpl->n_distant;
+  const cs_lnum_t *b_face_cells = cs_glob_mesh->b_face_cells;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  int n_unlocated = (ple_locator_get_n_interior(cpl->locator) != n_local);
+  cs_parall_max(1, CS_INT_TYPE, &n_unlocated);
+
+  if (n_unlocated > 0)
+    return NULL;
+
+  /* Send (rank, distant point id) pairs through the locator, so that
+     each local point knows where its value comes from */
+
+  cs_lnum_t *d_src = NULL, *l_src = NULL;
+  BFT_MALLOC(d_src, n_distant*2, cs_lnum_t);
+  BFT_MALLOC(l_src, n_local*2, cs_lnum_t);
+
+  for (cs_lnum_t ii = 0; ii < n_distant; ii++) {
+    d_src[ii*2] = local_rank;
+    d_src[ii*2 + 1] = ii;
+  }
+
+  ple_locator_exchange_point_var(cpl->locator,
+                                 d_src,
+                                 l_src,
+                                 NULL,
+                                 sizeof(cs_lnum_t),
+                                 2,
+                                 0);
+
+  BFT_FREE(d_src);
+
+  cs_internal_coupling_exchange_t *ex = NULL;
+  BFT_MALLOC(ex, 1, cs_internal_coupling_exchange_t);
+
+  /* Same-rank pairs */
+
+  ex->n_local_pairs = 0;
+  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+    if (l_src[ii*2] == local_rank)
+      ex->n_local_pairs += 1;
+  }
+
+  BFT_MALLOC(ex->local_dest, ex->n_local_pairs, cs_lnum_t);
+  BFT_MALLOC(ex->local_src, ex->n_local_pairs, cs_lnum_t);
+
+  ex->n_local_pairs = 0;
+  for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+    if (l_src[ii*2] == local_rank) {
+      ex->local_dest[ex->n_local_pairs] = ii;
+      ex->local_src[ex->n_local_pairs] = l_src[ii*2 + 1];
+      ex->n_local_pairs += 1;
+    }
+  }
+
+  BFT_MALLOC(ex->distant_cell_id, n_distant, cs_lnum_t);
+  for (cs_lnum_t ii = 0; ii < n_distant; ii++)
+    ex->distant_cell_id[ii] = b_face_cells[cpl->faces_distant[ii]];
+
+  /* Remote pairs */
+
+  ex->n_send_ranks = 0;
+  ex->n_recv_ranks = 0;
+  ex->send_rank = NULL;
+  ex->recv_rank = NULL;
+  ex->send_list = NULL;
+  ex->recv_list = NULL;
+
+  BFT_MALLOC(ex->send_index, 1, cs_lnum_t);
+  BFT_MALLOC(ex->recv_index, 1, cs_lnum_t);
+  ex->send_index[0] = 0;
+  ex->recv_index[0] = 0;
+
+  for (int s = 0; s <= _IC_EXCHANGE_MAX_STRIDE; s++) {
+    ex->req[s].send_buf = NULL;
+    ex->req[s].recv_buf = NULL;
+#if defined(HAVE_MPI)
+    ex->req[s].request = NULL;
+#endif
+  }
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int n_ranks = cs_glob_n_ranks;
+
+    int *send_count, *recv_count, *send_displ, *recv_displ;
+    BFT_MALLOC(send_count, n_ranks, int);
+    BFT_MALLOC(recv_count, n_ranks, int);
+    BFT_MALLOC(send_displ, n_ranks, int);
+    BFT_MALLOC(recv_displ, n_ranks, int);
+
+    for (int r = 0; r < n_ranks; r++)
+      recv_count[r] = 0;
+
+    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+      if (l_src[ii*2] != local_rank)
+        recv_count[l_src[ii*2]] += 1;
+    }
+
+    MPI_Alltoall(recv_count, 1, MPI_INT, send_count, 1, MPI_INT,
+                 cs_glob_mpi_comm);
+
+    send_displ[0] = 0;
+    recv_displ[0] = 0;
+    for (int r = 1; r < n_ranks; r++) {
+      send_displ[r] = send_displ[r-1] + send_count[r-1];
+      recv_displ[r] = recv_displ[r-1] + recv_count[r-1];
+    }
+
+    for (int r = 0; r < n_ranks; r++) {
+      if (send_count[r] > 0)
+        ex->n_send_ranks += 1;
+      if (recv_count[r] > 0)
+        ex->n_recv_ranks += 1;
+    }
+
+    BFT_MALLOC(ex->send_rank, ex->n_send_ranks, int);
+    BFT_MALLOC(ex->recv_rank, ex->n_recv_ranks, int);
+    BFT_REALLOC(ex->send_index, ex->n_send_ranks + 1, cs_lnum_t);
+    BFT_REALLOC(ex->recv_index, ex->n_recv_ranks + 1, cs_lnum_t);
+
+    ex->n_send_ranks = 0;
+    ex->n_recv_ranks = 0;
+
+    for (int r = 0; r < n_ranks; r++) {
+      if (send_count[r] > 0) {
+        ex->send_rank[ex->n_send_ranks] = r;
+        ex->n_send_ranks += 1;
+        ex->send_index[ex->n_send_ranks] = send_displ[r] + send_count[r];
+      }
+      if (recv_count[r] > 0) {
+        ex->recv_rank[ex->n_recv_ranks] = r;
+        ex->n_recv_ranks += 1;
+        ex->recv_index[ex->n_recv_ranks] = recv_displ[r] + recv_count[r];
+      }
+    }
+
+    const cs_lnum_t n_send = ex->send_index[ex->n_send_ranks];
+    const cs_lnum_t n_recv = ex->recv_index[ex->n_recv_ranks];
+
+    /* Local point ids are grouped by source rank, and matching distant
+       point ids are sent to the source ranks */
+
+    cs_lnum_t *recv_src;
+    BFT_MALLOC(ex->send_list, n_send, cs_lnum_t);
+    BFT_MALLOC(ex->recv_list, n_recv, cs_lnum_t);
+    BFT_MALLOC(recv_src, n_recv, cs_lnum_t);
+
+    for (cs_lnum_t ii = 0; ii < n_local; ii++) {
+      int r = l_src[ii*2];
+      if (r != local_rank) {
+        cs_lnum_t k = recv_displ[r];
+        ex->recv_list[k] = ii;
+        recv_src[k] = l_src[ii*2 + 1];
+        recv_displ[r] += 1;
+      }
+    }
+
+    for (int r = 0; r < n_ranks; r++)
+      recv_displ[r] -= recv_count[r];
+
+    MPI_Alltoallv(recv_src, recv_count, recv_displ, CS_MPI_LNUM,
+                  ex->send_list, send_count, send_displ, CS_MPI_LNUM,
+                  cs_glob_mpi_comm);
+
+    BFT_FREE(recv_src);
+
+    BFT_FREE(recv_displ);
+    BFT_FREE(send_displ);
+    BFT_FREE(recv_count);
+    BFT_FREE(send_count);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_FREE(l_src);
+
+  return ex;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy exchange pattern of a coupling entity.
+ *
+ * parameters:
+ *   ex <-> pointer to exchange structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_destroy(cs_internal_coupling_exchange_t  **ex)
+{
+  cs_internal_coupling_exchange_t *_ex = *ex;
+
+  if (_ex == NULL)
+    return;
+
+  for (int s = 0; s <= _IC_EXCHANGE_MAX_STRIDE; s++) {
+#if defined(HAVE_MPI)
+    if (_ex->req[s].request != NULL) {
+      int n_requests = _ex->n_send_ranks + _ex->n_recv_ranks;
+      for (int i = 0; i < n_requests; i++)
+        MPI_Request_free(_ex->req[s].request + i);
+      BFT_FREE(_ex->req[s].request);
+    }
+#endif
+    BFT_FREE(_ex->req[s].send_buf);
+    BFT_FREE(_ex->req[s].recv_buf);
+  }
+
+  BFT_FREE(_ex->distant_cell_id);
+  BFT_FREE(_ex->recv_list);
+  BFT_FREE(_ex->recv_index);
+  BFT_FREE(_ex->send_list);
+  BFT_FREE(_ex->send_index);
+  BFT_FREE(_ex->recv_rank);
+  BFT_FREE(_ex->send_rank);
+  BFT_FREE(_ex->local_src);
+  BFT_FREE(_ex->local_dest);
+
+  BFT_FREE(*ex);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Initialize communication buffers and requests for a given stride.
+ *
+ * If persistent is true, persistent requests are initialized, and will be
+ * started using MPI_Startall; otherwise, only buffers are allocated.
+ *
+ * parameters:
+ *   ex         <-- pointer to exchange structure
+ *   stride     <-- number of values per point
+ *   persistent <-- initialize persistent requests
+ *   r          <-> pointer to requests structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_requests_init(const cs_internal_coupling_exchange_t  *ex,
+                        int                                     stride,
+                        bool                                    persistent,
+                        _ic_exchange_requests_t                *r)
+{
+  const int n_requests = ex->n_send_ranks + ex->n_recv_ranks;
+  const int tag = 0;
+
+  BFT_MALLOC(r->send_buf, ex->send_index[ex->n_send_ranks]*stride, cs_real_t);
+  BFT_MALLOC(r->recv_buf, ex->recv_index[ex->n_recv_ranks]*stride, cs_real_t);
+  BFT_MALLOC(r->request, n_requests, MPI_Request);
+
+  if (! persistent)
+    return;
+
+  for (int i = 0; i < ex->n_recv_ranks; i++) {
+    cs_lnum_t s_id = ex->recv_index[i];
+    int n_vals = (ex->recv_index[i+1] - s_id)*stride;
+    MPI_Recv_init(r->recv_buf + s_id*stride, n_vals, CS_MPI_REAL,
+                  ex->recv_rank[i], tag, cs_glob_mpi_comm,
+                  r->request + i);
+  }
+
+  for (int i = 0; i < ex->n_send_ranks; i++) {
+    cs_lnum_t s_id = ex->send_index[i];
+    int n_vals = (ex->send_index[i+1] - s_id)*stride;
+    MPI_Send_init(r->send_buf + s_id*stride, n_vals, CS_MPI_REAL,
+                  ex->send_rank[i], tag, cs_glob_mpi_comm,
+                  r->request + ex->n_recv_ranks + i);
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Exchange values from distant to local points using exchange pattern.
+ *
+ * Values for distant point ii are read from src[src_id[ii]*stride], or
+ * src[ii*stride] if src_id is NULL.
+ *
+ * parameters:
+ *   ex     <-> pointer to exchange structure
+ *   stride <-- number of values per point (interleaved)
+ *   src    <-- source values
+ *   src_id <-- source ids of distant points, or NULL
+ *   local  --> local values, size n_local*stride
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_apply(cs_internal_coupling_exchange_t  *ex,
+                int                               stride,
+                const cs_real_t                   src[],
+                const cs_lnum_t                  *src_id,
+                cs_real_t                         local[])
+{
+#if defined(HAVE_MPI)
+
+  const int n_requests = ex->n_send_ranks + ex->n_recv_ranks;
+  const bool persistent = (stride <= _IC_EXCHANGE_MAX_STRIDE);
+
+  _ic_exchange_requests_t _r = {.send_buf = NULL,
+                                .recv_buf = NULL,
+                                .request = NULL};
+  _ic_exchange_requests_t *r = (persistent) ? ex->req + stride : &_r;
+
+  if (n_requests > 0) {
+
+    if (r->request == NULL)
+      _exchange_requests_init(ex, stride, persistent, r);
+
+    /* Pack values to send */
+
+    const cs_lnum_t n_send = ex->send_index[ex->n_send_ranks];
+    cs_real_t *send_buf = r->send_buf;
+
+#   pragma omp parallel for if (n_send > CS_THR_MIN)
+    for (cs_lnum_t k = 0; k < n_send; k++) {
+      cs_lnum_t ii = ex->send_list[k];
+      cs_lnum_t e_id = (src_id != NULL) ? src_id[ii] : ii;
+      for (int jj = 0; jj < stride; jj++)
+        send_buf[k*stride + jj] = src[e_id*stride + jj];
+    }
+
+    if (persistent)
+      MPI_Startall(n_requests, r->request);
+
+    else {
+      const int tag = 0;
+      for (int i = 0; i < ex->n_recv_ranks; i++) {
+        cs_lnum_t s_id = ex->recv_index[i];
+        MPI_Irecv(r->recv_buf + s_id*stride,
+                  (ex->recv_index[i+1] - s_id)*stride, CS_MPI_REAL,
+                  ex->recv_rank[i], tag, cs_glob_mpi_comm,
+                  r->request + i);
+      }
+      for (int i = 0; i < ex->n_send_ranks; i++) {
+        cs_lnum_t s_id = ex->send_index[i];
+        MPI_Isend(r->send_buf + s_id*stride,
+                  (ex->send_index[i+1] - s_id)*stride, CS_MPI_REAL,
+                  ex->send_rank[i], tag, cs_glob_mpi_comm,
+                  r->request + ex->n_recv_ranks + i);
+      }
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Same-rank values are copied directly (overlapping communication) */
+
+  const cs_lnum_t n_local_pairs = ex->n_local_pairs;
+
+# pragma omp parallel for if (n_local_pairs > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n_local_pairs; k++) {
+    cs_lnum_t ii = ex->local_src[k];
+    cs_lnum_t e_id = (src_id != NULL) ? src_id[ii] : ii;
+    cs_lnum_t l_id = ex->local_dest[k];
+    for (int jj = 0; jj < stride; jj++)
+      local[l_id*stride + jj] = src[e_id*stride + jj];
+  }
+
+#if defined(HAVE_MPI)
+
+  if (n_requests > 0) {
+
+    MPI_Waitall(n_requests, r->request, MPI_STATUSES_IGNORE);
+
+    /* Unpack received values */
+
+    const cs_lnum_t n_recv = ex->recv_index[ex->n_recv_ranks];
+    const cs_real_t *recv_buf = r->recv_buf;
+
+#   pragma omp parallel for if (n_recv > CS_THR_MIN)
+    for (cs_lnum_t k = 0; k < n_recv; k++) {
+      cs_lnum_t l_id = ex->recv_list[k];
+      for (int jj = 0; jj < stride; jj++)
+        local[l_id*stride + jj] = recv_buf[k*stride + jj];
+    }
+
+    if (! persistent) {
+      BFT_FREE(_r.request);
+      BFT_FREE(_r.send_buf);
+      BFT_FREE(_r.recv_buf);
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
 /*----------------------------------------------------------------------------
  * Destruction of given internal coupling structure.
  *
@@ -354,6 +804,7 @@ _destroy_entity(cs_internal_coupling_t  *cpl)
   BFT_FREE(cpl->cells_criteria);
   BFT_FREE(cpl->faces_criteria);
   BFT_FREE(cpl->namesca);
+  _exchange_destroy(&(cpl->exchange));
   ple_locator_destroy(cpl->locator);
 }
 
@@ -618,6 +1069,8 @@ _cpl_initialize(cs_internal_coupling_t *cpl)
   cpl->n_distant = 0;
   cpl->faces_distant = NULL;
 
+  cpl->exchange = NULL;
+
   cpl->coupled_faces = NULL;
 
   /* cpl->h_int = NULL; */
@@ -825,6 +1278,10 @@ _locator_initialize(cs_mesh_t               *m,
   for (cs_lnum_t i = 0; i < cpl->n_distant; i++)
     cpl->faces_distant[i] = faces_distant_num[i] - 1;
 
+  /* Exchange pattern, avoiding the locator's generic exchange */
+
+  cpl->exchange = _exchange_create(cpl);
+
   /* Geometric quantities */
 
   BFT_MALLOC(cpl->g_weight, cpl->n_local, cs_real_t);
@@ -2152,13 +2609,17 @@ cs_internal_coupling_exchange_var(const cs_internal_coupling_t  *cpl,
                                   cs_real_t                      distant[],
                                   cs_real_t                      local[])
 {
-  ple_locator_exchange_point_var(cpl->locator,
-                                 distant,
-                                 local,
-                                 NULL,
-                                 sizeof(cs_real_t),
-                                 stride,
-                                 0);
+  if (cpl->exchange != NULL)
+    _exchange_apply(cpl->exchange, stride, distant, NULL, local);
+
+  else
+    ple_locator_exchange_point_var(cpl->locator,
+                                   distant,
+                                   local,
+                                   NULL,
+                                   sizeof(cs_real_t),
+                                   stride,
+                                   0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2181,6 +2642,17 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
   int jj;
   cs_lnum_t face_id, cell_id;
 
+  /* Values are read directly from tab when possible */
+
+  if (cpl->exchange != NULL) {
+    _exchange_apply(cpl->exchange,
+                    stride,
+                    tab,
+                    cpl->exchange->distant_cell_id,
+                    local);
+    return;
+  }
+
   const cs_lnum_t n_distant = cpl->n_distant;
   const cs_lnum_t *faces_distant = cpl->faces_distant;
 
@@ -2227,6 +2699,17 @@ cs_internal_coupling_exchange_by_face_id(const cs_internal_coupling_t  *cpl,
                                          const cs_real_t                tab[],
                                          cs_real_t                      local[])
 {
+  /* Values are read directly from tab when possible */
+
+  if (cpl->exchange != NULL) {
+    _exchange_apply(cpl->exchange,
+                    stride,
+                    tab,
+                    cpl->faces_distant,
+                    local);
+    return;
+  }
+
   const cs_lnum_t n_distant = cpl->n_distant;
   const cs_lnum_t *faces_distant = cpl->faces_distant;
 
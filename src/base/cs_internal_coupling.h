@@ -57,6 +57,11 @@ BEGIN_C_DECLS
  *============================================================================*/
 
 
+/* Opaque exchange structure for coupled values */
+
+typedef struct _cs_internal_coupling_exchange_t
+  cs_internal_coupling_exchange_t;
+
 /* Internal coupling structure definition */
 
 typedef struct {
@@ -75,6 +80,10 @@ typedef struct {
   cs_lnum_t  n_distant; /* Number of faces in faces_distant */
   cs_lnum_t *faces_distant; /* Distant boundary faces associated with locator */
 
+  /* Exchange pattern built from locator (direct copies for same-rank
+     pairs, persistent communication for others), or NULL */
+  cs_internal_coupling_exchange_t  *exchange;
+
   /* face i is coupled in this entity if coupled_faces[i] = true */
   bool *coupled_faces;
 
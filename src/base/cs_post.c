@@ -3381,6 +3381,7 @@ _check_non_transient(const cs_post_writer_t  *writer,
  * - \c \b EnSight \c \b Gold (\c \b EnSight also accepted)
  * - \c \b MED
  * - \c \b CGNS
+ * - \c \b XDMF (with heavy data in a single HDF5 file)
  * - \c \b CCM (only for the full volume and boundary meshes)
  * - \c \b Catalyst (in-situ visualization)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
@@ -3414,6 +3415,18 @@ _check_non_transient(const cs_post_writer_t  *writer,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b serial_io to write data through rank 0 only, rather than using
+ *         parallel HDF5 collective writes when available (for \c \b XDMF).
+ * - \c \b chunk_size=<n> to use chunked datasets, with \c n entities
+ *         per chunk (for \c \b XDMF).
+ * - \c \b gzip or \c \b gzip=<level> to compress datasets using the
+ *         deflate filter (for \c \b XDMF).
+ * - \c \b shuffle to apply the shuffle filter before compression
+ *         (for \c \b XDMF).
+ * - \c \b lossy_digits=<d> to store field values using error-bounded
+ *         lossy compression (HDF5 scale-offset filter), keeping \c d
+ *         decimal digits, so that the absolute error is at most
+ *         0.5*10^-d (for \c \b XDMF).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -107,6 +107,131 @@ int cs_glob_post_util_flag[CS_POST_UTIL_N_TYPES]
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Select cells adjacent to flagged faces.
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   i_flag    <-- flag for interior faces (1 if selected, 0 otherwise)
+ *   b_flag    <-- flag for boundary faces (1 if selected, 0 otherwise),
+ *                 or NULL
+ *   n_cells   --> number of selected cells
+ *   cell_ids  --> array of selected cell ids (0 to n-1 numbering)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cells_adjacent_to_faces(const cs_mesh_t   *m,
+                         const char         i_flag[],
+                         const char         b_flag[],
+                         cs_lnum_t         *n_cells,
+                         cs_lnum_t        **cell_ids)
+{
+  cs_lnum_t _n_cells = m->n_cells;
+  cs_lnum_t *_cell_ids = NULL;
+
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  BFT_MALLOC(_cell_ids, _n_cells, cs_lnum_t);
+
+# pragma omp parallel for if (_n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < _n_cells; cell_id++)
+    _cell_ids[cell_id] = -1;
+
+  /* Mark cells adjacent to flagged faces; as for the segment-based
+     selection, use the face numbering so as to avoid thread races */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+        if (i_flag[face_id]) {
+          cs_lnum_t  c_id0 = m->i_face_cells[face_id][0];
+          cs_lnum_t  c_id1 = m->i_face_cells[face_id][1];
+          if (c_id0 < _n_cells)
+            _cell_ids[c_id0] = 1;
+          if (c_id1 < _n_cells)
+            _cell_ids[c_id1] = 1;
+        }
+      }
+    }
+
+  }
+
+  if (b_flag != NULL) {
+
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
+          if (b_flag[face_id])
+            _cell_ids[m->b_face_cells[face_id]] = 1;
+        }
+      }
+
+    }
+
+  }
+
+  /* Now compact marked cells */
+
+  _n_cells = 0;
+  for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
+    if (_cell_ids[cell_id] >= 0)
+      _cell_ids[_n_cells++] = cell_id;
+  }
+
+  BFT_REALLOC(_cell_ids, _n_cells, cs_lnum_t);
+
+  *n_cells = _n_cells;
+  *cell_ids = _cell_ids;
+}
+
+/*----------------------------------------------------------------------------
+ * Flag faces whose vertices are not all strictly on the same side
+ * of a plane.
+ *
+ * parameters:
+ *   n_faces     <-- number of faces
+ *   vtx_idx     <-- face -> vertices index
+ *   vtx_lst     <-- face -> vertices connectivity
+ *   v_side      <-- side of each vertex relative to plane (-1, 0, or 1)
+ *   face_flag   --> 1 for faces cut by plane, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static void
+_flag_faces_cut_by_plane(cs_lnum_t          n_faces,
+                         const cs_lnum_t    vtx_idx[],
+                         const cs_lnum_t    vtx_lst[],
+                         const int          v_side[],
+                         char               face_flag[])
+{
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
+    int s_min = 1, s_max = -1;
+    for (cs_lnum_t i = vtx_idx[face_id]; i < vtx_idx[face_id+1]; i++) {
+      int s = v_side[vtx_lst[i]];
+      if (s < s_min)
+        s_min = s;
+      if (s > s_max)
+        s_max = s;
+    }
+    face_flag[face_id] = (s_min <= 0 && s_max >= 0) ? 1 : 0;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -283,6 +408,154 @@ cs_cell_segment_intersect_select(void        *input,
   *cell_ids = _cell_ids;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select cells cut by a given plane
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to output fields on a slice of cells rather
+ * than on the whole volume.
+ *
+ * In this case, the input points to a real array containing the plane's
+ * coefficients [a, b, c, d], the plane being defined by ax + by + cz + d = 0
+ * (as for the "plane" selection criterion).
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to plane coefficients: [a, b, c, d]
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_plane_intersect_select(void        *input,
+                               cs_lnum_t   *n_cells,
+                               cs_lnum_t  **cell_ids)
+{
+  const cs_real_t *pl = (const cs_real_t *)input;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_real_3_t *vtx_coord= (const cs_real_3_t *)m->vtx_coord;
+
+  int *v_side;
+  char *i_flag, *b_flag;
+
+  BFT_MALLOC(v_side, n_vertices, int);
+  BFT_MALLOC(i_flag, m->n_i_faces, char);
+  BFT_MALLOC(b_flag, m->n_b_faces, char);
+
+  /* Side of each vertex relative to the plane */
+
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
+    cs_real_t d =   pl[0]*vtx_coord[v_id][0] + pl[1]*vtx_coord[v_id][1]
+                  + pl[2]*vtx_coord[v_id][2] + pl[3];
+    v_side[v_id] = (d > 0) ? 1 : ((d < 0) ? -1 : 0);
+  }
+
+  /* A cell is cut by the plane if and only if one of its faces is */
+
+  _flag_faces_cut_by_plane(m->n_i_faces,
+                           m->i_face_vtx_idx,
+                           m->i_face_vtx_lst,
+                           v_side,
+                           i_flag);
+
+  _flag_faces_cut_by_plane(m->n_b_faces,
+                           m->b_face_vtx_idx,
+                           m->b_face_vtx_lst,
+                           v_side,
+                           b_flag);
+
+  BFT_FREE(v_side);
+
+  _cells_adjacent_to_faces(m, i_flag, b_flag, n_cells, cell_ids);
+
+  BFT_FREE(b_flag);
+  BFT_FREE(i_flag);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select cells on either side of an iso-surface of a scalar field
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to output fields on the layer of cells
+ * containing an iso-surface rather than on the whole volume. As this
+ * layer usually changes over time, the associated postprocessing mesh
+ * should be time varying.
+ *
+ * In this case, the input points to a \ref cs_post_iso_value_t structure.
+ * Cells are selected when they are adjacent to an interior face whose
+ * two neighboring cell values bracket the iso-value. Ghost cell values
+ * of the field are synchronized first, so that the selection is
+ * consistent across ranks.
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to iso-value definition
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_iso_value_select(void        *input,
+                         cs_lnum_t   *n_cells,
+                         cs_lnum_t  **cell_ids)
+{
+  const cs_post_iso_value_t *iso = (const cs_post_iso_value_t *)input;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  cs_field_t *f = cs_field_by_id(iso->field_id);
+
+  if (f->location_id != CS_MESH_LOCATION_CELLS || f->dim != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: field \"%s\" is not a scalar field based on cells."),
+              __func__, f->name);
+
+  cs_field_synchronize(f, CS_HALO_STANDARD);
+
+  const cs_real_t *val = f->val;
+  const cs_real_t v_iso = iso->value;
+
+  char *i_flag;
+  BFT_MALLOC(i_flag, n_i_faces, char);
+
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_real_t v0 = val[i_face_cells[face_id][0]] - v_iso;
+    cs_real_t v1 = val[i_face_cells[face_id][1]] - v_iso;
+    i_flag[face_id] = (   (v0 <= 0 && v1 >= 0)
+                       || (v0 >= 0 && v1 <= 0)) ? 1 : 0;
+  }
+
+  _cells_adjacent_to_faces(m, i_flag, NULL, n_cells, cell_ids);
+
+  BFT_FREE(i_flag);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define probes based on the centers of cells intersected by
@@ -52,6 +52,15 @@ typedef enum {
 
 } cs_post_util_type_t;
 
+/*! Iso-value definition for cell selection */
+
+typedef struct {
+
+  int        field_id;   /*!< id of scalar field based on cells */
+  cs_real_t  value;      /*!< iso-value */
+
+} cs_post_iso_value_t;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -96,6 +105,76 @@ cs_cell_segment_intersect_select(void        *input,
                                  cs_lnum_t   *n_cells,
                                  cs_lnum_t  **cell_ids);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select cells cut by a given plane
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to output fields on a slice of cells rather
+ * than on the whole volume.
+ *
+ * In this case, the input points to a real array containing the plane's
+ * coefficients [a, b, c, d], the plane being defined by ax + by + cz + d = 0
+ * (as for the "plane" selection criterion).
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to plane coefficients: [a, b, c, d]
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_plane_intersect_select(void        *input,
+                               cs_lnum_t   *n_cells,
+                               cs_lnum_t  **cell_ids);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select cells on either side of an iso-surface of a scalar field
+ *
+ * This selection function may be used as an elements selection function
+ * for postprocessing, so as to output fields on the layer of cells
+ * containing an iso-surface rather than on the whole volume. As this
+ * layer usually changes over time, the associated postprocessing mesh
+ * should be time varying.
+ *
+ * In this case, the input points to a \ref cs_post_iso_value_t structure.
+ * Cells are selected when they are adjacent to an interior face whose
+ * two neighboring cell values bracket the iso-value. Ghost cell values
+ * of the field are synchronized first, so that the selection is
+ * consistent across ranks.
+ *
+ * Note: the input pointer must point to valid data when this selection
+ * function is called, so either:
+ * - that value or structure should not be temporary (i.e. local);
+ * - post-processing output must be ensured using cs_post_write_meshes()
+ *   with a fixed-mesh writer before the data pointed to goes out of scope;
+ *
+ * The caller is responsible for freeing the returned cell_ids array.
+ * When passed to postprocessing mesh or probe set definition functions,
+ * this is handled automatically.
+ *
+ * \param[in]   input     pointer to iso-value definition
+ * \param[out]  n_cells   number of selected cells
+ * \param[out]  cell_ids  array of selected cell ids (0 to n-1 numbering)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cell_iso_value_select(void        *input,
+                         cs_lnum_t   *n_cells,
+                         cs_lnum_t  **cell_ids);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define probes based on the centers of cells intersected by
@@ -52,15 +52,19 @@
 #include "bft_printf.h"
 
 #include "fvm_nodal.h"
+#include "fvm_point_location.h"
 #include "fvm_writer.h"
 
 #include "cs_base.h"
 #include "cs_coupling.h"
+#include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
 #include "cs_mesh_connect.h"
 #include "cs_prototypes.h"
 #include "cs_selector.h"
+#include "cs_turbomachinery.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -114,6 +118,15 @@ struct _cs_sat_coupling_t {
   fvm_nodal_t     *faces_sup;    /* Local faces at which distant values are
                                     interpolated*/
 
+  fvm_point_location_bvh_t  *cells_bvh;  /* Search structure for cells_sup,
+                                            used for relocation */
+  fvm_point_location_bvh_t  *faces_bvh;  /* Search structure for faces_sup,
+                                            used for relocation */
+
+  cs_lnum_t        n_loc_mesh_elts[3]; /* Number of mesh cells, boundary
+                                          faces and vertices at last full
+                                          location */
+
   cs_real_t       *distant_dist_fbr; /* Distant vectors (distance JJ') */
   cs_real_t       *distant_of;
   cs_real_t       *local_of;
@@ -147,6 +160,11 @@ static int _cs_glob_n_sat_cp = -1;
 static int                         _sat_coupling_builder_size = 0;
 static _cs_sat_coupling_builder_t *_sat_coupling_builder = NULL;
 
+/* Locator exchange algorithm */
+
+static ple_locator_exchange_t  _sat_coupling_exchange_type
+  = PLE_LOCATOR_EXCHANGE_P2P;
+
 static int                  cs_glob_sat_n_couplings = 0;
 static cs_sat_coupling_t  **cs_glob_sat_couplings = NULL;
 
@@ -528,6 +546,9 @@ _sat_coupling_destroy(cs_sat_coupling_t  *couplage)
   ple_locator_destroy(couplage->localis_cel);
   ple_locator_destroy(couplage->localis_fbr);
 
+  couplage->cells_bvh = fvm_point_location_bvh_destroy(couplage->cells_bvh);
+  couplage->faces_bvh = fvm_point_location_bvh_destroy(couplage->faces_bvh);
+
   if (couplage->cells_sup != NULL)
     fvm_nodal_destroy(couplage->cells_sup);
   if (couplage->faces_sup != NULL)
@@ -819,6 +840,380 @@ _sat_coupling_interpolate(cs_sat_coupling_t  *couplage)
   BFT_FREE(local_xyzcen);
 }
 
+/*----------------------------------------------------------------------------
+ * Update the location of points in local cells, starting from their
+ * previous location (see ple_mesh_elements_relocate_t).
+ *
+ * Points are kept only if they are inside a local cell, and are looked
+ * for by walking through adjacent cells, then by using the cells'
+ * bounding volume hierarchy.
+ *
+ * parameters:
+ *   mesh               <-- pointer to cells bounding volume hierarchy
+ *   tolerance_base     <-- associated base tolerance (unused)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance (unused)
+ *   n_points           <-- number of points to relocate
+ *   point_coords       <-- point coordinates
+ *   location           <-> number of parent cell containing each point,
+ *                          or -1 (size: n_points)
+ *   distance           --> distance from point to cell indicated by
+ *                          location[] (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_relocate_in_cells(const void         *mesh,
+                   float               tolerance_base,
+                   float               tolerance_fraction,
+                   ple_lnum_t          n_points,
+                   const ple_coord_t   point_coords[],
+                   ple_lnum_t          location[],
+                   float               distance[])
+{
+  const cs_lnum_t *c2c_idx = NULL, *c2c = NULL;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  CS_UNUSED(tolerance_base);
+  CS_UNUSED(tolerance_fraction);
+
+  if (ma != NULL) {
+    c2c_idx = ma->cell_cells_idx;
+    c2c = ma->cell_cells;
+  }
+
+  fvm_point_location_bvh_relocate(mesh,
+                                  n_points,
+                                  NULL,
+                                  point_coords,
+                                  c2c_idx,
+                                  c2c,
+                                  location,
+                                  distance);
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+    if (distance[i] < 0 || distance[i] > 1)
+      location[i] = -1;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update the location of points on local boundary faces, starting from
+ * their previous location (see ple_mesh_elements_relocate_t).
+ *
+ * As distances to surface elements are absolute, a point is kept only
+ * if the closest local face is the one on which it was previously located.
+ *
+ * parameters:
+ *   mesh               <-- pointer to faces bounding volume hierarchy
+ *   tolerance_base     <-- associated base tolerance (unused)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance (unused)
+ *   n_points           <-- number of points to relocate
+ *   point_coords       <-- point coordinates
+ *   location           <-> number of parent face containing each point,
+ *                          or -1 (size: n_points)
+ *   distance           --> distance from point to face indicated by
+ *                          location[] (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_relocate_on_faces(const void         *mesh,
+                   float               tolerance_base,
+                   float               tolerance_fraction,
+                   ple_lnum_t          n_points,
+                   const ple_coord_t   point_coords[],
+                   ple_lnum_t          location[],
+                   float               distance[])
+{
+  ple_lnum_t *prev_location = NULL;
+
+  CS_UNUSED(tolerance_base);
+  CS_UNUSED(tolerance_fraction);
+
+  BFT_MALLOC(prev_location, n_points, ple_lnum_t);
+
+  for (ple_lnum_t i = 0; i < n_points; i++)
+    prev_location[i] = location[i];
+
+  fvm_point_location_bvh_relocate(mesh,
+                                  n_points,
+                                  NULL,
+                                  point_coords,
+                                  NULL,
+                                  NULL,
+                                  location,
+                                  distance);
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+    if (location[i] != prev_location[i])
+      location[i] = -1;
+  }
+
+  BFT_FREE(prev_location);
+}
+
+/*----------------------------------------------------------------------------
+ * Update a coupling locator for moved points, searching only for points
+ * lost by the relocation or not previously located.
+ *
+ * parameters:
+ *   coupl       <-> pointer to coupling structure
+ *   locator     <-> pointer to associated locator
+ *   support     <-- local support mesh
+ *   bvh         <-- bounding volume hierarchy associated with support mesh
+ *   location_id <-- 0 for cells, 1 for boundary faces
+ *   point_coords <-- point coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_sat_coupling_relocate_locator(cs_sat_coupling_t         *coupl,
+                               ple_locator_t             *locator,
+                               fvm_nodal_t               *support,
+                               fvm_point_location_bvh_t  *bvh,
+                               int                        location_id,
+                               const cs_real_t           *point_coords)
+{
+  ple_lnum_t n_search;
+
+  ple_mesh_elements_relocate_t  *relocate_f = _relocate_in_cells;
+
+  if (   bvh != NULL
+      && fvm_nodal_get_max_entity_dim(support) < 3)
+    relocate_f = _relocate_on_faces;
+
+  n_search = ple_locator_relocate(locator,
+                                  bvh,
+                                  0.,
+                                  coupl->tolerance,
+                                  point_coords,
+                                  relocate_f);
+
+  if (n_search > 0) {
+
+    const char *sel = (location_id == 0) ?
+      coupl->cell_cpl_sel : coupl->face_cpl_sel;
+
+    cs_lnum_t n_points = 0;
+    cs_lnum_t *elt_list = NULL;
+    int *point_tag = NULL;
+
+    int locator_options[PLE_LOCATOR_N_OPTIONS];
+    locator_options[PLE_LOCATOR_NUMBERING] = 1;
+
+    if (sel != NULL) {
+      if (location_id == 0) {
+        BFT_MALLOC(elt_list, cs_glob_mesh->n_cells, cs_lnum_t);
+        cs_selector_get_cell_num_list(sel, &n_points, elt_list);
+      }
+      else {
+        BFT_MALLOC(elt_list, cs_glob_mesh->n_b_faces, cs_lnum_t);
+        cs_selector_get_b_face_num_list(sel, &n_points, elt_list);
+      }
+    }
+
+    if (coupl->tag_func != NULL) {
+      BFT_MALLOC(point_tag, n_points, int);
+      coupl->tag_func(coupl->tag_context,
+                      support,
+                      n_points,
+                      1,
+                      elt_list,
+                      point_tag);
+    }
+
+#if defined(PLE_HAVE_MPI)
+    ple_locator_exchange_t ple_exchange_type = ple_locator_get_exchange_type();
+    ple_locator_set_exchange_type(_sat_coupling_exchange_type);
+#endif
+
+    ple_locator_extend_search(locator,
+                              support,
+                              locator_options,
+                              0.,
+                              coupl->tolerance,
+                              n_points,
+                              elt_list,
+                              point_tag,
+                              point_coords,
+                              NULL,
+                              cs_coupling_mesh_extents,
+                              cs_coupling_point_in_mesh_p);
+
+#if defined(PLE_HAVE_MPI)
+    ple_locator_set_exchange_type(ple_exchange_type);
+#endif
+
+    BFT_FREE(point_tag);
+    BFT_FREE(elt_list);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update location incrementally for a coupling whose meshes have moved.
+ *
+ * Incremental relocation is used only if locators have already been
+ * initialized and mesh topologies on both sides are unchanged since
+ * the last full location (i.e. not with transient turbomachinery).
+ * Selection criteria are assumed not to depend on moved coordinates.
+ *
+ * parameters:
+ *   coupl <-> pointer to coupling structure
+ *
+ * returns:
+ *   true if location was updated, false if a full location is required
+ *----------------------------------------------------------------------------*/
+
+static bool
+_sat_coupling_relocate(cs_sat_coupling_t  *coupl)
+{
+  int reuse = 1;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
+
+  if (   coupl->localis_cel == NULL || coupl->localis_fbr == NULL
+      || cs_turbomachinery_get_model() == CS_TURBOMACHINERY_TRANSIENT
+      || coupl->n_loc_mesh_elts[0] != m->n_cells
+      || coupl->n_loc_mesh_elts[1] != m->n_b_faces
+      || coupl->n_loc_mesh_elts[2] != m->n_vertices)
+    reuse = 0;
+
+#if defined(HAVE_MPI)
+  if (coupl->comm != MPI_COMM_NULL) {
+    int _reuse = reuse;
+    MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, coupl->comm);
+  }
+#endif
+
+  if (reuse == 0)
+    return false;
+
+  /* Update search structures (support meshes share mesh vertices) */
+
+  if (coupl->cells_sup != NULL) {
+    if (coupl->cells_bvh == NULL)
+      coupl->cells_bvh = fvm_point_location_bvh_create(coupl->cells_sup,
+                                                       0.,
+                                                       coupl->tolerance,
+                                                       1);
+    else
+      fvm_point_location_bvh_update(coupl->cells_bvh);
+  }
+
+  if (coupl->faces_sup != NULL) {
+    if (coupl->faces_bvh == NULL)
+      coupl->faces_bvh = fvm_point_location_bvh_create(coupl->faces_sup,
+                                                       0.,
+                                                       coupl->tolerance,
+                                                       1);
+    else
+      fvm_point_location_bvh_update(coupl->faces_bvh);
+  }
+
+  /* Relocate coupled cells and faces */
+
+  _sat_coupling_relocate_locator(coupl,
+                                 coupl->localis_cel,
+                                 coupl->cells_sup,
+                                 coupl->cells_bvh,
+                                 0,
+                                 mq->cell_cen);
+
+  if (coupl->faces_sup != NULL)
+    _sat_coupling_relocate_locator(coupl,
+                                   coupl->localis_fbr,
+                                   coupl->faces_sup,
+                                   coupl->faces_bvh,
+                                   1,
+                                   mq->b_face_cog);
+  else
+    _sat_coupling_relocate_locator(coupl,
+                                   coupl->localis_fbr,
+                                   coupl->cells_sup,
+                                   coupl->cells_bvh,
+                                   1,
+                                   mq->b_face_cog);
+
+  _sat_coupling_interpolate(coupl);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Log timing info
+ *----------------------------------------------------------------------------*/
+
+static void
+_all_comm_times(void)
+{
+  if (cs_glob_sat_n_couplings == 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nCode_Saturne coupling overheads\n"));
+
+  for (int coupl_id = 0; coupl_id < cs_glob_sat_n_couplings; coupl_id++) {
+
+    cs_sat_coupling_t *coupl = cs_glob_sat_couplings[coupl_id];
+
+    for (int ent_id = 0; ent_id < 2; ent_id++) {
+
+      ple_locator_t *locator
+        = (ent_id == 0) ? coupl->localis_cel : coupl->localis_fbr;
+      const char *ent_type[] = {N_("cells"), N_("boundary faces")};
+
+      if (locator == NULL)
+        continue;
+
+      double location_wtime[2], location_comm_wtime[2];
+      double relocate_wtime[2];
+      double exchange_wtime, exchange_comm_wtime;
+
+      if (coupl->sat_name != NULL)
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n  %s (%s):\n\n"),
+                      coupl->sat_name, _(ent_type[ent_id]));
+      else
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      _("\n  coupling %d (%s):\n\n"),
+                      coupl_id + 1, _(ent_type[ent_id]));
+
+      ple_locator_get_times(locator,
+                            location_wtime,
+                            NULL,
+                            &exchange_wtime,
+                            NULL);
+
+      ple_locator_get_comm_times(locator,
+                                 location_comm_wtime,
+                                 NULL,
+                                 &exchange_comm_wtime,
+                                 NULL);
+
+      ple_locator_get_relocate_times(locator,
+                                     relocate_wtime,
+                                     NULL);
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("    location time:                 %12.3f\n"
+                      "      communication and wait:      %12.3f\n"
+                      "    relocation time:               %12.3f\n"
+                      "      communication and wait:      %12.3f\n"
+                      "    variable exchange time:        %12.3f\n"
+                      "      communication and wait:      %12.3f\n"),
+                    location_wtime[0], location_comm_wtime[0],
+                    relocate_wtime[0], relocate_wtime[1],
+                    exchange_wtime, exchange_comm_wtime);
+
+    }
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -907,11 +1302,22 @@ void CS_PROCF (defloc, DEFLOC)
   else
     coupl = cs_glob_sat_couplings[*numcpl - 1];
 
+  /* With a moving mesh of fixed topology, try to update the previous
+     location incrementally */
+
+  if (_sat_coupling_relocate(coupl))
+    return;
+
   /* Removing the connectivity and localization informations in case of
      coupling update */
 
-  if (coupl->cells_sup != NULL) fvm_nodal_destroy(coupl->cells_sup);
-  if (coupl->faces_sup != NULL) fvm_nodal_destroy(coupl->faces_sup);
+  coupl->cells_bvh = fvm_point_location_bvh_destroy(coupl->cells_bvh);
+  coupl->faces_bvh = fvm_point_location_bvh_destroy(coupl->faces_bvh);
+
+  if (coupl->cells_sup != NULL)
+    coupl->cells_sup = fvm_nodal_destroy(coupl->cells_sup);
+  if (coupl->faces_sup != NULL)
+    coupl->faces_sup = fvm_nodal_destroy(coupl->faces_sup);
 
   /* Create the local lists */
 
@@ -1002,6 +1408,11 @@ void CS_PROCF (defloc, DEFLOC)
 
   /* Initialization of the distant point localization */
 
+#if defined(PLE_HAVE_MPI)
+  ple_locator_exchange_t ple_exchange_type = ple_locator_get_exchange_type();
+  ple_locator_set_exchange_type(_sat_coupling_exchange_type);
+#endif
+
   if (coupl->cell_cpl_sel != NULL) {
 
     BFT_MALLOC(c_elt_list, cs_glob_mesh->n_cells, cs_lnum_t);
@@ -1079,6 +1490,10 @@ void CS_PROCF (defloc, DEFLOC)
                        cs_coupling_mesh_extents,
                        cs_coupling_point_in_mesh_p);
 
+#if defined(PLE_HAVE_MPI)
+  ple_locator_set_exchange_type(ple_exchange_type);
+#endif
+
   BFT_FREE(point_tag);
 
   if (coupl->face_cpl_sel != NULL) BFT_FREE(f_elt_list);
@@ -1088,6 +1503,10 @@ void CS_PROCF (defloc, DEFLOC)
   if (coupl->localis_fbr != NULL)
     _sat_coupling_interpolate(coupl);
 
+  coupl->n_loc_mesh_elts[0] = cs_glob_mesh->n_cells;
+  coupl->n_loc_mesh_elts[1] = cs_glob_mesh->n_b_faces;
+  coupl->n_loc_mesh_elts[2] = cs_glob_mesh->n_vertices;
+
 #if 0
   /* TODO: associate the FVM meshes to the post-processing,
      with a fonction giving a pointer to the associated FVM structures,
@@ -1981,6 +2400,42 @@ cs_sat_coupling_by_id(int coupling_id)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Set the locator exchange algorithm used by Code_Saturne couplings.
+ *
+ * The type is applied when couplings are located or relocated, and must
+ * be the same for both coupled instances; if it is not, point-to-point
+ * exchanges are used.
+ *
+ * parameters:
+ *   type <-- PLE_LOCATOR_EXCHANGE_P2P (default) or
+ *            PLE_LOCATOR_EXCHANGE_NEIGHBOR
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sat_coupling_set_exchange_type(ple_locator_exchange_t  type)
+{
+  if (type != PLE_LOCATOR_EXCHANGE_P2P && type != PLE_LOCATOR_EXCHANGE_NEIGHBOR)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid locator exchange type (%d)."),
+              __func__, (int)type);
+
+  _sat_coupling_exchange_type = type;
+}
+
+/*----------------------------------------------------------------------------
+ * Get the locator exchange algorithm used by Code_Saturne couplings.
+ *
+ * returns:
+ *   locator exchange algorithm type
+ *----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t
+cs_sat_coupling_get_exchange_type(void)
+{
+  return _sat_coupling_exchange_type;
+}
+
 /*----------------------------------------------------------------------------
  * Initialize Code_Saturne couplings.
  *
@@ -2079,6 +2534,12 @@ cs_sat_coupling_add(const char  *face_cpl_sel_c,
   sat_coupling->faces_sup = NULL;
   sat_coupling->cells_sup = NULL;
 
+  sat_coupling->cells_bvh = NULL;
+  sat_coupling->faces_bvh = NULL;
+
+  for (int i = 0; i < 3; i++)
+    sat_coupling->n_loc_mesh_elts[i] = -1;
+
   sat_coupling->localis_fbr = NULL;
   sat_coupling->localis_cel = NULL;
 
@@ -2165,6 +2626,8 @@ cs_sat_coupling_all_finalize(void)
 {
   int  i;
 
+  _all_comm_times();
+
   for (i = 0 ; i < cs_glob_sat_n_couplings ; i++)
     _sat_coupling_destroy(cs_glob_sat_couplings[i]);
 
@@ -31,6 +31,12 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+/*----------------------------------------------------------------------------
+ * PLE library headers
+ *----------------------------------------------------------------------------*/
+
+#include <ple_locator.h>
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -493,6 +499,31 @@ cs_sat_coupling_add_internal(cs_sat_coupling_tag_t  *tag_func,
                              float                   loc_tolerance,
                              int                     verbosity);
 
+/*----------------------------------------------------------------------------
+ * Set the locator exchange algorithm used by Code_Saturne couplings.
+ *
+ * The type is applied when couplings are located or relocated, and must
+ * be the same for both coupled instances; if it is not, point-to-point
+ * exchanges are used.
+ *
+ * parameters:
+ *   type <-- PLE_LOCATOR_EXCHANGE_P2P (default) or
+ *            PLE_LOCATOR_EXCHANGE_NEIGHBOR
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sat_coupling_set_exchange_type(ple_locator_exchange_t  type);
+
+/*----------------------------------------------------------------------------
+ * Get the locator exchange algorithm used by Code_Saturne couplings.
+ *
+ * returns:
+ *   locator exchange algorithm type
+ *----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t
+cs_sat_coupling_get_exchange_type(void);
+
 /*----------------------------------------------------------------------------
  * Initialize Code_Saturne couplings.
  *
@@ -107,6 +107,14 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Maximum number of moments updated in a same loop on elements */
+
+#define CS_TIME_MOMENT_BATCH_SIZE 8
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -142,6 +150,10 @@ typedef struct {
   cs_real_t              *val;          /* Pointer to associated values
                                            otherwise */
 
+  float                   c0;           /* Compensation term for val0 */
+  float                  *c;            /* Compensation terms for val,
+                                           or NULL */
+
 } cs_time_moment_wa_t;
 
 /* Moment definitions */
@@ -172,10 +184,36 @@ typedef struct {
   char                   *name;         /* Associated name, if f_id < 0 */
   double                 *val;          /* Associated value, if f_id < 0 */
 
+  float                  *c;            /* Compensation terms, or NULL */
+
   int                     nt_cur;       /* Time step number of last update */
 
 } cs_time_moment_t;
 
+/* Moment values access, for batched updates */
+/*--------------------------------------------*/
+
+typedef struct {
+
+  cs_real_t              *val;          /* Values */
+  float                  *c;            /* Compensation terms, or NULL */
+
+} cs_time_moment_val_t;
+
+/* Moment update batch entry */
+/*---------------------------*/
+
+typedef struct {
+
+  cs_time_moment_t       *mt;           /* Associated moment */
+  cs_real_t              *x;            /* Current data values */
+
+  cs_time_moment_val_t    v;            /* Moment values */
+  cs_time_moment_val_t    m;            /* Lower order moment (mean) values,
+                                           for variances */
+
+} cs_time_moment_batch_t;
+
 /* Moment restart metadata */
 /*-------------------------*/
 
@@ -230,6 +268,8 @@ static double _t_prev_iter = 0.;
 
 static const cs_real_t *_p_dt = NULL; /* Mapped cell time step */
 
+static bool _compensated = false;  /* Compensated accumulation */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1095,6 +1135,9 @@ _find_or_add_wa(cs_time_moment_data_t  *data_func,
 
   mwa->val = NULL;
 
+  mwa->c0 = 0;
+  mwa->c = NULL;
+
   /* Structure is now initialized */
 
   return wa_id;
@@ -1112,6 +1155,7 @@ _free_all_wa(void)
   for (i = 0; i < _n_moment_wa; i++) {
     cs_time_moment_wa_t *mwa = _moment_wa + i;
     BFT_FREE(mwa->val);
+    BFT_FREE(mwa->c);
   }
 
   BFT_FREE(_moment_wa);
@@ -1200,6 +1244,8 @@ _find_or_add_moment(int                     location_id,
   mt->name = NULL;
   mt->val = NULL;
 
+  mt->c = NULL;
+
   mt->nt_cur = -1;
 
   return moment_id;
@@ -1218,6 +1264,7 @@ _free_all_moments(void)
     cs_time_moment_t *mt = _moment + i;
     BFT_FREE(mt->name);
     BFT_FREE(mt->val);
+    BFT_FREE(mt->c);
   }
 
   BFT_FREE(_moment);
@@ -1381,6 +1428,26 @@ _ensure_init_weight_accumulator(cs_time_moment_wa_t  *mwa)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Add a value to a sum, using compensated (Kahan) summation.
+ *
+ * parameters:
+ *   s <-> sum
+ *   c <-> associated compensation term
+ *   v <-- value to add
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_kahan_add(cs_real_t  *s,
+           float      *c,
+           double      v)
+{
+  double y = v - *c;
+  double t = *s + y;
+  *c = (float)((t - *s) - y);
+  *s = t;
+}
+
 /*----------------------------------------------------------------------------
  * Update weight accumulator
  *
@@ -1393,12 +1460,27 @@ static void
 _update_weight_accumulator(cs_time_moment_wa_t  *mwa,
                            cs_real_t            *restrict w)
 {
-  if (mwa->location_id == CS_MESH_LOCATION_NONE)
-    mwa->val0 += w[0];
+  if (mwa->location_id == CS_MESH_LOCATION_NONE) {
+    if (_compensated)
+      _kahan_add(&(mwa->val0), &(mwa->c0), w[0]);
+    else
+      mwa->val0 += w[0];
+  }
   else {
     cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
-    for (cs_lnum_t i = 0; i < n_w_elts; i++)
-      mwa->val[i] += w[i];
+    if (_compensated && mwa->c == NULL) {
+      BFT_MALLOC(mwa->c, n_w_elts, float);
+      for (cs_lnum_t i = 0; i < n_w_elts; i++)
+        mwa->c[i] = 0;
+    }
+    if (mwa->c != NULL) {
+      for (cs_lnum_t i = 0; i < n_w_elts; i++)
+        _kahan_add(mwa->val + i, mwa->c + i, w[i]);
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_w_elts; i++)
+        mwa->val[i] += w[i];
+    }
   }
 }
 
@@ -1412,13 +1494,224 @@ _update_weight_accumulator(cs_time_moment_wa_t  *mwa,
 static void
 _ensure_init_moment(cs_time_moment_t  *mt)
 {
+  cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[0];
+  cs_lnum_t n_d_elts = n_elts*(cs_lnum_t)(mt->dim);
+
   if (mt->f_id < 0 && mt->val == NULL) {
-    cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[0];
-    cs_lnum_t n_d_elts = n_elts*(cs_lnum_t)(mt->dim);
     BFT_MALLOC(mt->val, n_d_elts, cs_real_t);
     for (cs_lnum_t i = 0; i < n_d_elts; i++)
       mt->val[i] = 0.;
   }
+
+  if (_compensated && mt->c == NULL) {
+    BFT_MALLOC(mt->c, n_d_elts, float);
+    for (cs_lnum_t i = 0; i < n_d_elts; i++)
+      mt->c[i] = 0.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return access structure to moment values, initializing them if required.
+ *
+ * parameters:
+ *   mt <-> moment
+ *
+ * returns:
+ *   moment values access structure
+ *----------------------------------------------------------------------------*/
+
+static cs_time_moment_val_t
+_moment_values(cs_time_moment_t  *mt)
+{
+  _ensure_init_moment(mt);
+
+  cs_time_moment_val_t v = {.val = mt->val, .c = mt->c};
+
+  if (mt->f_id > -1) {
+    cs_field_t *f = cs_field_by_id(mt->f_id);
+    v.val = f->val;
+  }
+
+  return v;
+}
+
+/*----------------------------------------------------------------------------
+ * Return a moment value.
+ *
+ * parameters:
+ *   v <-- moment values access structure
+ *   j <-- value id
+ *
+ * returns:
+ *   moment value
+ *----------------------------------------------------------------------------*/
+
+static inline double
+_moment_value_get(const cs_time_moment_val_t  *v,
+                  cs_lnum_t                    j)
+{
+  return v->val[j];
+}
+
+/*----------------------------------------------------------------------------
+ * Add an increment to a moment value.
+ *
+ * parameters:
+ *   v  <-> moment values access structure
+ *   j  <-- value id
+ *   dv <-- increment
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_moment_value_add(cs_time_moment_val_t  *v,
+                  cs_lnum_t              j,
+                  double                 dv)
+{
+  if (v->c != NULL)
+    _kahan_add(v->val + j, v->c + j, dv);
+  else
+    v->val[j] += dv;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a batch of moments sharing a weight accumulator, mesh location,
+ * and type.
+ *
+ * All moments of the batch are updated in a single loop on elements, so
+ * the weight ratio is computed only once per element.
+ *
+ * Moment updates use the increment form of the weighted (Welford type)
+ * incremental formulas, so that compensated summation may be applied.
+ *
+ * parameters:
+ *   mwa        <-- associated weight accumulator
+ *   w          <-- current weight values
+ *   n_moments  <-- number of moments in batch
+ *   moment_ids <-- ids of moments in batch
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_moment_batch(const cs_time_moment_wa_t  *mwa,
+                     const cs_real_t            *restrict w,
+                     int                         n_moments,
+                     const int                   moment_ids[])
+{
+  cs_time_moment_batch_t  b[CS_TIME_MOMENT_BATCH_SIZE];
+
+  const cs_time_step_t  *ts = cs_glob_time_step;
+
+  assert(n_moments > 0 && n_moments <= CS_TIME_MOMENT_BATCH_SIZE);
+
+  /* Current and accumulated weight */
+
+  cs_lnum_t  wa_stride = 1;
+  const cs_real_t *restrict wa_sum = mwa->val;
+
+  if (mwa->location_id == CS_MESH_LOCATION_NONE) {
+    wa_sum = &(mwa->val0);
+    wa_stride = 0;
+  }
+
+  const cs_lnum_t n_elts
+    = cs_mesh_location_get_n_elts(_moment[moment_ids[0]].location_id)[0];
+
+  /* Current data and moment values */
+
+  for (int i = 0; i < n_moments; i++) {
+
+    cs_time_moment_t *mt = _moment + moment_ids[i];
+
+    assert(mt->location_id == _moment[moment_ids[0]].location_id);
+
+    b[i].mt = mt;
+
+    BFT_MALLOC(b[i].x, n_elts*mt->data_dim, cs_real_t);
+    mt->data_func(mt->data_input, b[i].x);
+
+    b[i].v = _moment_values(mt);
+
+    if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+      assert(mt->l_id > -1);
+      b[i].m = _moment_values(_moment + mt->l_id);
+    }
+
+  }
+
+  /* Single loop on elements for all moments */
+
+  for (cs_lnum_t je = 0; je < n_elts; je++) {
+
+    const cs_lnum_t k = je*wa_stride;
+    const double r = w[k] / (fmax(w[k] + wa_sum[k], 1e-100));
+
+    for (int i = 0; i < n_moments; i++) {
+
+      const cs_time_moment_t *mt = b[i].mt;
+      const cs_real_t *restrict x = b[i].x;
+
+      if (mt->type == CS_TIME_MOMENT_MEAN) {
+        for (cs_lnum_t l = 0; l < mt->dim; l++) {
+          const cs_lnum_t j = je*mt->dim + l;
+          _moment_value_add(&(b[i].v), j,
+                            (x[j] - _moment_value_get(&(b[i].v), j)) * r);
+        }
+      }
+
+      else if (mt->dim == 6) { /* variance-covariance matrix */
+        assert(mt->data_dim == 3);
+        double delta[3], delta_n[3], dm[3], v[6];
+        for (cs_lnum_t l = 0; l < 3; l++) {
+          const cs_lnum_t jml = je*3 + l;
+          delta[l] = x[jml] - _moment_value_get(&(b[i].m), jml);
+          dm[l] = delta[l] * r;
+          delta_n[l] = delta[l] - dm[l];
+        }
+        for (cs_lnum_t l = 0; l < 6; l++)
+          v[l] = _moment_value_get(&(b[i].v), je*6 + l);
+        /* Covariance terms.
+           Note we could have a symmetric formula using
+             0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+           instead of
+             delta[i]*delta_n[j]
+           but unit tests in cs_moment_test.c do not seem to favor
+           one variant over the other; we use the simplest one.
+        */
+        const double dd[6] = {delta[0]*delta_n[0],
+                              delta[1]*delta_n[1],
+                              delta[2]*delta_n[2],
+                              delta[0]*delta_n[1],
+                              delta[1]*delta_n[2],
+                              delta[0]*delta_n[2]};
+        for (cs_lnum_t l = 0; l < 6; l++)
+          _moment_value_add(&(b[i].v), je*6 + l, (dd[l] - v[l]) * r);
+        for (cs_lnum_t l = 0; l < 3; l++)
+          _moment_value_add(&(b[i].m), je*3 + l, dm[l]);
+      }
+
+      else { /* simple variance */
+        for (cs_lnum_t l = 0; l < mt->dim; l++) {
+          const cs_lnum_t j = je*mt->dim + l;
+          double delta = x[j] - _moment_value_get(&(b[i].m), j);
+          double dm = delta * r;
+          double v = _moment_value_get(&(b[i].v), j);
+          _moment_value_add(&(b[i].v), j, (delta*(delta - dm) - v) * r);
+          _moment_value_add(&(b[i].m), j, dm);
+        }
+      }
+
+    }
+
+  }
+
+  /* Mark moments as updated and free work arrays */
+
+  for (int i = 0; i < n_moments; i++) {
+    cs_time_moment_t *mt = b[i].mt;
+    mt->nt_cur = ts->nt_cur;
+    if (mt->type == CS_TIME_MOMENT_VARIANCE)
+      _moment[mt->l_id].nt_cur = ts->nt_cur;
+    BFT_FREE(b[i].x);
+  }
 }
 
 /*============================================================================
@@ -1870,6 +2163,42 @@ cs_time_moment_map_cell_dt(const cs_real_t  *dt)
   _p_dt = dt;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable compensated accumulation of temporal moments.
+ *
+ * With compensated accumulation, a single precision compensation term is
+ * kept for each moment and weight accumulator value, so that rounding
+ * errors of successive updates do not build up over long averaging
+ * periods (Kahan summation).
+ *
+ * Compensation terms are allocated at the next update of each moment
+ * and weight accumulator, and freed when this option is disabled, so it
+ * may be changed at any time. Only updates following its activation are
+ * compensated, so it is best enabled before accumulation starts.
+ *
+ * \param[in]  compensated  use compensated accumulation if true
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_set_compensated(bool  compensated)
+{
+  _compensated = compensated;
+
+  if (_compensated)
+    return;
+
+  for (int i = 0; i < _n_moments; i++)
+    BFT_FREE(_moment[i].c);
+
+  for (int i = 0; i < _n_moment_wa; i++) {
+    cs_time_moment_wa_t *mwa = _moment_wa + i;
+    BFT_FREE(mwa->c);
+    mwa->c0 = 0;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all moment accumulators.
@@ -1928,136 +2257,65 @@ cs_time_moment_update_all(void)
       wa_cur_data[i] = NULL;
   }
 
-  /* Loop on variances first */
+  /* Update moments by batches sharing a weight accumulator, location,
+     and type; loop on variances first, as they also update their means */
 
-  for (int m_type = CS_TIME_MOMENT_VARIANCE;
-       m_type >= (int)CS_TIME_MOMENT_MEAN;
-       m_type --) {
+  int *m_ids;
+  BFT_MALLOC(m_ids, _n_moments, int);
 
-    for (i = 0; i < _n_moments; i++) {
-
-      cs_time_moment_t *mt = _moment + i;
-      cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
+  for (int wa_id = 0; wa_id < _n_moment_wa; wa_id++) {
 
-      if (   mt->nt_cur < ts->nt_cur
-          && (int)(mt->type) == m_type
-          && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
+    if (wa_cur_data[wa_id] == NULL)
+      continue;
 
-        /* Current and accumulated weight */
+    for (int m_type = CS_TIME_MOMENT_VARIANCE;
+         m_type >= (int)CS_TIME_MOMENT_MEAN;
+         m_type --) {
 
-        cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+      int n_sel = 0;
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
-
-        if (mwa->location_id == CS_MESH_LOCATION_NONE) {
-          wa_sum = &(mwa->val0);
-          wa_stride = 0;
-        }
-        else {
-          wa_sum = mwa->val;
-          wa_stride = 1;
-        }
-
-        /* Current value */
-
-        const cs_lnum_t n_elts
-          = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
-
-        BFT_MALLOC(x, nd, cs_real_t);
-
-        mt->data_func(mt->data_input, x);
-
-        _ensure_init_moment(mt);
-
-        cs_real_t *restrict val = mt->val;
-        if (mt->f_id > -1) {
-          cs_field_t *f = cs_field_by_id(mt->f_id);
-          val = f->val;
-        }
-
-        if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+      for (i = 0; i < _n_moments; i++) {
+        cs_time_moment_t *mt = _moment + i;
+        if (   mt->wa_id == wa_id
+            && (int)(mt->type) == m_type
+            && mt->nt_cur < ts->nt_cur)
+          m_ids[n_sel++] = i;
+      }
 
-          assert(mt->l_id > -1);
+      int s_start = 0;
 
-          cs_time_moment_t *mt_mean = _moment + mt->l_id;
+      while (s_start < n_sel) {
 
-          _ensure_init_moment(mt_mean);
-          cs_real_t *restrict m = mt_mean->val;
-          if (mt_mean->f_id > -1) {
-            cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-            m = f_mean->val;
-          }
+        int b_ids[CS_TIME_MOMENT_BATCH_SIZE];
+        int n_b = 0;
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
-            assert(mt->data_dim == 3);
-            for (cs_lnum_t je = 0; je < n_elts; je++) {
-              double delta[3], delta_n[3], r[3], m_n[3];
-              const cs_lnum_t k = je*wa_stride;
-              const double wa_sum_n = w[k] + wa_sum[k];
-              for (cs_lnum_t l = 0; l < 3; l++) {
-                cs_lnum_t jl = je*6 + l, jml = je*3 + l;
-                delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / (fmax(wa_sum_n, 1e-100)));
-                m_n[l] = m[jml] + r[l];
-                delta_n[l] = x[jml] - m_n[l];
-                val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
-                          / wa_sum_n;
-              }
-              /* Covariance terms.
-                 Note we could have a symmetric formula using
-                   0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                 instead of
-                   delta[i]*delta_n[j]
-                 but unit tests in cs_moment_test.c do not seem to favor
-                 one variant over the other; we use the simplest one.
-              */
-              cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
-              val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
-                        / wa_sum_n;
-              val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
-                        / wa_sum_n;
-              val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
-                        / wa_sum_n;
-              for (cs_lnum_t l = 0; l < 3; l++)
-                m[je*3 + l] += r[l];
-            }
-          }
+        const int location_id = _moment[m_ids[s_start]].location_id;
 
-          else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / (fmax(wa_sum_n, 1e-100)));
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
-            }
+        for (int s_id = s_start;
+             s_id < n_sel && n_b < CS_TIME_MOMENT_BATCH_SIZE;
+             s_id++) {
+          if (   m_ids[s_id] > -1
+              && _moment[m_ids[s_id]].location_id == location_id) {
+            b_ids[n_b++] = m_ids[s_id];
+            m_ids[s_id] = -1;
           }
-
-          mt_mean->nt_cur = ts->nt_cur;
         }
 
-        else if (mt->type == CS_TIME_MOMENT_MEAN) {
-
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
-          }
-
-        }
+        _update_moment_batch(_moment_wa + wa_id,
+                             wa_cur_data[wa_id],
+                             n_b,
+                             b_ids);
 
-        mt->nt_cur = ts->nt_cur;
+        while (s_start < n_sel && m_ids[s_start] < 0)
+          s_start++;
 
-        BFT_FREE(x);
+      }
 
-      } /* End of test if moment is active */
+    } /* End of loop on moment types */
 
-    } /* End of loop on moments */
+  } /* End of loop on weight accumulators */
 
-  } /* End of loop on moment types */
+  BFT_FREE(m_ids);
 
   /* Update and free weight data */
 
@@ -2243,6 +2501,10 @@ cs_time_moment_log_setup(void)
     }
 
   }
+
+  if (_compensated)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("\n  Compensated (Kahan) accumulation enabled.\n"));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -119,6 +119,26 @@ cs_time_moment_destroy_all(void);
 void
 cs_time_moment_map_cell_dt(const cs_real_t  *dt);
 
+/*----------------------------------------------------------------------------
+ * Enable or disable compensated accumulation of temporal moments.
+ *
+ * With compensated accumulation, a single precision compensation term is
+ * kept for each moment and weight accumulator value, so that rounding
+ * errors of successive updates do not build up over long averaging
+ * periods (Kahan summation).
+ *
+ * Compensation terms are allocated at the next update of each moment
+ * and weight accumulator, and freed when this option is disabled, so it
+ * may be changed at any time. Only updates following its activation are
+ * compensated, so it is best enabled before accumulation starts.
+ *
+ * parameters:
+ *   compensated <-- use compensated accumulation if true
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_set_compensated(bool  compensated);
+
 /*----------------------------------------------------------------------------
  * Update all moment accumulators.
  *----------------------------------------------------------------------------*/
@@ -28,6 +28,12 @@
 #  include "cs_config.h"
 #endif
 
+/* syscall() is needed to open hardware counters */
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+#  define _GNU_SOURCE
+#endif
+
 #if defined(HAVE_CLOCK_GETTIME)
 #if !defined(_POSIX_C_SOURCE)
 #define _POSIX_C_SOURCE 200112L
@@ -42,10 +48,19 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <math.h>
+#include <stdio.h>
 #include <string.h>
 #include <time.h>
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -53,7 +68,9 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
@@ -84,10 +101,25 @@ BEGIN_C_DECLS
   Timer statistics also allow for incrementing results from base timers
   (in addition to starting/stopping their own timers), so they may be used
   to assist logging and plotting of other timers.
+
+  In addition to the main (single-thread) timers, per-thread timers may be
+  used inside OpenMP parallel regions, and hardware counters may be
+  attributed to statistics. A summary including minimum, maximum, and
+  mean times over ranks is logged at finalization, and timed intervals
+  may also be exported as a trace for visualization.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*-------------------------------------------------------------------------------
+ * Local macro documentation
+ *-----------------------------------------------------------------------------*/
+
+/* Number of hardware counters (CPU cycles, instructions,
+   last-level cache misses) */
+
+#define CS_TIMER_STATS_N_HW 3
+
 /*-----------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -108,11 +140,34 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  unsigned long long   hw_start[CS_TIMER_STATS_N_HW]; /* Hardware counter
+                                                          values at start */
+  unsigned long long   hw_tot[CS_TIMER_STATS_N_HW];   /* Hardware counter
+                                                          totals */
+
 } cs_timer_stats_t;
 
-/*-------------------------------------------------------------------------------
- * Local macro documentation
- *-----------------------------------------------------------------------------*/
+/* Per-thread timer (wall-clock time only) */
+
+typedef struct {
+
+  double               t_start;         /* Start wall-clock time */
+  double               wall_time;       /* Total wall-clock time */
+
+} cs_timer_stats_thread_t;
+
+/* Traced time interval */
+
+typedef struct {
+
+  int                  id;              /* Statistic id */
+  long long            start_nsec;      /* Start time, relative to
+                                           reference time */
+  long long            wall_nsec;       /* Duration */
+  unsigned long long   hw[CS_TIMER_STATS_N_HW]; /* Hardware counter
+                                                   increments */
+
+} cs_timer_stats_event_t;
 
 /*-----------------------------------------------------------------------------
  * Local static variable definitions
@@ -140,6 +195,27 @@ static cs_timer_stats_t  *_stats= NULL;
 
 static cs_map_name_to_id_t  *_name_map = NULL;
 
+/* Reference time (for traces) */
+
+static cs_timer_t  _t_ref;
+
+/* Per-thread timers, with _n_stats_max entries per thread */
+
+static int                       _n_threads = 0;
+static cs_timer_stats_thread_t  *_thread_times = NULL;
+
+/* Hardware counters (group leader and members for each thread) */
+
+static int  *_hw_fd = NULL;
+
+/* Trace */
+
+static int                      _n_trace_max = 0;
+static int                      _n_trace_events = 0;
+static int                      _n_trace_events_max = 0;
+static cs_gnum_t                _n_trace_dropped = 0;
+static cs_timer_stats_event_t  *_trace_events = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -211,6 +287,657 @@ _common_parent_id(int  id_0,
   return p0;
 }
 
+/*----------------------------------------------------------------------------
+ * Return wall-clock time difference between two timers, in nanoseconds
+ *
+ * parameters:
+ *   t0  <-- oldest timer value
+ *   t1  <-- most recent timer value
+ *
+ * return:
+ *   elapsed wall-clock time in nanoseconds
+ *----------------------------------------------------------------------------*/
+
+static inline long long
+_wall_nsec(const cs_timer_t  *t0,
+           const cs_timer_t  *t1)
+{
+  return   (t1->wall_sec - t0->wall_sec) * 1000000000
+         + (t1->wall_nsec - t0->wall_nsec);
+}
+
+/*----------------------------------------------------------------------------
+ * Read hardware counters, summed over threads.
+ *
+ * parameters:
+ *   counts --> counter values (size: CS_TIMER_STATS_N_HW)
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_counters_read(unsigned long long  counts[])
+{
+  for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+    counts[k] = 0;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  if (_hw_fd == NULL)
+    return;
+
+  for (int t_id = 0; t_id < _n_threads; t_id++) {
+
+    int fd = _hw_fd[t_id*CS_TIMER_STATS_N_HW];
+    if (fd < 0)
+      continue;
+
+    /* Group read format: number of counters, then values */
+
+    uint64_t buf[1 + CS_TIMER_STATS_N_HW];
+    if (read(fd, buf, sizeof(buf)) == (ssize_t)sizeof(buf)) {
+      for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+        counts[k] += buf[1+k];
+    }
+
+  }
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Close hardware counters.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_counters_close(void)
+{
+  if (_hw_fd == NULL)
+    return;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+  for (int i = 0; i < _n_threads*CS_TIMER_STATS_N_HW; i++) {
+    if (_hw_fd[i] > -1)
+      close(_hw_fd[i]);
+  }
+#endif
+
+  BFT_FREE(_hw_fd);
+}
+
+/*----------------------------------------------------------------------------
+ * Open hardware counters for each thread.
+ *
+ * Each thread opens a group of counters measuring itself, so the
+ * mapping of OpenMP threads to system threads is assumed not to change
+ * between parallel regions (which is the case in practice with a
+ * constant number of threads).
+ *
+ * return:
+ *   true if counters could be opened for all threads, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_hw_counters_open(void)
+{
+  int n_failed = 0;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  const int n_threads = _n_threads;
+
+  BFT_MALLOC(_hw_fd, n_threads*CS_TIMER_STATS_N_HW, int);
+  for (int i = 0; i < n_threads*CS_TIMER_STATS_N_HW; i++)
+    _hw_fd[i] = -1;
+
+  const unsigned long long config[CS_TIMER_STATS_N_HW]
+    = {PERF_COUNT_HW_CPU_CYCLES,
+       PERF_COUNT_HW_INSTRUCTIONS,
+       PERF_COUNT_HW_CACHE_MISSES};
+
+# pragma omp parallel reduction(+:n_failed) num_threads(n_threads)
+  {
+    int t_id = 0;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+#endif
+
+    int *fd = _hw_fd + t_id*CS_TIMER_STATS_N_HW;
+
+    for (int k = 0; k < CS_TIMER_STATS_N_HW; k++) {
+
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = config[k];
+      attr.disabled = (k == 0) ? 1 : 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+
+      /* Measure calling thread on any CPU, with first counter
+         as group leader */
+
+      fd[k] = syscall(__NR_perf_event_open, &attr, 0, -1,
+                      (k == 0) ? -1 : fd[0], 0);
+
+      if (fd[k] < 0) {
+        n_failed += 1;
+        break;
+      }
+
+    }
+
+    if (fd[CS_TIMER_STATS_N_HW - 1] > -1)
+      ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+
+#else
+
+  n_failed = 1;
+
+#endif
+
+  if (n_failed > 0)
+    _hw_counters_close();
+
+  return (n_failed > 0) ? false : true;
+}
+
+/*----------------------------------------------------------------------------
+ * Record a timed interval for tracing.
+ *
+ * parameters:
+ *   id  <-- id of statistic
+ *   t0  <-- oldest timer value
+ *   t1  <-- most recent timer value
+ *   hw0 <-- hardware counter values at t0, or NULL
+ *   hw1 <-- hardware counter values at t1, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_add(int                        id,
+           const cs_timer_t          *t0,
+           const cs_timer_t          *t1,
+           const unsigned long long   hw0[],
+           const unsigned long long   hw1[])
+{
+  if (_n_trace_events >= _n_trace_max) {
+    _n_trace_dropped += 1;
+    return;
+  }
+
+  if (_n_trace_events >= _n_trace_events_max) {
+    _n_trace_events_max = CS_MAX(_n_trace_events_max*2, 1024);
+    _n_trace_events_max = CS_MIN(_n_trace_events_max, _n_trace_max);
+    BFT_REALLOC(_trace_events, _n_trace_events_max, cs_timer_stats_event_t);
+  }
+
+  cs_timer_stats_event_t *e = _trace_events + _n_trace_events;
+
+  e->id = id;
+  e->start_nsec = _wall_nsec(&_t_ref, t0);
+  e->wall_nsec = _wall_nsec(t0, t1);
+
+  for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+    e->hw[k] = (hw0 != NULL) ? hw1[k] - hw0[k] : 0;
+
+  _n_trace_events += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Mark a statistic as active.
+ *
+ * parameters:
+ *   s  <-> pointer to statistic
+ *   t  <-- start time
+ *   hw <-- hardware counter values at start
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_activate(cs_timer_stats_t          *s,
+          const cs_timer_t          *t,
+          const unsigned long long   hw[])
+{
+  s->active = true;
+  s->t_start = *t;
+  for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+    s->hw_start[k] = hw[k];
+}
+
+/*----------------------------------------------------------------------------
+ * Update counters of an active statistic.
+ *
+ * parameters:
+ *   id <-- id of statistic
+ *   t  <-- current time
+ *   hw <-- hardware counter values at current time
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_update(int                        id,
+        const cs_timer_t          *t,
+        const unsigned long long   hw[])
+{
+  cs_timer_stats_t  *s = _stats + id;
+
+  cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), t);
+
+  if (_hw_fd != NULL) {
+    for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+      s->hw_tot[k] += hw[k] - s->hw_start[k];
+  }
+
+  if (_n_trace_max > 0)
+    _trace_add(id, &(s->t_start), t,
+               (_hw_fd != NULL) ? s->hw_start : NULL, hw);
+}
+
+/*----------------------------------------------------------------------------
+ * Reallocate per-thread timers when the number of statistics grows.
+ *
+ * parameters:
+ *   n_stats_max_prev <-- previous maximum number of statistics
+ *----------------------------------------------------------------------------*/
+
+static void
+_resize_thread_times(int  n_stats_max_prev)
+{
+  if (_n_threads < 1)
+    _n_threads = cs_glob_n_threads;
+
+  cs_timer_stats_thread_t *tt;
+  BFT_MALLOC(tt, _n_threads*_n_stats_max, cs_timer_stats_thread_t);
+  memset(tt, 0, _n_threads*_n_stats_max*sizeof(cs_timer_stats_thread_t));
+
+  if (_thread_times != NULL) {
+    for (int t_id = 0; t_id < _n_threads; t_id++)
+      memcpy(tt + t_id*_n_stats_max,
+             _thread_times + t_id*n_stats_max_prev,
+             n_stats_max_prev*sizeof(cs_timer_stats_thread_t));
+    BFT_FREE(_thread_times);
+  }
+
+  _thread_times = tt;
+}
+
+/*----------------------------------------------------------------------------
+ * Return label used for a statistic in logged summary.
+ *
+ * Root statistics are designated by their name, as their label
+ * is usually "total".
+ *
+ * parameters:
+ *   id <-- id of statistic
+ *
+ * return:
+ *   pointer to label
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_summary_label(int  id)
+{
+  cs_timer_stats_t  *s = _stats + id;
+
+  if (s->parent_id < 0)
+    return cs_map_name_to_id_reverse(_name_map, id);
+  else
+    return s->label;
+}
+
+/*----------------------------------------------------------------------------
+ * Log wall-clock times of a statistic's children, recursively.
+ *
+ * parameters:
+ *   parent_id <-- id of parent statistic, or -1 for roots
+ *   depth     <-- depth of children in tree
+ *   n_stats   <-- number of statistics
+ *   n_v       <-- number of summed values per statistic
+ *   v_sum     <-- summed values per statistic (wall-clock time first)
+ *   v_min     <-- minimum wall-clock time per statistic
+ *   v_max     <-- maximum wall-clock and thread time per statistic
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_wall_times(int           parent_id,
+                int           depth,
+                int           n_stats,
+                int           n_v,
+                const double  v_sum[],
+                const double  v_min[],
+                const double  v_max[])
+{
+  const double n_ranks = cs_glob_n_ranks;
+
+  for (int stats_id = parent_id + 1; stats_id < n_stats; stats_id++) {
+
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->parent_id != parent_id || !(v_max[stats_id*2] > 0))
+      continue;
+
+    double t_mean = v_sum[stats_id*n_v] / n_ranks;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %*s%-*s %12.3f %12.3f %12.3f %9.3f\n",
+                  2*depth, "", 32 - 2*depth, _summary_label(stats_id),
+                  t_mean, v_min[stats_id], v_max[stats_id*2],
+                  v_max[stats_id*2] / t_mean);
+
+    _log_wall_times(stats_id, depth + 1, n_stats, n_v, v_sum, v_min, v_max);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Log summary of timer statistics, with values aggregated over ranks.
+ *
+ * This function is collective.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_summary(void)
+{
+  int n_stats = _n_stats;
+  cs_parall_min(1, CS_INT_TYPE, &n_stats);
+
+  if (n_stats < 1)
+    return;
+
+  /* Local values: wall-clock time, thread time max and mean,
+     and hardware counters */
+
+  const int n_v = 3 + CS_TIMER_STATS_N_HW;
+
+  double *v_sum, *v_min, *v_max;
+  BFT_MALLOC(v_sum, n_stats*n_v, double);
+  BFT_MALLOC(v_min, n_stats, double);
+  BFT_MALLOC(v_max, n_stats*2, double);
+
+  for (int stats_id = 0; stats_id < n_stats; stats_id++) {
+
+    cs_timer_stats_t  *s = _stats + stats_id;
+    double *v = v_sum + stats_id*n_v;
+
+    v[0] = (s->t_tot.wall_nsec + s->t_cur.wall_nsec)*1e-9;
+    v[1] = 0;
+    v[2] = 0;
+    for (int t_id = 0; t_id < _n_threads; t_id++) {
+      double t = _thread_times[t_id*_n_stats_max + stats_id].wall_time;
+      v[1] = CS_MAX(v[1], t);
+      v[2] += t / _n_threads;
+    }
+    for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+      v[3+k] = s->hw_tot[k];
+
+    v_min[stats_id] = v[0];
+    v_max[stats_id*2] = v[0];
+    v_max[stats_id*2 + 1] = v[1];
+
+  }
+
+  cs_parall_sum(n_stats*n_v, CS_DOUBLE, v_sum);
+  cs_parall_min(n_stats, CS_DOUBLE, v_min);
+  cs_parall_max(n_stats*2, CS_DOUBLE, v_max);
+
+  int hw_active = (_hw_fd != NULL) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &hw_active);
+
+  const double n_ranks = cs_glob_n_ranks;
+
+  /* Wall-clock times */
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nTimer statistics summary (wall-clock time):\n\n"
+                  "  %-32s %12s %12s %12s %9s\n"),
+                " ", _("mean (s)"), _("min (s)"), _("max (s)"),
+                _("max/mean"));
+
+  _log_wall_times(-1, 0, n_stats, n_v, v_sum, v_min, v_max);
+
+  /* Per-thread times */
+
+  int n_thread_stats = 0;
+
+  for (int stats_id = 0; stats_id < n_stats; stats_id++) {
+
+    const double *v = v_sum + stats_id*n_v;
+    if (!(v_max[stats_id*2 + 1] > 0))
+      continue;
+
+    if (n_thread_stats == 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\nTimer statistics in OpenMP regions "
+                      "(wall-clock time per thread):\n\n"
+                      "  %-32s %12s %12s %9s\n"),
+                    " ", _("mean (s)"), _("max (s)"), _("max/mean"));
+
+    double t_mean = v[2] / n_ranks;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32s %12.3f %12.3f %9.3f\n",
+                  _summary_label(stats_id),
+                  t_mean, v_max[stats_id*2 + 1],
+                  v_max[stats_id*2 + 1] / t_mean);
+
+    n_thread_stats++;
+
+  }
+
+  /* Hardware counters */
+
+  if (hw_active) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\nTimer statistics hardware counters "
+                    "(sum over ranks and threads):\n\n"
+                    "  %-32s %12s %12s %6s %12s %12s\n"),
+                  " ", _("Gcycles"), _("Ginstr."), _("IPC"),
+                  _("LLC miss (M)"), _("est. GB/s"));
+
+    for (int stats_id = 0; stats_id < n_stats; stats_id++) {
+
+      const double *v = v_sum + stats_id*n_v;
+      if (!(v[3] > 0))
+        continue;
+
+      /* Memory traffic is estimated as one 64-byte cache line
+         per last-level cache miss */
+
+      double t_mean = v[0] / n_ranks;
+      double gbs = (t_mean > 0) ? v[5]*64*1e-9/t_mean : 0;
+
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    "  %-32s %12.3f %12.3f %6.2f %12.3f %12.3f\n",
+                    _summary_label(stats_id),
+                    v[3]*1e-9, v[4]*1e-9, v[4]/v[3], v[5]*1e-6, gbs);
+
+    }
+
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(v_max);
+  BFT_FREE(v_min);
+  BFT_FREE(v_sum);
+}
+
+/*----------------------------------------------------------------------------
+ * Write a string to a JSON file, with required escapes.
+ *
+ * parameters:
+ *   f <-> output file
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_json_write_string(FILE        *f,
+                   const char  *s)
+{
+  fputc('"', f);
+  for (const char *c = s; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\')
+      fputc('\\', f);
+    if ((unsigned char)(*c) >= 0x20)
+      fputc(*c, f);
+  }
+  fputc('"', f);
+}
+
+/*----------------------------------------------------------------------------
+ * Write traced events of a given rank to a JSON file.
+ *
+ * parameters:
+ *   f        <-> output file
+ *   rank_id  <-- rank id
+ *   n_events <-- number of events
+ *   events   <-- events
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_trace_events(FILE                          *f,
+                    int                            rank_id,
+                    int                            n_events,
+                    const cs_timer_stats_event_t   events[])
+{
+  /* Name tracks: one per rank, and one thread per statistics tree */
+
+  fprintf(f, "%s{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+          "\"args\":{\"name\":\"rank %d\"}}",
+          (rank_id > 0) ? ",\n" : "", rank_id, rank_id);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->parent_id > -1)
+      continue;
+    fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+            "\"tid\":%d,\"args\":{\"name\":",
+            rank_id, s->root_id);
+    _json_write_string(f, cs_map_name_to_id_reverse(_name_map, stats_id));
+    fprintf(f, "}}");
+  }
+
+  for (int i = 0; i < n_events; i++) {
+
+    const cs_timer_stats_event_t *e = events + i;
+
+    int root_id = -1;
+    const char *label = NULL;
+    if (e->id < _n_stats) {
+      root_id = (_stats + e->id)->root_id;
+      label = (_stats + e->id)->label;
+    }
+
+    fprintf(f, ",\n{\"name\":");
+    if (label != NULL)
+      _json_write_string(f, label);
+    else
+      fprintf(f, "\"stat %d\"", e->id);
+
+    fprintf(f, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,"
+            "\"ts\":%.3f,\"dur\":%.3f",
+            rank_id, root_id,
+            e->start_nsec*1e-3, e->wall_nsec*1e-3);
+
+    if (e->hw[0] > 0)
+      fprintf(f, ",\"args\":{\"cycles\":%llu,\"instructions\":%llu,"
+              "\"llc_misses\":%llu}",
+              e->hw[0], e->hw[1], e->hw[2]);
+
+    fprintf(f, "}");
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write traced events of all ranks to a Chrome trace format file.
+ *
+ * Rank 0 writes the file, receiving events from other ranks one rank
+ * at a time. Times are relative to the reference time of rank 0.
+ *
+ * This function is collective.
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_trace(void)
+{
+  int n_trace_max = _n_trace_max;
+  cs_parall_max(1, CS_INT_TYPE, &n_trace_max);
+
+  if (n_trace_max < 1)
+    return;
+
+  /* Shift events relative to rank 0 reference time */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    long long t_ref_0[2] = {_t_ref.wall_sec, _t_ref.wall_nsec};
+    MPI_Bcast(t_ref_0, 2, MPI_LONG_LONG, 0, cs_glob_mpi_comm);
+    long long shift =   (_t_ref.wall_sec - t_ref_0[0]) * 1000000000
+                      + (_t_ref.wall_nsec - t_ref_0[1]);
+    for (int i = 0; i < _n_trace_events; i++)
+      _trace_events[i].start_nsec += shift;
+  }
+#endif
+
+  cs_gnum_t n_dropped = _n_trace_dropped;
+  cs_parall_counter(&n_dropped, 1);
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen("timer_stats_trace.json", "w");
+    if (f == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), "timer_stats_trace.json");
+
+    fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    _write_trace_events(f, 0, _n_trace_events, _trace_events);
+
+#if defined(HAVE_MPI)
+
+    for (int rank_id = 1; rank_id < cs_glob_n_ranks; rank_id++) {
+
+      MPI_Status status;
+      int n_events = 0;
+      cs_timer_stats_event_t *events = NULL;
+
+      MPI_Recv(&n_events, 1, MPI_INT, rank_id, 0, cs_glob_mpi_comm, &status);
+      BFT_MALLOC(events, n_events, cs_timer_stats_event_t);
+      MPI_Recv(events, n_events*sizeof(cs_timer_stats_event_t), MPI_BYTE,
+               rank_id, 0, cs_glob_mpi_comm, &status);
+
+      _write_trace_events(f, rank_id, n_events, events);
+
+      BFT_FREE(events);
+
+    }
+
+#endif
+
+    fprintf(f, "\n]}\n");
+    fclose(f);
+
+    if (n_dropped > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\nTimer statistics trace: %llu intervals not "
+                      "recorded (maximum of %d per rank reached).\n"),
+                    (unsigned long long)n_dropped, n_trace_max);
+
+  }
+
+#if defined(HAVE_MPI)
+
+  else {
+    MPI_Send(&_n_trace_events, 1, MPI_INT, 0, 0, cs_glob_mpi_comm);
+    MPI_Send(_trace_events, _n_trace_events*sizeof(cs_timer_stats_event_t),
+             MPI_BYTE, 0, 0, cs_glob_mpi_comm);
+  }
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Create time plots
  *----------------------------------------------------------------------------*/
@@ -306,6 +1033,8 @@ cs_timer_stats_initialize(void)
 
   _name_map = cs_map_name_to_id_create();
 
+  _t_ref = cs_timer_time();
+
   id = cs_timer_stats_create(NULL, "operations", "total");
   cs_timer_stats_start(id);
 
@@ -331,6 +1060,19 @@ cs_timer_stats_finalize(void)
 
   _time_id = -1;
 
+  _write_trace();
+  _log_summary();
+
+  _hw_counters_close();
+
+  BFT_FREE(_thread_times);
+  _n_threads = 0;
+
+  BFT_FREE(_trace_events);
+  _n_trace_events = 0;
+  _n_trace_events_max = 0;
+  _n_trace_dropped = 0;
+
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
     cs_timer_stats_t  *s = _stats + stats_id;
     BFT_FREE(s->label);
@@ -407,14 +1149,17 @@ cs_timer_stats_increment_time_step(void)
 {
   cs_timer_t t_incr = cs_timer_time();
 
+  unsigned long long hw[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw);
+
   /* Update start and current time for active statistics
      (should be only root statistics if used properly) */
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
     cs_timer_stats_t  *s = _stats + stats_id;
     if (s->active) {
-      cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
-      s->t_start = t_incr;
+      _update(stats_id, &t_incr, hw);
+      _activate(s, &t_incr, hw);
     }
   }
 
@@ -502,11 +1247,13 @@ cs_timer_stats_create(const char  *parent_name,
   /* Reallocate pointers if necessary */
 
   if (_n_stats > _n_stats_max) {
+    int n_stats_max_prev = _n_stats_max;
     if (_n_stats_max == 0)
       _n_stats_max = 8;
     else
       _n_stats_max *= 2;
     BFT_REALLOC(_stats, _n_stats_max, cs_timer_stats_t);
+    _resize_thread_times(n_stats_max_prev);
   }
 
   /* Now build new statistics */
@@ -538,6 +1285,11 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  for (int k = 0; k < CS_TIMER_STATS_N_HW; k++) {
+    s->hw_start[k] = 0;
+    s->hw_tot[k] = 0;
+  }
+
   return stats_id;
 }
 
@@ -639,16 +1391,17 @@ cs_timer_stats_start(int  id)
 
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
+  unsigned long long hw[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw);
+
   /* Start timer and inactive parents */
 
   for (int p_id = id; p_id > parent_id; p_id = (_stats + p_id)->parent_id) {
 
     s = _stats + p_id;
 
-    if (s->active == false) {
-      s->active = true;
-      s->t_start = t_start;
-    }
+    if (s->active == false)
+      _activate(s, &t_start, hw);
 
   }
 
@@ -674,6 +1427,9 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  unsigned long long hw[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw);
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -684,8 +1440,8 @@ cs_timer_stats_stop(int  id)
 
     if (s->active == true) {
       s->active = false;
+      _update(_active_id[root_id], &t_stop, hw);
       _active_id[root_id] = s->parent_id;
-      cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
     }
 
   }
@@ -723,6 +1479,9 @@ cs_timer_stats_switch(int  id)
 
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
+  unsigned long long hw[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw);
+
   /* Stop all active timers of same type which are lower level than the
      common parent. */
 
@@ -732,8 +1491,8 @@ cs_timer_stats_switch(int  id)
 
     if (s->active == true) {
       s->active = false;
+      _update(_active_id[root_id], &t_switch, hw);
       _active_id[root_id] = s->parent_id;
-      cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
     }
 
   }
@@ -745,10 +1504,8 @@ cs_timer_stats_switch(int  id)
 
     s = _stats + p_id;
 
-    if (s->active == false) {
-      s->active = true;
-      s->t_start = t_switch;
-    }
+    if (s->active == false)
+      _activate(s, &t_switch, hw);
 
   }
 
@@ -775,21 +1532,159 @@ cs_timer_stats_add_diff(int                id,
                         const cs_timer_t  *t0,
                         const cs_timer_t  *t1)
 {
-  if (id < 0 || id > _n_stats) return;
+  if (id < 0 || id >= _n_stats) return;
 
   cs_timer_stats_t  *s = _stats + id;
 
-  if (s->active == false)
+  if (s->active == false) {
     cs_timer_counter_add_diff(&(s->t_cur), t0, t1);
+    if (_n_trace_max > 0)
+      _trace_add(id, t0, t1, NULL, NULL);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start the per-thread timer of a given statistic.
+ *
+ * This function is intended to be called by each thread inside an OpenMP
+ * parallel region, so as to measure load imbalance between threads;
+ * the matching call to \ref cs_timer_stats_thread_stop should be placed
+ * before any implicit barrier. Per-thread timings do not modify the
+ * main timer of the statistic, and are only reported in the summary
+ * logged at finalization. Only wall-clock time is measured, so as to
+ * keep this timer cheap.
+ *
+ * \param[in]  id  id of statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_thread_start(int  id)
+{
+  if (id < 0 || id >= _n_stats) return;
+
+  int t_id = 0;
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+#endif
+
+  if (t_id < _n_threads)
+    _thread_times[t_id*_n_stats_max + id].t_start = cs_timer_wtime();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Stop the per-thread timer of a given statistic.
+ *
+ * \param[in]  id  id of statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_thread_stop(int  id)
+{
+  if (id < 0 || id >= _n_stats) return;
+
+  int t_id = 0;
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+#endif
+
+  if (t_id < _n_threads) {
+    cs_timer_stats_thread_t *tt = _thread_times + t_id*_n_stats_max + id;
+    tt->wall_time += cs_timer_wtime() - tt->t_start;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable hardware counters for timer statistics.
+ *
+ * When enabled (and supported by the system), CPU cycles, instructions and
+ * last-level cache misses are counted for each thread, and attributed to
+ * statistics between calls to \ref cs_timer_stats_start and
+ * \ref cs_timer_stats_stop (or \ref cs_timer_stats_switch).
+ *
+ * Counters are opened by each OpenMP thread, so this function must be
+ * called outside of parallel regions.
+ *
+ * \param[in]  enable  true to enable hardware counters, false to disable
+ *
+ * \return  true if hardware counters are active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_timer_stats_set_hw_counters(bool  enable)
+{
+  if (enable == false) {
+    _hw_counters_close();
+    return false;
+  }
+
+  if (_hw_fd != NULL)
+    return true;
+
+  if (_n_threads < 1)
+    _n_threads = cs_glob_n_threads;
+
+  if (_hw_counters_open() == false) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\nWarning: hardware counters for timer statistics "
+                    "are not available\n"
+                    "         on this system, and are not activated.\n"));
+    return false;
+  }
+
+  /* Counters of active statistics start now */
+
+  unsigned long long hw[CS_TIMER_STATS_N_HW];
+  _hw_counters_read(hw);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    for (int k = 0; k < CS_TIMER_STATS_N_HW; k++)
+      s->hw_start[k] = hw[k];
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable tracing of timer statistics.
+ *
+ * When enabled, each timed interval is recorded, and all ranks' records
+ * are written at finalization to a "timer_stats_trace.json" file, using
+ * the Chrome trace event format (which may be viewed with
+ * chrome://tracing or Perfetto).
+ *
+ * \param[in]  n_max_events  maximum number of recorded intervals per rank,
+ *                           or 0 to disable tracing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(int  n_max_events)
+{
+  _n_trace_max = CS_MAX(n_max_events, 0);
+
+  if (_n_trace_events > _n_trace_max)
+    _n_trace_events = _n_trace_max;
 }
 
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
  *
- * This creates 2 statistic timer trees, whose roots ids are:
+ * This adds default statistics to the 2 statistic timer trees, whose roots
+ * ids are:
  * - 0 for computational operations
  * - 1 for computational stages
+ *
+ * and defines an "mpi_wait" root statistic, to which time spent waiting
+ * for completion of halo exchanges is added.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -823,6 +1718,12 @@ cs_timer_stats_define_defaults(void)
   id = cs_timer_stats_create("stages",
                              "postprocessing_stage",
                              "post-processing");
+
+  /* Communication */
+
+  id = cs_timer_stats_create(NULL,
+                             "mpi_wait",
+                             "MPI wait");
 }
 
 /*-----------------------------------------------------------------------------*/
@@ -241,13 +241,85 @@ cs_timer_stats_add_diff(int  id,
                         const cs_timer_t    *t0,
                         const cs_timer_t    *t1);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start the per-thread timer of a given statistic.
+ *
+ * This function is intended to be called by each thread inside an OpenMP
+ * parallel region, so as to measure load imbalance between threads;
+ * the matching call to \ref cs_timer_stats_thread_stop should be placed
+ * before any implicit barrier. Per-thread timings do not modify the
+ * main timer of the statistic, and are only reported in the summary
+ * logged at finalization. Only wall-clock time is measured, so as to
+ * keep this timer cheap.
+ *
+ * \param[in]  id  id of statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_thread_start(int  id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Stop the per-thread timer of a given statistic.
+ *
+ * \param[in]  id  id of statistic
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_thread_stop(int  id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable hardware counters for timer statistics.
+ *
+ * When enabled (and supported by the system), CPU cycles, instructions and
+ * last-level cache misses are counted for each thread, and attributed to
+ * statistics between calls to \ref cs_timer_stats_start and
+ * \ref cs_timer_stats_stop (or \ref cs_timer_stats_switch).
+ *
+ * Counters are opened by each OpenMP thread, so this function must be
+ * called outside of parallel regions.
+ *
+ * \param[in]  enable  true to enable hardware counters, false to disable
+ *
+ * \return  true if hardware counters are active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_timer_stats_set_hw_counters(bool  enable);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable or disable tracing of timer statistics.
+ *
+ * When enabled, each timed interval is recorded, and all ranks' records
+ * are written at finalization to a "timer_stats_trace.json" file, using
+ * the Chrome trace event format (which may be viewed with
+ * chrome://tracing or Perfetto).
+ *
+ * \param[in]  n_max_events  maximum number of recorded intervals per rank,
+ *                           or 0 to disable tracing
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(int  n_max_events);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
  *
- * This creates 2 statistic timer trees, whose roots ids are:
+ * This adds default statistics to the 2 statistic timer trees, whose roots
+ * ids are:
  * - 0 for computational operations
  * - 1 for computational stages
+ *
+ * and defines an "mpi_wait" root statistic, to which time spent waiting
+ * for completion of halo exchanges is added.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -60,6 +60,32 @@ module field_operator
 
     !---------------------------------------------------------------------------
 
+    !> \brief  Compute cell gradients of multiple scalar fields together.
+
+    !> \param[in]   n_fields         number of fields
+    !> \param[in]   f_id             field ids
+    !> \param[in]   use_previous_t   1 if values at previous time step should
+    !>                               be used, 0 otherwise
+    !> \param[in]   imrgra           gradient computation mode
+    !> \param[in]   inc              0: increment; 1: do not increment
+    !> \param[in]   recompute_cocg   1 or 0: recompute COCG or not
+    !> \param[out]  grad             gradients (3, ncelet, n_fields)
+
+    subroutine field_gradient_scalars(n_fields, f_id, use_previous_t, imrgra,  &
+                                      inc, recompute_cocg,                     &
+                                      grad)                                    &
+      bind(C, name='cs_f_field_gradient_scalars')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value             :: n_fields
+      integer(c_int), dimension(*)      :: f_id
+      integer(c_int), value             :: use_previous_t, imrgra, inc
+      integer(c_int), value             :: recompute_cocg
+      real(kind=c_double), dimension(*) :: grad
+    end subroutine field_gradient_scalars
+
+    !---------------------------------------------------------------------------
+
     !> \brief  Compute cell gradient of potential field
 
     !> \param[in]   f_id             field id
@@ -127,6 +153,21 @@ module field_operator
       real(kind=c_double), dimension(6,3,*) :: grad
     end subroutine field_gradient_tensor
 
+    !---------------------------------------------------------------------------
+
+    !> \brief  Synchronize current parallel and periodic values of several
+    !>         fields together (standard halo).
+
+    !> \param[in]   n_fields         number of fields
+    !> \param[in]   f_id             field ids
+
+    subroutine field_synchronize_fields(n_fields, f_id)                        &
+      bind(C, name='cs_f_field_synchronize_fields')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value        :: n_fields
+      integer(c_int), dimension(*) :: f_id
+    end subroutine field_synchronize_fields
 
     !---------------------------------------------------------------------------
 
@@ -91,6 +91,7 @@ use rotation
 use turbomachinery
 use ptrglo
 use field
+use field_operator
 use cavitation
 use vof
 use cs_c_bindings
@@ -123,6 +124,7 @@ integer          nswrgp, imligp, iwarnp
 integer          nbrval, iappel
 integer          ndircp, icpt
 integer          numcpl
+integer          f_ids(2)
 integer          iflvoi, iflvob
 double precision rnorm , rnormt, rnorma, rnormi, vitnor
 double precision dtsrom, unsrom, rhom, rovolsdt
@@ -317,6 +319,16 @@ imax = 0
 
 if (nterup.gt.1) then
 
+  ! On assure la periodicite ou le parallelisme de la vitesse (donc de UVWK)
+  ! et de la pression, en un seul echange
+  if (iterns.gt.1) then
+    if (irangp.ge.0.or.iperio.eq.1) then
+      f_ids(1) = ivarfl(iu)
+      f_ids(2) = ivarfl(ipr)
+      call field_synchronize_fields(2, f_ids)
+    endif
+  endif
+
   !$omp parallel do private(isou)
   do iel = 1,ncelet
     do isou = 1, 3
@@ -351,14 +363,6 @@ if (nterup.gt.1) then
     xnrmu0 = sqrt(xnrmu0)
   endif
 
-  ! On assure la periodicite ou le parallelisme de UVWK et la pression
-  if (iterns.gt.1) then
-    if (irangp.ge.0.or.iperio.eq.1) then
-      call synvin(uvwk(1,1))
-      call synsca(cvar_pr)
-    endif
-  endif
-
 endif
 
 ! --- Physical quantities
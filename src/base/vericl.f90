@@ -119,14 +119,15 @@ integer          nstuvw, nstoup, nstuke
 integer          nstrij, nsurij, nstov2
 integer          nstuv2, nstokw, nstukw
 integer          nstunu, nstonu
-integer          nstusc
+integer          nstusc, nstbcr
 integer          iis, icodcu, icodcv, icodcw, icodck, icodce
 integer          icodcn
 integer          icodcp, icodcf, icodca, icodom
 integer          icor11, icor22, icor33, icor12, icor13, icor23
 integer          ipp, iokcod, iok
+integer          ii, f_id_ref, ivar_f, ivar_ref, kbcref, keyvar
 integer          icodni(2), icodvi(3), icodpp(2), icodtb(8), icodsc(2)
-integer          icodvf(2), icoduv(3), icodct(11), icodus(4)
+integer          icodvf(2), icoduv(3), icodct(11), icodus(4), icodbr(4)
 
 !===============================================================================
 
@@ -154,6 +155,7 @@ do ipp = 1, 11
 enddo
 do ipp = 1, 4
   icodus(ipp) = -1
+  icodbr(ipp) = -1
 enddo
 
 
@@ -178,6 +180,7 @@ nstoni = 0
 nstosc = 0
 nstovf = 0
 nstusc = 0
+nstbcr = 0
 nstvit = 0
 nstopp = 0
 nstoke = 0
@@ -1248,6 +1251,42 @@ if( nscal.ge.1 ) then
   enddo
 endif
 
+! 2.6 VERIFICATIONS DES COEFFICIENTS DE CL PARTAGES
+! =================================================
+
+! --- Les variables partageant les coefficients implicites de CL d'une autre
+!     variable (cle "bc_coeffs_ref") doivent avoir les memes types de CL
+!     et coefficients d'echange, faute de quoi les coefficients partages
+!     ne seraient valables que pour l'une d'entre elles.
+
+call field_get_key_id("bc_coeffs_ref", kbcref)
+call field_get_key_id("variable_id", keyvar)
+
+do ivar = 1, nvar
+  ! Traitement unique de chaque champ, a partir de sa premiere composante
+  call field_get_key_int(ivarfl(ivar), keyvar, ivar_f)
+  if (ivar.ne.ivar_f) cycle
+  call field_get_key_int(ivarfl(ivar), kbcref, f_id_ref)
+  if (f_id_ref.lt.0) cycle
+  call field_get_key_int(f_id_ref, keyvar, ivar_ref)
+  call field_get_dim(ivarfl(ivar), f_dim)
+  do ii = 0, f_dim-1
+    do ifac = 1, nfabor
+      if (     icodcl(ifac,ivar+ii).ne.icodcl(ifac,ivar_ref+ii)          &
+          .or. rcodcl(ifac,ivar+ii,2).ne.rcodcl(ifac,ivar_ref+ii,2)) then
+        if (itypfb(ifac).gt.0) then
+          itypfb(ifac) = -itypfb(ifac)
+        endif
+        icodbr(1) = ivar
+        icodbr(2) = ivar_ref
+        icodbr(3) = icodcl(ifac,ivar+ii)
+        icodbr(4) = icodcl(ifac,ivar_ref+ii)
+        nstbcr = nstbcr + 1
+      endif
+    enddo
+  enddo
+enddo
+
 !===============================================================================
 ! 3.  IMPRESSIONS RECAPITULATIVES
 !===============================================================================
@@ -1258,6 +1297,10 @@ if (nstoni.gt.0 .or. nstosc.gt.0 .or. nstovf.gt.0 .or. nstusc.gt.0 ) then
   iok = 1
 endif
 
+if (nstbcr.gt.0) then
+  iok = 1
+endif
+
 if (nstvit.gt.0 .or. nstopp.gt.0 .or. nstoke.gt.0 .or. nstrij.gt.0 .or.        &
     nstov2.gt.0 .or. nstonu.gt.0 .or. nstuvw.gt.0 .or. nstoup.gt.0 .or.        &
     nstuke.gt.0 .or. nsurij.gt.0 .or. nstuv2.gt.0 .or. nstunu.gt.0     ) then
@@ -1443,6 +1486,14 @@ if(iok.ne.0) then
          icodus(2), icodus(3), icodus(4)
   endif
 
+  call sync_bc_err(nstbcr, 4, icodbr)
+  if (nstbcr.ne.0) then
+    call field_get_label(ivarfl (icodbr(1)), chaine)
+    write(nfecra,1060) nstbcr, chaine, icodbr(3)
+    call field_get_label(ivarfl (icodbr(2)), chaine)
+    write(nfecra,1061) chaine, icodbr(4)
+  endif
+
   if (nstoni.gt.0 .or. nstosc.gt.0 .or. nstovf.gt.0 .or. nstusc.gt.0 ) then
     write (nfecra,1901) nstoni, nstosc, nstovf, nstusc
   endif
@@ -1519,6 +1570,15 @@ endif
 '@     derniere face : '                                       ,/,&
 '@       scalaire numero ',i10                                 ,/,&
 '@       icodcl scalaire ',i10   ,'; icodcl vitesse ',i10      ,/,&
+'@                                                            '  )
+ 1060 format(                                                     &
+'@                                                            ',/,&
+'@ COEFFICIENTS DE CL PARTAGES INCOHERENTS                    ',/,&
+'@   Nombre de faces de bord ',i10   ,'; variable ',a16        ,/,&
+'@     derniere face : icodcl ',i10                            ,/,&
+'@     (type de CL ou coefficient d''echange different)       '  )
+ 1061 format(                                                     &
+'@   variable de reference ',a16   ,'; icodcl ',i10            ,/,&
 '@                                                            '  )
  1901 format(                                                     &
 '@                                                            ',/,&
@@ -1664,6 +1724,15 @@ endif
 '@     last face:'                                             ,/,&
 '@       scalar number ',i10                                   ,/,&
 '@       icodcl scalar ',i10   ,'; icodcl velocity ',i10       ,/,&
+'@                                                            '  )
+ 1060 format(                                                     &
+'@                                                            ',/,&
+'@ INCOHERENT SHARED BOUNDARY CONDITION COEFFICIENTS          ',/,&
+'@   Number of boundary faces ',i10   ,'; variable ',a16       ,/,&
+'@     last face: icodcl ',i10                                 ,/,&
+'@     (different BC type or exchange coefficient)            '  )
+ 1061 format(                                                     &
+'@   reference variable ',a16   ,'; icodcl ',i10               ,/,&
 '@                                                            '  )
  1901 format(                                                     &
 '@                                                            ',/,&
@@ -143,12 +143,21 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Alignment of arrays allocated in memory arenas, and default arena
+   chunk size */
+
+#define BFT_MEM_ARENA_ALIGN 64
+#define BFT_MEM_ARENA_CHUNK_SIZE (1 << 20)
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
 
 /*
- * Structure defining an allocated memory block (for memory tracing)
+ * Structure defining an allocated memory block (for memory tracing).
+ *
+ * Blocks are stored in an open addressing hash table indexed by
+ * their address, with a power of 2 size.
  */
 
 struct _bft_mem_block_t {
@@ -158,6 +167,39 @@ struct _bft_mem_block_t {
 
 };
 
+/*
+ * Per-thread part of a memory arena
+ */
+
+typedef struct {
+
+  int       n_chunks;      /* Number of allocated chunks */
+  int       n_chunks_max;  /* Size of chunk arrays */
+  int       chunk_id;      /* Id of current chunk */
+  size_t    offset;        /* Offset of first free byte in current chunk */
+
+  size_t    used;          /* Number of bytes in use (including padding) */
+  size_t    used_max;      /* Maximum number of bytes used */
+
+  char    **chunk;         /* Chunk start addresses */
+  size_t   *chunk_size;    /* Chunk sizes */
+
+  char      _pad[64];      /* Padding to avoid false sharing */
+
+} _bft_mem_thread_arena_t;
+
+/*
+ * Memory arena (pool) for short-lived temporary arrays
+ */
+
+struct _bft_mem_arena_t {
+
+  char                     *name;        /* Arena name */
+  int                       n_threads;   /* Number of per-thread arenas */
+  _bft_mem_thread_arena_t  *t;           /* Per-thread arenas */
+
+};
+
 /*-----------------------------------------------------------------------------
  * Local function prototypes
  *-----------------------------------------------------------------------------*/
@@ -211,6 +253,9 @@ static bft_error_handler_t  *_bft_mem_error_handler
 static omp_lock_t _bft_mem_lock;
 #endif
 
+static int               _bft_mem_n_arenas = 0;
+static bft_mem_arena_t **_bft_mem_arenas = NULL;
+
 /*-----------------------------------------------------------------------------
  * Local function definitions
  *-----------------------------------------------------------------------------*/
@@ -409,6 +454,31 @@ _bft_mem_error(const char  *file_name,
   va_end(arg_ptr);
 }
 
+/*
+ * Return the hash table slot associated with a given pointer.
+ *
+ * The pointer value is mixed (using the MurmurHash3 finalizer) so
+ * that aligned addresses are well distributed.
+ *
+ * parameters:
+ *   p: <-- pointer
+ *
+ * returns:
+ *   associated hash table slot.
+ */
+
+static inline unsigned long
+_bft_mem_block_hash(const void  *p)
+{
+  unsigned long long k = (unsigned long long)((uintptr_t)p);
+
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+
+  return (unsigned long)(k & (_bft_mem_global_block_max - 1));
+}
+
 /*
  * Return the _bft_mem_block structure corresponding to a given
  * allocated block.
@@ -424,23 +494,27 @@ static struct _bft_mem_block_t *
 _bft_mem_block_info(const void *p_get)
 {
   struct _bft_mem_block_t  *pinfo = NULL;
-  unsigned long idx;
 
   if (_bft_mem_global_block_array != NULL) {
 
-    for (idx = _bft_mem_global_block_nbr - 1;
-         idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_get;
-         idx--);
+    const unsigned long mask = _bft_mem_global_block_max - 1;
+
+    /* Linear probing; the table always contains empty slots */
+
+    for (unsigned long idx = _bft_mem_block_hash(p_get);
+         _bft_mem_global_block_array[idx].p_bloc != NULL;
+         idx = (idx + 1) & mask) {
+      if (_bft_mem_global_block_array[idx].p_bloc == p_get) {
+        pinfo = _bft_mem_global_block_array + idx;
+        break;
+      }
+    }
 
-    if ((_bft_mem_global_block_array + idx)->p_bloc != p_get)
+    if (pinfo == NULL)
       _bft_mem_error(__FILE__, __LINE__, 0,
                      _("Adress [%10p] does not correspond to "
                        "the beginning of an allocated block."),
                      p_get);
-    else {
-      pinfo = _bft_mem_global_block_array + idx;
-      assert(p_get == pinfo->p_bloc);
-    }
 
   }
 
@@ -468,6 +542,29 @@ _bft_mem_block_size(const void  *p_in)
     return 0;
 }
 
+/*
+ * Insert a block in the hash table, which must have an empty slot.
+ *
+ * parameters:
+ *   p_new:    <-- allocated block's start adress.
+ *   size_new: <-- allocated block's size.
+ */
+
+static void
+_bft_mem_block_insert(void          *p_new,
+                      const size_t   size_new)
+{
+  const unsigned long mask = _bft_mem_global_block_max - 1;
+
+  unsigned long idx = _bft_mem_block_hash(p_new);
+
+  while (_bft_mem_global_block_array[idx].p_bloc != NULL)
+    idx = (idx + 1) & mask;
+
+  _bft_mem_global_block_array[idx].p_bloc = p_new;
+  _bft_mem_global_block_array[idx].size = size_new;
+}
+
 /*
  * Fill a _bft_mem_block_t structure for an allocated pointer.
  */
@@ -476,20 +573,22 @@ static void
 _bft_mem_block_malloc(void          *p_new,
                       const size_t   size_new)
 {
-  struct _bft_mem_block_t *pinfo;
-
   assert(size_new != 0);
 
   if (_bft_mem_global_block_array == NULL)
     return;
 
-  if (_bft_mem_global_block_nbr >= _bft_mem_global_block_max) {
+  /* Keep load factor below 1/2, rehashing if necessary */
+
+  if ((_bft_mem_global_block_nbr + 1)*2 > _bft_mem_global_block_max) {
+
+    struct _bft_mem_block_t *old_array = _bft_mem_global_block_array;
+    unsigned long old_max = _bft_mem_global_block_max;
 
     _bft_mem_global_block_max *= 2;
     _bft_mem_global_block_array
-      = (struct _bft_mem_block_t *) realloc(_bft_mem_global_block_array,
-                                            sizeof(struct _bft_mem_block_t)
-                                            * _bft_mem_global_block_max);
+      = (struct _bft_mem_block_t *) calloc(_bft_mem_global_block_max,
+                                           sizeof(struct _bft_mem_block_t));
 
     if (_bft_mem_global_block_array == NULL) {
       _bft_mem_error(__FILE__, __LINE__, errno,
@@ -497,75 +596,116 @@ _bft_mem_block_malloc(void          *p_new,
       return;
     }
 
-  }
+    for (unsigned long idx = 0; idx < old_max; idx++) {
+      if (old_array[idx].p_bloc != NULL)
+        _bft_mem_block_insert(old_array[idx].p_bloc, old_array[idx].size);
+    }
 
-  _bft_mem_global_block_nbr += 1;
+    free(old_array);
 
-  pinfo = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
+  }
 
-  /* Start adress and size of allocated block */
+  _bft_mem_block_insert(p_new, size_new);
 
-  pinfo->p_bloc = p_new;
-  pinfo->size   = size_new;
+  _bft_mem_global_block_nbr += 1;
 }
 
 /*
- * Update a _bft_mem_block_t structure for an reallocated pointer.
+ * Free a _bft_mem_block_t structure for a freed pointer.
  */
 
 static void
-_bft_mem_block_realloc(const void    *p_old,
-                       void          *p_new,
-                       size_t         size_new)
+_bft_mem_block_free(const void *p_free)
 {
-  struct _bft_mem_block_t *pinfo;
+  if (_bft_mem_global_block_array == NULL)
+    return;
 
-  assert(size_new != 0);
+  struct _bft_mem_block_t *pinfo = _bft_mem_block_info(p_free);
+
+  if (pinfo == NULL)
+    return;
+
+  /* Remove entry, shifting back following entries of the same probe
+     sequence so that no tombstones are needed */
 
-  pinfo = _bft_mem_block_info(p_old);
+  const unsigned long mask = _bft_mem_global_block_max - 1;
+  struct _bft_mem_block_t *a = _bft_mem_global_block_array;
 
-  if (pinfo != NULL) {
-    pinfo->p_bloc = p_new;
-    pinfo->size   = size_new;
+  unsigned long i = pinfo - a;
+  unsigned long j = i;
+
+  while (true) {
+    j = (j + 1) & mask;
+    if (a[j].p_bloc == NULL)
+      break;
+    unsigned long k = _bft_mem_block_hash(a[j].p_bloc);
+    bool keep = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+    if (! keep) {
+      a[i] = a[j];
+      i = j;
+    }
   }
+
+  a[i].p_bloc = NULL;
+  a[i].size = 0;
+
+  _bft_mem_global_block_nbr -= 1;
 }
 
 /*
- * Free a _bft_mem_block_t structure for a freed pointer.
+ * Return the calling thread's part of a memory arena.
+ *
+ * parameters:
+ *   arena: <-- pointer to memory arena.
+ *
+ * returns:
+ *   pointer to per-thread arena.
  */
 
-static void
-_bft_mem_block_free(const void *p_free)
+static _bft_mem_thread_arena_t *
+_bft_mem_arena_thread(bft_mem_arena_t  *arena)
 {
-  struct _bft_mem_block_t *pinfo, *pmove;
-  unsigned long idx;
+  int t_id = 0;
 
-  if (_bft_mem_global_block_array == NULL)
-    return;
-
-  for (idx = _bft_mem_global_block_nbr - 1;
-       idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_free;
-       idx--);
-
-  if ((_bft_mem_global_block_array + idx)->p_bloc != p_free)
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+  if (t_id >= arena->n_threads)
     _bft_mem_error(__FILE__, __LINE__, 0,
-                   _("Adress [%10p] does not correspond to "
-                     "the beginning of an allocated block."),
-                   p_free);
-
-  else {
-
-    /* We move the contents of the array's final block to the position
-       of the freed block, and shorten the array's useful part by one. */
+                   _("Memory arena \"%s\" used by thread %d\n"
+                     "but created for %d threads."),
+                   arena->name, t_id, arena->n_threads);
+#endif
 
-    pinfo = _bft_mem_global_block_array + idx;
-    pmove = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
-    pinfo->p_bloc = pmove->p_bloc;
-    pinfo->size   = pmove->size;
+  return arena->t + t_id;
+}
 
-    _bft_mem_global_block_nbr -= 1;
+/*
+ * Add a chunk to a per-thread arena.
+ *
+ * parameters:
+ *   arena: <-- pointer to memory arena (for naming).
+ *   ta:    <-> pointer to per-thread arena.
+ *   size:  <-- chunk size.
+ */
 
+static void
+_bft_mem_arena_add_chunk(const bft_mem_arena_t    *arena,
+                         _bft_mem_thread_arena_t  *ta,
+                         size_t                    size)
+{
+  if (ta->n_chunks >= ta->n_chunks_max) {
+    ta->n_chunks_max = (ta->n_chunks_max > 0) ? ta->n_chunks_max*2 : 4;
+    ta->chunk = bft_mem_realloc(ta->chunk, ta->n_chunks_max, sizeof(char *),
+                                "arena->chunk", __FILE__, __LINE__);
+    ta->chunk_size = bft_mem_realloc(ta->chunk_size, ta->n_chunks_max,
+                                     sizeof(size_t),
+                                     "arena->chunk_size", __FILE__, __LINE__);
   }
+
+  ta->chunk[ta->n_chunks] = bft_mem_malloc(size, 1, arena->name,
+                                           __FILE__, __LINE__);
+  ta->chunk_size[ta->n_chunks] = size;
+  ta->n_chunks += 1;
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -608,7 +748,7 @@ bft_mem_init(const char *log_file_name)
   alloc_size = sizeof(struct _bft_mem_block_t) * _bft_mem_global_block_max;
 
   _bft_mem_global_block_array
-    = malloc(sizeof(struct _bft_mem_block_t) * _bft_mem_global_block_max);
+    = calloc(_bft_mem_global_block_max, sizeof(struct _bft_mem_block_t));
 
   if (_bft_mem_global_block_array == NULL) {
     _bft_mem_error(__FILE__, __LINE__, errno,
@@ -695,9 +835,12 @@ void bft_mem_end(void)
       fprintf(_bft_mem_global_file, "List of non freed pointers:\n");
 
       for (pinfo = _bft_mem_global_block_array;
-           pinfo < _bft_mem_global_block_array + _bft_mem_global_block_nbr;
+           pinfo < _bft_mem_global_block_array + _bft_mem_global_block_max;
            pinfo++) {
 
+        if (pinfo->p_bloc == NULL)
+          continue;
+
         fprintf(_bft_mem_global_file,"[%10p]\n", pinfo->p_bloc);
         non_free++;
 
@@ -905,6 +1048,21 @@ bft_mem_realloc(void        *ptr,
 
     size_diff = new_size - old_size;
 
+    /* Remove the old block from the map while its address is still
+       valid, as the old pointer may not be used once reallocated */
+
+#if defined(HAVE_OPENMP)
+    if (in_parallel)
+      omp_set_lock(&_bft_mem_lock);
+#endif
+
+    _bft_mem_block_free(ptr);
+
+#if defined(HAVE_OPENMP)
+    if (in_parallel)
+      omp_unset_lock(&_bft_mem_lock);
+#endif
+
     p_loc = realloc(ptr, new_size);
 
     if (p_loc == NULL) {
@@ -942,7 +1100,7 @@ bft_mem_realloc(void        *ptr,
         fflush(_bft_mem_global_file);
       }
 
-      _bft_mem_block_realloc(ptr, p_loc, new_size);
+      _bft_mem_block_malloc(p_loc, new_size);
 
       _bft_mem_global_n_reallocs += 1;
 
@@ -1207,6 +1365,311 @@ bft_mem_have_memalign(void)
 #endif
 }
 
+/*!
+ * \brief Return a memory arena, creating it if needed.
+ *
+ * Memory arenas are intended for short-lived temporary arrays, such as
+ * work arrays whose lifetime does not exceed a time step. Allocation
+ * from an arena only increments an offset in a preallocated chunk, so
+ * it is much cheaper than a regular allocation, and arrays are not freed
+ * individually: memory is released either up to a previously obtained
+ * mark (using bft_mem_arena_release()), or globally when the arena
+ * is reset (usually at the end of a time step).
+ *
+ * Each thread uses its own part of the arena, so allocation is thread-safe
+ * without locking. Arenas are identified by name, so that peak memory
+ * may be attributed to the associated subsystem.
+ *
+ * This function should be called outside of OpenMP parallel regions.
+ *
+ * \param [in] name  arena name.
+ *
+ * \returns pointer to memory arena.
+ */
+
+bft_mem_arena_t *
+bft_mem_arena_get(const char  *name)
+{
+  for (int i = 0; i < _bft_mem_n_arenas; i++) {
+    if (strcmp(_bft_mem_arenas[i]->name, name) == 0)
+      return _bft_mem_arenas[i];
+  }
+
+  bft_mem_arena_t *arena = bft_mem_malloc(1, sizeof(bft_mem_arena_t),
+                                          "arena", __FILE__, __LINE__);
+
+  arena->name = bft_mem_malloc(strlen(name) + 1, 1, "arena->name",
+                               __FILE__, __LINE__);
+  strcpy(arena->name, name);
+
+  arena->n_threads = 1;
+#if defined(HAVE_OPENMP)
+  arena->n_threads = omp_get_max_threads();
+#endif
+
+  arena->t = bft_mem_malloc(arena->n_threads,
+                            sizeof(_bft_mem_thread_arena_t),
+                            "arena->t", __FILE__, __LINE__);
+  memset(arena->t, 0, arena->n_threads*sizeof(_bft_mem_thread_arena_t));
+
+  _bft_mem_arenas = bft_mem_realloc(_bft_mem_arenas,
+                                    _bft_mem_n_arenas + 1,
+                                    sizeof(bft_mem_arena_t *),
+                                    "_bft_mem_arenas", __FILE__, __LINE__);
+  _bft_mem_arenas[_bft_mem_n_arenas] = arena;
+  _bft_mem_n_arenas += 1;
+
+  return arena;
+}
+
+/*!
+ * \brief Allocate memory for ni elements of size bytes from a memory arena.
+ *
+ * Memory is taken from the calling thread's part of the arena, and
+ * aligned to 64 bytes.
+ *
+ * \param [in] arena  pointer to memory arena.
+ * \param [in] ni     number of elements.
+ * \param [in] size   element size.
+ *
+ * \returns pointer to allocated memory.
+ */
+
+void *
+bft_mem_arena_alloc(bft_mem_arena_t  *arena,
+                    size_t            ni,
+                    size_t            size)
+{
+  const size_t n_bytes = ni * size;
+
+  if (n_bytes == 0)
+    return NULL;
+
+  _bft_mem_thread_arena_t *ta = _bft_mem_arena_thread(arena);
+
+  while (true) {
+
+    if (ta->chunk_id >= ta->n_chunks) {
+      size_t chunk_size = n_bytes + BFT_MEM_ARENA_ALIGN;
+      if (chunk_size < BFT_MEM_ARENA_CHUNK_SIZE)
+        chunk_size = BFT_MEM_ARENA_CHUNK_SIZE;
+      _bft_mem_arena_add_chunk(arena, ta, chunk_size);
+    }
+
+    char *base = ta->chunk[ta->chunk_id];
+    uintptr_t start = (uintptr_t)(base + ta->offset);
+    start = (start + BFT_MEM_ARENA_ALIGN - 1)
+            & ~((uintptr_t)BFT_MEM_ARENA_ALIGN - 1);
+    size_t end = (start - (uintptr_t)base) + n_bytes;
+
+    if (end <= ta->chunk_size[ta->chunk_id]) {
+      ta->used += end - ta->offset;
+      ta->offset = end;
+      if (ta->used > ta->used_max)
+        ta->used_max = ta->used;
+      return (void *)start;
+    }
+
+    /* Not enough room in this chunk: move to the next one */
+
+    ta->used += ta->chunk_size[ta->chunk_id] - ta->offset;
+    ta->chunk_id += 1;
+    ta->offset = 0;
+
+  }
+}
+
+/*!
+ * \brief Return a mark of the calling thread's current position in a
+ *        memory arena.
+ *
+ * \param [in] arena  pointer to memory arena.
+ *
+ * \returns mark which may be passed to bft_mem_arena_release().
+ */
+
+bft_mem_arena_mark_t
+bft_mem_arena_mark(bft_mem_arena_t  *arena)
+{
+  _bft_mem_thread_arena_t *ta = _bft_mem_arena_thread(arena);
+
+  bft_mem_arena_mark_t mark = {.chunk_id = ta->chunk_id,
+                               .offset = ta->offset,
+                               .used = ta->used};
+
+  return mark;
+}
+
+/*!
+ * \brief Release memory allocated by the calling thread from a memory
+ *        arena since a given mark.
+ *
+ * Arrays allocated after the mark must not be used anymore.
+ *
+ * \param [in] arena  pointer to memory arena.
+ * \param [in] mark   mark obtained using bft_mem_arena_mark().
+ */
+
+void
+bft_mem_arena_release(bft_mem_arena_t       *arena,
+                      bft_mem_arena_mark_t   mark)
+{
+  _bft_mem_thread_arena_t *ta = _bft_mem_arena_thread(arena);
+
+  ta->chunk_id = mark.chunk_id;
+  ta->offset = mark.offset;
+  ta->used = mark.used;
+}
+
+/*!
+ * \brief Reset a memory arena, releasing all arrays allocated from it.
+ *
+ * When several chunks were needed by a given thread, they are replaced
+ * by a single one of the same total size, so that following allocations
+ * of similar sizes fit in a single chunk. Marks obtained before the
+ * reset are invalidated.
+ *
+ * This function should be called outside of OpenMP parallel regions.
+ *
+ * \param [in] arena  pointer to memory arena.
+ */
+
+void
+bft_mem_arena_reset(bft_mem_arena_t  *arena)
+{
+  for (int t_id = 0; t_id < arena->n_threads; t_id++) {
+
+    _bft_mem_thread_arena_t *ta = arena->t + t_id;
+
+    if (ta->n_chunks > 1) {
+      size_t total_size = 0;
+      for (int i = 0; i < ta->n_chunks; i++) {
+        total_size += ta->chunk_size[i];
+        ta->chunk[i] = bft_mem_free(ta->chunk[i], arena->name,
+                                    __FILE__, __LINE__);
+      }
+      ta->n_chunks = 0;
+      _bft_mem_arena_add_chunk(arena, ta, total_size);
+    }
+
+    ta->chunk_id = 0;
+    ta->offset = 0;
+    ta->used = 0;
+
+  }
+}
+
+/*!
+ * \brief Reset all memory arenas.
+ *
+ * This function should be called outside of OpenMP parallel regions,
+ * usually at time step boundaries.
+ */
+
+void
+bft_mem_arena_reset_all(void)
+{
+  for (int i = 0; i < _bft_mem_n_arenas; i++)
+    bft_mem_arena_reset(_bft_mem_arenas[i]);
+}
+
+/*!
+ * \brief Return the number of defined memory arenas.
+ *
+ * \returns number of memory arenas.
+ */
+
+int
+bft_mem_arena_n_arenas(void)
+{
+  return _bft_mem_n_arenas;
+}
+
+/*!
+ * \brief Return a memory arena given its id.
+ *
+ * \param [in] arena_id  arena id (0 to bft_mem_arena_n_arenas() - 1).
+ *
+ * \returns pointer to memory arena, or NULL if not present.
+ */
+
+bft_mem_arena_t *
+bft_mem_arena_by_id(int  arena_id)
+{
+  if (arena_id < 0 || arena_id >= _bft_mem_n_arenas)
+    return NULL;
+
+  return _bft_mem_arenas[arena_id];
+}
+
+/*!
+ * \brief Return the name of a memory arena.
+ *
+ * \param [in] arena  pointer to memory arena.
+ *
+ * \returns arena name.
+ */
+
+const char *
+bft_mem_arena_get_name(const bft_mem_arena_t  *arena)
+{
+  return arena->name;
+}
+
+/*!
+ * \brief Return maximum memory used in a memory arena.
+ *
+ * This is the sum over threads of each thread's maximum usage, so it
+ * may be larger than the maximum usage at a given instant.
+ *
+ * \param [in] arena  pointer to memory arena.
+ *
+ * \returns maximum memory used in arena (in kB).
+ */
+
+size_t
+bft_mem_arena_size_max(const bft_mem_arena_t  *arena)
+{
+  size_t used_max = 0;
+
+  for (int t_id = 0; t_id < arena->n_threads; t_id++)
+    used_max += arena->t[t_id].used_max;
+
+  return (used_max / 1024);
+}
+
+/*!
+ * \brief Destroy all memory arenas.
+ *
+ * Arrays allocated from arenas must not be used anymore after this call.
+ */
+
+void
+bft_mem_arena_destroy_all(void)
+{
+  for (int i = 0; i < _bft_mem_n_arenas; i++) {
+
+    bft_mem_arena_t *arena = _bft_mem_arenas[i];
+
+    for (int t_id = 0; t_id < arena->n_threads; t_id++) {
+      _bft_mem_thread_arena_t *ta = arena->t + t_id;
+      for (int j = 0; j < ta->n_chunks; j++)
+        bft_mem_free(ta->chunk[j], arena->name, __FILE__, __LINE__);
+      bft_mem_free(ta->chunk, "arena->chunk", __FILE__, __LINE__);
+      bft_mem_free(ta->chunk_size, "arena->chunk_size", __FILE__, __LINE__);
+    }
+
+    bft_mem_free(arena->t, "arena->t", __FILE__, __LINE__);
+    bft_mem_free(arena->name, "arena->name", __FILE__, __LINE__);
+    bft_mem_free(arena, "arena", __FILE__, __LINE__);
+
+  }
+
+  _bft_mem_arenas = bft_mem_free(_bft_mem_arenas, "_bft_mem_arenas",
+                                 __FILE__, __LINE__);
+  _bft_mem_n_arenas = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -43,6 +43,20 @@ BEGIN_C_DECLS
  * Public types
  *============================================================================*/
 
+/* Memory arena (opaque) */
+
+typedef struct _bft_mem_arena_t  bft_mem_arena_t;
+
+/* Position in a thread's part of a memory arena */
+
+typedef struct {
+
+  int     chunk_id;   /* Id of current chunk */
+  size_t  offset;     /* Offset in current chunk */
+  size_t  used;       /* Number of bytes in use */
+
+} bft_mem_arena_mark_t;
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -120,6 +134,22 @@ _ptr = bft_mem_free(_ptr, #_ptr, __FILE__, __LINE__)
 _ptr = (_type *) bft_mem_memalign(_align, _ni, sizeof(_type), \
                                   #_ptr, __FILE__, __LINE__)
 
+/*
+ * Allocate memory for _ni items of type _type from a memory arena.
+ *
+ * This macro calls bft_mem_arena_alloc(). Memory allocated this way
+ * must not be freed using BFT_FREE.
+ *
+ * parameters:
+ *   _ptr   --> pointer to allocated memory.
+ *   _arena <-> pointer to memory arena.
+ *   _ni    <-- number of items.
+ *   _type  <-- element type.
+ */
+
+#define BFT_ARENA_ALLOC(_ptr, _arena, _ni, _type) \
+_ptr = (_type *) bft_mem_arena_alloc(_arena, _ni, sizeof(_type))
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -336,6 +366,166 @@ bft_mem_error_handler_get(void);
 void
 bft_mem_error_handler_set(bft_error_handler_t *handler);
 
+/*
+ * Return a memory arena, creating it if needed.
+ *
+ * Memory arenas are intended for short-lived temporary arrays, such as
+ * work arrays whose lifetime does not exceed a time step. Allocation
+ * from an arena only increments an offset in a preallocated chunk, and
+ * arrays are not freed individually: memory is released either up to a
+ * previously obtained mark (using bft_mem_arena_release()), or globally
+ * when the arena is reset (usually at the end of a time step).
+ *
+ * Each thread uses its own part of the arena, so allocation is thread-safe
+ * without locking. Arenas are identified by name, so that peak memory
+ * may be attributed to the associated subsystem.
+ *
+ * This function should be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   name <-- arena name.
+ *
+ * returns:
+ *   pointer to memory arena.
+ */
+
+bft_mem_arena_t *
+bft_mem_arena_get(const char  *name);
+
+/*
+ * Allocate memory for ni elements of size bytes from a memory arena.
+ *
+ * Memory is taken from the calling thread's part of the arena, and
+ * aligned to 64 bytes.
+ *
+ * parameters:
+ *   arena <-> pointer to memory arena.
+ *   ni    <-- number of elements.
+ *   size  <-- element size.
+ *
+ * returns:
+ *   pointer to allocated memory.
+ */
+
+void *
+bft_mem_arena_alloc(bft_mem_arena_t  *arena,
+                    size_t            ni,
+                    size_t            size);
+
+/*
+ * Return a mark of the calling thread's current position in a memory arena.
+ *
+ * parameters:
+ *   arena <-- pointer to memory arena.
+ *
+ * returns:
+ *   mark which may be passed to bft_mem_arena_release().
+ */
+
+bft_mem_arena_mark_t
+bft_mem_arena_mark(bft_mem_arena_t  *arena);
+
+/*
+ * Release memory allocated by the calling thread from a memory arena
+ * since a given mark.
+ *
+ * Arrays allocated after the mark must not be used anymore.
+ *
+ * parameters:
+ *   arena <-> pointer to memory arena.
+ *   mark  <-- mark obtained using bft_mem_arena_mark().
+ */
+
+void
+bft_mem_arena_release(bft_mem_arena_t       *arena,
+                      bft_mem_arena_mark_t   mark);
+
+/*
+ * Reset a memory arena, releasing all arrays allocated from it.
+ *
+ * When several chunks were needed by a given thread, they are replaced
+ * by a single one of the same total size. Marks obtained before the
+ * reset are invalidated.
+ *
+ * This function should be called outside of OpenMP parallel regions.
+ *
+ * parameters:
+ *   arena <-> pointer to memory arena.
+ */
+
+void
+bft_mem_arena_reset(bft_mem_arena_t  *arena);
+
+/*
+ * Reset all memory arenas.
+ *
+ * This function should be called outside of OpenMP parallel regions,
+ * usually at time step boundaries.
+ */
+
+void
+bft_mem_arena_reset_all(void);
+
+/*
+ * Return the number of defined memory arenas.
+ *
+ * returns:
+ *   number of memory arenas.
+ */
+
+int
+bft_mem_arena_n_arenas(void);
+
+/*
+ * Return a memory arena given its id.
+ *
+ * parameters:
+ *   arena_id <-- arena id (0 to bft_mem_arena_n_arenas() - 1).
+ *
+ * returns:
+ *   pointer to memory arena, or NULL if not present.
+ */
+
+bft_mem_arena_t *
+bft_mem_arena_by_id(int  arena_id);
+
+/*
+ * Return the name of a memory arena.
+ *
+ * parameters:
+ *   arena <-- pointer to memory arena.
+ *
+ * returns:
+ *   arena name.
+ */
+
+const char *
+bft_mem_arena_get_name(const bft_mem_arena_t  *arena);
+
+/*
+ * Return maximum memory used in a memory arena.
+ *
+ * This is the sum over threads of each thread's maximum usage.
+ *
+ * parameters:
+ *   arena <-- pointer to memory arena.
+ *
+ * returns:
+ *   maximum memory used in arena (in kB).
+ */
+
+size_t
+bft_mem_arena_size_max(const bft_mem_arena_t  *arena);
+
+/*
+ * Destroy all memory arenas.
+ *
+ * Arrays allocated from arenas must not be used anymore after this call.
+ */
+
+void
+bft_mem_arena_destroy_all(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -112,13 +112,13 @@ double precision smbrs(ncelet), rovsdt(ncelet)
 
 integer          ivar, iel, idirac
 integer          inc , iccocg, iprev
-integer          ii
+integer          f_ids(2)
 
 double precision sum, epsi
 double precision tsgrad, tschim, tsdiss
 double precision turb_schmidt
 
-double precision, allocatable, dimension(:,:) :: gradf, grady
+double precision, allocatable, dimension(:,:,:) :: gradfy
 double precision, allocatable, dimension(:) :: w10, w11
 double precision, dimension(:), pointer :: crom
 double precision, dimension(:), pointer :: visct
@@ -225,42 +225,29 @@ endif
 if (ivar.eq.isca(icoyfp)) then
 
   ! Allocate a temporary array for gradient computation
-  allocate(gradf(3,ncelet), grady(3,ncelet))
+  allocate(gradfy(3,ncelet,2))
 
   ! Allocate work arrays
   allocate(w10(ncelet), w11(ncelet))
 
-! --- Calcul du gradient de F
-!     =======================
+! --- Calcul des gradients de F et de Yfuel
+!     =====================================
 
-  ii = isca(ifm)
   do iel = 1, ncel
     w10(iel) = cvara_fm(iel)
-  enddo
-
-  iprev = 1
-  inc = 1
-  iccocg = 1
-
-  call field_gradient_scalar(ivarfl(ii), iprev, imrgra, inc,              &
-                             iccocg,                                      &
-                             gradf)
-
-! --- Calcul du gradient de Yfuel
-!     ===========================
-
-  ii = isca(iyfm)
-  do iel = 1, ncel
     w11(iel) = cvara_yfm(iel)
   enddo
 
+  f_ids(1) = ivarfl(isca(ifm))
+  f_ids(2) = ivarfl(isca(iyfm))
+
   iprev = 1
   inc = 1
   iccocg = 1
 
-  call field_gradient_scalar(ivarfl(ii), iprev, imrgra, inc,              &
-                             iccocg,                                      &
-                             grady)
+  call field_gradient_scalars(2, f_ids, iprev, imrgra, inc,               &
+                              iccocg,                                     &
+                              gradfy)
 
 ! --- Calcul du terme source
 !     ======================
@@ -324,9 +311,9 @@ if (ivar.eq.isca(icoyfp)) then
 
     tsgrad =  (2.0d0                                              &
          * visct(iel)/(turb_schmidt)                              &
-         * (  gradf(1,iel)*grady(1,iel)                           &
-            + gradf(2,iel)*grady(2,iel)                           &
-            + gradf(3,iel)*grady(3,iel) ))                        &
+         * (  gradfy(1,iel,1)*gradfy(1,iel,2)                     &
+            + gradfy(2,iel,1)*gradfy(2,iel,2)                     &
+            + gradfy(3,iel,1)*gradfy(3,iel,2) ))                  &
          * volume(iel)
 
 
@@ -351,7 +338,7 @@ if (ivar.eq.isca(icoyfp)) then
   enddo
 
   ! Free memory
-  deallocate(gradf, grady)
+  deallocate(gradfy)
   deallocate(w10, w11)
 
 endif
@@ -62,6 +62,7 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_halo.h"
+#include "cs_halo_batch.h"
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
@@ -168,12 +169,43 @@ static int               _n_ct_zones_max = 0;
 static int               _n_ct_zones     = 0;
 static cs_ctwr_zone_t  **_ct_zone   = NULL;
 
+/* Halo batch for synchronization of cooling tower arrays
+   (buffers are kept from one call to the next) */
+
+static cs_halo_batch_t   *_halo_batch = NULL;
+static const cs_halo_t   *_halo_batch_halo = NULL;
+
 /* Restart file */
 
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return the cooling towers halo batch, emptied of previously registered
+ * arrays, and (re)created if the halo has changed.
+ *
+ * parameters:
+ *   halo <-- pointer to associated halo structure
+ *
+ * returns:
+ *   pointer to halo batch structure
+ *----------------------------------------------------------------------------*/
+
+static cs_halo_batch_t *
+_get_halo_batch(const cs_halo_t  *halo)
+{
+  if (_halo_batch_halo != halo) {
+    cs_halo_batch_destroy(&_halo_batch);
+    _halo_batch = cs_halo_batch_create(halo, CS_HALO_STANDARD);
+    _halo_batch_halo = halo;
+  }
+  else
+    cs_halo_batch_clear(_halo_batch);
+
+  return _halo_batch;
+}
+
 /*----------------------------------------------------------------------------
  * Additional output for cooling towers
  *
@@ -613,6 +645,9 @@ cs_ctwr_all_destroy(void)
   _n_ct_zones = 0;
 
   BFT_FREE(_ct_zone);
+
+  cs_halo_batch_destroy(&_halo_batch);
+  _halo_batch_halo = NULL;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1031,15 +1066,15 @@ cs_ctwr_init_field_vars(cs_real_t  rho0,
 
   /* Parallel synchronization */
   if (halo != NULL) {
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, vel_l);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, cpro_taup);
+    cs_halo_batch_t *batch = _get_halo_batch(halo);
+    cs_halo_batch_add(batch, vel_l, 1, false);
+    cs_halo_batch_add(batch, cpro_taup, 1, false);
     if (cfld_yp != NULL)
-      cs_halo_sync_var(halo, CS_HALO_STANDARD, cfld_yp->val);
-    if (cfld_drift_vel != NULL) {
-      cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, cfld_drift_vel->val, 3);
-      if (m->n_init_perio > 0)
-        cs_halo_perio_sync_var_vect(halo, CS_HALO_STANDARD, cfld_drift_vel->val);
-    }
+      cs_halo_batch_add(batch, cfld_yp->val, 1, false);
+    if (cfld_drift_vel != NULL)
+      cs_halo_batch_add(batch, cfld_drift_vel->val, 3,
+                        (m->n_init_perio > 0));
+    cs_halo_batch_sync(batch);
   }
 
   /* Free memory */
@@ -1489,15 +1524,15 @@ cs_ctwr_restart_field_vars(cs_real_t  rho0,
 
   /* Parallel synchronization */
   if (halo != NULL) {
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, vel_l);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, cpro_taup);
+    cs_halo_batch_t *batch = _get_halo_batch(halo);
+    cs_halo_batch_add(batch, vel_l, 1, false);
+    cs_halo_batch_add(batch, cpro_taup, 1, false);
     if (cfld_yp != NULL)
-      cs_halo_sync_var(halo, CS_HALO_STANDARD, cfld_yp->val);
-    if (cfld_drift_vel != NULL) {
-      cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, cfld_drift_vel->val, 3);
-      if (m->n_init_perio > 0)
-        cs_halo_perio_sync_var_vect(halo, CS_HALO_STANDARD, cfld_drift_vel->val);
-    }
+      cs_halo_batch_add(batch, cfld_yp->val, 1, false);
+    if (cfld_drift_vel != NULL)
+      cs_halo_batch_add(batch, cfld_drift_vel->val, 3,
+                        (m->n_init_perio > 0));
+    cs_halo_batch_sync(batch);
   }
 
   /* Free memory */
@@ -1690,13 +1725,11 @@ cs_ctwr_phyvar_update(cs_real_t  rho0,
 
   /* Parallel synchronization */
   if (halo != NULL) {
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, x);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, x_s);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, cpro_x1);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, cp_h);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, h_h);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, rho_h);
-    cs_halo_sync_var(halo, CS_HALO_STANDARD, t_l);
+    cs_real_t *sync_vars[] = {x, x_s, cpro_x1, cp_h, h_h, rho_h, t_l};
+    cs_halo_batch_t *batch = _get_halo_batch(halo);
+    for (int i = 0; i < 7; i++)
+      cs_halo_batch_add(batch, sync_vars[i], 1, false);
+    cs_halo_batch_sync(batch);
   }
 
   for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
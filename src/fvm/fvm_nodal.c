@@ -132,6 +132,37 @@ BEGIN_C_DECLS
   Parallelism is thus made quite "transparent" to the calling code.
 */
 
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Maximum number of cached output distributors per entity set */
+
+#define FVM_NODAL_N_BLOCK_DISTS_MAX 4
+
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Cached part to block distribution (linked list, most recent first) */
+
+struct _fvm_nodal_block_dist_t {
+
+#if defined(HAVE_MPI)
+
+  int                    n_sub;        /* Number of appended sections */
+  cs_lnum_t              n_part_ents;  /* Local number of entities */
+  cs_block_dist_info_t   bi;           /* Block distribution info */
+  MPI_Comm               comm;         /* Associated communicator */
+
+  cs_part_to_block_t    *d;            /* Associated distributor */
+
+#endif
+
+  fvm_nodal_block_dist_t  *next;       /* Next cached distribution */
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -197,6 +228,59 @@ static int _compare_edges(const void *x, const void *y)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Create an empty list of cached output distributors.
+ *
+ * The list starts with a head node which is never removed before the
+ * associated structure is destroyed, so that entries may be added or
+ * removed through const pointers to that structure.
+ *
+ * returns:
+ *   pointer to list head
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_block_dist_t *
+_block_dists_create(void)
+{
+  fvm_nodal_block_dist_t *head;
+
+  BFT_MALLOC(head, 1, fvm_nodal_block_dist_t);
+
+#if defined(HAVE_MPI)
+  head->n_sub = -1;
+  head->n_part_ents = -1;
+  head->d = NULL;
+#endif
+  head->next = NULL;
+
+  return head;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a list of cached output distributors.
+ *
+ * parameters:
+ *   block_dists <-> pointer to first cached distributor in list
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_dists_destroy(fvm_nodal_block_dist_t  **block_dists)
+{
+  fvm_nodal_block_dist_t *bd = *block_dists;
+
+  while (bd != NULL) {
+    fvm_nodal_block_dist_t *next = bd->next;
+#if defined(HAVE_MPI)
+    if (bd->d != NULL)
+      cs_part_to_block_destroy(&(bd->d));
+#endif
+    BFT_FREE(bd);
+    bd = next;
+  }
+
+  *block_dists = NULL;
+}
+
 /*----------------------------------------------------------------------------
  * Copy a nodal mesh section representation structure, sharing arrays
  * with the original structure.
@@ -264,6 +348,8 @@ _fvm_nodal_section_copy(const fvm_nodal_section_t *this_section)
   else
     new_section->global_element_num = NULL;
 
+  new_section->block_dists = _block_dists_create();
+
   return (new_section);
 }
 
@@ -834,6 +920,8 @@ fvm_nodal_section_create(const fvm_element_t  type)
 
   this_section->global_element_num = NULL;
 
+  this_section->block_dists = _block_dists_create();
+
   return (this_section);
 }
 
@@ -882,6 +970,8 @@ fvm_nodal_section_destroy(fvm_nodal_section_t  * this_section)
   if (this_section->global_element_num != NULL)
     fvm_io_num_destroy(this_section->global_element_num);
 
+  _block_dists_destroy(&(this_section->block_dists));
+
   /* Main structure destroyed and NULL returned */
 
   BFT_FREE(this_section);
@@ -1111,6 +1201,136 @@ fvm_nodal_cell_face_connect(fvm_element_t   element_type,
   }
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return a cached part to block distributor for output, if available.
+ *
+ * Distributors are cached for vertices at the mesh level (when
+ * this_section is NULL), or for elements at the level of the first
+ * section of a group of appended sections. A cached distributor is
+ * only returned if it was built for the same number of appended
+ * sections, local entities, block distribution, and communicator.
+ *
+ * The returned distributor remains owned by the mesh, and must not
+ * be destroyed by the caller.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to nodal mesh structure (for vertices)
+ *   this_section  <-- pointer to first section (for elements), or NULL
+ *   n_sub         <-- number of appended sections (0 for vertices)
+ *   n_part_ents   <-- local number of entities distributed
+ *   bi            <-- associated block distribution info
+ *   comm          <-- associated communicator
+ *
+ * returns:
+ *   pointer to cached distributor, or NULL if none matches
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+fvm_nodal_block_dist_get(const fvm_nodal_t          *this_nodal,
+                         const fvm_nodal_section_t  *this_section,
+                         int                         n_sub,
+                         cs_lnum_t                   n_part_ents,
+                         cs_block_dist_info_t        bi,
+                         MPI_Comm                    comm)
+{
+  const fvm_nodal_block_dist_t *head
+    = (this_section != NULL) ? this_section->block_dists
+                             : this_nodal->block_dists;
+
+  for (fvm_nodal_block_dist_t *bd = head->next; bd != NULL; bd = bd->next) {
+    if (   bd->n_sub == n_sub
+        && bd->n_part_ents == n_part_ents
+        && bd->bi.gnum_range[0] == bi.gnum_range[0]
+        && bd->bi.gnum_range[1] == bi.gnum_range[1]
+        && bd->bi.n_ranks == bi.n_ranks
+        && bd->bi.rank_step == bi.rank_step
+        && bd->bi.block_size == bi.block_size
+        && bd->comm == comm)
+      return bd->d;
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a part to block distributor to a mesh's output cache.
+ *
+ * Ownership of the distributor is transferred to the mesh.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to nodal mesh structure (for vertices)
+ *   this_section  <-- pointer to first section (for elements), or NULL
+ *   n_sub         <-- number of appended sections (0 for vertices)
+ *   n_part_ents   <-- local number of entities distributed
+ *   bi            <-- associated block distribution info
+ *   comm          <-- associated communicator
+ *   d             <-- distributor to cache
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_block_dist_add(const fvm_nodal_t          *this_nodal,
+                         const fvm_nodal_section_t  *this_section,
+                         int                         n_sub,
+                         cs_lnum_t                   n_part_ents,
+                         cs_block_dist_info_t        bi,
+                         MPI_Comm                    comm,
+                         cs_part_to_block_t         *d)
+{
+  fvm_nodal_block_dist_t *head
+    = (this_section != NULL) ? this_section->block_dists
+                             : this_nodal->block_dists;
+
+  fvm_nodal_block_dist_t *bd;
+  BFT_MALLOC(bd, 1, fvm_nodal_block_dist_t);
+
+  bd->n_sub = n_sub;
+  bd->n_part_ents = n_part_ents;
+  bd->bi = bi;
+  bd->comm = comm;
+  bd->d = d;
+  bd->next = head->next;
+
+  head->next = bd;
+
+  /* Limit cache size (the oldest entries are dropped) */
+
+  int n_cached = 1;
+  while (bd->next != NULL) {
+    if (n_cached >= FVM_NODAL_N_BLOCK_DISTS_MAX) {
+      _block_dists_destroy(&(bd->next));
+      break;
+    }
+    bd = bd->next;
+    n_cached++;
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Free all cached output distributors of a nodal mesh.
+ *
+ * This must be called whenever the mesh's sections or global numberings
+ * are modified.
+ *
+ * parameters:
+ *   this_nodal <-> pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_block_dist_clear(fvm_nodal_t  *this_nodal)
+{
+  if (this_nodal == NULL)
+    return;
+
+  _block_dists_destroy(&(this_nodal->block_dists->next));
+
+  for (int i = 0; i < this_nodal->n_sections; i++)
+    _block_dists_destroy(&(this_nodal->sections[i]->block_dists->next));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1166,6 +1386,7 @@ fvm_nodal_create(const char  *name,
   this_nodal->_parent_vertex_num = NULL;
 
   this_nodal->global_vertex_num = NULL;
+  this_nodal->block_dists = _block_dists_create();
 
   this_nodal->sections = NULL;
 
@@ -1214,6 +1435,8 @@ fvm_nodal_destroy(fvm_nodal_t   *this_nodal)
   if (this_nodal->global_vertex_num != NULL)
     fvm_io_num_destroy(this_nodal->global_vertex_num);
 
+  _block_dists_destroy(&(this_nodal->block_dists));
+
   for (i = 0; i < this_nodal->n_sections; i++)
     fvm_nodal_section_destroy(this_nodal->sections[i]);
 
@@ -1295,6 +1518,8 @@ fvm_nodal_copy(const fvm_nodal_t *this_nodal)
   else
     new_nodal->global_vertex_num = NULL;
 
+  new_nodal->block_dists = _block_dists_create();
+
   BFT_MALLOC(new_nodal->sections,
              new_nodal->n_sections,
              fvm_nodal_section_t *);
@@ -1358,6 +1583,8 @@ fvm_nodal_reduce(fvm_nodal_t  *this_nodal,
       this_nodal->global_vertex_num
         = fvm_io_num_destroy(this_nodal->global_vertex_num);
 
+    _block_dists_destroy(&(this_nodal->block_dists->next));
+
   }
 
   if (this_nodal->gc_set != NULL)
@@ -1483,6 +1710,8 @@ fvm_nodal_init_io_num(fvm_nodal_t       *this_nodal,
   int  i;
   fvm_nodal_section_t  *section;
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   if (entity_dim == 0) {
     this_nodal->global_vertex_num
       = fvm_io_num_create(this_nodal->parent_vertex_num,
@@ -1530,6 +1759,8 @@ void
 fvm_nodal_transfer_vertex_io_num(fvm_nodal_t    *this_nodal,
                                  fvm_io_num_t  **io_num)
 {
+  fvm_nodal_block_dist_clear(this_nodal);
+
   this_nodal->global_vertex_num = *io_num;
   *io_num = NULL;
   _remove_global_vertex_labels(this_nodal);
@@ -2323,6 +2554,8 @@ fvm_nodal_copy_edges(const char         *name,
   else
     new_nodal->global_vertex_num = NULL;
 
+  new_nodal->block_dists = _block_dists_create();
+
   /* Counting step */
 
   for (i = 0; i < this_nodal->n_sections; i++) {
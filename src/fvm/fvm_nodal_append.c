@@ -271,6 +271,8 @@ fvm_nodal_append_by_transfer(fvm_nodal_t    *this_nodal,
 
   assert(this_nodal != NULL);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   n_sections = this_nodal->n_sections;
 
   /* Create new section */
@@ -346,6 +348,8 @@ fvm_nodal_append_shared(fvm_nodal_t    *this_nodal,
 
   assert(this_nodal != NULL);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   n_sections = this_nodal->n_sections;
 
   /* Create new section */
@@ -237,6 +237,8 @@ fvm_nodal_extrude(fvm_nodal_t        *this_nodal,
   assert(this_nodal != NULL);
   assert(extrusion_vectors != NULL || this_nodal->n_vertices == 0);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   dim = this_nodal->dim;
 
   /* Check that no section is of too high dimension */
@@ -1237,6 +1237,8 @@ _fvm_nodal_add_sections(fvm_nodal_t          *this_nodal,
   }
   this_nodal->n_sections += section_count;
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -33,7 +33,9 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_block_dist.h"
 #include "cs_mesh.h"
+#include "cs_part_to_block.h"
 #include "fvm_defs.h"
 #include "fvm_group.h"
 #include "fvm_nodal.h"
@@ -51,6 +53,12 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Cached part to block distribution used for output (opaque)
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_nodal_block_dist_t  fvm_nodal_block_dist_t;
+
 /*----------------------------------------------------------------------------
  * Structure defining a mesh section
  *----------------------------------------------------------------------------*/
@@ -145,6 +153,12 @@ typedef struct _fvm_nodal_section_t {
 
   fvm_io_num_t  *global_element_num;     /* Global element numbers */
 
+  /* Output distribution cache (for this section and those appended to it);
+     only the list head is referenced, so cached entries may be added
+     for const sections, as they do not change the mesh definition */
+
+  fvm_nodal_block_dist_t  *block_dists;
+
 } fvm_nodal_section_t;
 
 /*----------------------------------------------------------------------------
@@ -201,6 +215,9 @@ struct _fvm_nodal_t {
 
   fvm_io_num_t  *global_vertex_num;     /* Global vertex numbering */
 
+  fvm_nodal_block_dist_t  *block_dists; /* Vertex output distribution cache
+                                           (list head, as for sections) */
+
   /* Mesh connectivity */
   /*-------------------*/
 
@@ -318,6 +335,79 @@ fvm_nodal_cell_face_connect(fvm_element_t   element_type,
                             int             n_face_vertices[6],
                             int             face_vertices[6][4]);
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Return a cached part to block distributor for output, if available.
+ *
+ * Distributors are cached for vertices at the mesh level (when
+ * this_section is NULL), or for elements at the level of the first
+ * section of a group of appended sections. A cached distributor is
+ * only returned if it was built for the same number of appended
+ * sections, local entities, block distribution, and communicator.
+ *
+ * The returned distributor remains owned by the mesh, and must not
+ * be destroyed by the caller.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to nodal mesh structure (for vertices)
+ *   this_section  <-- pointer to first section (for elements), or NULL
+ *   n_sub         <-- number of appended sections (0 for vertices)
+ *   n_part_ents   <-- local number of entities distributed
+ *   bi            <-- associated block distribution info
+ *   comm          <-- associated communicator
+ *
+ * returns:
+ *   pointer to cached distributor, or NULL if none matches
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+fvm_nodal_block_dist_get(const fvm_nodal_t          *this_nodal,
+                         const fvm_nodal_section_t  *this_section,
+                         int                         n_sub,
+                         cs_lnum_t                   n_part_ents,
+                         cs_block_dist_info_t        bi,
+                         MPI_Comm                    comm);
+
+/*----------------------------------------------------------------------------
+ * Add a part to block distributor to a mesh's output cache.
+ *
+ * Ownership of the distributor is transferred to the mesh.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to nodal mesh structure (for vertices)
+ *   this_section  <-- pointer to first section (for elements), or NULL
+ *   n_sub         <-- number of appended sections (0 for vertices)
+ *   n_part_ents   <-- local number of entities distributed
+ *   bi            <-- associated block distribution info
+ *   comm          <-- associated communicator
+ *   d             <-- distributor to cache
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_block_dist_add(const fvm_nodal_t          *this_nodal,
+                         const fvm_nodal_section_t  *this_section,
+                         int                         n_sub,
+                         cs_lnum_t                   n_part_ents,
+                         cs_block_dist_info_t        bi,
+                         MPI_Comm                    comm,
+                         cs_part_to_block_t         *d);
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Free all cached output distributors of a nodal mesh.
+ *
+ * This must be called whenever the mesh's sections or global numberings
+ * are modified.
+ *
+ * parameters:
+ *   this_nodal <-> pointer to nodal mesh structure
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_nodal_block_dist_clear(fvm_nodal_t  *this_nodal);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -421,6 +421,8 @@ fvm_nodal_project(fvm_nodal_t  *this_nodal,
 
   assert(this_nodal != NULL);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   n_vertices = this_nodal->n_vertices;
   BFT_MALLOC(selected_vertices, n_vertices, _Bool);
 
@@ -517,6 +517,8 @@ fvm_nodal_triangulate(fvm_nodal_t  *this_nodal,
 
   assert(this_nodal != NULL);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   /* Now triangulate and update new section list */
 
   for (i = 0; i < this_nodal->n_sections; i++) {
@@ -591,6 +593,8 @@ fvm_nodal_triangulate_polygons(fvm_nodal_t  *this_nodal,
 
   assert(this_nodal != NULL);
 
+  fvm_nodal_block_dist_clear(this_nodal);
+
   /* Best estimate for new section list size: polygonal sections
      may lead to 2 sections (triangles + quads) */
 
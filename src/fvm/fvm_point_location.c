@@ -72,6 +72,18 @@ BEGIN_C_DECLS
 #define HUGE_VAL 1.0e+30
 #endif
 
+/* Maximum number of elements in bounding volume hierarchy leaves */
+
+#define _BVH_LEAF_SIZE 8
+
+/* Bounding volume hierarchy traversal stack size */
+
+#define _BVH_STACK_SIZE 128
+
+/* Maximum number of steps for walk-based relocation */
+
+#define _BVH_WALK_MAX_STEPS 8
+
 /* Geometric operation macros*/
 
 enum {X, Y, Z};
@@ -148,6 +160,50 @@ typedef struct {
 
 } _quadtree_t;
 
+/*----------------------------------------------------------------------------
+ * Structure defining a bounding volume hierarchy over mesh elements (3d)
+ *----------------------------------------------------------------------------*/
+
+struct _fvm_point_location_bvh_t {
+
+  const fvm_nodal_t  *mesh;              /* Associated nodal mesh */
+
+  int           locate_on_parents;       /* Location relative to parent
+                                            element numbers if 1 */
+  int           entity_dim;              /* Dimension of located elements */
+  double        tolerance[2];            /* Base and fraction tolerance */
+
+  int           n_sections;              /* Number of located sections */
+  int          *section_id;              /* Ids of located sections */
+  cs_lnum_t    *section_idx;             /* Element index by located section
+                                            (size: n_sections + 1) */
+  cs_lnum_t    *section_base;            /* Base element number by section */
+  cs_lnum_t     n_vertices_max;          /* Maximum number of vertices per
+                                            element or polyhedron face */
+
+  cs_lnum_t     n_elts;                  /* Number of elements */
+  cs_lnum_t    *elt_id;                  /* Element ids (in concatenated
+                                            located sections), in tree order */
+  double       *elt_extents;             /* Element extents in tree order,
+                                            by component (x_min for all
+                                            elements, then y_min, ...) */
+
+  cs_lnum_t     n_nodes;                 /* Number of tree nodes */
+  cs_lnum_t     n_nodes_max;             /* Allocated number of tree nodes */
+  cs_lnum_t    *node_child;              /* Id of first child of each node
+                                            (second follows), or -1 */
+  cs_lnum_t    *node_range;              /* Element range of each node
+                                            (size: 2*n_nodes_max) */
+  double       *node_extents;            /* Node extents
+                                            (size: 6*n_nodes_max) */
+
+  cs_lnum_t     max_elt_num;             /* Maximum element number */
+  cs_lnum_t    *elt_num_pos;             /* Tree position of each element
+                                            number, or -1
+                                            (size: max_elt_num + 1) */
+
+};
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -2287,135 +2343,226 @@ _locate_in_cell_3d(cs_lnum_t          elt_num,
 }
 
 /*----------------------------------------------------------------------------
- * Find elements in a given polyhedral section containing points: updates the
- * location[] and distance[] arrays associated with a set of points
- * for points that are in an element of this section, or closer to one
- * than to previously encountered elements.
- *
- * Space and element dimensions are both equal to 3 here.
+ * Return maximum number of vertices of elements (or faces for polyhedra)
+ * of a given section, for triangulation work arrays.
  *
  * parameters:
- *   this_section      <-- pointer to mesh section representation structure
- *   parent_vertex_num <-- pointer to parent vertex numbers (or NULL)
- *   vertex_coords     <-- pointer to vertex coordinates
- *   tolerance         <-- addition to local extents of each element:
- *                         extent =   base_extent * (1 + tolerance[1])
- *                                  + tolerance[0]
- *   base_element_num  <-- < 0 for location relative to parent element numbers,
- *                         number of elements in preceding sections of same
- *                         element dimension + 1 otherwise
- *   point_tag         <-- optional point tag (size: n_points)
- *   point_coords      <-- point coordinates
- *   octree            <-- point octree
- *   points_in_extents <-> array for query of ids of points in extents
- *                         (size: n_points, less usually needed)
- *   location          <-> number of element containing or closest to each
- *                         point (size: n_points)
- *   distance          <-> distance from point to element indicated by
- *                         location[]: < 0 if unlocated, 0 - 1 if inside,
- *                         > 1 if outside (size: n_points)
+ *   this_section <-- pointer to mesh section representation structure
+ *
+ * returns:
+ *   maximum number of vertices per element or face
  *----------------------------------------------------------------------------*/
 
-static void
-_polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
-                          const cs_lnum_t            *parent_vertex_num,
-                          const cs_coord_t            vertex_coords[],
-                          const double                tolerance[2],
-                          cs_lnum_t                   base_element_num,
-                          const cs_lnum_t            *point_tag,
-                          const cs_coord_t            point_coords[],
-                          _octree_t                  *octree,
-                          cs_lnum_t                   points_in_extents[],
-                          cs_lnum_t                   location[],
-                          float                       distance[])
+static cs_lnum_t
+_section_n_vertices_max(const fvm_nodal_section_t  *this_section)
 {
-  cs_lnum_t   i, j, k, n_vertices, face_id, vertex_id, elt_num;
-  cs_coord_t  center[3];
-  double elt_extents[6];
+  cs_lnum_t i, n_vertices;
+  cs_lnum_t n_vertices_max = this_section->stride;
 
-  /* double tolerance, as polyhedra is split into tetrahedra,
-     whose extents are approximately 1/2 the polyhedron extents */
-  double _tolerance[2] = {tolerance[0], tolerance[1] * 2};
-
-  cs_lnum_t n_vertices_max = 0;
-  cs_lnum_t n_points_in_extents = 0;
-  cs_lnum_t *triangle_vertices = NULL;
-  fvm_triangulate_state_t *state = NULL;
+  if (this_section->type == FVM_CELL_POLY) {
+    for (i = 0; i < this_section->n_faces; i++) {
+      n_vertices =   this_section->vertex_index[i + 1]
+                   - this_section->vertex_index[i];
+      if (n_vertices > n_vertices_max)
+        n_vertices_max = n_vertices;
+    }
+  }
 
-  assert(this_section->face_index != NULL);
+  else if (this_section->type == FVM_FACE_POLY) {
+    for (i = 0; i < this_section->n_elements; i++) {
+      n_vertices =   this_section->vertex_index[i + 1]
+                   - this_section->vertex_index[i];
+      if (n_vertices > n_vertices_max)
+        n_vertices_max = n_vertices;
+    }
+  }
 
-  /* Return immediately if nothing to do for this rank */
+  return n_vertices_max;
+}
 
-  if (this_section->n_elements == 0)
-    return;
+/*----------------------------------------------------------------------------
+ * Return the number of an element of a given section, as used in location[].
+ *
+ * parameters:
+ *   this_section     <-- pointer to mesh section representation structure
+ *   elt_id           <-- element id in section
+ *   base_element_num <-- < 0 for location relative to parent element numbers,
+ *                        number of elements in preceding sections of same
+ *                        element dimension + 1 otherwise
+ *
+ * returns:
+ *   element number
+ *----------------------------------------------------------------------------*/
 
-  /* Counting loop on faces */
+inline static cs_lnum_t
+_section_elt_num(const fvm_nodal_section_t  *this_section,
+                 cs_lnum_t                   elt_id,
+                 cs_lnum_t                   base_element_num)
+{
+  cs_lnum_t elt_num;
 
-  for (i = 0; i < this_section->n_faces; i++) {
-    n_vertices =   this_section->vertex_index[i + 1]
-                 - this_section->vertex_index[i];
-    if (n_vertices > n_vertices_max)
-      n_vertices_max = n_vertices;
+  if (base_element_num < 0) {
+    if (this_section->parent_element_num != NULL)
+      elt_num = this_section->parent_element_num[elt_id];
+    else
+      elt_num = elt_id + 1;
   }
+  else
+    elt_num = base_element_num + elt_id;
 
-  if (n_vertices_max < 3)
-    return;
-
-  BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, int);
-  state = fvm_triangulate_state_create(n_vertices_max);
+  return elt_num;
+}
 
-  /* Loop on elements */
+/*----------------------------------------------------------------------------
+ * Compute extents of an element of a given section in 3d, including
+ * search tolerance.
+ *
+ * parameters:
+ *   this_section      <-- pointer to mesh section representation structure
+ *   elt_id            <-- element id in section
+ *   parent_vertex_num <-- pointer to parent vertex numbers (or NULL)
+ *   vertex_coords     <-- pointer to vertex coordinates
+ *   tolerance         <-- addition to local extents of each element:
+ *                         extent =   base_extent * (1 + tolerance[1])
+ *                                  + tolerance[0]
+ *   elt_extents       --> extents associated with element:
+ *                         x_min, y_min, z_min, x_max, y_max, z_max
+ *----------------------------------------------------------------------------*/
 
-  for (i = 0; i < this_section->n_elements; i++) {
+static void
+_section_elt_extents_3d(const fvm_nodal_section_t  *this_section,
+                        cs_lnum_t                   elt_id,
+                        const cs_lnum_t            *parent_vertex_num,
+                        const cs_coord_t            vertex_coords[],
+                        const double                tolerance[2],
+                        double                      elt_extents[6])
+{
+  cs_lnum_t j, k, face_id, vertex_id;
 
-    _Bool elt_initialized = false;
+  _Bool elt_initialized = false;
 
-    /* Compute extents */
+  if (this_section->type == FVM_CELL_POLY) {
 
-    for (j = this_section->face_index[i];
-         j < this_section->face_index[i + 1];
+    for (j = this_section->face_index[elt_id];
+         j < this_section->face_index[elt_id + 1];
          j++) {
       face_id = CS_ABS(this_section->face_num[j]) - 1;
       for (k = this_section->vertex_index[face_id];
            k < this_section->vertex_index[face_id + 1];
            k++) {
         vertex_id = this_section->vertex_num[k] - 1;
-
         _update_elt_extents(3,
                             vertex_id,
                             parent_vertex_num,
                             vertex_coords,
                             elt_extents,
                             &elt_initialized);
-
       }
     }
 
     _elt_extents_finalize(3, 3, tolerance, elt_extents);
 
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
-      else
-        elt_num = i + 1;
+  }
+
+  else if (this_section->type == FVM_FACE_POLY) {
+
+    for (j = this_section->vertex_index[elt_id];
+         j < this_section->vertex_index[elt_id + 1];
+         j++) {
+      vertex_id = this_section->vertex_num[j] - 1;
+      _update_elt_extents(3,
+                          vertex_id,
+                          parent_vertex_num,
+                          vertex_coords,
+                          elt_extents,
+                          &elt_initialized);
     }
-    else
-      elt_num = base_element_num + i;
 
-    _query_octree(elt_extents,
-                  point_coords,
-                  octree,
-                  &n_points_in_extents,
-                  points_in_extents);
+    _elt_extents_finalize(3, 2, tolerance, elt_extents);
 
-    if (this_section->tag != NULL && point_tag != NULL)
-      _ignore_same_tag(this_section->tag[i],
-                       point_tag,
-                       &n_points_in_extents,
-                       points_in_extents);
+  }
 
-    if (n_points_in_extents < 1)
-      continue;
+  else {
+
+    for (j = 0; j < this_section->stride; j++) {
+      vertex_id = this_section->vertex_num[elt_id*this_section->stride + j] - 1;
+      _update_elt_extents(3,
+                          vertex_id,
+                          parent_vertex_num,
+                          vertex_coords,
+                          elt_extents,
+                          &elt_initialized);
+    }
+
+    _elt_extents_finalize(3,
+                          this_section->entity_dim,
+                          tolerance,
+                          elt_extents);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Locate 3d points in or on a given element of a section: updates the
+ * location[] and distance[] arrays associated with a set of points
+ * for points that are in this element, or closer to it than to previously
+ * encountered elements.
+ *
+ * Polyhedra are split into tetrahedra joining face triangles and a
+ * pseudo-center, and polygons are triangulated.
+ *
+ * parameters:
+ *   this_section        <-- pointer to mesh section representation structure
+ *   elt_id              <-- element id in section
+ *   elt_num             <-- element number (value for location[])
+ *   parent_vertex_num   <-- pointer to parent vertex numbers (or NULL)
+ *   vertex_coords       <-- pointer to vertex coordinates
+ *   tolerance           <-- addition to local extents of each element:
+ *                           extent =   base_extent * (1 + tolerance[1])
+ *                                    + tolerance[0]
+ *   elt_extents         <-- element extents, including tolerance
+ *   point_coords        <-- point coordinates
+ *   n_points_in_extents <-- number of points in element extents
+ *   points_in_extents   <-- ids of points in element extents
+ *   triangle_vertices   <-> work array for triangulation
+ *                           (size: (n_vertices_max - 2)*3, and at least 6)
+ *   state               <-> triangulation state for polygons and polyhedra
+ *   location            <-> number of element containing or closest to each
+ *                           point (size: n_points)
+ *   distance            <-> distance from point to element indicated by
+ *                           location[]: < 0 if unlocated; 0 - 1 if inside,
+ *                           and > 1 if outside a volume element, or absolute
+ *                           distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_section_elt_locate_3d(const fvm_nodal_section_t  *this_section,
+                       cs_lnum_t                   elt_id,
+                       cs_lnum_t                   elt_num,
+                       const cs_lnum_t            *parent_vertex_num,
+                       const cs_coord_t            vertex_coords[],
+                       const double                tolerance[2],
+                       const double                elt_extents[6],
+                       const cs_coord_t            point_coords[],
+                       cs_lnum_t                   n_points_in_extents,
+                       const cs_lnum_t             points_in_extents[],
+                       cs_lnum_t                   triangle_vertices[],
+                       fvm_triangulate_state_t    *state,
+                       cs_lnum_t                   location[],
+                       float                       distance[])
+{
+  cs_lnum_t j, k, n_vertices, face_id, vertex_id;
+  int n_triangles;
+
+  /* If section contains polyhedra */
+
+  if (this_section->type == FVM_CELL_POLY) {
+
+    cs_coord_t  center[3];
+
+    /* double tolerance, as polyhedra is split into tetrahedra,
+       whose extents are approximately 1/2 the polyhedron extents */
+    double _tolerance[2] = {tolerance[0], tolerance[1] * 2};
 
     /* Compute psuedo-element center */
 
@@ -2424,12 +2571,10 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
 
     /* Loop on element faces */
 
-    for (j = this_section->face_index[i];
-         j < this_section->face_index[i + 1];
+    for (j = this_section->face_index[elt_id];
+         j < this_section->face_index[elt_id + 1];
          j++) {
 
-      cs_lnum_t n_triangles;
-
       const cs_lnum_t *_vertex_num;
 
       face_id = CS_ABS(this_section->face_num[j]) - 1;
@@ -2517,135 +2662,17 @@ _polyhedra_section_locate(const fvm_nodal_section_t  *this_section,
                        location,
                        distance);
 
-  } /* End of loop on elements */
-
-  BFT_FREE(triangle_vertices);
-  state = fvm_triangulate_state_destroy(state);
-}
-
-/*----------------------------------------------------------------------------
- * Find elements in a given polygonal section containing 3d points: updates
- * the location[] and distance[] arrays associated with a set of points
- * for points that are in an element of this section, or closer to one
- * than to previously encountered elements.
- *
- * parameters:
- *   this_section      <-- pointer to mesh section representation structure
- *   parent_vertex_num <-- pointer to parent vertex numbers (or NULL)
- *   vertex_coords     <-- pointer to vertex coordinates
- *   tolerance         <-- addition to local extents of each element:
- *                         extent =   base_extent * (1 + tolerance[1])
- *                                  + tolerance[0]
- *   base_element_num  <-- < 0 for location relative to parent element numbers,
- *                         number of elements in preceding sections of same
- *                         element dimension + 1 otherwise
- *   n_points          <-- number of points to locate
- *   point_tag         <-- optional point tag (size: n_points)
- *   point_coords      <-- point coordinates
- *   octree            <-- point octree
- *   points_in_extents <-- array for query of ids of points in extents
- *                         (size: n_points, less usually needed)
- *   location          <-> number of element containing or closest to each
- *                         point (size: n_points)
- *   distance          <-> distance from point to element indicated by
- *                         location[]: < 0 if unlocated, absolute distance
- *                         to element if located (size: n_points)
- *----------------------------------------------------------------------------*/
-
-static void
-_polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
-                            const cs_lnum_t             *parent_vertex_num,
-                            const cs_coord_t             vertex_coords[],
-                            const double                 tolerance[2],
-                            cs_lnum_t                    base_element_num,
-                            const cs_lnum_t             *point_tag,
-                            const cs_coord_t             point_coords[],
-                            _octree_t                   *octree,
-                            cs_lnum_t                    points_in_extents[],
-                            cs_lnum_t                    location[],
-                            float                        distance[])
-{
-  cs_lnum_t   i, j, n_vertices, vertex_id, elt_num;
-  int n_triangles;
-  double elt_extents[6];
-
-  int n_vertices_max = 0;
-  cs_lnum_t n_points_in_extents = 0;
-
-  cs_lnum_t *triangle_vertices = NULL;
-  fvm_triangulate_state_t *state = NULL;
-
-  /* Return immediately if nothing to do for this rank */
-
-  if (this_section->n_elements == 0)
-    return;
-
-  /* Counting loop on elements */
-
-  for (i = 0; i < this_section->n_elements; i++) {
-
-    n_vertices = (  this_section->vertex_index[i + 1]
-                  - this_section->vertex_index[i]);
-
-    if (n_vertices > n_vertices_max)
-      n_vertices_max = n_vertices;
-
   }
 
-  if (n_vertices_max < 3)
-    return;
-
-  BFT_MALLOC(triangle_vertices, (n_vertices_max-2)*3, int);
-  state = fvm_triangulate_state_create(n_vertices_max);
-
-  /* Main loop on elements */
-
-  for (i = 0; i < this_section->n_elements; i++) {
-
-    _Bool elt_initialized = false;
-
-    for (j = this_section->vertex_index[i];
-         j < this_section->vertex_index[i + 1];
-         j++) {
-      vertex_id = this_section->vertex_num[j] - 1;
-
-      _update_elt_extents(3,
-                          vertex_id,
-                          parent_vertex_num,
-                          vertex_coords,
-                          elt_extents,
-                          &elt_initialized);
-
-    }
-
-    _elt_extents_finalize(3, 2, tolerance, elt_extents);
-
-    if (base_element_num < 0) {
-      if (this_section->parent_element_num != NULL)
-        elt_num = this_section->parent_element_num[i];
-      else
-        elt_num = i + 1;
-    }
-    else
-      elt_num = base_element_num + i;
-
-    _query_octree(elt_extents,
-                  point_coords,
-                  octree,
-                  &n_points_in_extents,
-                  points_in_extents);
+  /* If section contains polygons */
 
-    if (this_section->tag != NULL && point_tag != NULL)
-      _ignore_same_tag(this_section->tag[i],
-                       point_tag,
-                       &n_points_in_extents,
-                       points_in_extents);
+  else if (this_section->type == FVM_FACE_POLY) {
 
     /* Triangulate polygon */
 
-    n_vertices = (  this_section->vertex_index[i + 1]
-                  - this_section->vertex_index[i]);
-    vertex_id = this_section->vertex_index[i];
+    n_vertices = (  this_section->vertex_index[elt_id + 1]
+                  - this_section->vertex_index[elt_id]);
+    vertex_id = this_section->vertex_index[elt_id];
 
     n_triangles = fvm_triangulate_polygon(3,
                                           1,
@@ -2672,15 +2699,81 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
                             location,
                             distance);
 
-  } /* End of loop on elements */
+  }
 
-  BFT_FREE(triangle_vertices);
-  state = fvm_triangulate_state_destroy(state);
-}
+  /* If section contains regular elements */
 
-/*----------------------------------------------------------------------------
- * Find elements in a given section containing 3d points: updates the
- * location[] and distance[] arrays associated with a set of points
+  else if (this_section->entity_dim == 3)
+
+    _locate_in_cell_3d(elt_num,
+                       this_section->type,
+                       this_section->vertex_num + elt_id*this_section->stride,
+                       parent_vertex_num,
+                       vertex_coords,
+                       point_coords,
+                       n_points_in_extents,
+                       points_in_extents,
+                       tolerance[1],
+                       location,
+                       distance);
+
+  else if (this_section->entity_dim == 2) {
+
+    if (this_section->type == FVM_FACE_QUAD)
+
+      n_triangles = fvm_triangulate_quadrangle(3,
+                                               1,
+                                               vertex_coords,
+                                               parent_vertex_num,
+                                               (  this_section->vertex_num
+                                                + elt_id*this_section->stride),
+                                               triangle_vertices);
+
+    else {
+
+      assert(this_section->type == FVM_FACE_TRIA);
+
+      n_triangles = 1;
+      for (j = 0; j < 3; j++)
+        triangle_vertices[j]
+          = this_section->vertex_num[elt_id*this_section->stride + j];
+
+    }
+
+    _locate_on_triangles_3d(elt_num,
+                            n_triangles,
+                            triangle_vertices,
+                            parent_vertex_num,
+                            vertex_coords,
+                            point_coords,
+                            n_points_in_extents,
+                            points_in_extents,
+                            tolerance[1],
+                            location,
+                            distance);
+  }
+
+  else if (this_section->entity_dim == 1) {
+
+    assert(this_section->type == FVM_EDGE);
+
+    _locate_on_edge_3d(elt_num,
+                       this_section->vertex_num + elt_id*this_section->stride,
+                       parent_vertex_num,
+                       vertex_coords,
+                       point_coords,
+                       n_points_in_extents,
+                       points_in_extents,
+                       tolerance[1],
+                       location,
+                       distance);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Find elements in a given section containing 3d points: updates the
+ * location[] and distance[] arrays associated with a set of points
  * for points that are in an element of this section, or closer to one
  * than to previously encountered elements.
  *
@@ -2707,6 +2800,7 @@ _polygons_section_locate_3d(const fvm_nodal_section_t   *this_section,
  *                         distance to a surface element (size: n_points)
  *----------------------------------------------------------------------------*/
 
+
 static void
 _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                          const cs_lnum_t            *parent_vertex_num,
@@ -2720,161 +2814,77 @@ _nodal_section_locate_3d(const fvm_nodal_section_t  *this_section,
                          cs_lnum_t                   location[],
                          float                       distance[])
 {
-  cs_lnum_t   i, j, vertex_id, elt_num, triangle_vertices[6];
-  int n_triangles;
+  cs_lnum_t  i, n_vertices_max;
   double elt_extents[6];
 
   cs_lnum_t n_points_in_extents = 0;
+  cs_lnum_t *triangle_vertices = NULL;
+  fvm_triangulate_state_t *state = NULL;
 
-  /* If section contains polyhedra */
-
-  if (this_section->type == FVM_CELL_POLY)
-
-    _polyhedra_section_locate(this_section,
-                              parent_vertex_num,
-                              vertex_coords,
-                              tolerance,
-                              base_element_num,
-                              point_tag,
-                              point_coords,
-                              octree,
-                              points_in_extents,
-                              location,
-                              distance);
-
-  /* If section contains polygons */
-
-  else if (this_section->type == FVM_FACE_POLY)
-
-    _polygons_section_locate_3d(this_section,
-                                parent_vertex_num,
-                                vertex_coords,
-                                tolerance,
-                                base_element_num,
-                                point_tag,
-                                point_coords,
-                                octree,
-                                points_in_extents,
-                                location,
-                                distance);
+  /* Return immediately if nothing to do for this rank */
 
-  /* If section contains regular elements */
+  if (this_section->n_elements == 0)
+    return;
 
-  else {
+  /* Work arrays for triangulation */
 
-    for (i = 0; i < this_section->n_elements; i++) {
+  n_vertices_max = _section_n_vertices_max(this_section);
 
-      _Bool elt_initialized = false;
+  if (   this_section->type == FVM_CELL_POLY
+      || this_section->type == FVM_FACE_POLY) {
+    if (n_vertices_max < 3)
+      return;
+    state = fvm_triangulate_state_create(n_vertices_max);
+  }
 
-      if (base_element_num < 0) {
-        if (this_section->parent_element_num != NULL)
-          elt_num = this_section->parent_element_num[i];
-        else
-          elt_num = i + 1;
-      }
-      else
-        elt_num = base_element_num + i;
+  BFT_MALLOC(triangle_vertices, CS_MAX((n_vertices_max-2)*3, 6), cs_lnum_t);
 
-      for (j = 0; j < this_section->stride; j++) {
+  /* Loop on elements */
 
-        vertex_id = this_section->vertex_num[i*this_section->stride + j] - 1;
+  for (i = 0; i < this_section->n_elements; i++) {
 
-        _update_elt_extents(3,
-                            vertex_id,
+    _section_elt_extents_3d(this_section,
+                            i,
                             parent_vertex_num,
                             vertex_coords,
-                            elt_extents,
-                            &elt_initialized);
-
-      }
-
-      _elt_extents_finalize(3,
-                            this_section->entity_dim,
                             tolerance,
                             elt_extents);
 
-      _query_octree(elt_extents,
-                    point_coords,
-                    octree,
-                    &n_points_in_extents,
-                    points_in_extents);
-
-      if (this_section->tag != NULL && point_tag != NULL)
-        _ignore_same_tag(this_section->tag[i],
-                         point_tag,
-                         &n_points_in_extents,
-                         points_in_extents);
-
-      if (this_section->entity_dim == 3)
-
-        _locate_in_cell_3d(elt_num,
-                           this_section->type,
-                           this_section->vertex_num + i*this_section->stride,
-                           parent_vertex_num,
-                           vertex_coords,
-                           point_coords,
-                           n_points_in_extents,
-                           points_in_extents,
-                           tolerance[1],
-                           location,
-                           distance);
-
-      else if (this_section->entity_dim == 2) {
-
-        if (this_section->type == FVM_FACE_QUAD)
-
-          n_triangles = fvm_triangulate_quadrangle(3,
-                                                   1,
-                                                   vertex_coords,
-                                                   parent_vertex_num,
-                                                   (  this_section->vertex_num
-                                                    + i*this_section->stride),
-                                                   triangle_vertices);
-
-        else {
-
-          assert(this_section->type == FVM_FACE_TRIA);
-
-          n_triangles = 1;
-          for (j = 0; j < 3; j++)
-            triangle_vertices[j]
-              = this_section->vertex_num[i*this_section->stride + j];
-
-
-        }
-
-        _locate_on_triangles_3d(elt_num,
-                                n_triangles,
-                                triangle_vertices,
-                                parent_vertex_num,
-                                vertex_coords,
-                                point_coords,
-                                n_points_in_extents,
-                                points_in_extents,
-                                tolerance[1],
-                                location,
-                                distance);
-      }
+    _query_octree(elt_extents,
+                  point_coords,
+                  octree,
+                  &n_points_in_extents,
+                  points_in_extents);
 
-      else if (this_section->entity_dim == 1) {
+    if (this_section->tag != NULL && point_tag != NULL)
+      _ignore_same_tag(this_section->tag[i],
+                       point_tag,
+                       &n_points_in_extents,
+                       points_in_extents);
 
-        assert(this_section->type == FVM_EDGE);
+    if (n_points_in_extents < 1)
+      continue;
 
-        _locate_on_edge_3d(elt_num,
-                           this_section->vertex_num + i*this_section->stride,
+    _section_elt_locate_3d(this_section,
+                           i,
+                           _section_elt_num(this_section, i, base_element_num),
                            parent_vertex_num,
                            vertex_coords,
+                           tolerance,
+                           elt_extents,
                            point_coords,
                            n_points_in_extents,
                            points_in_extents,
-                           tolerance[1],
+                           triangle_vertices,
+                           state,
                            location,
                            distance);
 
-      }
-    }
+  } /* End of loop on elements */
 
-  }
+  BFT_FREE(triangle_vertices);
+  if (state != NULL)
+    state = fvm_triangulate_state_destroy(state);
 }
 
 /*----------------------------------------------------------------------------
@@ -3218,6 +3228,476 @@ _nodal_section_locate_1d(const fvm_nodal_section_t  *this_section,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Return the located section index and element id in section matching
+ * an element id in concatenated located sections of a BVH.
+ *
+ * parameters:
+ *   bvh     <-- pointer to bounding volume hierarchy
+ *   elt_id  <-- element id in concatenated located sections
+ *   s_id    --> located section index
+ *
+ * returns:
+ *   element id in section
+ *----------------------------------------------------------------------------*/
+
+inline static cs_lnum_t
+_bvh_section_elt_id(const fvm_point_location_bvh_t  *bvh,
+                    cs_lnum_t                        elt_id,
+                    int                             *s_id)
+{
+  int i = 0;
+
+  while (elt_id >= bvh->section_idx[i+1])
+    i++;
+
+  *s_id = i;
+
+  return elt_id - bvh->section_idx[i];
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure BVH node arrays may hold a given number of nodes.
+ *
+ * parameters:
+ *   bvh     <-> pointer to bounding volume hierarchy
+ *   n_nodes <-- required number of nodes
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_reserve_nodes(fvm_point_location_bvh_t  *bvh,
+                   cs_lnum_t                  n_nodes)
+{
+  if (n_nodes <= bvh->n_nodes_max)
+    return;
+
+  while (bvh->n_nodes_max < n_nodes)
+    bvh->n_nodes_max = CS_MAX(bvh->n_nodes_max*2, 16);
+
+  BFT_REALLOC(bvh->node_child, bvh->n_nodes_max, cs_lnum_t);
+  BFT_REALLOC(bvh->node_range, bvh->n_nodes_max*2, cs_lnum_t);
+  BFT_REALLOC(bvh->node_extents, bvh->n_nodes_max*6, double);
+}
+
+/*----------------------------------------------------------------------------
+ * Partially order element ids so that the element of rank k (based on
+ * the extents center along a given axis) is at position k, with lower
+ * ranked elements before it and higher ranked ones after it.
+ *
+ * parameters:
+ *   n       <-- number of elements
+ *   k       <-- rank of element to place
+ *   axis    <-- axis (0 to 2)
+ *   extents <-- element extents (interleaved, size: 6 per element)
+ *   ids     <-> element ids
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_select(cs_lnum_t        n,
+            cs_lnum_t        k,
+            int              axis,
+            const double     extents[],
+            cs_lnum_t        ids[])
+{
+  cs_lnum_t l = 0, r = n - 1;
+
+  while (r > l) {
+
+    cs_lnum_t i = l, j = r;
+    cs_lnum_t p_id = ids[(l + r) / 2];
+    double pivot = extents[p_id*6 + axis] + extents[p_id*6 + axis + 3];
+
+    while (i <= j) {
+      while (extents[ids[i]*6 + axis] + extents[ids[i]*6 + axis + 3] < pivot)
+        i++;
+      while (extents[ids[j]*6 + axis] + extents[ids[j]*6 + axis + 3] > pivot)
+        j--;
+      if (i <= j) {
+        cs_lnum_t tmp = ids[i];
+        ids[i] = ids[j];
+        ids[j] = tmp;
+        i++;
+        j--;
+      }
+    }
+
+    if (k <= j)
+      r = j;
+    else if (k >= i)
+      l = i;
+    else
+      break;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Recursively split a BVH node, using a median split along the largest
+ * dimension of element extent centers.
+ *
+ * parameters:
+ *   bvh     <-> pointer to bounding volume hierarchy
+ *   node_id <-- id of node to split
+ *   start   <-- start of node element range
+ *   end     <-- past-the-end of node element range
+ *   extents <-- element extents (interleaved, size: 6 per element)
+ *   ids     <-> element ids, in tree order
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_split(fvm_point_location_bvh_t  *bvh,
+           cs_lnum_t                  node_id,
+           cs_lnum_t                  start,
+           cs_lnum_t                  end,
+           const double               extents[],
+           cs_lnum_t                  ids[])
+{
+  cs_lnum_t i, child_id, mid;
+  int j, axis = 0;
+  double c_min[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+  double c_max[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+  bvh->node_child[node_id] = -1;
+  bvh->node_range[node_id*2] = start;
+  bvh->node_range[node_id*2 + 1] = end;
+
+  if (end - start <= _BVH_LEAF_SIZE)
+    return;
+
+  /* Choose axis based on extents of element centers
+     (centers are scaled by 2, which does not matter here) */
+
+  for (i = start; i < end; i++) {
+    const double *e = extents + ids[i]*6;
+    for (j = 0; j < 3; j++) {
+      double c = e[j] + e[j+3];
+      if (c < c_min[j])
+        c_min[j] = c;
+      if (c > c_max[j])
+        c_max[j] = c;
+    }
+  }
+
+  for (j = 1; j < 3; j++) {
+    if (c_max[j] - c_min[j] > c_max[axis] - c_min[axis])
+      axis = j;
+  }
+
+  /* If all centers are identical, keep a larger leaf */
+
+  if (!(c_max[axis] > c_min[axis]))
+    return;
+
+  mid = start + (end - start)/2;
+
+  _bvh_select(end - start, mid - start, axis, extents, ids + start);
+
+  child_id = bvh->n_nodes;
+  bvh->n_nodes += 2;
+  _bvh_reserve_nodes(bvh, bvh->n_nodes);
+
+  bvh->node_child[node_id] = child_id;
+
+  _bvh_split(bvh, child_id, start, mid, extents, ids);
+  _bvh_split(bvh, child_id + 1, mid, end, extents, ids);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute element and node extents of a BVH whose structure is built,
+ * based on current mesh vertex coordinates.
+ *
+ * parameters:
+ *   bvh <-> pointer to bounding volume hierarchy
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_update_extents(fvm_point_location_bvh_t  *bvh)
+{
+  const fvm_nodal_t *mesh = bvh->mesh;
+  const cs_lnum_t n_elts = bvh->n_elts;
+
+  double *restrict elt_extents = bvh->elt_extents;
+
+  /* Element extents */
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n_elts; k++) {
+    int s_id;
+    double e[6];
+    cs_lnum_t i = _bvh_section_elt_id(bvh, bvh->elt_id[k], &s_id);
+    _section_elt_extents_3d(mesh->sections[bvh->section_id[s_id]],
+                            i,
+                            mesh->parent_vertex_num,
+                            mesh->vertex_coords,
+                            bvh->tolerance,
+                            e);
+    for (int j = 0; j < 6; j++)
+      elt_extents[j*n_elts + k] = e[j];
+  }
+
+  /* Node extents; children always follow their parent, so
+     a reverse loop on nodes updates children first */
+
+  for (cs_lnum_t n_id = bvh->n_nodes - 1; n_id > -1; n_id--) {
+
+    double *restrict n_e = bvh->node_extents + n_id*6;
+    cs_lnum_t c_id = bvh->node_child[n_id];
+
+    for (int j = 0; j < 3; j++) {
+      n_e[j] = HUGE_VAL;
+      n_e[j+3] = -HUGE_VAL;
+    }
+
+    if (c_id > -1) {
+      const double *c_e = bvh->node_extents + c_id*6;
+      for (int j = 0; j < 3; j++) {
+        n_e[j] = CS_MIN(c_e[j], c_e[j+6]);
+        n_e[j+3] = CS_MAX(c_e[j+3], c_e[j+9]);
+      }
+    }
+    else {
+      for (cs_lnum_t k = bvh->node_range[n_id*2];
+           k < bvh->node_range[n_id*2 + 1];
+           k++) {
+        for (int j = 0; j < 3; j++) {
+          n_e[j] = CS_MIN(n_e[j], elt_extents[j*n_elts + k]);
+          n_e[j+3] = CS_MAX(n_e[j+3], elt_extents[(j+3)*n_elts + k]);
+        }
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Locate a point relative to a given element of a BVH.
+ *
+ * parameters:
+ *   bvh               <-- pointer to bounding volume hierarchy
+ *   pos               <-- element position in tree order
+ *   point_id          <-- point id
+ *   point_tag         <-- optional point tag (size: n_points)
+ *   point_coords      <-- point coordinates
+ *   triangle_vertices <-> work array for triangulation
+ *   state             <-> triangulation state
+ *   location          <-> number of element containing or closest to each
+ *                         point (size: n_points)
+ *   distance          <-> distance from point to element indicated by
+ *                         location[] (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_elt_locate(const fvm_point_location_bvh_t  *bvh,
+                cs_lnum_t                        pos,
+                cs_lnum_t                        point_id,
+                const cs_lnum_t                 *point_tag,
+                const cs_coord_t                 point_coords[],
+                cs_lnum_t                        triangle_vertices[],
+                fvm_triangulate_state_t         *state,
+                cs_lnum_t                        location[],
+                float                            distance[])
+{
+  int s_id;
+  double elt_extents[6];
+
+  const cs_lnum_t i = _bvh_section_elt_id(bvh, bvh->elt_id[pos], &s_id);
+  const fvm_nodal_section_t *section
+    = bvh->mesh->sections[bvh->section_id[s_id]];
+
+  if (section->tag != NULL && point_tag != NULL) {
+    if (section->tag[i] == point_tag[point_id])
+      return;
+  }
+
+  for (int j = 0; j < 6; j++)
+    elt_extents[j] = bvh->elt_extents[j*bvh->n_elts + pos];
+
+  _section_elt_locate_3d(section,
+                         i,
+                         _section_elt_num(section, i, bvh->section_base[s_id]),
+                         bvh->mesh->parent_vertex_num,
+                         bvh->mesh->vertex_coords,
+                         bvh->tolerance,
+                         elt_extents,
+                         point_coords,
+                         1,
+                         &point_id,
+                         triangle_vertices,
+                         state,
+                         location,
+                         distance);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the distance from a point to a given element of a BVH.
+ *
+ * The location[] and distance[] values for this point are used as work
+ * values, and reset to -1 on return.
+ *
+ * parameters:
+ *   bvh               <-- pointer to bounding volume hierarchy
+ *   elt_num           <-- element number (as in location[])
+ *   point_id          <-- point id
+ *   point_tag         <-- optional point tag (size: n_points)
+ *   point_coords      <-- point coordinates
+ *   triangle_vertices <-> work array for triangulation
+ *   state             <-> triangulation state
+ *   location          <-> work array (size: n_points)
+ *   distance          <-> work array (size: n_points)
+ *
+ * returns:
+ *   distance from point to element (< 0 if not computed), as defined
+ *   for fvm_point_location_nodal()
+ *----------------------------------------------------------------------------*/
+
+static float
+_bvh_elt_distance(const fvm_point_location_bvh_t  *bvh,
+                  cs_lnum_t                        elt_num,
+                  cs_lnum_t                        point_id,
+                  const cs_lnum_t                 *point_tag,
+                  const cs_coord_t                 point_coords[],
+                  cs_lnum_t                        triangle_vertices[],
+                  fvm_triangulate_state_t         *state,
+                  cs_lnum_t                        location[],
+                  float                            distance[])
+{
+  float retval = -1;
+
+  if (elt_num < 0 || elt_num > bvh->max_elt_num)
+    return retval;
+
+  const cs_lnum_t pos = bvh->elt_num_pos[elt_num];
+
+  if (pos < 0)
+    return retval;
+
+  location[point_id] = -1;
+  distance[point_id] = -1;
+
+  _bvh_elt_locate(bvh,
+                  pos,
+                  point_id,
+                  point_tag,
+                  point_coords,
+                  triangle_vertices,
+                  state,
+                  location,
+                  distance);
+
+  if (location[point_id] == elt_num)
+    retval = distance[point_id];
+
+  location[point_id] = -1;
+  distance[point_id] = -1;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Locate a point using a BVH: updates the location[] and distance[]
+ * arrays for this point if it is in an element whose extents contain it,
+ * or closer to one than to previously encountered elements.
+ *
+ * parameters:
+ *   bvh               <-- pointer to bounding volume hierarchy
+ *   point_id          <-- point id
+ *   point_tag         <-- optional point tag (size: n_points)
+ *   point_coords      <-- point coordinates
+ *   triangle_vertices <-> work array for triangulation
+ *   state             <-> triangulation state
+ *   location          <-> number of element containing or closest to each
+ *                         point (size: n_points)
+ *   distance          <-> distance from point to element indicated by
+ *                         location[] (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_bvh_locate_point(const fvm_point_location_bvh_t  *bvh,
+                  cs_lnum_t                        point_id,
+                  const cs_lnum_t                 *point_tag,
+                  const cs_coord_t                 point_coords[],
+                  cs_lnum_t                        triangle_vertices[],
+                  fvm_triangulate_state_t         *state,
+                  cs_lnum_t                        location[],
+                  float                            distance[])
+{
+  int n_stack = 0;
+  cs_lnum_t stack[_BVH_STACK_SIZE];
+
+  const cs_lnum_t n_elts = bvh->n_elts;
+  const cs_coord_t *p = point_coords + point_id*3;
+
+  if (bvh->n_nodes < 1)
+    return;
+
+  if (!_within_extents(3, p, bvh->node_extents))
+    return;
+
+  stack[n_stack++] = 0;
+
+  while (n_stack > 0) {
+
+    const cs_lnum_t n_id = stack[--n_stack];
+    const cs_lnum_t c_id = bvh->node_child[n_id];
+
+    /* Internal node: only push children whose extents contain the point */
+
+    if (c_id > -1) {
+      for (cs_lnum_t l = c_id + 1; l >= c_id; l--) {
+        const double *e = bvh->node_extents + l*6;
+        if (   p[0] >= e[0] && p[0] <= e[3]
+            && p[1] >= e[1] && p[1] <= e[4]
+            && p[2] >= e[2] && p[2] <= e[5]) {
+          assert(n_stack < _BVH_STACK_SIZE);
+          stack[n_stack++] = l;
+        }
+      }
+      continue;
+    }
+
+    /* Leaf: test element extents by blocks (vectorizable) */
+
+    for (cs_lnum_t s_id = bvh->node_range[n_id*2];
+         s_id < bvh->node_range[n_id*2 + 1];
+         s_id += _BVH_LEAF_SIZE) {
+
+      const cs_lnum_t n = CS_MIN(_BVH_LEAF_SIZE,
+                                 bvh->node_range[n_id*2 + 1] - s_id);
+
+      const double *restrict x_min = bvh->elt_extents + s_id;
+      const double *restrict y_min = x_min + n_elts;
+      const double *restrict z_min = y_min + n_elts;
+      const double *restrict x_max = z_min + n_elts;
+      const double *restrict y_max = x_max + n_elts;
+      const double *restrict z_max = y_max + n_elts;
+
+      int in_extents[_BVH_LEAF_SIZE];
+
+#     pragma omp simd
+      for (cs_lnum_t k = 0; k < n; k++)
+        in_extents[k] =    (p[0] >= x_min[k]) & (p[0] <= x_max[k])
+                         & (p[1] >= y_min[k]) & (p[1] <= y_max[k])
+                         & (p[2] >= z_min[k]) & (p[2] <= z_max[k]);
+
+      for (cs_lnum_t k = 0; k < n; k++) {
+        if (in_extents[k])
+          _bvh_elt_locate(bvh,
+                          s_id + k,
+                          point_id,
+                          point_tag,
+                          point_coords,
+                          triangle_vertices,
+                          state,
+                          location,
+                          distance);
+      }
+
+    }
+
+  }
+}
+
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3589,6 +4069,407 @@ fvm_point_location_closest_vertex(const fvm_nodal_t  *this_nodal,
   BFT_FREE(section_list);
 }
 
+/*----------------------------------------------------------------------------
+ * Create a bounding volume hierarchy over the elements of a 3d nodal mesh,
+ * for repeated point location.
+ *
+ * Only sections of the highest element dimension are considered, as for
+ * fvm_point_location_nodal(). The nodal mesh must remain available
+ * during the lifetime of the hierarchy; if its vertex coordinates are
+ * modified, fvm_point_location_bvh_update() must be called.
+ *
+ * parameters:
+ *   this_nodal         <-- pointer to nodal mesh representation structure
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   locate_on_parents  <-- location relative to parent element numbers if 1,
+ *                          id of element + 1 in concatenated sections of
+ *                          same element dimension if 0
+ *
+ * returns:
+ *   pointer to created bounding volume hierarchy
+ *----------------------------------------------------------------------------*/
+
+fvm_point_location_bvh_t *
+fvm_point_location_bvh_create(const fvm_nodal_t  *this_nodal,
+                              float               tolerance_base,
+                              float               tolerance_fraction,
+                              int                 locate_on_parents)
+{
+  int i;
+  cs_lnum_t j, k;
+  double *extents = NULL;
+  fvm_point_location_bvh_t *bvh = NULL;
+
+  if (this_nodal->dim != 3)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: only 3d meshes are handled\n"
+                "(mesh \"%s\" has spatial dimension %d)."),
+              __func__, this_nodal->name, this_nodal->dim);
+
+  BFT_MALLOC(bvh, 1, fvm_point_location_bvh_t);
+
+  bvh->mesh = this_nodal;
+  bvh->locate_on_parents = locate_on_parents;
+  bvh->entity_dim = fvm_nodal_get_max_entity_dim(this_nodal);
+  bvh->tolerance[0] = tolerance_base;
+  bvh->tolerance[1] = tolerance_fraction;
+
+  /* Located sections */
+
+  BFT_MALLOC(bvh->section_id, this_nodal->n_sections, int);
+  BFT_MALLOC(bvh->section_idx, this_nodal->n_sections + 1, cs_lnum_t);
+  BFT_MALLOC(bvh->section_base, this_nodal->n_sections, cs_lnum_t);
+
+  bvh->n_sections = 0;
+  bvh->section_idx[0] = 0;
+  bvh->n_vertices_max = 0;
+
+  for (i = 0; i < this_nodal->n_sections; i++) {
+    const fvm_nodal_section_t  *this_section = this_nodal->sections[i];
+    if (this_section->entity_dim == bvh->entity_dim) {
+      int s_id = bvh->n_sections;
+      bvh->section_id[s_id] = i;
+      bvh->section_idx[s_id + 1]
+        = bvh->section_idx[s_id] + this_section->n_elements;
+      if (locate_on_parents == 1)
+        bvh->section_base[s_id] = -1;
+      else
+        bvh->section_base[s_id] = bvh->section_idx[s_id] + 1;
+      bvh->n_vertices_max = CS_MAX(bvh->n_vertices_max,
+                                   _section_n_vertices_max(this_section));
+      bvh->n_sections += 1;
+    }
+  }
+
+  bvh->n_elts = bvh->section_idx[bvh->n_sections];
+
+  /* Build tree structure */
+
+  BFT_MALLOC(bvh->elt_id, bvh->n_elts, cs_lnum_t);
+  BFT_MALLOC(bvh->elt_extents, bvh->n_elts*6, double);
+  BFT_MALLOC(extents, bvh->n_elts*6, double);
+
+  for (i = 0; i < bvh->n_sections; i++) {
+    const fvm_nodal_section_t  *this_section
+      = this_nodal->sections[bvh->section_id[i]];
+    for (j = 0; j < this_section->n_elements; j++) {
+      k = bvh->section_idx[i] + j;
+      bvh->elt_id[k] = k;
+      _section_elt_extents_3d(this_section,
+                              j,
+                              this_nodal->parent_vertex_num,
+                              this_nodal->vertex_coords,
+                              bvh->tolerance,
+                              extents + k*6);
+    }
+  }
+
+  bvh->n_nodes = 0;
+  bvh->n_nodes_max = 0;
+  bvh->node_child = NULL;
+  bvh->node_range = NULL;
+  bvh->node_extents = NULL;
+
+  if (bvh->n_elts > 0) {
+    _bvh_reserve_nodes(bvh, 2*(bvh->n_elts/_BVH_LEAF_SIZE) + 1);
+    bvh->n_nodes = 1;
+    _bvh_split(bvh, 0, 0, bvh->n_elts, extents, bvh->elt_id);
+  }
+
+  BFT_FREE(extents);
+
+  _bvh_update_extents(bvh);
+
+  /* Map element numbers to tree positions, for relocation */
+
+  bvh->max_elt_num = 0;
+
+  for (k = 0; k < bvh->n_elts; k++) {
+    int s_id;
+    j = _bvh_section_elt_id(bvh, bvh->elt_id[k], &s_id);
+    cs_lnum_t elt_num
+      = _section_elt_num(this_nodal->sections[bvh->section_id[s_id]],
+                         j,
+                         bvh->section_base[s_id]);
+    bvh->max_elt_num = CS_MAX(bvh->max_elt_num, elt_num);
+  }
+
+  BFT_MALLOC(bvh->elt_num_pos, bvh->max_elt_num + 1, cs_lnum_t);
+
+  for (j = 0; j < bvh->max_elt_num + 1; j++)
+    bvh->elt_num_pos[j] = -1;
+
+  for (k = 0; k < bvh->n_elts; k++) {
+    int s_id;
+    j = _bvh_section_elt_id(bvh, bvh->elt_id[k], &s_id);
+    cs_lnum_t elt_num
+      = _section_elt_num(this_nodal->sections[bvh->section_id[s_id]],
+                         j,
+                         bvh->section_base[s_id]);
+    bvh->elt_num_pos[elt_num] = k;
+  }
+
+  return bvh;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a bounding volume hierarchy.
+ *
+ * parameters:
+ *   bvh <-- pointer to bounding volume hierarchy
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+fvm_point_location_bvh_t *
+fvm_point_location_bvh_destroy(fvm_point_location_bvh_t  *bvh)
+{
+  if (bvh != NULL) {
+
+    BFT_FREE(bvh->elt_num_pos);
+    BFT_FREE(bvh->node_extents);
+    BFT_FREE(bvh->node_range);
+    BFT_FREE(bvh->node_child);
+    BFT_FREE(bvh->elt_extents);
+    BFT_FREE(bvh->elt_id);
+    BFT_FREE(bvh->section_base);
+    BFT_FREE(bvh->section_idx);
+    BFT_FREE(bvh->section_id);
+
+    BFT_FREE(bvh);
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a bounding volume hierarchy after its associated mesh's vertex
+ * coordinates have been modified (mesh topology must be unchanged).
+ *
+ * Element and node extents are recomputed, but the tree structure is
+ * kept, so the hierarchy may become less efficient in case of large
+ * deformations.
+ *
+ * parameters:
+ *   bvh <-> pointer to bounding volume hierarchy
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_bvh_update(fvm_point_location_bvh_t  *bvh)
+{
+  _bvh_update_extents(bvh);
+}
+
+/*----------------------------------------------------------------------------
+ * Find elements of the mesh associated with a bounding volume hierarchy
+ * containing points: updates the location[] and distance[] arrays
+ * associated with a set of points for points that are in an element
+ * of this mesh, or closer to one than to previously encountered elements.
+ *
+ * This is equivalent to fvm_point_location_nodal() with the tolerance
+ * and numbering options used to create the hierarchy, but the search
+ * structure is reused, and points are handled in parallel by threads.
+ *
+ * parameters:
+ *   bvh          <-- pointer to bounding volume hierarchy
+ *   n_points     <-- number of points to locate
+ *   point_tag    <-- optional point tag (size: n_points)
+ *   point_coords <-- point coordinates
+ *   location     <-> number of element containing or closest to each
+ *                    point (size: n_points)
+ *   distance     <-> distance from point to element indicated by
+ *                    location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                    and > 1 if outside a volume element, or absolute
+ *                    distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_bvh_locate(const fvm_point_location_bvh_t  *bvh,
+                              cs_lnum_t                        n_points,
+                              const cs_lnum_t                 *point_tag,
+                              const cs_coord_t                 point_coords[],
+                              cs_lnum_t                        location[],
+                              float                            distance[])
+{
+  const cs_lnum_t n_tv = CS_MAX((bvh->n_vertices_max - 2)*3, 6);
+
+# pragma omp parallel if (n_points > CS_THR_MIN)
+  {
+    cs_lnum_t *triangle_vertices = NULL;
+    fvm_triangulate_state_t *state
+      = fvm_triangulate_state_create(CS_MAX(bvh->n_vertices_max, 3));
+
+    BFT_MALLOC(triangle_vertices, n_tv, cs_lnum_t);
+
+#   pragma omp for schedule(dynamic, 64)
+    for (cs_lnum_t i = 0; i < n_points; i++)
+      _bvh_locate_point(bvh,
+                        i,
+                        point_tag,
+                        point_coords,
+                        triangle_vertices,
+                        state,
+                        location,
+                        distance);
+
+    BFT_FREE(triangle_vertices);
+    state = fvm_triangulate_state_destroy(state);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Relocate points which may have moved slightly since a previous location
+ * using the same bounding volume hierarchy.
+ *
+ * For volume meshes, the element indicated by the previous location is
+ * tested first for each point; if the point is not inside this element
+ * and an element adjacency is given, a walk through adjacent elements is
+ * done, moving to the closest adjacent element while the distance to the
+ * point decreases. Points not found that way are located using the full
+ * hierarchy. When locating on parents and several elements share a same
+ * parent (as with split polyhedra), only one of them is tested first.
+ *
+ * parameters:
+ *   bvh          <-- pointer to bounding volume hierarchy
+ *   n_points     <-- number of points to locate
+ *   point_tag    <-- optional point tag (size: n_points)
+ *   point_coords <-- point coordinates
+ *   elt_adj_idx  <-- optional element adjacency index, by element
+ *                    number - 1 (same numbering as location[])
+ *   elt_adj      <-- optional element adjacency, as element number - 1
+ *   location     <-> on input, previous location of each point, or -1;
+ *                    on output, number of element containing or closest
+ *                    to each point, or -1 (size: n_points)
+ *   distance     --> distance from point to element indicated by
+ *                    location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                    and > 1 if outside a volume element, or absolute
+ *                    distance to a surface element (size: n_points)
+ *
+ * returns:
+ *   number of points which required a full search
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_point_location_bvh_relocate(const fvm_point_location_bvh_t  *bvh,
+                                cs_lnum_t                        n_points,
+                                const cs_lnum_t                 *point_tag,
+                                const cs_coord_t                 point_coords[],
+                                const cs_lnum_t                  elt_adj_idx[],
+                                const cs_lnum_t                  elt_adj[],
+                                cs_lnum_t                        location[],
+                                float                            distance[])
+{
+  cs_lnum_t n_searched = 0;
+
+  const cs_lnum_t n_tv = CS_MAX((bvh->n_vertices_max - 2)*3, 6);
+
+# pragma omp parallel if (n_points > CS_THR_MIN) reduction(+:n_searched)
+  {
+    cs_lnum_t *triangle_vertices = NULL;
+    fvm_triangulate_state_t *state
+      = fvm_triangulate_state_create(CS_MAX(bvh->n_vertices_max, 3));
+
+    BFT_MALLOC(triangle_vertices, n_tv, cs_lnum_t);
+
+#   pragma omp for schedule(dynamic, 64)
+    for (cs_lnum_t i = 0; i < n_points; i++) {
+
+      cs_lnum_t prev_num = location[i];
+
+      location[i] = -1;
+      distance[i] = -1;
+
+      if (bvh->entity_dim == 3 && prev_num > -1) {
+
+        /* Test previous element first */
+
+        cs_lnum_t cur_num = prev_num;
+        float cur_dist = _bvh_elt_distance(bvh,
+                                           prev_num,
+                                           i,
+                                           point_tag,
+                                           point_coords,
+                                           triangle_vertices,
+                                           state,
+                                           location,
+                                           distance);
+
+        /* Then walk through adjacent elements, moving to the closest
+           one as long as the point is not inside and distance decreases */
+
+        if (elt_adj_idx != NULL && (cur_dist < 0 || cur_dist > 1)) {
+
+          for (int step = 0; step < _BVH_WALK_MAX_STEPS; step++) {
+
+            cs_lnum_t best_num = -1;
+            float best_dist = -1;
+
+            for (cs_lnum_t k = elt_adj_idx[cur_num - 1];
+                 k < elt_adj_idx[cur_num];
+                 k++) {
+              cs_lnum_t n_num = elt_adj[k] + 1;
+              float n_dist = _bvh_elt_distance(bvh,
+                                               n_num,
+                                               i,
+                                               point_tag,
+                                               point_coords,
+                                               triangle_vertices,
+                                               state,
+                                               location,
+                                               distance);
+              if (n_dist >= 0 && (best_dist < 0 || n_dist < best_dist)) {
+                best_num = n_num;
+                best_dist = n_dist;
+              }
+            }
+
+            if (best_num < 0 || (cur_dist >= 0 && best_dist >= cur_dist))
+              break;
+
+            cur_num = best_num;
+            cur_dist = best_dist;
+
+            if (cur_dist <= 1)
+              break;
+
+          }
+
+        }
+
+        if (cur_dist >= 0 && cur_dist <= 1) {
+          location[i] = cur_num;
+          distance[i] = cur_dist;
+          continue;
+        }
+
+      }
+
+      /* Otherwise, use full search */
+
+      _bvh_locate_point(bvh,
+                        i,
+                        point_tag,
+                        point_coords,
+                        triangle_vertices,
+                        state,
+                        location,
+                        distance);
+
+      n_searched += 1;
+
+    }
+
+    BFT_FREE(triangle_vertices);
+    state = fvm_triangulate_state_destroy(state);
+  }
+
+  return n_searched;
+}
+
 /*----------------------------------------------------------------------------*/
 
 #undef _DOT_PRODUCT
@@ -48,6 +48,12 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Opaque bounding volume hierarchy structure for point location
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_point_location_bvh_t fvm_point_location_bvh_t;
+
 /*=============================================================================
  * Static global variables
  *============================================================================*/
@@ -126,6 +132,136 @@ fvm_point_location_closest_vertex(const fvm_nodal_t  *this_nodal,
                                   cs_lnum_t           located_ent_num[],
                                   cs_lnum_t           located_vtx_num[]);
 
+/*----------------------------------------------------------------------------
+ * Create a bounding volume hierarchy over the elements of a 3d nodal mesh,
+ * for repeated point location.
+ *
+ * Only sections of the highest element dimension are considered, as for
+ * fvm_point_location_nodal(). The nodal mesh must remain available
+ * during the lifetime of the hierarchy; if its vertex coordinates are
+ * modified, fvm_point_location_bvh_update() must be called.
+ *
+ * parameters:
+ *   this_nodal         <-- pointer to nodal mesh representation structure
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   locate_on_parents  <-- location relative to parent element numbers if 1,
+ *                          id of element + 1 in concatenated sections of
+ *                          same element dimension if 0
+ *
+ * returns:
+ *   pointer to created bounding volume hierarchy
+ *----------------------------------------------------------------------------*/
+
+fvm_point_location_bvh_t *
+fvm_point_location_bvh_create(const fvm_nodal_t  *this_nodal,
+                              float               tolerance_base,
+                              float               tolerance_fraction,
+                              int                 locate_on_parents);
+
+/*----------------------------------------------------------------------------
+ * Destroy a bounding volume hierarchy.
+ *
+ * parameters:
+ *   bvh <-- pointer to bounding volume hierarchy
+ *
+ * returns:
+ *   NULL pointer
+ *----------------------------------------------------------------------------*/
+
+fvm_point_location_bvh_t *
+fvm_point_location_bvh_destroy(fvm_point_location_bvh_t  *bvh);
+
+/*----------------------------------------------------------------------------
+ * Update a bounding volume hierarchy after its associated mesh's vertex
+ * coordinates have been modified (mesh topology must be unchanged).
+ *
+ * Element and node extents are recomputed, but the tree structure is
+ * kept, so the hierarchy may become less efficient in case of large
+ * deformations.
+ *
+ * parameters:
+ *   bvh <-> pointer to bounding volume hierarchy
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_bvh_update(fvm_point_location_bvh_t  *bvh);
+
+/*----------------------------------------------------------------------------
+ * Find elements of the mesh associated with a bounding volume hierarchy
+ * containing points: updates the location[] and distance[] arrays
+ * associated with a set of points for points that are in an element
+ * of this mesh, or closer to one than to previously encountered elements.
+ *
+ * This is equivalent to fvm_point_location_nodal() with the tolerance
+ * and numbering options used to create the hierarchy, but the search
+ * structure is reused, and points are handled in parallel by threads.
+ *
+ * parameters:
+ *   bvh          <-- pointer to bounding volume hierarchy
+ *   n_points     <-- number of points to locate
+ *   point_tag    <-- optional point tag (size: n_points)
+ *   point_coords <-- point coordinates
+ *   location     <-> number of element containing or closest to each
+ *                    point (size: n_points)
+ *   distance     <-> distance from point to element indicated by
+ *                    location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                    and > 1 if outside a volume element, or absolute
+ *                    distance to a surface element (size: n_points)
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_point_location_bvh_locate(const fvm_point_location_bvh_t  *bvh,
+                              cs_lnum_t                        n_points,
+                              const cs_lnum_t                 *point_tag,
+                              const cs_coord_t                 point_coords[],
+                              cs_lnum_t                        location[],
+                              float                            distance[]);
+
+/*----------------------------------------------------------------------------
+ * Relocate points which may have moved slightly since a previous location
+ * using the same bounding volume hierarchy.
+ *
+ * For volume meshes, the element indicated by the previous location is
+ * tested first for each point; if the point is not inside this element
+ * and an element adjacency is given, a walk through adjacent elements is
+ * done, moving to the closest adjacent element while the distance to the
+ * point decreases. Points not found that way are located using the full
+ * hierarchy. When locating on parents and several elements share a same
+ * parent (as with split polyhedra), only one of them is tested first.
+ *
+ * parameters:
+ *   bvh          <-- pointer to bounding volume hierarchy
+ *   n_points     <-- number of points to locate
+ *   point_tag    <-- optional point tag (size: n_points)
+ *   point_coords <-- point coordinates
+ *   elt_adj_idx  <-- optional element adjacency index, by element
+ *                    number - 1 (same numbering as location[])
+ *   elt_adj      <-- optional element adjacency, as element number - 1
+ *   location     <-> on input, previous location of each point, or -1;
+ *                    on output, number of element containing or closest
+ *                    to each point, or -1 (size: n_points)
+ *   distance     --> distance from point to element indicated by
+ *                    location[]: < 0 if unlocated, 0 - 1 if inside,
+ *                    and > 1 if outside a volume element, or absolute
+ *                    distance to a surface element (size: n_points)
+ *
+ * returns:
+ *   number of points which required a full search
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_point_location_bvh_relocate(const fvm_point_location_bvh_t  *bvh,
+                                cs_lnum_t                        n_points,
+                                const cs_lnum_t                 *point_tag,
+                                const cs_coord_t                 point_coords[],
+                                const cs_lnum_t                  elt_adj_idx[],
+                                const cs_lnum_t                  elt_adj[],
+                                cs_lnum_t                        location[],
+                                float                            distance[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -1366,14 +1366,13 @@ _export_vertex_coords_g(fvm_to_cgns_writer_t  *writer,
 
   /* Initialize distribution info */
 
-  fvm_writer_vertex_part_to_block_create(writer->min_rank_step,
-                                         writer->min_block_size,
-                                         n_g_extra_vertices,
-                                         n_extra_vertices,
-                                         mesh,
-                                         &bi,
-                                         &d,
-                                         writer->comm);
+  d = fvm_writer_vertex_part_to_block_get(writer->min_rank_step,
+                                          writer->min_block_size,
+                                          n_g_extra_vertices,
+                                          n_extra_vertices,
+                                          mesh,
+                                          &bi,
+                                          writer->comm);
 
   /* Compute extra vertex coordinates if present */
 
@@ -1461,8 +1460,6 @@ _export_vertex_coords_g(fvm_to_cgns_writer_t  *writer,
 
   } /* end of loop on spatial dimension */
 
-  cs_part_to_block_destroy(&d);
-
   BFT_FREE(block_coords);
   BFT_FREE(part_coords);
   if (extra_vertex_coords != NULL)
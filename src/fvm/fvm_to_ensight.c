@@ -455,14 +455,13 @@ _export_vertex_coords_g(const fvm_to_ensight_writer_t  *this_writer,
 
   /* Initialize distribution info */
 
-  fvm_writer_vertex_part_to_block_create(this_writer->min_rank_step,
-                                         this_writer->min_block_size,
-                                         n_g_extra_vertices,
-                                         n_extra_vertices,
-                                         mesh,
-                                         &bi,
-                                         &d,
-                                         this_writer->comm);
+  d = fvm_writer_vertex_part_to_block_get(this_writer->min_rank_step,
+                                          this_writer->min_block_size,
+                                          n_g_extra_vertices,
+                                          n_extra_vertices,
+                                          mesh,
+                                          &bi,
+                                          this_writer->comm);
 
   /* Compute extra vertex coordinates if present */
 
@@ -519,8 +518,6 @@ _export_vertex_coords_g(const fvm_to_ensight_writer_t  *this_writer,
 
   } /* end of loop on spatial dimension */
 
-  cs_part_to_block_destroy(&d);
-
   BFT_FREE(block_coords);
   BFT_FREE(part_coords);
   if (extra_vertex_coords != NULL)
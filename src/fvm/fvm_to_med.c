@@ -1497,14 +1497,13 @@ _export_vertex_coords_g(const fvm_nodal_t    *mesh,
 
   /* Initialize distribution info */
 
-  fvm_writer_vertex_part_to_block_create(writer->min_rank_step,
-                                         writer->min_block_size,
-                                         n_g_extra_vertices,
-                                         n_extra_vertices,
-                                         mesh,
-                                         &bi,
-                                         &d,
-                                         writer->comm);
+  d = fvm_writer_vertex_part_to_block_get(writer->min_rank_step,
+                                          writer->min_block_size,
+                                          n_g_extra_vertices,
+                                          n_extra_vertices,
+                                          mesh,
+                                          &bi,
+                                          writer->comm);
 
   /* Build arrays */
 
@@ -1554,8 +1553,6 @@ _export_vertex_coords_g(const fvm_nodal_t    *mesh,
                               part_coords,
                               block_coords);
 
-  cs_part_to_block_destroy(&d);
-
   BFT_FREE(part_coords);
 
   if (writer->block_comm != MPI_COMM_NULL) { /* Parallel IO */
@@ -0,0 +1,1945 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to XDMF files, with heavy data in a single HDF5 file
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#if defined(HAVE_HDF5)
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * HDF5 library header
+ *----------------------------------------------------------------------------*/
+
+#include <hdf5.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_defs.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_block_dist.h"
+#include "cs_file.h"
+#include "cs_parall.h"
+#include "cs_part_to_block.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_xdmf.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Use parallel HDF5 (collective MPI-IO) when available */
+
+#if defined(HAVE_MPI) && defined(H5_HAVE_PARALLEL)
+#define _XDMF_PARALLEL_IO 1
+#endif
+
+/* Default number of entities per chunk when compression is requested
+   without an explicit chunk size */
+
+#define _XDMF_DEFAULT_CHUNK_SIZE  65536
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Geometry (coordinates and connectivity) written for a mesh
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int          time_id;            /* Associated time id, or -1 */
+
+  cs_gnum_t    n_g_vertices;       /* Global number of vertices */
+  cs_gnum_t    n_g_elements;       /* Global number of elements */
+  cs_gnum_t    connect_size;       /* Size of mixed connectivity array */
+
+  char        *coords_path;        /* Coordinates dataset path */
+  char        *connect_path;       /* Connectivity dataset path */
+
+} _xdmf_geom_t;
+
+/*----------------------------------------------------------------------------
+ * Field values written for a mesh
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Field name */
+  char        *path;               /* Dataset path */
+
+  int          dim;                /* Field dimension */
+  bool         on_cells;           /* true for per-element values,
+                                      false for per-vertex values */
+  int          time_id;            /* Associated time id, or -1 */
+  int          geom_id;            /* Associated geometry id */
+
+} _xdmf_field_t;
+
+/*----------------------------------------------------------------------------
+ * Mesh structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char           *name;            /* Mesh name */
+  char           *h5_name;         /* Associated HDF5 group name */
+
+  int             n_geoms;         /* Number of written geometries */
+  _xdmf_geom_t   *geoms;           /* Written geometries */
+
+  int             n_fields;        /* Number of written field values */
+  _xdmf_field_t  *fields;          /* Written field values */
+
+} _xdmf_mesh_t;
+
+/*----------------------------------------------------------------------------
+ * XDMF writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char          *name;               /* Writer name */
+  char          *filename;           /* HDF5 file name */
+  char          *h5_basename;        /* HDF5 file name, without path */
+  char          *xmf_filename;       /* XDMF file name */
+
+  fvm_writer_time_dep_t  time_dependency;  /* Mesh time dependency */
+
+  int            n_time_values;      /* Number of time values */
+  int           *time_steps;         /* Time step numbers */
+  double        *time_values;        /* Time values */
+  int            time_id;            /* Current time id, or -1 */
+
+  int            n_meshes;           /* Number of meshes */
+  _xdmf_mesh_t  *meshes;             /* Array of meshes */
+
+  bool           discard_polygons;   /* Option to discard polygonal
+                                        elements */
+  bool           discard_polyhedra;  /* Option to discard polyhedral
+                                        elements */
+
+  hsize_t        chunk_size;         /* Entities per dataset chunk, or 0 */
+  int            deflate_level;      /* Deflate compression level, or 0 */
+  bool           shuffle;            /* Apply shuffle filter if true */
+  int            lossy_digits;       /* Decimal digits kept by lossy
+                                        compression of field values,
+                                        or -1 */
+
+  bool           modified;           /* Has the XDMF file been modified
+                                        since last flush ? */
+
+  hid_t          file_id;            /* HDF5 file id (< 0 if not open
+                                        on this rank) */
+
+  int            rank;               /* Rank of current process
+                                        in communicator */
+  int            n_ranks;            /* Number of processes
+                                        in communicator */
+
+  bool           parallel_io;        /* Use parallel HDF5 if true */
+
+#if defined(HAVE_MPI)
+  int            min_rank_step;      /* Minimum rank step */
+  int            min_block_size;     /* Minimum block buffer size */
+  MPI_Comm       block_comm;         /* Associated MPI block communicator */
+  MPI_Comm       comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_xdmf_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  fvm_to_xdmf_writer_t  *writer;      /* Pointer to writer structure */
+
+  const char            *path;        /* Dataset path */
+  cs_gnum_t              n_g_ents;    /* Global number of entities */
+
+} _xdmf_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char _hdf5_version_string[2][32] = {"", ""};
+
+/* XDMF mixed topology element type ids, indexed by FVM element type */
+
+static const int _xdmf_type_id[FVM_N_ELEMENT_TYPES] = {2,   /* Polyline */
+                                                       4,   /* Triangle */
+                                                       5,   /* Quadrilateral */
+                                                       3,   /* Polygon */
+                                                       6,   /* Tetrahedron */
+                                                       7,   /* Pyramid */
+                                                       8,   /* Wedge */
+                                                       9,   /* Hexahedron */
+                                                       16}; /* Polyhedron */
+
+/* XDMF prism vertex ordering (orientation differs from FVM) */
+
+static const int _xdmf_prism_order[6] = {0, 2, 1, 3, 5, 4};
+
+/* XDMF symmetric tensor component ordering */
+
+static const int _xdmf_c_order_6[6] = {0, 3, 5, 1, 4, 2};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Copy a name, replacing characters not suitable for an HDF5 link name.
+ *
+ * parameters:
+ *   name <-- name to copy
+ *
+ * returns:
+ *   newly allocated name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_h5_name(const char  *name)
+{
+  size_t l = strlen(name);
+  char *s = NULL;
+
+  BFT_MALLOC(s, l + 1, char);
+  for (size_t i = 0; i < l; i++) {
+    if (name[i] == '/' || name[i] == ' ' || name[i] == '\t' || name[i] == ':')
+      s[i] = '_';
+    else
+      s[i] = name[i];
+  }
+  s[l] = '\0';
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a string to an XML file, escaping special characters.
+ *
+ * parameters:
+ *   f <-- pointer to file
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_xml_string(FILE        *f,
+                  const char  *s)
+{
+  for (const char *c = s; *c != '\0'; c++) {
+    switch (*c) {
+    case '&':
+      fputs("&amp;", f);
+      break;
+    case '<':
+      fputs("&lt;", f);
+      break;
+    case '>':
+      fputs("&gt;", f);
+      break;
+    case '"':
+      fputs("&quot;", f);
+      break;
+    default:
+      fputc(*c, f);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Return time id associated with a given time step, adding it to the
+ * writer's time values if necessary.
+ *
+ * parameters:
+ *   w          <-> pointer to writer structure
+ *   time_step  <-- time step number
+ *   time_value <-- associated time value
+ *
+ * returns:
+ *   time id, or -1 for time-independent data
+ *----------------------------------------------------------------------------*/
+
+static int
+_time_id(fvm_to_xdmf_writer_t  *w,
+         int                    time_step,
+         double                 time_value)
+{
+  if (time_step < 0)
+    return -1;
+
+  int n = w->n_time_values;
+
+  if (n > 0) {
+    if (time_step == w->time_steps[n-1])
+      return n-1;
+    else if (time_step < w->time_steps[n-1])
+      bft_error(__FILE__, __LINE__, 0,
+                _("The given time step value should be greater than %d\n"
+                  "(the last time step for writer \"%s\"), and not %d."),
+                w->time_steps[n-1], w->name, time_step);
+  }
+
+  BFT_REALLOC(w->time_steps, n+1, int);
+  BFT_REALLOC(w->time_values, n+1, double);
+  w->time_steps[n] = time_step;
+  w->time_values[n] = time_value;
+  w->n_time_values = n+1;
+
+  w->modified = true;
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Return pointer to the writer's structure for a given mesh, adding it
+ * if not already present.
+ *
+ * parameters:
+ *   w    <-> pointer to writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *
+ * returns:
+ *   pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static _xdmf_mesh_t *
+_get_mesh(fvm_to_xdmf_writer_t  *w,
+          const fvm_nodal_t     *mesh)
+{
+  const char *name = (mesh->name != NULL) ? mesh->name : "mesh";
+
+  for (int i = 0; i < w->n_meshes; i++) {
+    if (strcmp(w->meshes[i].name, name) == 0)
+      return w->meshes + i;
+  }
+
+  BFT_REALLOC(w->meshes, w->n_meshes + 1, _xdmf_mesh_t);
+
+  _xdmf_mesh_t *m = w->meshes + w->n_meshes;
+  w->n_meshes += 1;
+
+  BFT_MALLOC(m->name, strlen(name) + 1, char);
+  strcpy(m->name, name);
+  m->h5_name = _h5_name(name);
+
+  m->n_geoms = 0;
+  m->geoms = NULL;
+  m->n_fields = 0;
+  m->fields = NULL;
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Build an HDF5 dataset path.
+ *
+ * parameters:
+ *   group     <-- mesh group name
+ *   sub_group <-- sub-group name
+ *   time_step <-- time step, or -1 for time-independent data
+ *   name      <-- dataset name
+ *
+ * returns:
+ *   newly allocated path
+ *----------------------------------------------------------------------------*/
+
+static char *
+_dataset_path(const char  *group,
+              const char  *sub_group,
+              int          time_step,
+              const char  *name)
+{
+  char t_name[32] = "";
+  char *path = NULL;
+
+  if (time_step > -1)
+    snprintf(t_name, 31, "_%d", time_step);
+  t_name[31] = '\0';
+
+  size_t l = strlen(group) + strlen(sub_group) + strlen(t_name)
+             + strlen(name) + 4;
+
+  BFT_MALLOC(path, l, char);
+  snprintf(path, l, "/%s/%s%s/%s", group, sub_group, t_name, name);
+
+  return path;
+}
+
+/*----------------------------------------------------------------------------
+ * Check an HDF5 return status.
+ *
+ * parameters:
+ *   w      <-- pointer to writer structure
+ *   path   <-- path of dataset or group being handled
+ *   status <-- return status of HDF5 call
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_status(const fvm_to_xdmf_writer_t  *w,
+              const char                  *path,
+              herr_t                       status)
+{
+  if (status < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5 error writing \"%s\" in file:\n"
+                "\"%s\"."),
+              path, w->filename);
+}
+
+/*----------------------------------------------------------------------------
+ * Open the writer's HDF5 file if not already done.
+ *
+ * This function is collective when parallel HDF5 is used.
+ *
+ * parameters:
+ *   w <-> pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_open_file(fvm_to_xdmf_writer_t  *w)
+{
+  if (w->file_id >= 0)
+    return;
+
+  if (w->parallel_io == false && w->rank > 0)
+    return;
+
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+
+#if defined(_XDMF_PARALLEL_IO)
+  if (w->parallel_io)
+    H5Pset_fapl_mpio(fapl, w->comm, MPI_INFO_NULL);
+#endif
+
+  w->file_id = H5Fcreate(w->filename, H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+
+  H5Pclose(fapl);
+
+  if (w->file_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5 error opening file:\n"
+                "\"%s\"."), w->filename);
+}
+
+/*----------------------------------------------------------------------------
+ * Create a 1d or 2d HDF5 dataset.
+ *
+ * Intermediate groups are created if needed, and an existing dataset
+ * with the same path is replaced if indicated.
+ *
+ * If allowed and requested by the writer options, floating-point values
+ * are stored using the HDF5 scale-offset filter in decimal scaling mode,
+ * which is lossy, but bounds the absolute error by 0.5*10^(-lossy_digits).
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   path      <-- dataset path
+ *   file_type <-- HDF5 datatype in file
+ *   stride    <-- number of values per entity (2d dataset if > 1)
+ *   n_g_ents  <-- global number of entities
+ *   replace   <-- true if a dataset with the same path exists
+ *   lossy     <-- allow lossy compression of values
+ *
+ * returns:
+ *   HDF5 dataset id
+ *----------------------------------------------------------------------------*/
+
+static hid_t
+_create_dataset(const fvm_to_xdmf_writer_t  *w,
+                const char                  *path,
+                hid_t                        file_type,
+                int                          stride,
+                cs_gnum_t                    n_g_ents,
+                bool                         replace,
+                bool                         lossy)
+{
+  int rank = (stride > 1) ? 2 : 1;
+  hsize_t dims[2] = {n_g_ents, stride};
+
+  if (replace)
+    _check_status(w, path, H5Ldelete(w->file_id, path, H5P_DEFAULT));
+
+  if (w->lossy_digits < 0 || H5Tget_class(file_type) != H5T_FLOAT)
+    lossy = false;
+
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+
+  if (   n_g_ents > 0
+      && (w->chunk_size > 0 || w->deflate_level > 0 || lossy)) {
+    hsize_t c_dims[2] = {w->chunk_size, stride};
+    if (c_dims[0] < 1)
+      c_dims[0] = _XDMF_DEFAULT_CHUNK_SIZE;
+    if (c_dims[0] > n_g_ents)
+      c_dims[0] = n_g_ents;
+    H5Pset_chunk(dcpl, rank, c_dims);
+    if (lossy)
+      H5Pset_scaleoffset(dcpl, H5Z_SO_FLOAT_DSCALE, w->lossy_digits);
+    if (w->shuffle)
+      H5Pset_shuffle(dcpl);
+    if (w->deflate_level > 0)
+      H5Pset_deflate(dcpl, w->deflate_level);
+  }
+
+  hid_t lcpl = H5Pcreate(H5P_LINK_CREATE);
+  H5Pset_create_intermediate_group(lcpl, 1);
+
+  hid_t f_space = H5Screate_simple(rank, dims, NULL);
+
+  hid_t dataset = H5Dcreate2(w->file_id, path, file_type, f_space,
+                             lcpl, dcpl, H5P_DEFAULT);
+
+  H5Sclose(f_space);
+  H5Pclose(lcpl);
+  H5Pclose(dcpl);
+
+  if (dataset < 0)
+    _check_status(w, path, -1);
+
+  return dataset;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a block of values to an open HDF5 dataset.
+ *
+ * parameters:
+ *   w         <-- pointer to writer structure
+ *   dataset   <-- HDF5 dataset id
+ *   path      <-- dataset path
+ *   mem_type  <-- HDF5 datatype in memory
+ *   stride    <-- number of values per entity
+ *   start     <-- global id (0 to n-1) of first entity in block
+ *   n_ents    <-- number of entities in block
+ *   values    <-- block values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block(const fvm_to_xdmf_writer_t  *w,
+             hid_t                        dataset,
+             const char                  *path,
+             hid_t                        mem_type,
+             int                          stride,
+             cs_gnum_t                    start,
+             cs_gnum_t                    n_ents,
+             const void                  *values)
+{
+  int rank = (stride > 1) ? 2 : 1;
+  hsize_t h_start[2] = {start, 0};
+  hsize_t h_count[2] = {n_ents, stride};
+
+  hid_t f_space = H5Dget_space(dataset);
+  hid_t m_space = H5Screate_simple(rank, h_count, NULL);
+
+  if (n_ents > 0)
+    H5Sselect_hyperslab(f_space, H5S_SELECT_SET, h_start, NULL, h_count, NULL);
+  else {
+    H5Sselect_none(f_space);
+    H5Sselect_none(m_space);
+  }
+
+  hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+
+#if defined(_XDMF_PARALLEL_IO)
+  if (w->parallel_io)
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  herr_t status = H5Dwrite(dataset, mem_type, m_space, f_space, dxpl, values);
+
+  H5Pclose(dxpl);
+  H5Sclose(m_space);
+  H5Sclose(f_space);
+
+  _check_status(w, path, status);
+}
+
+/*----------------------------------------------------------------------------
+ * Write block-distributed values to a new HDF5 dataset.
+ *
+ * When parallel HDF5 is used, each rank writes its own block using
+ * collective I/O; otherwise, blocks are serialized to rank 0.
+ *
+ * parameters:
+ *   w           <-- pointer to writer structure
+ *   path        <-- dataset path
+ *   mem_type    <-- HDF5 datatype in memory
+ *   file_type   <-- HDF5 datatype in file
+ *   stride      <-- number of values per entity
+ *   n_g_ents    <-- global number of entities
+ *   block_start <-- global number (1 to n) of first entity in block
+ *   block_end   <-- global number (1 to n) of past-the-end entity in block
+ *   replace     <-- true if a dataset with the same path exists
+ *   lossy       <-- allow lossy compression of values
+ *   values      <-- block values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_dataset(fvm_to_xdmf_writer_t  *w,
+               const char            *path,
+               hid_t                  mem_type,
+               hid_t                  file_type,
+               int                    stride,
+               cs_gnum_t              n_g_ents,
+               cs_gnum_t              block_start,
+               cs_gnum_t              block_end,
+               bool                   replace,
+               bool                   lossy,
+               void                  *values)
+{
+  _open_file(w);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1 && w->parallel_io == false) {
+
+    hid_t dataset = -1;
+    size_t elt_size = H5Tget_size(mem_type);
+
+    if (w->rank == 0)
+      dataset = _create_dataset(w, path, file_type, stride, n_g_ents,
+                                replace, lossy);
+
+    cs_file_serializer_t *s
+      = cs_file_serializer_create(elt_size,
+                                  stride,
+                                  block_start,
+                                  block_end,
+                                  0,
+                                  values,
+                                  w->comm);
+
+    void *_values = NULL;
+
+    do {
+
+      cs_gnum_t range[2] = {block_start, block_end};
+
+      _values = cs_file_serializer_advance(s, range);
+
+      if (_values != NULL) /* only possible on rank 0 */
+        _write_block(w, dataset, path, mem_type, stride,
+                     range[0] - 1, range[1] - range[0], _values);
+
+    } while (_values != NULL);
+
+    cs_file_serializer_destroy(&s);
+
+    if (w->rank == 0)
+      H5Dclose(dataset);
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  hid_t dataset = _create_dataset(w, path, file_type, stride, n_g_ents,
+                                  replace, lossy);
+
+  _write_block(w, dataset, path, mem_type, stride,
+               block_start - 1, block_end - block_start, values);
+
+  H5Dclose(dataset);
+}
+
+/*----------------------------------------------------------------------------
+ * Return global number of elements of an export list.
+ *
+ * parameters:
+ *   export_list <-- pointer to section helper structure list
+ *
+ * returns:
+ *   global number of exported elements
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_n_g_elements(const fvm_writer_section_t  *export_list)
+{
+  cs_gnum_t n_g_elements = 0;
+
+  for (const fvm_writer_section_t *export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+    const fvm_nodal_section_t  *section = export_section->section;
+    if (section->global_element_num != NULL)
+      n_g_elements
+        += fvm_io_num_get_global_count(section->global_element_num);
+    else
+      n_g_elements += section->n_elements;
+  }
+
+  return n_g_elements;
+}
+
+/*----------------------------------------------------------------------------
+ * Build mixed topology connectivity for a given element.
+ *
+ * parameters:
+ *   section   <-- pointer to nodal mesh section
+ *   elt_id    <-- element id in section
+ *   g_vtx_num <-- vertex global numbers, or NULL
+ *   connect   --> element connectivity, or NULL (to only count size)
+ *
+ * returns:
+ *   size of element connectivity
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_element_connect(const fvm_nodal_section_t  *section,
+                 cs_lnum_t                   elt_id,
+                 const cs_gnum_t            *g_vtx_num,
+                 cs_gnum_t                  *connect)
+{
+  cs_lnum_t n = 0;
+
+#undef _VTX_ID
+#define _VTX_ID(v_num) \
+  ((g_vtx_num != NULL) ? g_vtx_num[(v_num) - 1] - 1 : (cs_gnum_t)((v_num) - 1))
+
+  if (section->type == FVM_FACE_POLY) {
+
+    cs_lnum_t s_id = section->vertex_index[elt_id];
+    cs_lnum_t e_id = section->vertex_index[elt_id + 1];
+
+    if (connect != NULL) {
+      connect[n++] = _xdmf_type_id[FVM_FACE_POLY];
+      connect[n++] = e_id - s_id;
+      for (cs_lnum_t i = s_id; i < e_id; i++)
+        connect[n++] = _VTX_ID(section->vertex_num[i]);
+    }
+    else
+      n = 2 + e_id - s_id;
+
+  }
+  else if (section->type == FVM_CELL_POLY) {
+
+    cs_lnum_t s_id = section->face_index[elt_id];
+    cs_lnum_t e_id = section->face_index[elt_id + 1];
+
+    if (connect != NULL) {
+      connect[n++] = _xdmf_type_id[FVM_CELL_POLY];
+      connect[n++] = e_id - s_id;
+    }
+    else
+      n = 2;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+      cs_lnum_t face_id = CS_ABS(section->face_num[i]) - 1;
+      cs_lnum_t f_s_id = section->vertex_index[face_id];
+      cs_lnum_t face_length = section->vertex_index[face_id+1] - f_s_id;
+
+      if (connect != NULL) {
+        int face_sgn = (section->face_num[i] > 0) ? 1 : -1;
+        connect[n++] = face_length;
+        for (cs_lnum_t k = 0; k < face_length; k++) {
+          cs_lnum_t l = f_s_id + (face_length + (k*face_sgn))%face_length;
+          connect[n++] = _VTX_ID(section->vertex_num[l]);
+        }
+      }
+      else
+        n += 1 + face_length;
+
+    }
+
+  }
+  else {
+
+    const int stride = section->stride;
+    const cs_lnum_t *vertex_num = section->vertex_num + elt_id*stride;
+
+    if (connect != NULL) {
+      connect[n++] = _xdmf_type_id[section->type];
+      if (section->type == FVM_EDGE)
+        connect[n++] = stride;
+      if (section->type == FVM_CELL_PRISM) {
+        for (int i = 0; i < stride; i++)
+          connect[n++] = _VTX_ID(vertex_num[_xdmf_prism_order[i]]);
+      }
+      else {
+        for (int i = 0; i < stride; i++)
+          connect[n++] = _VTX_ID(vertex_num[i]);
+      }
+    }
+    else
+      n = (section->type == FVM_EDGE) ? 2 + stride : 1 + stride;
+
+  }
+
+#undef _VTX_ID
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Write vertex coordinates to the HDF5 file.
+ *
+ * parameters:
+ *   w            <-> pointer to writer structure
+ *   mesh         <-- pointer to nodal mesh structure
+ *   path         <-- dataset path
+ *   n_g_vertices <-- global number of vertices
+ *   replace      <-- true if a dataset with the same path exists
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_vertex_coords(fvm_to_xdmf_writer_t  *w,
+                      const fvm_nodal_t     *mesh,
+                      const char            *path,
+                      cs_gnum_t              n_g_vertices,
+                      bool                   replace)
+{
+  const int dim = mesh->dim;
+  const cs_lnum_t n_vertices = mesh->n_vertices;
+  const cs_coord_t *vertex_coords = mesh->vertex_coords;
+  const cs_lnum_t *parent_vertex_num = mesh->parent_vertex_num;
+
+  double *part_coords = NULL;
+
+  BFT_MALLOC(part_coords, n_vertices*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t j = (parent_vertex_num != NULL) ? parent_vertex_num[i]-1 : i;
+    for (int k = 0; k < 3; k++)
+      part_coords[i*3 + k] = (k < dim) ? vertex_coords[j*dim + k] : 0.;
+  }
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    cs_block_dist_info_t  bi;
+    cs_part_to_block_t  *d = NULL;
+    double *block_coords = NULL;
+
+    d = fvm_writer_vertex_part_to_block_get(w->min_rank_step,
+                                            w->min_block_size,
+                                            0,
+                                            0,
+                                            mesh,
+                                            &bi,
+                                            w->comm);
+
+    BFT_MALLOC(block_coords, (bi.gnum_range[1] - bi.gnum_range[0])*3, double);
+
+    cs_part_to_block_copy_array(d, CS_DOUBLE, 3, part_coords, block_coords);
+
+    _write_dataset(w, path, H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 3,
+                   n_g_vertices, bi.gnum_range[0], bi.gnum_range[1],
+                   replace, false, block_coords);
+
+    BFT_FREE(block_coords);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (w->n_ranks == 1)
+    _write_dataset(w, path, H5T_NATIVE_DOUBLE, H5T_IEEE_F64LE, 3,
+                   n_g_vertices, 1, n_vertices + 1,
+                   replace, false, part_coords);
+
+  BFT_FREE(part_coords);
+}
+
+/*----------------------------------------------------------------------------
+ * Write mixed topology connectivity to the HDF5 file.
+ *
+ * Elements are ordered by global number, in the order of the export list.
+ *
+ * parameters:
+ *   w           <-> pointer to writer structure
+ *   mesh        <-- pointer to nodal mesh structure
+ *   export_list <-- pointer to section helper structure list
+ *   path        <-- dataset path
+ *   replace     <-- true if a dataset with the same path exists
+ *
+ * returns:
+ *   global size of connectivity dataset
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_export_connect(fvm_to_xdmf_writer_t        *w,
+                const fvm_nodal_t           *mesh,
+                const fvm_writer_section_t  *export_list,
+                const char                  *path,
+                bool                         replace)
+{
+  const fvm_writer_section_t  *export_section;
+
+  cs_lnum_t n_part_elts = 0;
+  cs_lnum_t *part_index = NULL;
+  cs_gnum_t *part_connect = NULL;
+
+  const cs_gnum_t *g_vtx_num = NULL;
+  if (w->n_ranks > 1)
+    g_vtx_num = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  const hid_t mem_type = (sizeof(cs_gnum_t) == 8) ?
+    H5T_NATIVE_UINT64 : H5T_NATIVE_UINT32;
+
+  /* Build local connectivity */
+
+  for (export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next)
+    n_part_elts += export_section->section->n_elements;
+
+  BFT_MALLOC(part_index, n_part_elts + 1, cs_lnum_t);
+
+  part_index[0] = 0;
+  cs_lnum_t k = 0;
+
+  for (export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+    const fvm_nodal_section_t  *section = export_section->section;
+    for (cs_lnum_t i = 0; i < section->n_elements; i++, k++)
+      part_index[k+1] = part_index[k]
+                        + _element_connect(section, i, g_vtx_num, NULL);
+  }
+
+  BFT_MALLOC(part_connect, part_index[n_part_elts], cs_gnum_t);
+
+  k = 0;
+
+  for (export_section = export_list;
+       export_section != NULL;
+       export_section = export_section->next) {
+    const fvm_nodal_section_t  *section = export_section->section;
+    for (cs_lnum_t i = 0; i < section->n_elements; i++, k++)
+      _element_connect(section, i, g_vtx_num, part_connect + part_index[k]);
+  }
+
+  cs_gnum_t connect_size = part_index[n_part_elts];
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+
+    cs_gnum_t *part_gnum = NULL;
+    cs_lnum_t *block_index = NULL;
+    cs_gnum_t *block_connect = NULL;
+
+    /* Global element numbers, shifted by section */
+
+    BFT_MALLOC(part_gnum, n_part_elts, cs_gnum_t);
+
+    cs_gnum_t gnum_shift = 0;
+    k = 0;
+
+    for (export_section = export_list;
+         export_section != NULL;
+         export_section = export_section->next) {
+      const fvm_nodal_section_t  *section = export_section->section;
+      const cs_gnum_t *s_gnum
+        = fvm_io_num_get_global_num(section->global_element_num);
+      for (cs_lnum_t i = 0; i < section->n_elements; i++, k++)
+        part_gnum[k] = s_gnum[i] + gnum_shift;
+      gnum_shift += fvm_io_num_get_global_count(section->global_element_num);
+    }
+
+    /* Distribute to blocks */
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(w->rank,
+                                    w->n_ranks,
+                                    w->min_rank_step,
+                                    w->min_block_size / sizeof(cs_gnum_t),
+                                    gnum_shift);
+
+    cs_lnum_t block_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(w->comm, bi, n_part_elts, part_gnum);
+    cs_part_to_block_transfer_gnum(d, part_gnum);
+
+    BFT_MALLOC(block_index, block_size + 1, cs_lnum_t);
+    cs_part_to_block_copy_index(d, part_index, block_index);
+
+    BFT_MALLOC(block_connect, block_index[block_size], cs_gnum_t);
+    cs_part_to_block_copy_indexed(d,
+                                  CS_GNUM_TYPE,
+                                  part_index,
+                                  part_connect,
+                                  block_index,
+                                  block_connect);
+
+    cs_part_to_block_destroy(&d);
+
+    /* Blocks are ordered by rank, so offsets are given by a prefix sum */
+
+    cs_gnum_t block_connect_size = block_index[block_size];
+    cs_gnum_t block_connect_end = 0;
+
+    MPI_Scan(&block_connect_size, &block_connect_end, 1, CS_MPI_GNUM,
+             MPI_SUM, w->comm);
+    MPI_Allreduce(&block_connect_size, &connect_size, 1, CS_MPI_GNUM,
+                  MPI_SUM, w->comm);
+
+    _write_dataset(w, path, mem_type, H5T_STD_I64LE, 1,
+                   connect_size,
+                   block_connect_end - block_connect_size + 1,
+                   block_connect_end + 1,
+                   replace,
+                   false,
+                   block_connect);
+
+    BFT_FREE(block_connect);
+    BFT_FREE(block_index);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (w->n_ranks == 1)
+    _write_dataset(w, path, mem_type, H5T_STD_I64LE, 1,
+                   connect_size, 1, connect_size + 1,
+                   replace, false, part_connect);
+
+  BFT_FREE(part_connect);
+  BFT_FREE(part_index);
+
+  return connect_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and field context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(datatype);
+  CS_UNUSED(component_id);
+
+  _xdmf_context_t *c = context;
+
+  assert(datatype == CS_DOUBLE);
+
+  /* Replaced datasets are unlinked before calling the helper */
+
+  _write_dataset(c->writer,
+                 c->path,
+                 H5T_NATIVE_DOUBLE,
+                 H5T_IEEE_F64LE,
+                 dimension,
+                 c->n_g_ents,
+                 block_start,
+                 block_end,
+                 false,
+                 true,
+                 buffer);
+}
+
+/*----------------------------------------------------------------------------
+ * Write a DataItem element referencing an HDF5 dataset to an XDMF file.
+ *
+ * parameters:
+ *   f           <-- pointer to file
+ *   w           <-- pointer to writer structure
+ *   indent      <-- indentation
+ *   n           <-- number of entities
+ *   stride      <-- number of values per entity
+ *   number_type <-- XDMF number type
+ *   path        <-- dataset path
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_xmf_data_item(FILE                        *f,
+                     const fvm_to_xdmf_writer_t  *w,
+                     const char                  *indent,
+                     cs_gnum_t                    n,
+                     int                          stride,
+                     const char                  *number_type,
+                     const char                  *path)
+{
+  fprintf(f, "%s<DataItem Dimensions=\"%llu", indent, (unsigned long long)n);
+  if (stride > 1)
+    fprintf(f, " %d", stride);
+  fprintf(f, "\" NumberType=\"%s\" Precision=\"8\" Format=\"HDF\">",
+          number_type);
+  _write_xml_string(f, w->h5_basename);
+  fputc(':', f);
+  _write_xml_string(f, path);
+  fprintf(f, "</DataItem>\n");
+}
+
+/*----------------------------------------------------------------------------
+ * Write a uniform grid element to an XDMF file.
+ *
+ * parameters:
+ *   f       <-- pointer to file
+ *   w       <-- pointer to writer structure
+ *   m       <-- pointer to mesh structure
+ *   geom_id <-- associated geometry id
+ *   time_id <-- associated time id, or -1
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_xmf_grid(FILE                        *f,
+                const fvm_to_xdmf_writer_t  *w,
+                const _xdmf_mesh_t          *m,
+                int                          geom_id,
+                int                          time_id)
+{
+  const _xdmf_geom_t *g = m->geoms + geom_id;
+
+  fprintf(f, "      <Grid Name=\"");
+  _write_xml_string(f, m->name);
+  fprintf(f, "\" GridType=\"Uniform\">\n");
+
+  if (time_id > -1)
+    fprintf(f, "        <Time Value=\"%.12g\"/>\n", w->time_values[time_id]);
+
+  fprintf(f, "        <Topology TopologyType=\"Mixed\""
+          " NumberOfElements=\"%llu\">\n",
+          (unsigned long long)(g->n_g_elements));
+  _write_xmf_data_item(f, w, "          ",
+                       g->connect_size, 1, "Int", g->connect_path);
+  fprintf(f, "        </Topology>\n");
+
+  fprintf(f, "        <Geometry GeometryType=\"XYZ\">\n");
+  _write_xmf_data_item(f, w, "          ",
+                       g->n_g_vertices, 3, "Float", g->coords_path);
+  fprintf(f, "        </Geometry>\n");
+
+  for (int i = 0; i < m->n_fields; i++) {
+
+    const _xdmf_field_t *fd = m->fields + i;
+
+    if (   fd->geom_id != geom_id
+        || (fd->time_id != time_id && fd->time_id != -1))
+      continue;
+
+    const char *attr_type = "Matrix";
+    if (fd->dim == 1)
+      attr_type = "Scalar";
+    else if (fd->dim == 3)
+      attr_type = "Vector";
+    else if (fd->dim == 6)
+      attr_type = "Tensor6";
+    else if (fd->dim == 9)
+      attr_type = "Tensor";
+
+    fprintf(f, "        <Attribute Name=\"");
+    _write_xml_string(f, fd->name);
+    fprintf(f, "\" AttributeType=\"%s\" Center=\"%s\">\n",
+            attr_type, (fd->on_cells) ? "Cell" : "Node");
+    _write_xmf_data_item(f, w, "          ",
+                         (fd->on_cells) ? g->n_g_elements : g->n_g_vertices,
+                         fd->dim, "Float", fd->path);
+    fprintf(f, "        </Attribute>\n");
+
+  }
+
+  fprintf(f, "      </Grid>\n");
+}
+
+/*----------------------------------------------------------------------------
+ * Write XDMF file describing the HDF5 file contents (rank 0 only).
+ *
+ * The whole file is rewritten, so that it is always complete.
+ *
+ * parameters:
+ *   w <-- pointer to writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_xmf(const fvm_to_xdmf_writer_t  *w)
+{
+  if (w->rank > 0)
+    return;
+
+  FILE *f = fopen(w->xmf_filename, "w");
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file:\n"
+                "\"%s\"."), w->xmf_filename);
+
+  bool *has_time = NULL;
+  BFT_MALLOC(has_time, w->n_time_values, bool);
+
+  fprintf(f, "<?xml version=\"1.0\" ?>\n"
+          "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n"
+          "<Xdmf Version=\"3.0\">\n"
+          "  <Domain>\n");
+
+  for (int mesh_id = 0; mesh_id < w->n_meshes; mesh_id++) {
+
+    const _xdmf_mesh_t *m = w->meshes + mesh_id;
+
+    if (m->n_geoms < 1)
+      continue;
+
+    bool is_transient = false;
+
+    for (int t_id = 0; t_id < w->n_time_values; t_id++)
+      has_time[t_id] = false;
+    for (int i = 0; i < m->n_geoms; i++) {
+      if (m->geoms[i].time_id > -1) {
+        has_time[m->geoms[i].time_id] = true;
+        is_transient = true;
+      }
+    }
+    for (int i = 0; i < m->n_fields; i++) {
+      if (m->fields[i].time_id > -1) {
+        has_time[m->fields[i].time_id] = true;
+        is_transient = true;
+      }
+    }
+
+    fprintf(f, "    <Grid Name=\"");
+    _write_xml_string(f, m->name);
+    fprintf(f, "\" GridType=\"Collection\" CollectionType=\"%s\">\n",
+            (is_transient) ? "Temporal" : "Spatial");
+
+    if (is_transient) {
+      int geom_id = -1;
+      for (int t_id = 0; t_id < w->n_time_values; t_id++) {
+        while (   geom_id + 1 < m->n_geoms
+               && m->geoms[geom_id + 1].time_id <= t_id)
+          geom_id++;
+        if (has_time[t_id] && geom_id > -1)
+          _write_xmf_grid(f, w, m, geom_id, t_id);
+      }
+    }
+    else
+      _write_xmf_grid(f, w, m, m->n_geoms - 1, -1);
+
+    fprintf(f, "    </Grid>\n");
+
+  }
+
+  fprintf(f, "  </Domain>\n"
+          "</Xdmf>\n");
+
+  BFT_FREE(has_time);
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error closing file:\n"
+                "\"%s\"."), w->xmf_filename);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with the XDMF format.
+ *
+ * returns:
+ *   number of library version strings associated with the XDMF format.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_xdmf_n_version_strings(void)
+{
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with the XDMF format.
+ *
+ * In certain cases, when using dynamic libraries, fvm may be compiled
+ * with one library version, and linked with another. If both run-time
+ * and compile-time version information is available, this function
+ * will return the run-time version string by default.
+ *
+ * Setting the compile_time flag to 1, the compile-time version string
+ * will be returned if this is different from the run-time version.
+ * If the version is the same, or only one of the 2 version strings are
+ * available, a NULL character string will be returned with this flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_xdmf_version_string(int string_index,
+                           int compile_time_version)
+{
+  const char * retval = NULL;
+
+  if (string_index == 0) {
+
+    unsigned majnum, minnum, relnum;
+
+    H5get_libversion(&majnum, &minnum, &relnum);
+
+    snprintf(_hdf5_version_string[0], 31, "HDF5 %u.%u.%u",
+             majnum, minnum, relnum);
+    snprintf(_hdf5_version_string[1], 31, "HDF5 %d.%d.%d",
+             H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE);
+    _hdf5_version_string[0][31] = '\0';
+    _hdf5_version_string[1][31] = '\0';
+
+    if (compile_time_version) {
+      if (strcmp(_hdf5_version_string[0], _hdf5_version_string[1]) != 0)
+        retval = _hdf5_version_string[1];
+    }
+    else
+      retval = _hdf5_version_string[0];
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to XDMF file writer.
+ *
+ * Options are:
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *   serial_io           write HDF5 data from rank 0 only
+ *   chunk_size=<n>      use chunked datasets with <n> entities per chunk
+ *   gzip                compress datasets with the deflate filter
+ *   gzip=<level>        same, with given compression level (1 to 9)
+ *   shuffle             apply shuffle filter before compression
+ *   lossy_digits=<d>    store field values with error-bounded lossy
+ *                       compression, keeping <d> decimal digits
+ *                       (absolute error <= 0.5*10^-d)
+ *
+ * All meshes, time steps, and fields are written to a single HDF5 file,
+ * described by an XDMF (".xmf") file.
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque XDMF writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm)
+#else
+void *
+fvm_to_xdmf_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_xdmf_writer_t  *w = NULL;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(w, 1, fvm_to_xdmf_writer_t);
+
+  w->time_dependency = time_dependency;
+
+  w->n_time_values = 0;
+  w->time_steps = NULL;
+  w->time_values = NULL;
+  w->time_id = -1;
+
+  w->n_meshes = 0;
+  w->meshes = NULL;
+
+  w->discard_polygons = false;
+  w->discard_polyhedra = false;
+
+  w->chunk_size = 0;
+  w->deflate_level = 0;
+  w->shuffle = false;
+  w->lossy_digits = -1;
+
+  w->modified = false;
+
+  w->file_id = -1;
+
+  w->rank = 0;
+  w->n_ranks = 1;
+
+  w->parallel_io = false;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks, min_rank_step, min_block_size;
+    MPI_Comm w_block_comm, w_comm;
+    w->min_rank_step = 1;
+    w->min_block_size = 1024*1024*8;
+    w->block_comm = MPI_COMM_NULL;
+    w->comm = MPI_COMM_NULL;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      w->comm = comm;
+      MPI_Comm_rank(w->comm, &rank);
+      MPI_Comm_size(w->comm, &n_ranks);
+      w->rank = rank;
+      w->n_ranks = n_ranks;
+      cs_file_get_default_comm(&min_rank_step, &min_block_size,
+                               &w_block_comm, &w_comm);
+      if (comm == w_comm) {
+        w->min_rank_step = min_rank_step;
+        w->min_block_size = min_block_size;
+        w->block_comm = w_block_comm;
+      }
+#if defined(_XDMF_PARALLEL_IO)
+      if (n_ranks > 1)
+        w->parallel_io = true;
+#endif
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Parse options */
+
+  if (options != NULL) {
+
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+
+      for (i2 = i1 ; i2 < l_tot && options[i2] != ' ' ; i2++);
+      l_opt = i2 - i1;
+
+      if (        (l_opt == 16)
+               && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        w->discard_polygons = true;
+
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        w->discard_polyhedra = true;
+
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "serial_io", l_opt) == 0)) {
+        w->parallel_io = false;
+#if defined(HAVE_MPI)
+        w->min_rank_step = w->n_ranks;
+        w->block_comm = MPI_COMM_NULL;
+#endif
+      }
+
+      else if (   (l_opt == 4)
+               && (strncmp(options + i1, "gzip", l_opt) == 0))
+        w->deflate_level = 6;
+
+      else if (strncmp(options + i1, "gzip=", 5) == 0) {
+        int level;
+        if (sscanf(options + i1 + 5, "%d", &level) == 1)
+          w->deflate_level = CS_MIN(CS_MAX(level, 0), 9);
+      }
+
+      else if (   (l_opt == 7)
+               && (strncmp(options + i1, "shuffle", l_opt) == 0))
+        w->shuffle = true;
+
+      else if (strncmp(options + i1, "lossy_digits=", 13) == 0) {
+        int digits;
+        if (sscanf(options + i1 + 13, "%d", &digits) == 1)
+          w->lossy_digits = CS_MAX(digits, 0);
+      }
+
+      else if (strncmp(options + i1, "chunk_size=", 11) == 0) {
+        unsigned long long n;
+        if (sscanf(options + i1 + 11, "%llu", &n) == 1)
+          w->chunk_size = n;
+      }
+
+      for (i1 = i2 + 1 ; i1 < l_tot && options[i1] == ' ' ; i1++);
+
+    }
+
+  }
+
+  /* Writing filtered datasets requires collective I/O support
+     which is only available in recent parallel HDF5 versions */
+
+#if !H5_VERSION_GE(1, 10, 2)
+  if (w->parallel_io && (w->deflate_level > 0 || w->lossy_digits > -1)) {
+    bft_printf(_("\nXDMF writer \"%s\":\n"
+                 "  compression requires HDF5 >= 1.10.2 for parallel I/O;\n"
+                 "  data will be written through rank 0.\n"), name);
+    w->parallel_io = false;
+  }
+#endif
+
+  /* Writer name and file names */
+
+  size_t name_length = strlen(name);
+  if (name_length == 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Empty XDMF filename."));
+
+  BFT_MALLOC(w->name, name_length + 1, char);
+  strcpy(w->name, name);
+
+  for (size_t i = 0; i < name_length; i++) {
+    if (w->name[i] == ' ' || w->name[i] == '\t')
+      w->name[i] = '_';
+  }
+
+  size_t path_length = (path != NULL) ? strlen(path) : 0;
+
+  BFT_MALLOC(w->filename, path_length + name_length + 4, char);
+  BFT_MALLOC(w->xmf_filename, path_length + name_length + 5, char);
+
+  sprintf(w->filename, "%s%s.h5", (path != NULL) ? path : "", w->name);
+  sprintf(w->xmf_filename, "%s%s.xmf", (path != NULL) ? path : "", w->name);
+
+  w->h5_basename = w->filename + path_length;
+
+  /* Return writer */
+
+  return w;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to XDMF file writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque XDMF writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_xdmf_finalize_writer(void  *this_writer_p)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)this_writer_p;
+
+  fvm_to_xdmf_flush(w);
+
+  if (w->file_id >= 0)
+    H5Fclose(w->file_id);
+
+  for (int i = 0; i < w->n_meshes; i++) {
+    _xdmf_mesh_t *m = w->meshes + i;
+    for (int j = 0; j < m->n_geoms; j++) {
+      BFT_FREE(m->geoms[j].coords_path);
+      BFT_FREE(m->geoms[j].connect_path);
+    }
+    for (int j = 0; j < m->n_fields; j++) {
+      BFT_FREE(m->fields[j].name);
+      BFT_FREE(m->fields[j].path);
+    }
+    BFT_FREE(m->geoms);
+    BFT_FREE(m->fields);
+    BFT_FREE(m->name);
+    BFT_FREE(m->h5_name);
+  }
+  BFT_FREE(w->meshes);
+
+  BFT_FREE(w->time_steps);
+  BFT_FREE(w->time_values);
+
+  BFT_FREE(w->xmf_filename);
+  BFT_FREE(w->filename);
+  BFT_FREE(w->name);
+
+  BFT_FREE(w);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an XDMF geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_set_mesh_time(void     *this_writer_p,
+                          int       time_step,
+                          double    time_value)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)this_writer_p;
+
+  w->time_id = _time_id(w, time_step, time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to an XDMF file
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer.
+ *   mesh          <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_nodal(void               *this_writer_p,
+                         const fvm_nodal_t  *mesh)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)this_writer_p;
+
+  _xdmf_mesh_t *m = _get_mesh(w, mesh);
+
+  int time_id = (w->time_dependency == FVM_WRITER_FIXED_MESH) ?
+    -1 : w->time_id;
+  int time_step = (time_id > -1) ? w->time_steps[time_id] : -1;
+
+  /* Reuse previous connectivity if only coordinates change */
+
+  bool write_connect = true;
+  if (w->time_dependency == FVM_WRITER_TRANSIENT_COORDS && m->n_geoms > 0)
+    write_connect = false;
+
+  /* Add or replace geometry */
+
+  bool replace = false;
+  if (m->n_geoms > 0 && m->geoms[m->n_geoms - 1].time_id == time_id)
+    replace = true;
+
+  if (replace == false) {
+    BFT_REALLOC(m->geoms, m->n_geoms + 1, _xdmf_geom_t);
+    _xdmf_geom_t *g = m->geoms + m->n_geoms;
+    g->time_id = time_id;
+    g->coords_path = _dataset_path(m->h5_name, "geometry", time_step,
+                                   "coordinates");
+    if (write_connect)
+      g->connect_path = _dataset_path(m->h5_name, "geometry", time_step,
+                                      "connectivity");
+    else {
+      const _xdmf_geom_t *g_prev = m->geoms + m->n_geoms - 1;
+      BFT_MALLOC(g->connect_path, strlen(g_prev->connect_path) + 1, char);
+      strcpy(g->connect_path, g_prev->connect_path);
+      g->n_g_elements = g_prev->n_g_elements;
+      g->connect_size = g_prev->connect_size;
+    }
+    m->n_geoms += 1;
+  }
+
+  _xdmf_geom_t *g = m->geoms + m->n_geoms - 1;
+
+  /* Build list of sections that are used here, in order of output */
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             true,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  /* Vertex coordinates */
+
+  g->n_g_vertices = fvm_nodal_n_g_vertices(mesh);
+
+  _export_vertex_coords(w, mesh, g->coords_path, g->n_g_vertices, replace);
+
+  /* Element connectivity */
+
+  if (write_connect) {
+    g->n_g_elements = _n_g_elements(export_list);
+    g->connect_size = _export_connect(w, mesh, export_list,
+                                      g->connect_path, replace);
+  }
+
+  BFT_FREE(export_list);
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to an XDMF file.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_export_field(void                   *this_writer_p,
+                         const fvm_nodal_t      *mesh,
+                         const char             *name,
+                         fvm_writer_var_loc_t    location,
+                         int                     dimension,
+                         cs_interlace_t          interlace,
+                         int                     n_parent_lists,
+                         const cs_lnum_t         parent_num_shift[],
+                         cs_datatype_t           datatype,
+                         int                     time_step,
+                         double                  time_value,
+                         const void       *const field_values[])
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)this_writer_p;
+
+  _xdmf_mesh_t *m = _get_mesh(w, mesh);
+
+  if (m->n_geoms < 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Mesh \"%s\" must be written to XDMF file \"%s\"\n"
+                "before associated field \"%s\"."),
+              m->name, w->xmf_filename, name);
+
+  if (   location != FVM_WRITER_PER_NODE
+      && location != FVM_WRITER_PER_ELEMENT)
+    return;
+
+  int time_id = _time_id(w, time_step, time_value);
+  int geom_id = m->n_geoms - 1;
+
+  /* Find or add field record */
+
+  int field_id = -1;
+  for (int i = m->n_fields - 1; i > -1; i--) {
+    const _xdmf_field_t *fd = m->fields + i;
+    if (fd->time_id == time_id && strcmp(fd->name, name) == 0) {
+      field_id = i;
+      break;
+    }
+    else if (fd->time_id > -1 && fd->time_id < time_id)
+      break;
+  }
+
+  bool replace = (field_id > -1) ? true : false;
+
+  if (replace == false) {
+    char *f_name = _h5_name(name);
+    BFT_REALLOC(m->fields, m->n_fields + 1, _xdmf_field_t);
+    field_id = m->n_fields;
+    m->n_fields += 1;
+    _xdmf_field_t *fd = m->fields + field_id;
+    BFT_MALLOC(fd->name, strlen(name) + 1, char);
+    strcpy(fd->name, name);
+    fd->path = _dataset_path(m->h5_name, f_name, time_step, "values");
+    fd->time_id = time_id;
+    BFT_FREE(f_name);
+  }
+
+  _xdmf_field_t *fd = m->fields + field_id;
+
+  fd->dim = dimension;
+  fd->on_cells = (location == FVM_WRITER_PER_ELEMENT) ? true : false;
+  fd->geom_id = geom_id;
+
+  /* Replaced datasets are unlinked once, before block writes */
+
+  if (replace && w->file_id >= 0)
+    _check_status(w, fd->path, H5Ldelete(w->file_id, fd->path, H5P_DEFAULT));
+
+  /* Initialize writer helper */
+
+  const int *comp_order = (dimension == 6) ? _xdmf_c_order_6 : NULL;
+
+  fvm_writer_section_t *export_list
+    = fvm_writer_export_list(mesh,
+                             fvm_nodal_get_max_entity_dim(mesh),
+                             true,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  fvm_writer_field_helper_t *helper
+    = fvm_writer_field_helper_create(mesh,
+                                     export_list,
+                                     dimension,
+                                     CS_INTERLACE,
+                                     CS_DOUBLE,
+                                     location);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1)
+    fvm_writer_field_helper_init_g(helper,
+                                   w->min_rank_step,
+                                   w->min_block_size,
+                                   w->comm);
+
+#endif
+
+  _xdmf_context_t c;
+  c.writer = w;
+  c.path = fd->path;
+
+  /* Per node variable */
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+    c.n_g_ents = m->geoms[geom_id].n_g_vertices;
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     comp_order,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  /* Per element variable */
+
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    const fvm_writer_section_t  *export_section = export_list;
+
+    c.n_g_ents = _n_g_elements(export_list);
+
+    while (export_section != NULL)
+      export_section = fvm_writer_field_helper_output_e(helper,
+                                                        &c,
+                                                        export_section,
+                                                        dimension,
+                                                        interlace,
+                                                        comp_order,
+                                                        n_parent_lists,
+                                                        parent_num_shift,
+                                                        datatype,
+                                                        field_values,
+                                                        _field_output);
+
+  }
+
+  /* Free helper structures */
+
+  fvm_writer_field_helper_destroy(&helper);
+
+  BFT_FREE(export_list);
+
+  w->modified = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * The HDF5 file is flushed, and the XDMF file describing it is updated.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_xdmf_flush(void  *this_writer_p)
+{
+  fvm_to_xdmf_writer_t  *w = (fvm_to_xdmf_writer_t *)this_writer_p;
+
+  if (w->modified == false)
+    return;
+
+  if (w->file_id >= 0)
+    H5Fflush(w->file_id, H5F_SCOPE_GLOBAL);
+
+  _write_xmf(w);
+
+  w->modified = false;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_HDF5 */
@@ -72,6 +72,7 @@
 #include "fvm_to_histogram.h"
 #include "fvm_to_plot.h"
 #include "fvm_to_time_plot.h"
+#include "fvm_to_xdmf.h"
 
 #if defined(HAVE_CATALYST) && !defined(HAVE_PLUGIN_CATALYST)
 #include "fvm_to_catalyst.h"
@@ -107,9 +108,9 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
@@ -421,6 +422,41 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     NULL,
     NULL,
     NULL
+#endif
+  },
+
+  /* XDMF (with HDF5 heavy data) writer */
+  {
+    "XDMF",
+    "3.0",
+    (  FVM_WRITER_FORMAT_USE_EXTERNAL
+     | FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                 /* dynamic library count */
+    NULL,                              /* dynamic library */
+    NULL,                              /* dynamic library name */
+    NULL,                              /* dynamic library prefix */
+#if defined(HAVE_HDF5)
+    fvm_to_xdmf_n_version_strings,     /* n_version_strings_func */
+    fvm_to_xdmf_version_string,        /* version_string_func */
+    fvm_to_xdmf_init_writer,           /* init_func */
+    fvm_to_xdmf_finalize_writer,       /* finalize_func */
+    fvm_to_xdmf_set_mesh_time,         /* set_mesh_time_func */
+    NULL,                              /* needs_tesselation_func */
+    fvm_to_xdmf_export_nodal,          /* export_nodal_func */
+    fvm_to_xdmf_export_field,          /* export_field_func */
+    fvm_to_xdmf_flush                  /* flush_func */
+#else
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
 #endif
   }
 
@@ -840,6 +876,8 @@ fvm_writer_get_format_id(const char  *format_name)
     strcpy(closest_name, "CCM-IO");
   else if (strncmp(tmp_name, "melissa", 7) == 0)
     strcpy(closest_name, "Melissa");
+  else if (strncmp(tmp_name, "xdmf", 4) == 0)
+    strcpy(closest_name, "XDMF");
   else
     strcpy(closest_name, tmp_name);
 
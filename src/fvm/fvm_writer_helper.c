@@ -393,9 +393,27 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
   } while (   current_section != NULL
            && current_section->continues_previous == true);
 
+  /* Build distribution structures, reusing those of previous outputs
+     of this mesh if possible */
+
+  bi = cs_block_dist_compute_sizes(h->rank,
+                                   h->n_ranks,
+                                   h->min_rank_step,
+                                   min_block_size,
+                                   n_g_elements);
+
+  block_size = bi.gnum_range[1] - bi.gnum_range[0];
+
+  d = fvm_nodal_block_dist_get(NULL,
+                               export_section->section,
+                               n_sections,
+                               part_size,
+                               bi,
+                               h->comm);
+
   /* Build global numbering if necessary */
 
-  if (n_sections > 1) {
+  if (n_sections > 1 && d == NULL) {
 
     cs_lnum_t start_id = 0;
     cs_gnum_t gnum_shift = 0;
@@ -428,6 +446,26 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
              && current_section->continues_previous == true);
   }
 
+  if (d == NULL) {
+
+    d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
+
+    if (_g_elt_num != NULL)
+      cs_part_to_block_transfer_gnum(d, _g_elt_num);
+
+    fvm_nodal_block_dist_add(NULL,
+                             export_section->section,
+                             n_sections,
+                             part_size,
+                             bi,
+                             h->comm,
+                             d);
+
+  }
+
+  g_elt_num = NULL;
+  _g_elt_num = NULL;
+
   /* Build sub-element count if necessary */
 
   if (have_tesselation) {
@@ -462,24 +500,6 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
              && current_section->continues_previous == true);
   }
 
-  /* Build distribution structures */
-
-  bi = cs_block_dist_compute_sizes(h->rank,
-                                   h->n_ranks,
-                                   h->min_rank_step,
-                                   min_block_size,
-                                   n_g_elements);
-
-  block_size = bi.gnum_range[1] - bi.gnum_range[0];
-
-  d = cs_part_to_block_create_by_gnum(h->comm, bi, part_size, g_elt_num);
-
-  if (_g_elt_num != NULL)
-    cs_part_to_block_transfer_gnum(d, _g_elt_num);
-
-  g_elt_num = NULL;
-  _g_elt_num = NULL;
-
   /* Distribute sub-element info in case of tesselation */
 
   if (have_tesselation) {
@@ -629,8 +649,6 @@ _field_helper_output_eg(fvm_writer_field_helper_t          *helper,
   BFT_FREE(block_values);
   BFT_FREE(part_values);
 
-  cs_part_to_block_destroy(&d);
-
   if (block_n_sub != NULL)
     BFT_FREE(block_n_sub);
 
@@ -880,14 +898,13 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
 
   /* Initialize distribution info */
 
-  fvm_writer_vertex_part_to_block_create(h->min_rank_step,
-                                         min_block_size,
-                                         helper->n_g_vertices_add,
-                                         helper->n_vertices_add,
-                                         mesh,
-                                         &bi,
-                                         &d,
-                                         h->comm);
+  d = fvm_writer_vertex_part_to_block_get(h->min_rank_step,
+                                          min_block_size,
+                                          helper->n_g_vertices_add,
+                                          helper->n_vertices_add,
+                                          mesh,
+                                          &bi,
+                                          h->comm);
 
   part_size = cs_part_to_block_get_n_part_ents(d);
   block_size = bi.gnum_range[1] - bi.gnum_range[0];
@@ -1014,8 +1031,6 @@ _field_helper_output_ng(fvm_writer_field_helper_t        *helper,
 
   BFT_FREE(block_values);
   BFT_FREE(part_values);
-
-  cs_part_to_block_destroy(&d);
 }
 
 #endif /* defined(HAVE_MPI) */
@@ -1499,6 +1514,75 @@ fvm_writer_vertex_part_to_block_create(int                     min_rank_step,
     *d = _d;
 }
 
+/*----------------------------------------------------------------------------
+ * Return block info and part to block distribution helper for vertices,
+ * using the distributor cached with the mesh if available.
+ *
+ * The returned distributor is owned by the mesh (and shared by all
+ * writers and time steps until the mesh's numbering changes), so it
+ * must not be destroyed by the caller.
+ *
+ * parameters:
+ *   min_rank_step    <-- minimum step between output ranks
+ *   min_block_size   <-- minimum block buffer size
+ *   n_g_add_vertices <-- global number of vertices due to tesselated polyhedra
+ *   n_add_vertices   <-- local number of vertices due to tesselated polyhedra
+ *   mesh             <-- pointer to nodal mesh structure
+ *   bi               --> block information structure
+ *   comm             <-- associated communicator
+ *
+ * returns:
+ *   pointer to part to block distributor
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+fvm_writer_vertex_part_to_block_get(int                     min_rank_step,
+                                    cs_lnum_t               min_block_size,
+                                    cs_gnum_t               n_g_add_vertices,
+                                    cs_lnum_t               n_add_vertices,
+                                    const fvm_nodal_t      *mesh,
+                                    cs_block_dist_info_t   *bi,
+                                    MPI_Comm                comm)
+{
+  int  rank, n_ranks;
+  cs_block_dist_info_t  _bi;
+  cs_part_to_block_t   *d = NULL;
+
+  const cs_lnum_t  n_vertices_tot
+    = fvm_io_num_get_local_count(mesh->global_vertex_num) + n_add_vertices;
+  const cs_gnum_t  n_g_vertices_tot
+    =   fvm_io_num_get_global_count(mesh->global_vertex_num)
+      + n_g_add_vertices;
+
+  MPI_Comm_rank(comm, &rank);
+  MPI_Comm_size(comm, &n_ranks);
+
+  _bi = cs_block_dist_compute_sizes(rank,
+                                    n_ranks,
+                                    min_rank_step,
+                                    min_block_size,
+                                    n_g_vertices_tot);
+
+  d = fvm_nodal_block_dist_get(mesh, NULL, 0, n_vertices_tot, _bi, comm);
+
+  if (d == NULL) {
+    fvm_writer_vertex_part_to_block_create(min_rank_step,
+                                           min_block_size,
+                                           n_g_add_vertices,
+                                           n_add_vertices,
+                                           mesh,
+                                           NULL,
+                                           &d,
+                                           comm);
+    fvm_nodal_block_dist_add(mesh, NULL, 0, n_vertices_tot, _bi, comm, d);
+  }
+
+  if (bi != NULL)
+    *bi = _bi;
+
+  return d;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
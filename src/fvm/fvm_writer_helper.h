@@ -188,6 +188,36 @@ fvm_writer_vertex_part_to_block_create(int                     min_rank_step,
                                        cs_part_to_block_t    **d,
                                        MPI_Comm                comm);
 
+/*----------------------------------------------------------------------------
+ * Return block info and part to block distribution helper for vertices,
+ * using the distributor cached with the mesh if available.
+ *
+ * The returned distributor is owned by the mesh (and shared by all
+ * writers and time steps until the mesh's numbering changes), so it
+ * must not be destroyed by the caller.
+ *
+ * parameters:
+ *   min_rank_step    <-- minimum step between output ranks
+ *   min_block_size   <-- minimum block buffer size
+ *   n_g_add_vertices <-- global number of vertices due to tesselated polyhedra
+ *   n_add_vertices   <-- local number of vertices due to tesselated polyhedra
+ *   mesh             <-- pointer to nodal mesh structure
+ *   bi               --> block information structure
+ *   comm             <-- associated communicator
+ *
+ * returns:
+ *   pointer to part to block distributor
+ *----------------------------------------------------------------------------*/
+
+cs_part_to_block_t *
+fvm_writer_vertex_part_to_block_get(int                     min_rank_step,
+                                    cs_lnum_t               min_block_size,
+                                    cs_gnum_t               n_g_add_vertices,
+                                    cs_lnum_t               n_add_vertices,
+                                    const fvm_nodal_t      *mesh,
+                                    cs_block_dist_info_t   *bi,
+                                    MPI_Comm                comm);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
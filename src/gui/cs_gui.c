@@ -62,6 +62,7 @@
 #include "fvm_selector.h"
 
 #include "mei_evaluate.h"
+#include "mei_bytecode.h"
 
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
@@ -418,47 +419,74 @@ _physical_property(const char       *param,
         bft_error(__FILE__, __LINE__, 0,
                   _("Error: can not find the required symbol: %s\n"), symbol);
 
-      /* for each cell, update the value of the table of symbols for each scalar
-         (including the thermal scalar), and evaluate the interpreter */
+      /* evaluate the compiled interpreter for all cells, with values of
+         each scalar (including the thermal scalar) as inputs */
 
       cs_field_t *c_cp = CS_F_(cp);
       cs_field_t *c_rho = CS_F_(rho);
       cs_field_t *c_t = CS_F_(t);
 
-      for (iel = 0; iel < ncel; iel++) {
+      const int n_fields = cs_field_n_fields();
 
-        mei_tree_insert(ev_law, "x", cell_cen[iel][0]);
-        mei_tree_insert(ev_law, "y", cell_cen[iel][1]);
-        mei_tree_insert(ev_law, "z", cell_cen[iel][2]);
-        for (int f_id = 0; f_id < cs_field_n_fields(); f_id++) {
-          cs_field_t  *f = cs_field_by_id(f_id);
-          if (f->type & CS_FIELD_USER)
-            mei_tree_insert(ev_law, f->name, f->val[iel]);
+      int n_inputs = 0;
+      const char **input_names;
+      const cs_real_t **input_vals;
+      int *input_strides;
+      BFT_MALLOC(input_names, n_fields + 6, const char *);
+      BFT_MALLOC(input_vals, n_fields + 6, const cs_real_t *);
+      BFT_MALLOC(input_strides, n_fields + 6, int);
+
+      for (i = 0; i < 3; i++) {
+        const char *coo_names[] = {"x", "y", "z"};
+        input_names[n_inputs] = coo_names[i];
+        input_vals[n_inputs] = (const cs_real_t *)cell_cen + i;
+        input_strides[n_inputs++] = 3;
+      }
+      for (int f_id = 0; f_id < n_fields; f_id++) {
+        cs_field_t  *f = cs_field_by_id(f_id);
+        if (f->type & CS_FIELD_USER) {
+          input_names[n_inputs] = f->name;
+          input_vals[n_inputs] = f->val;
+          input_strides[n_inputs++] = 1;
         }
+      }
+      if (fth != NULL) {
+        input_names[n_inputs] = fth->name;
+        input_vals[n_inputs] = fth->val;
+        input_strides[n_inputs++] = 1;
+      }
+      if (cs_gui_strcmp(param, "molecular_viscosity")) {
+        input_names[n_inputs] = "rho";
+        input_vals[n_inputs] = c_rho->val;
+        input_strides[n_inputs++] = 1;
+        if (cs_gui_strcmp(vars->model, "compressible_model")) {
+          input_names[n_inputs] = "T";
+          input_vals[n_inputs] = c_t->val;
+          input_strides[n_inputs++] = 1;
+        }
+      }
 
-        if (fth != NULL)
-          mei_tree_insert(ev_law, fth->name, fth->val[iel]);
+      const char *output_names[] = {symbol};
+      cs_real_t *output_vals[] = {values};
+      const int output_strides[] = {1};
 
-        if (cs_gui_strcmp(param, "molecular_viscosity")) {
-          mei_tree_insert(ev_law, "rho", c_rho->val[iel]);
-          if (cs_gui_strcmp(vars->model, "compressible_model"))
-            mei_tree_insert(ev_law, "T", c_t->val[iel]);
-          }
+      mei_bytecode_t *bc_law = mei_bytecode_create(ev_law,
+                                                   n_inputs, input_names,
+                                                   1, output_names);
+      mei_bytecode_evaluate(bc_law, ncel, NULL,
+                            input_vals, input_strides,
+                            output_vals, output_strides);
+      mei_bytecode_destroy(bc_law);
 
-        mei_evaluate(ev_law);
+      BFT_FREE(input_names);
+      BFT_FREE(input_vals);
+      BFT_FREE(input_strides);
 
-        if (cs_gui_strcmp(param, "thermal_conductivity")) {
-          const cs_thermal_model_t  *tm = cs_glob_thermal_model;
-          if (tm->itherm == CS_THERMAL_MODEL_TEMPERATURE)
-            values[iel] = mei_tree_lookup(ev_law, symbol);
-          else if (icp > 0)
-            values[iel] = mei_tree_lookup(ev_law, symbol) / c_cp->val[iel];
-          else
-            values[iel] = mei_tree_lookup(ev_law, symbol) / cp0;
-        }
-        else {
-          values[iel] = mei_tree_lookup(ev_law, symbol);
-        }
+      /* for the Temperature, the diffusivity factor is not divided by Cp */
+      if (   cs_gui_strcmp(param, "thermal_conductivity")
+          && itherm != CS_THERMAL_MODEL_TEMPERATURE) {
+        for (iel = 0; iel < ncel; iel++)
+          values[iel] /= (icp > 0) ? c_cp->val[iel] : cp0;
       }
 
       mei_tree_destroy(ev_law);
@@ -1626,6 +1654,52 @@ _init_mei_tree(const char  *formula,
   return tree;
 }
 
+/*-----------------------------------------------------------------------------
+ * Evaluate a mei formula at selected cells, using cell center coordinates
+ * as "x", "y", and "z" symbols.
+ *
+ * The formula is compiled, so as to be evaluated over all cells together.
+ *
+ * parameters:
+ *   ev             <--  mei interpreter
+ *   n_cells        <--  number of selected cells
+ *   cell_ids       <--  ids of selected cells, or NULL
+ *   n_outputs      <--  number of output symbols
+ *   output_names   <--  names of output symbols
+ *   output_vals    -->  output values, indexed by cell id
+ *   output_strides <--  strides of output values
+ *----------------------------------------------------------------------------*/
+
+static void
+_evaluate_at_cells(mei_tree_t       *ev,
+                   cs_lnum_t         n_cells,
+                   const cs_lnum_t   cell_ids[],
+                   int               n_outputs,
+                   const char       *output_names[],
+                   cs_real_t        *output_vals[],
+                   const int         output_strides[])
+{
+  const cs_real_t *cell_cen = cs_glob_mesh_quantities->cell_cen;
+
+  const char *input_names[] = {"x", "y", "z"};
+  const cs_real_t *input_vals[] = {cell_cen, cell_cen + 1, cell_cen + 2};
+  const int input_strides[] = {3, 3, 3};
+
+  mei_bytecode_t *bc = mei_bytecode_create(ev,
+                                           3, input_names,
+                                           n_outputs, output_names);
+
+  mei_bytecode_evaluate(bc,
+                        n_cells,
+                        cell_ids,
+                        input_vals,
+                        input_strides,
+                        output_vals,
+                        output_strides);
+
+  mei_bytecode_destroy(bc);
+}
+
 /*----------------------------------------------------------------------------
  * Get label of 1D profile file name
  *
@@ -3684,8 +3758,6 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                               int                *iccfth)
 {
   /* Coal combustion: the initialization of the model scalar are not given */
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->cell_cen;
 
   int ccfth             = 0;
   char *path            = NULL;
@@ -3743,17 +3815,10 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                       _("Error: can not find the required symbol: %s\n"),
                       "velocity[0], velocity[1] ou velocity[2]");
 
-          for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-            cs_lnum_t iel = cell_ids[icel];
-            mei_tree_insert(ev_formula_uvw, "x", cell_cen[iel][0]);
-            mei_tree_insert(ev_formula_uvw, "y", cell_cen[iel][1]);
-            mei_tree_insert(ev_formula_uvw, "z", cell_cen[iel][2]);
-            mei_tree_insert(ev_formula_uvw, "uref", cs_glob_turb_ref_values->uref);
-            mei_evaluate(ev_formula_uvw);
-            c_vel->val[3 * iel    ] = mei_tree_lookup(ev_formula_uvw, "velocity[0]");
-            c_vel->val[3 * iel + 1] = mei_tree_lookup(ev_formula_uvw, "velocity[1]");
-            c_vel->val[3 * iel + 2] = mei_tree_lookup(ev_formula_uvw, "velocity[2]");
-          }
+          cs_real_t *vals_uvw[] = {c_vel->val, c_vel->val + 1, c_vel->val + 2};
+          const int strides_uvw[] = {3, 3, 3};
+          _evaluate_at_cells(ev_formula_uvw, n_cells, cell_ids,
+                             3, symbols_uvw, vals_uvw, strides_uvw);
           mei_tree_destroy(ev_formula_uvw);
         }
         else {
@@ -3783,14 +3848,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
           formula = cs_gui_get_text_value(path);
           if (formula != NULL) {
             ev_formula = _init_mei_tree(formula, "H");
-            for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-              cs_lnum_t iel = cell_ids[icel];
-              mei_tree_insert(ev_formula, "x", cell_cen[iel][0]);
-              mei_tree_insert(ev_formula, "y", cell_cen[iel][1]);
-              mei_tree_insert(ev_formula, "z", cell_cen[iel][2]);
-              mei_evaluate(ev_formula);
-              c->val[iel] = mei_tree_lookup(ev_formula, "H");
-            }
+            const char *symbols[] = {"H"};
+            cs_real_t *vals[] = {c->val};
+            const int strides[] = {1};
+            _evaluate_at_cells(ev_formula, n_cells, cell_ids,
+                               1, symbols, vals, strides);
             mei_tree_destroy(ev_formula);
           }
           BFT_FREE(formula);
@@ -3849,15 +3911,10 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
               cs_field_t *c_k   = cs_field_by_name("k");
               cs_field_t *c_eps = cs_field_by_name("epsilon");
 
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_turb);
-                c_k->val[iel]   = mei_tree_lookup(ev_formula_turb, "k");
-                c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-              }
+              cs_real_t *vals[] = {c_k->val, c_eps->val};
+              const int strides[] = {1, 1};
+              _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                 2, symbols, vals, strides);
             }
 
             else if (   cs_gui_strcmp(model, "Rij-epsilon")
@@ -3873,20 +3930,14 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
               cs_field_t *c_eps = cs_field_by_name("epsilon");
 
               if (c_rij != NULL) {
-                for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                  cs_lnum_t iel = cell_ids[icel];
-                  mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                  mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                  mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                  mei_evaluate(ev_formula_turb);
-                  c_rij->val[iel*6]   = mei_tree_lookup(ev_formula_turb, "r11");
-                  c_rij->val[iel*6+1] = mei_tree_lookup(ev_formula_turb, "r22");
-                  c_rij->val[iel*6+2] = mei_tree_lookup(ev_formula_turb, "r33");
-                  c_rij->val[iel*6+3] = mei_tree_lookup(ev_formula_turb, "r12");
-                  c_rij->val[iel*6+4] = mei_tree_lookup(ev_formula_turb, "r23");
-                  c_rij->val[iel*6+5] = mei_tree_lookup(ev_formula_turb, "r13");
-                  c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-                }
+                /* symbols r13 and r23 match components 5 and 4 */
+                cs_real_t *vals[] = {c_rij->val, c_rij->val + 1,
+                                     c_rij->val + 2, c_rij->val + 3,
+                                     c_rij->val + 5, c_rij->val + 4,
+                                     c_eps->val};
+                const int strides[] = {6, 6, 6, 6, 6, 6, 1};
+                _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                   7, symbols, vals, strides);
               }
               else {
                 cs_field_t *c_r11 = cs_field_by_name("r11");
@@ -3896,20 +3947,12 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                 cs_field_t *c_r13 = cs_field_by_name("r13");
                 cs_field_t *c_r23 = cs_field_by_name("r23");
 
-                for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                  cs_lnum_t iel = cell_ids[icel];
-                  mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                  mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                  mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                  mei_evaluate(ev_formula_turb);
-                  c_r11->val[iel] = mei_tree_lookup(ev_formula_turb, "r11");
-                  c_r22->val[iel] = mei_tree_lookup(ev_formula_turb, "r22");
-                  c_r33->val[iel] = mei_tree_lookup(ev_formula_turb, "r33");
-                  c_r12->val[iel] = mei_tree_lookup(ev_formula_turb, "r12");
-                  c_r13->val[iel] = mei_tree_lookup(ev_formula_turb, "r13");
-                  c_r23->val[iel] = mei_tree_lookup(ev_formula_turb, "r23");
-                  c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-                }
+                cs_real_t *vals[] = {c_r11->val, c_r22->val, c_r33->val,
+                                     c_r12->val, c_r13->val, c_r23->val,
+                                     c_eps->val};
+                const int strides[] = {1, 1, 1, 1, 1, 1, 1};
+                _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                   7, symbols, vals, strides);
               }
             }
 
@@ -3926,21 +3969,14 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
               cs_field_t *c_alp = cs_field_by_name("alpha");
 
               if (c_rij != NULL) {
-                for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                  cs_lnum_t iel = cell_ids[icel];
-                  mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                  mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                  mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                  mei_evaluate(ev_formula_turb);
-                  c_rij->val[iel*6]   = mei_tree_lookup(ev_formula_turb, "r11");
-                  c_rij->val[iel*6+1] = mei_tree_lookup(ev_formula_turb, "r22");
-                  c_rij->val[iel*6+2] = mei_tree_lookup(ev_formula_turb, "r33");
-                  c_rij->val[iel*6+3] = mei_tree_lookup(ev_formula_turb, "r12");
-                  c_rij->val[iel*6+4] = mei_tree_lookup(ev_formula_turb, "r23");
-                  c_rij->val[iel*6+5] = mei_tree_lookup(ev_formula_turb, "r13");
-                  c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-                  c_alp->val[iel] = mei_tree_lookup(ev_formula_turb, "alpha");
-                }
+                /* symbols r13 and r23 match components 5 and 4 */
+                cs_real_t *vals[] = {c_rij->val, c_rij->val + 1,
+                                     c_rij->val + 2, c_rij->val + 3,
+                                     c_rij->val + 5, c_rij->val + 4,
+                                     c_eps->val, c_alp->val};
+                const int strides[] = {6, 6, 6, 6, 6, 6, 1, 1};
+                _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                   8, symbols, vals, strides);
               }
               else {
                 cs_field_t *c_r11 = cs_field_by_name("r11");
@@ -3950,21 +3986,12 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                 cs_field_t *c_r13 = cs_field_by_name("r13");
                 cs_field_t *c_r23 = cs_field_by_name("r23");
 
-                for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                  cs_lnum_t iel = cell_ids[icel];
-                  mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                  mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                  mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                  mei_evaluate(ev_formula_turb);
-                  c_r11->val[iel] = mei_tree_lookup(ev_formula_turb, "r11");
-                  c_r22->val[iel] = mei_tree_lookup(ev_formula_turb, "r22");
-                  c_r33->val[iel] = mei_tree_lookup(ev_formula_turb, "r33");
-                  c_r12->val[iel] = mei_tree_lookup(ev_formula_turb, "r12");
-                  c_r13->val[iel] = mei_tree_lookup(ev_formula_turb, "r13");
-                  c_r23->val[iel] = mei_tree_lookup(ev_formula_turb, "r23");
-                  c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-                  c_alp->val[iel] = mei_tree_lookup(ev_formula_turb, "alpha");
-                }
+                cs_real_t *vals[] = {c_r11->val, c_r22->val, c_r33->val,
+                                     c_r12->val, c_r13->val, c_r23->val,
+                                     c_eps->val, c_alp->val};
+                const int strides[] = {1, 1, 1, 1, 1, 1, 1, 1};
+                _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                   8, symbols, vals, strides);
               }
             }
 
@@ -3980,17 +4007,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
               cs_field_t *c_phi = cs_field_by_name("phi");
               cs_field_t *c_alp = cs_field_by_name("alpha");
 
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_turb);
-                c_k->val[iel]   = mei_tree_lookup(ev_formula_turb, "k");
-                c_eps->val[iel] = mei_tree_lookup(ev_formula_turb, "epsilon");
-                c_phi->val[iel] = mei_tree_lookup(ev_formula_turb, "phi");
-                c_alp->val[iel] = mei_tree_lookup(ev_formula_turb, "alpha");
-              }
+              cs_real_t *vals[] = {c_k->val, c_eps->val,
+                                   c_phi->val, c_alp->val};
+              const int strides[] = {1, 1, 1, 1};
+              _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                 4, symbols, vals, strides);
             }
 
             else if (cs_gui_strcmp(model, "k-omega-SST")) {
@@ -4003,15 +4024,10 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
               cs_field_t *c_k   = cs_field_by_name("k");
               cs_field_t *c_ome = cs_field_by_name("omega");
 
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_turb);
-                c_k->val[iel]   = mei_tree_lookup(ev_formula_turb, "k");
-                c_ome->val[iel] = mei_tree_lookup(ev_formula_turb, "omega");
-              }
+              cs_real_t *vals[] = {c_k->val, c_ome->val};
+              const int strides[] = {1, 1};
+              _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                 2, symbols, vals, strides);
             }
 
             else if (cs_gui_strcmp(model, "Spalart-Allmaras")) {
@@ -4023,14 +4039,10 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
 
               cs_field_t *c_nu = cs_field_by_name("nu_tilda");
 
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_turb, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_turb, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_turb, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_turb);
-                c_nu->val[iel] = mei_tree_lookup(ev_formula_turb, "nu_tilda");
-              }
+              cs_real_t *vals[] = {c_nu->val};
+              const int strides[] = {1};
+              _evaluate_at_cells(ev_formula_turb, n_cells, cell_ids,
+                                 1, symbols, vals, strides);
             }
 
             else
@@ -4088,14 +4100,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                       c->name);
 
           if (*isuite == 0) {
-            for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-              cs_lnum_t iel = cell_ids[icel];
-              mei_tree_insert(ev_formula_sca, "x", cell_cen[iel][0]);
-              mei_tree_insert(ev_formula_sca, "y", cell_cen[iel][1]);
-              mei_tree_insert(ev_formula_sca, "z", cell_cen[iel][2]);
-              mei_evaluate(ev_formula_sca);
-              c->val[iel] = mei_tree_lookup(ev_formula_sca, c->name);
-            }
+            const char *symbols[] = {c->name};
+            cs_real_t *vals[] = {c->val};
+            const int strides[] = {1};
+            _evaluate_at_cells(ev_formula_sca, n_cells, cell_ids,
+                               1, symbols, vals, strides);
           }
           mei_tree_destroy(ev_formula_sca);
         } else {
@@ -4150,14 +4159,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                         f->name);
 
             if (*isuite == 0) {
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_sca, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_sca, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_sca, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_sca);
-                f->val[iel] = mei_tree_lookup(ev_formula_sca, f->name);
-              }
+              const char *symbols[] = {f->name};
+              cs_real_t *vals[] = {f->val};
+              const int strides[] = {1};
+              _evaluate_at_cells(ev_formula_sca, n_cells, cell_ids,
+                                 1, symbols, vals, strides);
             }
             mei_tree_destroy(ev_formula_sca);
           }
@@ -4219,14 +4225,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
                         name);
 
             if (*isuite == 0) {
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula_meteo, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula_meteo, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula_meteo, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula_meteo);
-                c->val[iel] = mei_tree_lookup(ev_formula_meteo, name);
-              }
+              const char *symbols[] = {name};
+              cs_real_t *vals[] = {c->val};
+              const int strides[] = {1};
+              _evaluate_at_cells(ev_formula_meteo, n_cells, cell_ids,
+                                 1, symbols, vals, strides);
             }
             mei_tree_destroy(ev_formula_meteo);
           }
@@ -4281,14 +4284,11 @@ void CS_PROCF(uiiniv, UIINIV)(const int          *isuite,
             formula = cs_gui_get_text_value(path1);
             ev_formula = _init_mei_tree(formula, name[j]);
             if (*isuite == 0) {
-              for (cs_lnum_t icel = 0; icel < n_cells; icel++) {
-                cs_lnum_t iel = cell_ids[icel];
-                mei_tree_insert(ev_formula, "x", cell_cen[iel][0]);
-                mei_tree_insert(ev_formula, "y", cell_cen[iel][1]);
-                mei_tree_insert(ev_formula, "z", cell_cen[iel][2]);
-                mei_evaluate(ev_formula);
-                c->val[iel] = mei_tree_lookup(ev_formula, name[j]);
-              }
+              const char *symbols[] = {name[j]};
+              cs_real_t *vals[] = {c->val};
+              const int strides[] = {1};
+              _evaluate_at_cells(ev_formula, n_cells, cell_ids,
+                                 1, symbols, vals, strides);
             }
             mei_tree_destroy(ev_formula);
           }
@@ -0,0 +1,1239 @@
+/*!
+ * \file mei_bytecode.c
+ *
+ * \brief Compiled evaluation of an interpreter over arrays of points
+ */
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_error.h"
+
+#include "mei_hash_table.h"
+#include "mei_node.h"
+#include "mei_evaluate.h"
+#include "mei_parser.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "mei_bytecode.h"
+
+/*----------------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*----------------------------------------------------------------------------
+ * Local macro definitions
+ *----------------------------------------------------------------------------*/
+
+/*!
+ * \brief Number of points handled by each instruction at a time.
+ */
+
+#define MEI_BYTECODE_CHUNK_SIZE 64
+
+/*!
+ * \brief Mask value for code which is never executed.
+ */
+
+#define MEI_BYTECODE_DEAD_MASK -2
+
+/*=============================================================================
+ * Specific pragmas to disable some unrelevant warnings
+ *============================================================================*/
+
+/* Globally disable warning on float-comparisons (equality) for GCC and Intel
+   compilers as we do it on purpose (same as the interpreter). */
+
+#if defined(__GNUC__) && !defined(__ICC)
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#elif defined(__ICC)
+#pragma warning disable 1572
+#endif
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*!
+ * \brief Bytecode operations
+ */
+
+typedef enum {
+
+  MEI_BC_CONST,    /* constant value */
+  MEI_BC_SYMBOL,   /* symbol table value, read once per evaluation */
+  MEI_BC_INPUT,    /* array-valued input symbol */
+
+  MEI_BC_NEG,
+  MEI_BC_NOT,
+  MEI_BC_SQRT,
+  MEI_BC_ABS,
+  MEI_BC_FUNC1,    /* other function of one argument */
+
+  MEI_BC_ADD,
+  MEI_BC_SUB,
+  MEI_BC_MUL,
+  MEI_BC_DIV,
+  MEI_BC_POW,
+  MEI_BC_LT,
+  MEI_BC_GT,
+  MEI_BC_LE,
+  MEI_BC_GE,
+  MEI_BC_EQ,
+  MEI_BC_NE,
+  MEI_BC_AND,
+  MEI_BC_OR,
+  MEI_BC_MIN,
+  MEI_BC_MAX,
+  MEI_BC_FUNC2,    /* other function of two arguments */
+
+  MEI_BC_SELECT    /* a ? b : c */
+
+} _mei_bc_op_t;
+
+/*!
+ * \brief Bytecode instruction
+ *
+ * Each instruction defines a new register, whose id is that of the
+ * instruction. Operands refer to previous registers.
+ */
+
+typedef struct {
+
+  _mei_bc_op_t    op;        /* operation */
+  bool            varying;   /* true if values differ between points */
+
+  int             a;         /* first operand, or -1 */
+  int             b;         /* second operand, or -1 */
+  int             c;         /* third operand, or -1 */
+  int             mask;      /* register of points for which the operation
+                                is executed, or -1 for all points */
+
+  int             id;        /* input id for MEI_BC_INPUT */
+  double          value;     /* value for MEI_BC_CONST */
+  const double   *p_value;   /* pointer to value for MEI_BC_SYMBOL */
+  func1_t         f1;        /* function for MEI_BC_FUNC1 */
+  func2_t         f2;        /* function for MEI_BC_FUNC2 */
+
+} _mei_bc_instr_t;
+
+/*!
+ * \brief Bytecode builder
+ */
+
+typedef struct {
+
+  int                n_instr;      /* number of instructions */
+  int                n_instr_max;  /* allocated instructions */
+  _mei_bc_instr_t   *instr;        /* instructions */
+
+  int                n_syms;       /* number of mapped symbols */
+  int                n_syms_max;   /* allocated mapped symbols */
+  const char       **sym_names;    /* names of mapped symbols */
+  int               *sym_regs;     /* current register of mapped symbols */
+
+  int                n_inputs;     /* number of input symbols */
+  const char       **input_names;  /* names of input symbols */
+
+  hash_table_t      *symbol;       /* table of symbols */
+
+  bool               unsupported;  /* true if the expression can not be
+                                      compiled */
+
+} _mei_bc_builder_t;
+
+/*!
+ * \brief Compiled interpreter
+ */
+
+struct _mei_bytecode_t {
+
+  mei_tree_t        *ev;           /* associated interpreter */
+  bool               compiled;     /* false if the interpreter is used */
+
+  int                n_inputs;     /* number of input symbols */
+  char             **input_names;  /* names of input symbols */
+  int                n_outputs;    /* number of output symbols */
+  char             **output_names; /* names of output symbols */
+
+  int                n_instr;      /* number of instructions */
+  _mei_bc_instr_t   *instr;        /* instructions */
+  int               *output_reg;   /* register of each output */
+
+  int                n_slots;      /* number of chunk-sized register slots */
+  int               *slot;         /* slot of each register used by varying
+                                      instructions, or -1 */
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply an instruction to a set of points.
+ *
+ * \param [in]  ins  instruction
+ * \param [in]  n    number of points
+ * \param [out] d    result values
+ * \param [in]  a    first operand values, or NULL
+ * \param [in]  b    second operand values, or NULL
+ * \param [in]  c    third operand values, or NULL
+ * \param [in]  m    mask values, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_execute(const _mei_bc_instr_t  *ins,
+         cs_lnum_t               n,
+         double                 *restrict d,
+         const double           *a,
+         const double           *b,
+         const double           *c,
+         const double           *m)
+{
+  /* Masked operations are only computed for active points, so that
+     operations which may raise floating-point exceptions are not
+     applied to values the interpreter would not have evaluated */
+
+#define _MEI_BC_LOOP(_expr) \
+  if (m == NULL) { \
+    for (cs_lnum_t j = 0; j < n; j++) \
+      d[j] = (_expr); \
+  } \
+  else { \
+    for (cs_lnum_t j = 0; j < n; j++) \
+      d[j] = (m[j] != 0) ? (_expr) : 0; \
+  }
+
+  switch(ins->op) {
+
+  case MEI_BC_CONST:
+    for (cs_lnum_t j = 0; j < n; j++)
+      d[j] = ins->value;
+    break;
+
+  case MEI_BC_SYMBOL:
+    for (cs_lnum_t j = 0; j < n; j++)
+      d[j] = *(ins->p_value);
+    break;
+
+  case MEI_BC_INPUT:
+    assert(0); /* handled by caller */
+    break;
+
+  case MEI_BC_NEG:
+    _MEI_BC_LOOP(-a[j]);
+    break;
+  case MEI_BC_NOT:
+    _MEI_BC_LOOP(!a[j]);
+    break;
+  case MEI_BC_SQRT:
+    _MEI_BC_LOOP(sqrt(a[j]));
+    break;
+  case MEI_BC_ABS:
+    _MEI_BC_LOOP(fabs(a[j]));
+    break;
+  case MEI_BC_FUNC1:
+    _MEI_BC_LOOP(ins->f1(a[j]));
+    break;
+
+  case MEI_BC_ADD:
+    _MEI_BC_LOOP(a[j] + b[j]);
+    break;
+  case MEI_BC_SUB:
+    _MEI_BC_LOOP(a[j] - b[j]);
+    break;
+  case MEI_BC_MUL:
+    _MEI_BC_LOOP(a[j] * b[j]);
+    break;
+
+  case MEI_BC_DIV:
+    {
+      cs_lnum_t n_zero = 0;
+      for (cs_lnum_t j = 0; j < n; j++) {
+        if (b[j] == 0 && (m == NULL || m[j] != 0))
+          n_zero++;
+      }
+      if (n_zero > 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("Error: floating point exception\n"));
+      _MEI_BC_LOOP(a[j] / b[j]);
+    }
+    break;
+
+  case MEI_BC_POW:
+    _MEI_BC_LOOP(pow(a[j], b[j]));
+    break;
+  case MEI_BC_LT:
+    _MEI_BC_LOOP(a[j] < b[j]);
+    break;
+  case MEI_BC_GT:
+    _MEI_BC_LOOP(a[j] > b[j]);
+    break;
+  case MEI_BC_LE:
+    _MEI_BC_LOOP(a[j] <= b[j]);
+    break;
+  case MEI_BC_GE:
+    _MEI_BC_LOOP(a[j] >= b[j]);
+    break;
+  case MEI_BC_EQ:
+    _MEI_BC_LOOP(a[j] == b[j]);
+    break;
+  case MEI_BC_NE:
+    _MEI_BC_LOOP(a[j] != b[j]);
+    break;
+  case MEI_BC_AND:
+    _MEI_BC_LOOP(a[j] != 0 && b[j] != 0);
+    break;
+  case MEI_BC_OR:
+    _MEI_BC_LOOP(a[j] != 0 || b[j] != 0);
+    break;
+  case MEI_BC_MIN:
+    _MEI_BC_LOOP(fmin(a[j], b[j]));
+    break;
+  case MEI_BC_MAX:
+    _MEI_BC_LOOP(fmax(a[j], b[j]));
+    break;
+  case MEI_BC_FUNC2:
+    _MEI_BC_LOOP(ins->f2(a[j], b[j]));
+    break;
+
+  case MEI_BC_SELECT:
+    for (cs_lnum_t j = 0; j < n; j++)
+      d[j] = (a[j] != 0) ? b[j] : c[j];
+    break;
+
+  }
+
+#undef _MEI_BC_LOOP
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return an instruction with given operation and operands.
+ *
+ * \param [in] op    operation
+ * \param [in] a     first operand, or -1
+ * \param [in] b     second operand, or -1
+ * \param [in] c     third operand, or -1
+ * \param [in] mask  mask register, or -1
+ * \return instruction
+ */
+/*----------------------------------------------------------------------------*/
+
+static _mei_bc_instr_t
+_instr(_mei_bc_op_t  op,
+       int           a,
+       int           b,
+       int           c,
+       int           mask)
+{
+  _mei_bc_instr_t ins = {.op = op, .varying = false,
+                         .a = a, .b = b, .c = c, .mask = mask,
+                         .id = -1, .value = 0, .p_value = NULL,
+                         .f1 = NULL, .f2 = NULL};
+
+  return ins;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append an instruction to a builder, folding constants.
+ *
+ * \param [in, out] bb   bytecode builder
+ * \param [in]      ins  instruction
+ * \return register holding the result
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_emit(_mei_bc_builder_t  *bb,
+      _mei_bc_instr_t     ins)
+{
+  const _mei_bc_instr_t *instr = bb->instr;
+
+  const int opnd[4] = {ins.a, ins.b, ins.c, ins.mask};
+
+  if (ins.op > MEI_BC_INPUT) {
+
+    /* Constant masks */
+
+    if (ins.mask > -1 && instr[ins.mask].op == MEI_BC_CONST) {
+      if (instr[ins.mask].value != 0)
+        ins.mask = -1;
+      else
+        return _emit(bb, _instr(MEI_BC_CONST, -1, -1, -1, -1));
+    }
+
+    /* Selection with a constant condition */
+
+    if (ins.op == MEI_BC_SELECT && instr[ins.a].op == MEI_BC_CONST)
+      return (instr[ins.a].value != 0) ? ins.b : ins.c;
+
+    /* Constant folding */
+
+    bool is_const = true;
+    for (int i = 0; i < 3; i++) {
+      if (opnd[i] > -1 && instr[opnd[i]].op != MEI_BC_CONST)
+        is_const = false;
+    }
+    if (ins.op == MEI_BC_DIV && is_const && instr[ins.b].value == 0)
+      is_const = false; /* keep error for evaluation */
+
+    if (is_const) {
+      double v[3] = {0, 0, 0};
+      for (int i = 0; i < 3; i++) {
+        if (opnd[i] > -1)
+          v[i] = instr[opnd[i]].value;
+      }
+      _mei_bc_instr_t c_ins = _instr(MEI_BC_CONST, -1, -1, -1, -1);
+      _execute(&ins, 1, &(c_ins.value), v, v+1, v+2, NULL);
+      return _emit(bb, c_ins);
+    }
+
+  }
+
+  /* Values differ between points if any operand or mask does */
+
+  ins.varying = (ins.op == MEI_BC_INPUT) ? true : false;
+  for (int i = 0; i < 4; i++) {
+    if (opnd[i] > -1 && instr[opnd[i]].varying)
+      ins.varying = true;
+  }
+
+  if (bb->n_instr >= bb->n_instr_max) {
+    bb->n_instr_max = (bb->n_instr_max > 0) ? bb->n_instr_max*2 : 16;
+    BFT_REALLOC(bb->instr, bb->n_instr_max, _mei_bc_instr_t);
+  }
+
+  bb->instr[bb->n_instr] = ins;
+  bb->n_instr += 1;
+
+  return bb->n_instr - 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append a constant to a builder.
+ *
+ * \param [in, out] bb     bytecode builder
+ * \param [in]      value  constant value
+ * \return register holding the constant
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_emit_const(_mei_bc_builder_t  *bb,
+            double              value)
+{
+  _mei_bc_instr_t ins = _instr(MEI_BC_CONST, -1, -1, -1, -1);
+  ins.value = value;
+
+  return _emit(bb, ins);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a register with a symbol.
+ *
+ * \param [in, out] bb    bytecode builder
+ * \param [in]      name  name of the symbol
+ * \param [in]      reg   register holding the symbol's current value
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_symbol_reg(_mei_bc_builder_t  *bb,
+                const char         *name,
+                int                 reg)
+{
+  for (int i = 0; i < bb->n_syms; i++) {
+    if (strcmp(bb->sym_names[i], name) == 0) {
+      bb->sym_regs[i] = reg;
+      return;
+    }
+  }
+
+  if (bb->n_syms >= bb->n_syms_max) {
+    bb->n_syms_max = (bb->n_syms_max > 0) ? bb->n_syms_max*2 : 16;
+    BFT_REALLOC(bb->sym_names, bb->n_syms_max, const char *);
+    BFT_REALLOC(bb->sym_regs, bb->n_syms_max, int);
+  }
+
+  bb->sym_names[bb->n_syms] = name;
+  bb->sym_regs[bb->n_syms] = reg;
+  bb->n_syms += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the register holding the current value of a symbol.
+ *
+ * Input symbols are bound to the matching input arrays, and other symbols
+ * are read from the table of symbols.
+ *
+ * \param [in, out] bb    bytecode builder
+ * \param [in]      name  name of the symbol
+ * \return register holding the symbol's current value
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_symbol_reg(_mei_bc_builder_t  *bb,
+            const char         *name)
+{
+  for (int i = 0; i < bb->n_syms; i++) {
+    if (strcmp(bb->sym_names[i], name) == 0)
+      return bb->sym_regs[i];
+  }
+
+  _mei_bc_instr_t ins = _instr(MEI_BC_INPUT, -1, -1, -1, -1);
+
+  for (int i = 0; i < bb->n_inputs; i++) {
+    if (strcmp(bb->input_names[i], name) == 0)
+      ins.id = i;
+  }
+
+  if (ins.id < 0) {
+    struct item *item = mei_hash_table_lookup(bb->symbol, name);
+    if (item == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error in mei_bytecode_create function: "
+                  "%s does not exist in the symbol table\n"), name);
+    ins.op = MEI_BC_SYMBOL;
+    ins.p_value = &(item->data->value);
+  }
+
+  int reg = _emit(bb, ins);
+  _set_symbol_reg(bb, name, reg);
+
+  return reg;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Combine an execution mask with a condition.
+ *
+ * \param [in, out] bb    bytecode builder
+ * \param [in]      mask  current mask register, or -1
+ * \param [in]      cond  condition register
+ * \return new mask register, -1 if all points are active, or
+ *         MEI_BYTECODE_DEAD_MASK if no point is active
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_and_mask(_mei_bc_builder_t  *bb,
+          int                 mask,
+          int                 cond)
+{
+  if (bb->instr[cond].op == MEI_BC_CONST)
+    return (bb->instr[cond].value != 0) ? mask : MEI_BYTECODE_DEAD_MASK;
+  else if (mask < 0)
+    return cond;
+  else
+    return _emit(bb, _instr(MEI_BC_AND, mask, cond, -1, -1));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile a node of an interpreter.
+ *
+ * Operations which may raise floating-point exceptions (division, power,
+ * functions) are masked in conditional code; other operations are
+ * computed for all points, so as to remain vectorizable.
+ *
+ * \param [in, out] bb    bytecode builder
+ * \param [in]      p     node of the interpreter
+ * \param [in]      mask  execution mask register, or -1
+ * \return register holding the node's value
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_compile(_mei_bc_builder_t  *bb,
+         mei_node_t         *p,
+         int                 mask)
+{
+  _mei_bc_instr_t ins;
+  struct item *item;
+  int ra, rb, m;
+
+  if (p == NULL || bb->unsupported)
+    return _emit_const(bb, 0);
+
+  switch(p->flag) {
+
+  case CONSTANT:
+    return _emit_const(bb, p->type->con.value);
+
+  case ID:
+    return _symbol_reg(bb, p->type->id.i);
+
+  case FUNC1:
+    item = mei_hash_table_lookup(bb->symbol, p->type->func.name);
+    ra = _compile(bb, p->type->func.op, mask);
+    ins = _instr(MEI_BC_FUNC1, ra, -1, -1, mask);
+    if (item->data->func == sqrt)
+      ins.op = MEI_BC_SQRT;
+    else if (item->data->func == fabs) {
+      ins.op = MEI_BC_ABS;
+      ins.mask = -1;
+    }
+    else
+      ins.f1 = item->data->func;
+    return _emit(bb, ins);
+
+  case FUNC2:
+    item = mei_hash_table_lookup(bb->symbol, p->type->funcx.name);
+    ra = _compile(bb, p->type->funcx.op[0], mask);
+    rb = _compile(bb, p->type->funcx.op[1], mask);
+    ins = _instr(MEI_BC_FUNC2, ra, rb, -1, mask);
+    if (item->data->f2 == fmin || item->data->f2 == fmax) {
+      ins.op = (item->data->f2 == fmin) ? MEI_BC_MIN : MEI_BC_MAX;
+      ins.mask = -1;
+    }
+    else
+      ins.f2 = item->data->f2;
+    return _emit(bb, ins);
+
+  case FUNC3:
+  case FUNC4:
+    bb->unsupported = true;
+    return _emit_const(bb, 0);
+
+  case OPR:
+    break;
+
+  }
+
+  mei_node_t **op = p->type->opr.op;
+
+  switch(p->type->opr.oper) {
+
+  case WHILE:
+  case PRINT:
+    bb->unsupported = true;
+    return _emit_const(bb, 0);
+
+  case ';':
+    _compile(bb, op[0], mask);
+    return _compile(bb, op[1], mask);
+
+  case '=':
+    ra = _compile(bb, op[1], mask);
+    if (mask > -1)
+      ra = _emit(bb, _instr(MEI_BC_SELECT,
+                            mask, ra, _symbol_reg(bb, op[0]->type->id.i), -1));
+    _set_symbol_reg(bb, op[0]->type->id.i, ra);
+    return _emit_const(bb, 0);
+
+  case IF:
+    ra = _compile(bb, op[0], mask);
+    m = _and_mask(bb, mask, ra);
+    if (m != MEI_BYTECODE_DEAD_MASK)
+      _compile(bb, op[1], m);
+    if (p->type->opr.nops > 2) {
+      rb = _emit(bb, _instr(MEI_BC_NOT, ra, -1, -1, -1));
+      m = _and_mask(bb, mask, rb);
+      if (m != MEI_BYTECODE_DEAD_MASK)
+        _compile(bb, op[2], m);
+    }
+    return _emit_const(bb, 0);
+
+  case UPLUS:
+    return _compile(bb, op[0], mask);
+
+  case UMINUS:
+    ra = _compile(bb, op[0], mask);
+    return _emit(bb, _instr(MEI_BC_NEG, ra, -1, -1, -1));
+
+  case '!':
+    ra = _compile(bb, op[0], mask);
+    return _emit(bb, _instr(MEI_BC_NOT, ra, -1, -1, -1));
+
+  case AND:
+    /* Second operand only evaluated where the first is true */
+    ra = _compile(bb, op[0], mask);
+    m = _and_mask(bb, mask, ra);
+    if (m == MEI_BYTECODE_DEAD_MASK)
+      return _emit_const(bb, 0);
+    rb = _compile(bb, op[1], m);
+    return _emit(bb, _instr(MEI_BC_AND, ra, rb, -1, -1));
+
+  case OR:
+    /* Second operand only evaluated where the first is false */
+    ra = _compile(bb, op[0], mask);
+    rb = _emit(bb, _instr(MEI_BC_NOT, ra, -1, -1, -1));
+    m = _and_mask(bb, mask, rb);
+    if (m == MEI_BYTECODE_DEAD_MASK)
+      return _emit_const(bb, 1);
+    rb = _compile(bb, op[1], m);
+    return _emit(bb, _instr(MEI_BC_OR, ra, rb, -1, -1));
+
+  default:
+    break;
+  }
+
+  /* Binary operators */
+
+  ra = _compile(bb, op[0], mask);
+  rb = _compile(bb, op[1], mask);
+
+  switch(p->type->opr.oper) {
+  case '+':
+    ins = _instr(MEI_BC_ADD, ra, rb, -1, -1);
+    break;
+  case '-':
+    ins = _instr(MEI_BC_SUB, ra, rb, -1, -1);
+    break;
+  case '*':
+    ins = _instr(MEI_BC_MUL, ra, rb, -1, -1);
+    break;
+  case '/':
+    ins = _instr(MEI_BC_DIV, ra, rb, -1, mask);
+    break;
+  case '^':
+    ins = _instr(MEI_BC_POW, ra, rb, -1, mask);
+    break;
+  case '<':
+    ins = _instr(MEI_BC_LT, ra, rb, -1, -1);
+    break;
+  case '>':
+    ins = _instr(MEI_BC_GT, ra, rb, -1, -1);
+    break;
+  case LE:
+    ins = _instr(MEI_BC_LE, ra, rb, -1, -1);
+    break;
+  case GE:
+    ins = _instr(MEI_BC_GE, ra, rb, -1, -1);
+    break;
+  case EQ:
+    ins = _instr(MEI_BC_EQ, ra, rb, -1, -1);
+    break;
+  case NE:
+    ins = _instr(MEI_BC_NE, ra, rb, -1, -1);
+    break;
+  default:
+    bb->unsupported = true;
+    return _emit_const(bb, 0);
+  }
+
+  return _emit(bb, ins);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Remove unused instructions and assign register slots.
+ *
+ * Varying registers share chunk-sized slots based on their lifetime, and
+ * uniform registers used by varying instructions get dedicated slots,
+ * filled once per thread.
+ *
+ * \param [in, out] bc  compiled interpreter
+ * \param [in]      bb  bytecode builder
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_finalize(mei_bytecode_t     *bc,
+          _mei_bc_builder_t  *bb)
+{
+  const int n = bb->n_instr;
+  int *new_id, *last_use, *free_slots;
+
+  BFT_MALLOC(new_id, n, int);
+
+  /* Mark live instructions (dead code elimination) */
+
+  for (int i = 0; i < n; i++)
+    new_id[i] = -1;
+  for (int i = 0; i < bc->n_outputs; i++)
+    new_id[bc->output_reg[i]] = 0;
+
+  for (int i = n-1; i > -1; i--) {
+    if (new_id[i] < 0)
+      continue;
+    const _mei_bc_instr_t *ins = bb->instr + i;
+    const int opnd[4] = {ins->a, ins->b, ins->c, ins->mask};
+    for (int k = 0; k < 4; k++) {
+      if (opnd[k] > -1)
+        new_id[opnd[k]] = 0;
+    }
+  }
+
+  /* Compact instructions */
+
+  bc->n_instr = 0;
+  for (int i = 0; i < n; i++) {
+    if (new_id[i] > -1)
+      new_id[i] = bc->n_instr++;
+  }
+
+  BFT_MALLOC(bc->instr, bc->n_instr, _mei_bc_instr_t);
+
+  for (int i = 0; i < n; i++) {
+    if (new_id[i] < 0)
+      continue;
+    _mei_bc_instr_t *ins = bc->instr + new_id[i];
+    *ins = bb->instr[i];
+    if (ins->a > -1) ins->a = new_id[ins->a];
+    if (ins->b > -1) ins->b = new_id[ins->b];
+    if (ins->c > -1) ins->c = new_id[ins->c];
+    if (ins->mask > -1) ins->mask = new_id[ins->mask];
+  }
+
+  for (int i = 0; i < bc->n_outputs; i++)
+    bc->output_reg[i] = new_id[bc->output_reg[i]];
+
+  BFT_FREE(new_id);
+
+  /* Last use of each register by a varying instruction */
+
+  const int n_instr = bc->n_instr;
+
+  BFT_MALLOC(last_use, n_instr, int);
+  BFT_MALLOC(free_slots, n_instr, int);
+  BFT_MALLOC(bc->slot, n_instr, int);
+
+  for (int i = 0; i < n_instr; i++) {
+    last_use[i] = -1;
+    bc->slot[i] = -1;
+  }
+
+  for (int i = 0; i < n_instr; i++) {
+    const _mei_bc_instr_t *ins = bc->instr + i;
+    if (ins->varying) {
+      const int opnd[4] = {ins->a, ins->b, ins->c, ins->mask};
+      for (int k = 0; k < 4; k++) {
+        if (opnd[k] > -1)
+          last_use[opnd[k]] = i;
+      }
+    }
+  }
+
+  /* Dedicated slots for broadcast uniform registers */
+
+  bc->n_slots = 0;
+
+  for (int i = 0; i < n_instr; i++) {
+    if (!bc->instr[i].varying && last_use[i] > -1)
+      bc->slot[i] = bc->n_slots++;
+  }
+
+  /* Output values are kept until the end */
+
+  for (int i = 0; i < bc->n_outputs; i++)
+    last_use[bc->output_reg[i]] = n_instr;
+
+  /* Shared slots for varying registers */
+
+  int n_free = 0;
+
+  for (int i = 0; i < n_instr; i++) {
+    const _mei_bc_instr_t *ins = bc->instr + i;
+    if (!ins->varying)
+      continue;
+    bc->slot[i] = (n_free > 0) ? free_slots[--n_free] : bc->n_slots++;
+    const int opnd[4] = {ins->a, ins->b, ins->c, ins->mask};
+    for (int k = 0; k < 4; k++) {
+      int r = opnd[k];
+      if (r < 0 || !bc->instr[r].varying || last_use[r] != i)
+        continue;
+      bool dup = false;
+      for (int l = 0; l < k; l++) {
+        if (opnd[l] == r)
+          dup = true;
+      }
+      if (!dup)
+        free_slots[n_free++] = bc->slot[r];
+    }
+  }
+
+  BFT_FREE(free_slots);
+  BFT_FREE(last_use);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to the values of a register for the current chunk.
+ *
+ * \param [in] bc   compiled interpreter
+ * \param [in] r    register slots values
+ * \param [in] reg  register id, or -1
+ * \return pointer to register values, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline double *
+_reg_vals(const mei_bytecode_t  *bc,
+          double                *r,
+          int                    reg)
+{
+  return (reg > -1) ? r + bc->slot[reg]*MEI_BYTECODE_CHUNK_SIZE : NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate an expression point by point using the interpreter.
+ *
+ * \param [in]  bc              compiled interpreter
+ * \param [in]  n_elts          number of elements
+ * \param [in]  elt_ids         ids of elements, or NULL
+ * \param [in]  input_vals      values of input symbols
+ * \param [in]  input_strides   strides of input values
+ * \param [out] output_vals     values of output symbols
+ * \param [in]  output_strides  strides of output values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_evaluate_interpreted(const mei_bytecode_t  *bc,
+                      cs_lnum_t              n_elts,
+                      const cs_lnum_t        elt_ids[],
+                      const cs_real_t *const input_vals[],
+                      const int              input_strides[],
+                      cs_real_t       *const output_vals[],
+                      const int              output_strides[])
+{
+  for (cs_lnum_t j = 0; j < n_elts; j++) {
+
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[j] : j;
+
+    for (int i = 0; i < bc->n_inputs; i++)
+      mei_tree_insert(bc->ev,
+                      bc->input_names[i],
+                      input_vals[i][e_id*input_strides[i]]);
+
+    mei_evaluate(bc->ev);
+
+    for (int i = 0; i < bc->n_outputs; i++)
+      output_vals[i][e_id*output_strides[i]]
+        = mei_tree_lookup(bc->ev, bc->output_names[i]);
+
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile an interpreter for evaluation over arrays of points.
+ *
+ * The expression tree is lowered to a flat register-based bytecode, with
+ * constant folding. Symbols of the input list are bound to arrays at each
+ * evaluation, and other symbols of the interpreter's table (constants,
+ * time, notebook variables, ...) are read once per evaluation.
+ *
+ * Conditional statements are evaluated by masking, so that they do not
+ * prevent vectorization. If the expression contains statements which
+ * can not be compiled (while loops, print), evaluation falls back to
+ * the interpreter, one point at a time.
+ *
+ * The interpreter must have been built (see \ref mei_tree_builder), and
+ * must not be destroyed before the returned structure.
+ *
+ * \param [in] ev            interpreter
+ * \param [in] n_inputs      number of array-valued input symbols
+ * \param [in] input_names   names of input symbols
+ * \param [in] n_outputs     number of output symbols
+ * \param [in] output_names  names of output symbols
+ * \return new compiled interpreter
+ */
+/*----------------------------------------------------------------------------*/
+
+mei_bytecode_t *
+mei_bytecode_create(mei_tree_t  *ev,
+                    int          n_inputs,
+                    const char  *input_names[],
+                    int          n_outputs,
+                    const char  *output_names[])
+{
+  mei_bytecode_t *bc = NULL;
+
+  assert(ev != NULL);
+  assert(ev->errors == 0);
+
+  BFT_MALLOC(bc, 1, mei_bytecode_t);
+
+  bc->ev = ev;
+  bc->compiled = false;
+
+  bc->n_inputs = n_inputs;
+  bc->n_outputs = n_outputs;
+  BFT_MALLOC(bc->input_names, n_inputs, char *);
+  BFT_MALLOC(bc->output_names, n_outputs, char *);
+  for (int i = 0; i < n_inputs; i++) {
+    BFT_MALLOC(bc->input_names[i], strlen(input_names[i]) + 1, char);
+    strcpy(bc->input_names[i], input_names[i]);
+  }
+  for (int i = 0; i < n_outputs; i++) {
+    BFT_MALLOC(bc->output_names[i], strlen(output_names[i]) + 1, char);
+    strcpy(bc->output_names[i], output_names[i]);
+  }
+
+  bc->n_instr = 0;
+  bc->instr = NULL;
+  bc->n_slots = 0;
+  bc->slot = NULL;
+  BFT_MALLOC(bc->output_reg, n_outputs, int);
+
+  /* Lower expression tree to bytecode */
+
+  _mei_bc_builder_t bb = {.n_instr = 0,
+                          .n_instr_max = 0,
+                          .instr = NULL,
+                          .n_syms = 0,
+                          .n_syms_max = 0,
+                          .sym_names = NULL,
+                          .sym_regs = NULL,
+                          .n_inputs = n_inputs,
+                          .input_names = input_names,
+                          .symbol = ev->symbol,
+                          .unsupported = false};
+
+  _compile(&bb, ev->node, -1);
+
+  if (bb.unsupported == false) {
+    for (int i = 0; i < n_outputs; i++)
+      bc->output_reg[i] = _symbol_reg(&bb, output_names[i]);
+    _finalize(bc, &bb);
+    bc->compiled = true;
+  }
+
+  BFT_FREE(bb.instr);
+  BFT_FREE(bb.sym_names);
+  BFT_FREE(bb.sym_regs);
+
+  return bc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a compiled interpreter structure.
+ *
+ * \param [in] bc  compiled interpreter
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+mei_bytecode_destroy(mei_bytecode_t  *bc)
+{
+  if (bc == NULL)
+    return;
+
+  for (int i = 0; i < bc->n_inputs; i++)
+    BFT_FREE(bc->input_names[i]);
+  for (int i = 0; i < bc->n_outputs; i++)
+    BFT_FREE(bc->output_names[i]);
+  BFT_FREE(bc->input_names);
+  BFT_FREE(bc->output_names);
+
+  BFT_FREE(bc->instr);
+  BFT_FREE(bc->output_reg);
+  BFT_FREE(bc->slot);
+
+  BFT_FREE(bc);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query if a compiled interpreter uses bytecode evaluation (true),
+ * or falls back to the interpreter (false).
+ *
+ * \param [in] bc  compiled interpreter
+ * \return true if bytecode evaluation is used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+mei_bytecode_is_compiled(const mei_bytecode_t  *bc)
+{
+  return bc->compiled;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate a compiled interpreter over a set of elements.
+ *
+ * For element j, the value of input symbol i is
+ * input_vals[i][elt_ids[j]*input_strides[i]], and the value of output
+ * symbol i is stored in output_vals[i][elt_ids[j]*output_strides[i]]
+ * (with elt_ids[j] replaced by j if elt_ids is NULL).
+ *
+ * Uniform values are computed once, and values depending on inputs are
+ * computed by chunks of points, distributed among threads.
+ *
+ * \param [in]  bc              compiled interpreter
+ * \param [in]  n_elts          number of elements
+ * \param [in]  elt_ids         ids of elements, or NULL
+ * \param [in]  input_vals      values of input symbols
+ * \param [in]  input_strides   strides of input values
+ * \param [out] output_vals     values of output symbols
+ * \param [in]  output_strides  strides of output values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+mei_bytecode_evaluate(const mei_bytecode_t  *bc,
+                      cs_lnum_t              n_elts,
+                      const cs_lnum_t        elt_ids[],
+                      const cs_real_t *const input_vals[],
+                      const int              input_strides[],
+                      cs_real_t       *const output_vals[],
+                      const int              output_strides[])
+{
+  if (bc->compiled == false) {
+    _evaluate_interpreted(bc, n_elts, elt_ids,
+                          input_vals, input_strides,
+                          output_vals, output_strides);
+    return;
+  }
+
+  const int n_instr = bc->n_instr;
+  const _mei_bc_instr_t *instr = bc->instr;
+
+  /* Uniform values */
+
+  double *u;
+  BFT_MALLOC(u, n_instr, double);
+
+  for (int i = 0; i < n_instr; i++) {
+    const _mei_bc_instr_t *ins = instr + i;
+    if (ins->varying)
+      continue;
+    _execute(ins, 1, u + i,
+             (ins->a > -1) ? u + ins->a : NULL,
+             (ins->b > -1) ? u + ins->b : NULL,
+             (ins->c > -1) ? u + ins->c : NULL,
+             (ins->mask > -1) ? u + ins->mask : NULL);
+  }
+
+  /* Varying values, by chunks */
+
+  const cs_lnum_t n_chunks
+    = (n_elts + MEI_BYTECODE_CHUNK_SIZE - 1) / MEI_BYTECODE_CHUNK_SIZE;
+
+# pragma omp parallel if (n_elts > CS_THR_MIN)
+  {
+    double *r;
+    BFT_MALLOC(r, bc->n_slots*MEI_BYTECODE_CHUNK_SIZE, double);
+
+    for (int i = 0; i < n_instr; i++) {
+      if (!instr[i].varying && bc->slot[i] > -1) {
+        double *d = _reg_vals(bc, r, i);
+        for (cs_lnum_t j = 0; j < MEI_BYTECODE_CHUNK_SIZE; j++)
+          d[j] = u[i];
+      }
+    }
+
+#   pragma omp for
+    for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+      const cs_lnum_t s_id = c_id*MEI_BYTECODE_CHUNK_SIZE;
+      const cs_lnum_t n = CS_MIN(MEI_BYTECODE_CHUNK_SIZE, n_elts - s_id);
+      const cs_lnum_t *_elt_ids = (elt_ids != NULL) ? elt_ids + s_id : NULL;
+
+      for (int i = 0; i < n_instr; i++) {
+
+        const _mei_bc_instr_t *ins = instr + i;
+        if (!ins->varying)
+          continue;
+
+        double *d = _reg_vals(bc, r, i);
+
+        if (ins->op == MEI_BC_INPUT) {
+          const cs_real_t *v = input_vals[ins->id];
+          const cs_lnum_t stride = input_strides[ins->id];
+          if (_elt_ids != NULL) {
+            for (cs_lnum_t j = 0; j < n; j++)
+              d[j] = v[_elt_ids[j]*stride];
+          }
+          else {
+            for (cs_lnum_t j = 0; j < n; j++)
+              d[j] = v[(s_id + j)*stride];
+          }
+        }
+        else
+          _execute(ins, n, d,
+                   _reg_vals(bc, r, ins->a),
+                   _reg_vals(bc, r, ins->b),
+                   _reg_vals(bc, r, ins->c),
+                   _reg_vals(bc, r, ins->mask));
+
+      }
+
+      /* Copy outputs */
+
+      for (int i = 0; i < bc->n_outputs; i++) {
+        const int reg = bc->output_reg[i];
+        cs_real_t *v = output_vals[i];
+        const cs_lnum_t stride = output_strides[i];
+        const double *s = (instr[reg].varying) ? _reg_vals(bc, r, reg) : NULL;
+        for (cs_lnum_t j = 0; j < n; j++) {
+          const cs_lnum_t e_id = (_elt_ids != NULL) ? _elt_ids[j] : s_id + j;
+          v[e_id*stride] = (s != NULL) ? s[j] : u[reg];
+        }
+      }
+
+    }
+
+    BFT_FREE(r);
+  }
+
+  BFT_FREE(u);
+}
+
+/*----------------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
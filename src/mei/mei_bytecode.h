@@ -0,0 +1,151 @@
+#ifndef __MEI_BYTECODE_H__
+#define __MEI_BYTECODE_H__
+
+/*!
+ * \file mei_bytecode.h
+ *
+ * \brief Compiled evaluation of an interpreter over arrays of points
+ */
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "mei_evaluate.h"
+
+/*----------------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*!
+ * Opaque structure defining the compiled form of an interpreter
+ */
+
+typedef struct _mei_bytecode_t mei_bytecode_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compile an interpreter for evaluation over arrays of points.
+ *
+ * The expression tree is lowered to a flat register-based bytecode, with
+ * constant folding. Symbols of the input list are bound to arrays at each
+ * evaluation, and other symbols of the interpreter's table (constants,
+ * time, notebook variables, ...) are read once per evaluation.
+ *
+ * Conditional statements are evaluated by masking, so that they do not
+ * prevent vectorization. If the expression contains statements which
+ * can not be compiled (while loops, print), evaluation falls back to
+ * the interpreter, one point at a time.
+ *
+ * The interpreter must have been built (see mei_tree_builder), and must
+ * not be destroyed before the returned structure.
+ *
+ * parameters:
+ *   ev           <-- interpreter
+ *   n_inputs     <-- number of array-valued input symbols
+ *   input_names  <-- names of input symbols
+ *   n_outputs    <-- number of output symbols
+ *   output_names <-- names of output symbols
+ *
+ * returns:
+ *   pointer to new compiled interpreter structure.
+ *----------------------------------------------------------------------------*/
+
+mei_bytecode_t *
+mei_bytecode_create(mei_tree_t  *ev,
+                    int          n_inputs,
+                    const char  *input_names[],
+                    int          n_outputs,
+                    const char  *output_names[]);
+
+/*----------------------------------------------------------------------------
+ * Free a compiled interpreter structure.
+ *
+ * parameters:
+ *   bc <-- compiled interpreter
+ *----------------------------------------------------------------------------*/
+
+void
+mei_bytecode_destroy(mei_bytecode_t  *bc);
+
+/*----------------------------------------------------------------------------
+ * Query if a compiled interpreter uses bytecode evaluation (true), or falls
+ * back to the interpreter (false).
+ *
+ * parameters:
+ *   bc <-- compiled interpreter
+ *
+ * returns:
+ *   true if bytecode evaluation is used, false otherwise.
+ *----------------------------------------------------------------------------*/
+
+bool
+mei_bytecode_is_compiled(const mei_bytecode_t  *bc);
+
+/*----------------------------------------------------------------------------
+ * Evaluate a compiled interpreter over a set of elements.
+ *
+ * For element j, the value of input symbol i is
+ * input_vals[i][elt_ids[j]*input_strides[i]], and the value of output
+ * symbol i is stored in output_vals[i][elt_ids[j]*output_strides[i]]
+ * (with elt_ids[j] replaced by j if elt_ids is NULL).
+ *
+ * parameters:
+ *   bc             <-- compiled interpreter
+ *   n_elts         <-- number of elements
+ *   elt_ids        <-- ids of elements, or NULL
+ *   input_vals     <-- values of input symbols
+ *   input_strides  <-- strides of input values
+ *   output_vals    --> values of output symbols
+ *   output_strides <-- strides of output values
+ *----------------------------------------------------------------------------*/
+
+void
+mei_bytecode_evaluate(const mei_bytecode_t  *bc,
+                      cs_lnum_t              n_elts,
+                      const cs_lnum_t        elt_ids[],
+                      const cs_real_t *const input_vals[],
+                      const int              input_strides[],
+                      cs_real_t       *const output_vals[],
+                      const int              output_strides[]);
+
+/*----------------------------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* __MEI_BYTECODE_H__ */
@@ -60,6 +60,8 @@
 
 #include "cs_prototypes.h"
 
+#include "cs_rad_transfer_solve.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -184,6 +186,21 @@ BEGIN_C_DECLS
   \var  cs_rad_transfer_params_t::itpt1d
         Calculation of the temperature with the 1D wall thermal module,
         which solves a heat equation.
+  \var  cs_rad_transfer_params_t::dom_sweep
+        For the DOM model, solve the radiative transfer equation for each
+        direction by sweeping cells in upwind (topological) order instead
+        of using an iterative linear solver:
+        - false: iterative linear solver (default)
+        - true: sweep solver
+  \var  cs_rad_transfer_params_t::dom_batch
+        For the DOM model, when the sweep solver is not used, solve the
+        radiative transfer equations of all directions of a given octant
+        together, with a batched iterative linear solver traversing the
+        matrix structure once for all directions:
+        - false: solve each direction separately (default)
+        - true: solve directions by octant batches\n
+        This option is ignored with the atmospheric infrared absorption
+        model, for which boundary conditions depend on the direction.
 */
 
 /*----------------------------------------------------------------------------*/
@@ -244,7 +261,9 @@ cs_rad_transfer_params_t _rt_params = {.type = CS_RAD_TRANSFER_NONE,
                                        .ifgrno = 31,
                                        .ifrefl = 32,
                                        .itpt1d = 4,
-                                       .atmo_ir_absorption = false};
+                                       .atmo_ir_absorption = false,
+                                       .dom_sweep = false,
+                                       .dom_batch = false};
 
 cs_rad_transfer_params_t *cs_glob_rad_transfer_params = &_rt_params;
 
@@ -295,6 +314,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_solve_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
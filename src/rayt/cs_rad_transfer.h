@@ -112,6 +112,11 @@ typedef struct {
 
   bool          atmo_ir_absorption; /*!< infrared absorption model */
 
+  bool          dom_sweep;          /*!< use sweep solver for DOM */
+
+  bool          dom_batch;          /*!< solve DOM directions of each
+                                         octant together */
+
 } cs_rad_transfer_params_t;
 
 extern cs_rad_transfer_params_t *cs_glob_rad_transfer_params;
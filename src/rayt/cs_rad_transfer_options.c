@@ -341,6 +341,14 @@ cs_rad_transfer_log_setup(void)
         (CS_LOG_SETUP,
          _("    ndirec:                 %3d\n"),
          cs_glob_rad_transfer_params->ndirec);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    dom_sweep:              %3d  (0: linear solver; 1: sweep)\n"),
+       (int)cs_glob_rad_transfer_params->dom_sweep);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    dom_batch:              %3d  (0: per direction; 1: per octant)\n"),
+       (int)cs_glob_rad_transfer_params->dom_batch);
   }
 
   cs_log_printf
@@ -54,8 +54,13 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
+#include "cs_matrix.h"
+#include "cs_matrix_building.h"
+#include "cs_matrix_default.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_parameters_check.h"
@@ -103,6 +108,42 @@ static int ipadom = 0;
  * Local type definitions
  *============================================================================*/
 
+/* Cell ordering for sweeps in a given direction (DOM model) */
+
+typedef struct {
+
+  int          n_levels;      /* Number of levels (wavefronts) */
+  cs_lnum_t   *level_index;   /* Index of cells by level (size: n_levels+1);
+                                 cells of a same level are independent */
+  cs_lnum_t   *cell_ids;      /* Cell ids, grouped by level */
+
+  bool         lagged;        /* True if some upstream values are lagged
+                                 (dependency cycles or ghost cells)
+                                 on at least one rank */
+
+} _sweep_order_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Sweep orderings (one per direction) and cell -> faces adjacency */
+
+static int              _n_sweep_dirs = 0;
+static _sweep_order_t  *_sweep_orders = NULL;
+
+static cs_lnum_t  *_cell_i_faces_idx = NULL;
+static cs_lnum_t  *_cell_i_faces = NULL;
+static cs_lnum_t  *_cell_b_faces_idx = NULL;
+static cs_lnum_t  *_cell_b_faces = NULL;
+
+/* Matrices for batched solves (one per direction of an octant, reused
+   for all octants), and matching default matrix */
+
+static int                 _n_batch_matrices = 0;
+static cs_matrix_t       **_batch_matrices = NULL;
+static const cs_matrix_t  *_batch_matrix_ref = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -227,9 +268,656 @@ _order_axis(const cs_real_t  s[],
 
 }
 
+/*----------------------------------------------------------------------------
+ * Build cell -> interior and boundary faces adjacency used by sweeps.
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_cell_faces_adjacency(void)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  BFT_REALLOC(_cell_i_faces_idx, n_cells + 1, cs_lnum_t);
+  BFT_REALLOC(_cell_b_faces_idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++) {
+    _cell_i_faces_idx[c_id] = 0;
+    _cell_b_faces_idx[c_id] = 0;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        _cell_i_faces_idx[c_id + 1] += 1;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++)
+    _cell_b_faces_idx[m->b_face_cells[f_id] + 1] += 1;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    _cell_i_faces_idx[c_id + 1] += _cell_i_faces_idx[c_id];
+    _cell_b_faces_idx[c_id + 1] += _cell_b_faces_idx[c_id];
+  }
+
+  BFT_REALLOC(_cell_i_faces, _cell_i_faces_idx[n_cells], cs_lnum_t);
+  BFT_REALLOC(_cell_b_faces, _cell_b_faces_idx[n_cells], cs_lnum_t);
+
+  cs_lnum_t *count;
+  BFT_MALLOC(count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    count[c_id] = _cell_i_faces_idx[c_id];
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        _cell_i_faces[count[c_id]++] = f_id;
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    count[c_id] = _cell_b_faces_idx[c_id];
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    cs_lnum_t c_id = m->b_face_cells[f_id];
+    _cell_b_faces[count[c_id]++] = f_id;
+  }
+
+  BFT_FREE(count);
+}
+
+/*----------------------------------------------------------------------------
+ * Free sweep orderings.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_sweep_orders(void)
+{
+  for (int i = 0; i < _n_sweep_dirs; i++) {
+    BFT_FREE(_sweep_orders[i].level_index);
+    BFT_FREE(_sweep_orders[i].cell_ids);
+  }
+  BFT_FREE(_sweep_orders);
+  _n_sweep_dirs = 0;
+
+  BFT_FREE(_cell_i_faces_idx);
+  BFT_FREE(_cell_i_faces);
+  BFT_FREE(_cell_b_faces_idx);
+  BFT_FREE(_cell_b_faces);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the sweep ordering of cells for a given direction.
+ *
+ * Cells are grouped in levels (wavefronts) using a topological ordering of
+ * the upwind dependency graph: a cell depends on its neighbors through
+ * faces across which the radiance enters the cell. Cells of a same level
+ * only depend on cells of lower levels, so they may be updated
+ * concurrently.
+ *
+ * When the graph has cycles (possible on non-orthogonal meshes), the
+ * first remaining cell in the projected coordinate order is forced
+ * into its own level, and its unresolved upstream values are lagged.
+ * Upstream values from ghost cells are always lagged.
+ *
+ * parameters:
+ *   v        <-- direction vector
+ *   p_order  <-- cells ordered by projected coordinate along v
+ *   so       --> sweep ordering structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_order_build(const cs_real_t   v[3],
+                   const cs_lnum_t   p_order[],
+                   _sweep_order_t   *so)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+
+  cs_lnum_t *in_deg, *frontier;
+  bool *placed;
+
+  BFT_MALLOC(in_deg, n_cells, cs_lnum_t);
+  BFT_MALLOC(frontier, n_cells, cs_lnum_t);
+  BFT_MALLOC(placed, n_cells, bool);
+
+  cs_gnum_t n_lagged = 0;
+
+  /* Count local upstream dependencies */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    in_deg[c_id] = 0;
+    placed[c_id] = false;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    cs_real_t flux = cs_math_3_dot_product(v, i_face_normal[f_id]);
+    cs_lnum_t c_id_up = i_face_cells[f_id][0];
+    cs_lnum_t c_id_dn = i_face_cells[f_id][1];
+    if (flux < 0.) {
+      c_id_up = i_face_cells[f_id][1];
+      c_id_dn = i_face_cells[f_id][0];
+    }
+    else if (flux <= 0.)
+      continue;
+    if (c_id_dn < n_cells) {
+      if (c_id_up < n_cells)
+        in_deg[c_id_dn] += 1;
+      else
+        n_lagged += 1;
+    }
+  }
+
+  /* Build levels */
+
+  BFT_MALLOC(so->cell_ids, n_cells, cs_lnum_t);
+  BFT_MALLOC(so->level_index, n_cells + 1, cs_lnum_t);
+
+  so->n_levels = 0;
+  so->level_index[0] = 0;
+
+  cs_lnum_t n_placed = 0, n_frontier = 0, p_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t c_id = p_order[i];
+    if (in_deg[c_id] == 0)
+      frontier[n_frontier++] = c_id;
+  }
+
+  while (n_placed < n_cells) {
+
+    /* Break dependency cycle if needed */
+
+    if (n_frontier == 0) {
+      while (placed[p_order[p_id]])
+        p_id++;
+      cs_lnum_t c_id = p_order[p_id];
+      n_lagged += in_deg[c_id];
+      in_deg[c_id] = 0;
+      frontier[n_frontier++] = c_id;
+    }
+
+    /* Add level */
+
+    for (cs_lnum_t i = 0; i < n_frontier; i++) {
+      cs_lnum_t c_id = frontier[i];
+      so->cell_ids[n_placed + i] = c_id;
+      placed[c_id] = true;
+    }
+
+    cs_lnum_t s_id = n_placed;
+    n_placed += n_frontier;
+    so->n_levels += 1;
+    so->level_index[so->n_levels] = n_placed;
+
+    /* Release downstream cells */
+
+    n_frontier = 0;
+
+    for (cs_lnum_t i = s_id; i < n_placed; i++) {
+      cs_lnum_t c_id = so->cell_ids[i];
+      for (cs_lnum_t j = _cell_i_faces_idx[c_id];
+           j < _cell_i_faces_idx[c_id+1];
+           j++) {
+        cs_lnum_t f_id = _cell_i_faces[j];
+        cs_real_t flux = cs_math_3_dot_product(v, i_face_normal[f_id]);
+        cs_lnum_t c_id_dn = -1;
+        if (i_face_cells[f_id][0] == c_id && flux > 0.)
+          c_id_dn = i_face_cells[f_id][1];
+        else if (i_face_cells[f_id][1] == c_id && flux < 0.)
+          c_id_dn = i_face_cells[f_id][0];
+        if (c_id_dn > -1 && c_id_dn < n_cells && placed[c_id_dn] == false) {
+          in_deg[c_id_dn] -= 1;
+          if (in_deg[c_id_dn] == 0)
+            frontier[n_frontier++] = c_id_dn;
+        }
+      }
+    }
+
+  }
+
+  BFT_REALLOC(so->level_index, so->n_levels + 1, cs_lnum_t);
+
+  BFT_FREE(placed);
+  BFT_FREE(frontier);
+  BFT_FREE(in_deg);
+
+  cs_parall_counter(&n_lagged, 1);
+
+  so->lagged = (n_lagged > 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the radiative transfer equation for a given direction by sweeping
+ * cells in upwind order.
+ *
+ * The discrete system is the same as the one built for the upwind
+ * steady convection problem solved by the iterative linear solver:
+ * for each cell, the radiance is obtained directly from upstream
+ * values, so that a single sweep is needed when no value is lagged.
+ * Otherwise, sweeps are repeated (with a halo update between sweeps)
+ * until convergence.
+ *
+ * parameters:
+ *   so            <-- sweep ordering for this direction
+ *   name          <-- name of the direction's equation
+ *   verbosity     <-- verbosity level
+ *   epsilon       <-- convergence threshold
+ *   coefap        <-- boundary condition array (explicit part)
+ *   coefbp        <-- boundary condition array (implicit part)
+ *   flurds        <-- pseudo mass flux at interior faces
+ *   flurdb        <-- pseudo mass flux at boundary faces
+ *   rovsdt        <-- implicit source term
+ *   rhs           <-- explicit source term
+ *   radiance      <-> radiance
+ *   radiance_prev --- work array
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_solve(const _sweep_order_t  *so,
+             const char            *name,
+             int                    verbosity,
+             double                 epsilon,
+             const cs_real_t        coefap[],
+             const cs_real_t        coefbp[],
+             const cs_real_t        flurds[],
+             const cs_real_t        flurdb[],
+             const cs_real_t        rovsdt[],
+             const cs_real_t        rhs[],
+             cs_real_t    *restrict radiance,
+             cs_real_t    *restrict radiance_prev)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  const int n_max_sweeps = 1000;
+
+  int n_sweeps = 0;
+  double residue = 0.;
+
+  do {
+
+    if (so->lagged) {
+      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+        radiance_prev[c_id] = radiance[c_id];
+      if (m->halo != NULL)
+        cs_halo_sync_var(m->halo, CS_HALO_STANDARD, radiance);
+    }
+
+#   pragma omp parallel if (n_cells > CS_THR_MIN)
+    {
+      for (int l_id = 0; l_id < so->n_levels; l_id++) {
+
+#       pragma omp for
+        for (cs_lnum_t i = so->level_index[l_id];
+             i < so->level_index[l_id+1];
+             i++) {
+
+          cs_lnum_t c_id = so->cell_ids[i];
+
+          cs_real_t num = rhs[c_id], den = rovsdt[c_id];
+
+          for (cs_lnum_t j = _cell_i_faces_idx[c_id];
+               j < _cell_i_faces_idx[c_id+1];
+               j++) {
+            cs_lnum_t f_id = _cell_i_faces[j];
+            cs_real_t flux_in;
+            cs_lnum_t c_id_up;
+            if (i_face_cells[f_id][0] == c_id) {
+              flux_in = - flurds[f_id];
+              c_id_up = i_face_cells[f_id][1];
+            }
+            else {
+              flux_in = flurds[f_id];
+              c_id_up = i_face_cells[f_id][0];
+            }
+            if (flux_in > 0.) {
+              num += flux_in * radiance[c_id_up];
+              den += flux_in;
+            }
+          }
+
+          for (cs_lnum_t j = _cell_b_faces_idx[c_id];
+               j < _cell_b_faces_idx[c_id+1];
+               j++) {
+            cs_lnum_t f_id = _cell_b_faces[j];
+            cs_real_t flux_in = - flurdb[f_id];
+            if (flux_in > 0.) {
+              num += flux_in * coefap[f_id];
+              den += flux_in * (1. - coefbp[f_id]);
+            }
+          }
+
+          radiance[c_id] = (den > 0.) ? num / den : 0.;
+
+        }
+
+      }
+    }
+
+    n_sweeps++;
+
+    if (so->lagged) {
+      double s[2] = {0., 0.};
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        s[0] += cs_math_sq(radiance[c_id] - radiance_prev[c_id]);
+        s[1] += cs_math_sq(radiance[c_id]);
+      }
+      cs_parall_sum(2, CS_DOUBLE, s);
+      residue = (s[1] > 0.) ? sqrt(s[0]/s[1]) : sqrt(s[0]);
+    }
+
+  } while (so->lagged && residue > epsilon && n_sweeps < n_max_sweeps);
+
+  if (m->halo != NULL)
+    cs_halo_sync_var(m->halo, CS_HALO_STANDARD, radiance);
+
+  if (verbosity > 0)
+    bft_printf(_("  %s: %d sweep(s), %d levels, residue %12.5e\n"),
+               name, n_sweeps, so->n_levels, residue);
+}
+
+/*----------------------------------------------------------------------------
+ * Free matrices used for batched solves.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_batch_matrices(void)
+{
+  for (int i = 0; i < _n_batch_matrices; i++)
+    cs_matrix_destroy(_batch_matrices + i);
+  BFT_FREE(_batch_matrices);
+
+  _n_batch_matrices = 0;
+  _batch_matrix_ref = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Return matrices used for batched solves, building them if needed.
+ *
+ * Matrices share the structure of the default MSR matrix, and are only
+ * rebuilt if that matrix or the number of directions changes.
+ *
+ * parameters:
+ *   n_dirs <-- number of directions per octant
+ *
+ * returns:
+ *   array of matrices (one per direction)
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_t **
+_get_batch_matrices(int  n_dirs)
+{
+  cs_matrix_t *a_ref = cs_matrix_msr(false, NULL, NULL);
+
+  if (a_ref != _batch_matrix_ref || n_dirs != _n_batch_matrices) {
+
+    _free_batch_matrices();
+
+    BFT_MALLOC(_batch_matrices, n_dirs, cs_matrix_t *);
+    for (int i = 0; i < n_dirs; i++)
+      _batch_matrices[i] = cs_matrix_create_by_copy(a_ref);
+
+    _n_batch_matrices = n_dirs;
+    _batch_matrix_ref = a_ref;
+
+  }
+
+  return _batch_matrices;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if directions are solved by octant batches.
+ *
+ * returns:
+ *   true if batched solves are used, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_use_batch(void)
+{
+  return (   cs_glob_rad_transfer_params->dom_batch
+          && !cs_glob_rad_transfer_params->dom_sweep
+          && !cs_glob_rad_transfer_params->atmo_ir_absorption);
+}
+
+/*----------------------------------------------------------------------------
+ * Return iterative linear solver context used for batched solution of
+ * all directions of a given octant, defining it if needed.
+ *
+ * parameters:
+ *   octant_id <-- octant id (1 to 8)
+ *
+ * returns:
+ *   pointer to solver context, or NULL if the solver defined for this
+ *   octant is not an iterative solver
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_it_t *
+_batch_sles_context(int  octant_id)
+{
+  char name[32];
+  sprintf(name, "radiation_octant_%d", octant_id);
+
+  cs_sles_t *sles = cs_sles_find(-1, name);
+
+  if (sles == NULL) {
+    (void)cs_sles_it_define(-1,
+                            name,
+                            CS_SLES_P_GAUSS_SEIDEL,
+                            0,      /* poly_degree */
+                            1000);  /* n_max_iter */
+    sles = cs_sles_find(-1, name);
+  }
+
+  if (strcmp(cs_sles_get_type(sles), "cs_sles_it_t") != 0)
+    return NULL;
+
+  return cs_sles_get_context(sles);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the radiative transfer equations of all directions of an octant
+ * together.
+ *
+ * The matrices of all directions share the same structure, and only
+ * differ through the pseudo mass fluxes, so the batched linear solver
+ * traverses the structure (and exchanges ghost values) once for all
+ * directions of the octant. The matrix objects are built once and
+ * reused for all octants and time steps; only coefficients are updated.
+ *
+ * The discrete system is the same as the one built for the upwind
+ * steady convection problem solved separately for each direction.
+ *
+ * parameters:
+ *   sc          <-> iterative linear solver context for this octant
+ *   octant_id   <-- octant id (1 to 8)
+ *   octant      <-- octant direction signs
+ *   verbosity   <-- verbosity level
+ *   precision   <-- linear solver precision
+ *   coefap      <-- boundary condition array (explicit part)
+ *   coefbp      <-- boundary condition array (implicit part)
+ *   cofbfp      <-- boundary condition array for diffusion (implicit part)
+ *   flurds      --- pseudo mass flux work array (interior faces)
+ *   flurdb      --- pseudo mass flux work array (boundary faces)
+ *   viscf       <-- visc*surface/dist at interior faces (zero)
+ *   viscb       <-- visc*surface/dist at boundary faces (zero)
+ *   rovsdt      <-- implicit source term
+ *   rhs         <-- explicit source term
+ *   radiance_b  --> interleaved radiance for all directions of the octant
+ *----------------------------------------------------------------------------*/
+
+static void
+_batch_solve(cs_sles_it_t     *sc,
+             int               octant_id,
+             const int         octant[3],
+             int               verbosity,
+             double            precision,
+             const cs_real_t   coefap[],
+             const cs_real_t   coefbp[],
+             const cs_real_t   cofbfp[],
+             cs_real_t         flurds[],
+             cs_real_t         flurdb[],
+             const cs_real_t   viscf[],
+             const cs_real_t   viscb[],
+             const cs_real_t   rovsdt[],
+             const cs_real_t   rhs[],
+             cs_real_t         radiance_b[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+
+  const int n_dirs = cs_glob_rad_transfer_params->ndirs;
+
+  char name[32];
+  sprintf(name, "radiation_octant_%d", octant_id);
+
+  cs_matrix_t **a = _get_batch_matrices(n_dirs);
+
+  cs_real_t *da, *xa, *rhs_b;
+  double *r_norm, *residue;
+  int *n_iter;
+
+  BFT_MALLOC(da, (size_t)n_cells_ext*n_dirs, cs_real_t);
+  BFT_MALLOC(xa, (size_t)2*n_i_faces*n_dirs, cs_real_t);
+  BFT_MALLOC(rhs_b, (size_t)n_cells*n_dirs, cs_real_t);
+  BFT_MALLOC(r_norm, n_dirs, double);
+  BFT_MALLOC(residue, n_dirs, double);
+  BFT_MALLOC(n_iter, n_dirs, int);
+
+  for (int dir_id = 0; dir_id < n_dirs; dir_id++) {
+
+    cs_real_t v[3] = {octant[0]*cs_glob_rad_transfer_params->vect_s[dir_id][0],
+                      octant[1]*cs_glob_rad_transfer_params->vect_s[dir_id][1],
+                      octant[2]*cs_glob_rad_transfer_params->vect_s[dir_id][2]};
+
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+      flurds[face_id] = cs_math_3_dot_product(v, i_face_normal[face_id]);
+
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+      flurdb[face_id] = cs_math_3_dot_product(v, b_face_normal[face_id]);
+
+    /* Matrix (pure upwind convection and implicit source term) */
+
+    cs_real_t *_da = da + (size_t)n_cells_ext*dir_id;
+    cs_real_t *_xa = xa + (size_t)2*n_i_faces*dir_id;
+
+    cs_matrix_wrapper_scalar(1,     /* iconvp */
+                             0,     /* idiffp */
+                             1,     /* ndircp */
+                             2,     /* isym */
+                             1.,    /* thetap */
+                             0,     /* imucpp */
+                             coefbp,
+                             cofbfp,
+                             rovsdt,
+                             flurds,
+                             flurdb,
+                             viscf,
+                             viscb,
+                             NULL,
+                             _da,
+                             _xa);
+
+    cs_matrix_set_coefficients(a[dir_id],
+                               false,
+                               NULL,
+                               NULL,
+                               n_i_faces,
+                               (const cs_lnum_2_t *)(m->i_face_cells),
+                               _da,
+                               _xa);
+
+    /* Right-hand side: explicit source term and upwind boundary values
+       (the radiance is solved for from a zero initial value) */
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      rhs_b[cell_id*n_dirs + dir_id] = rhs[cell_id];
+
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+      if (flurdb[face_id] < 0.) {
+        cs_lnum_t cell_id = b_face_cells[face_id];
+        rhs_b[cell_id*n_dirs + dir_id] -= flurdb[face_id] * coefap[face_id];
+      }
+    }
+
+    r_norm[dir_id] = 0.;
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      r_norm[dir_id] += cs_math_sq(rhs_b[cell_id*n_dirs + dir_id]);
+
+  }
+
+  cs_parall_sum(n_dirs, CS_DOUBLE, r_norm);
+
+  for (int dir_id = 0; dir_id < n_dirs; dir_id++)
+    r_norm[dir_id] = sqrt(r_norm[dir_id]);
+
+  for (cs_lnum_t ii = 0; ii < n_cells_ext*n_dirs; ii++)
+    radiance_b[ii] = 0.;
+
+  cs_sles_it_solve_multi(sc,
+                         name,
+                         n_dirs,
+                         n_dirs,
+                         (const cs_matrix_t *const *)a,
+                         verbosity,
+                         precision,
+                         r_norm,
+                         n_iter,
+                         residue,
+                         rhs_b,
+                         radiance_b);
+
+  if (verbosity > 0) {
+    int n_iter_max = 0;
+    for (int dir_id = 0; dir_id < n_dirs; dir_id++)
+      n_iter_max = CS_MAX(n_iter_max, n_iter[dir_id]);
+    bft_printf(_("  %s: %d directions, %d iteration(s)\n"),
+               name, n_dirs, n_iter_max);
+  }
+
+  for (int dir_id = 0; dir_id < n_dirs; dir_id++)
+    cs_matrix_release_coefficients(a[dir_id]);
+
+  BFT_FREE(n_iter);
+  BFT_FREE(residue);
+  BFT_FREE(r_norm);
+  BFT_FREE(rhs_b);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Order linear solvers for DOM radiative model.
+ * \brief Order linear solvers (or sweeps) for DOM radiative model.
  */
 /*----------------------------------------------------------------------------*/
 
@@ -244,13 +932,53 @@ _order_by_direction(void)
     = (const cs_real_3_t *restrict)fvq->cell_cen;
 
   int kdir = 0;
+  int octant_id = 0;
 
   cs_real_t *s;
   BFT_MALLOC(s, n_cells, cs_real_t);
 
+  /* For the sweep solver, cell orderings are kept for each direction */
+
+  const bool sweep = cs_glob_rad_transfer_params->dom_sweep;
+
+  if (sweep) {
+    _free_sweep_orders();
+    _build_cell_faces_adjacency();
+    _n_sweep_dirs = 8 * cs_glob_rad_transfer_params->ndirs;
+    BFT_MALLOC(_sweep_orders, _n_sweep_dirs, _sweep_order_t);
+  }
+
+  /* For batched solves, a same ordering (along the octant's diagonal)
+     is used for all directions of an octant */
+
+  const bool batch = _use_batch();
+
   for (int ii = -1; ii < 2; ii+=2) {
     for (int jj = -1; jj < 2; jj+=2) {
       for (int kk = -1; kk < 2; kk+=2) {
+
+        octant_id++;
+
+        cs_sles_it_t *sc_batch = (batch) ? _batch_sles_context(octant_id) : NULL;
+
+        if (sc_batch != NULL) {
+
+          for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+            s[c_id] = ii*cell_cen[c_id][0] + jj*cell_cen[c_id][1]
+                                           + kk*cell_cen[c_id][2];
+
+          cs_lnum_t *order;
+          BFT_MALLOC(order, n_cells, cs_lnum_t);
+
+          _order_axis(s, order, n_cells);
+
+          cs_sles_it_assign_order(sc_batch, &order); /* becomes owner */
+
+          kdir += cs_glob_rad_transfer_params->ndirs;
+
+          continue;
+        }
+
         for (int dir_id = 0; dir_id < cs_glob_rad_transfer_params->ndirs; dir_id++) {
 
           cs_real_t v[3] = {ii*cs_glob_rad_transfer_params->vect_s[dir_id][0],
@@ -260,6 +988,25 @@ _order_by_direction(void)
           /* Gloal direction id */
           kdir++;
 
+          if (sweep) {
+
+            for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+              s[c_id] =   v[0]*cell_cen[c_id][0]
+                        + v[1]*cell_cen[c_id][1]
+                        + v[2]*cell_cen[c_id][2];
+
+            cs_lnum_t *order;
+            BFT_MALLOC(order, n_cells, cs_lnum_t);
+
+            _order_axis(s, order, n_cells);
+
+            _sweep_order_build(v, order, _sweep_orders + kdir - 1);
+
+            BFT_FREE(order);
+
+            continue;
+          }
+
           char name[32];
           sprintf(name, "radiation_%03d", kdir);
 
@@ -399,6 +1146,14 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
   if (cs_glob_rad_transfer_params->atmo_ir_absorption)
     BFT_MALLOC(ck_u_d,  n_cells_ext, cs_real_t);
 
+  /* Interleaved radiance of all directions of an octant for batched solves */
+
+  cs_real_t *radiance_b = NULL;
+  if (_use_batch())
+    BFT_MALLOC(radiance_b,
+               (size_t)n_cells_ext*cs_glob_rad_transfer_params->ndirs,
+               cs_real_t);
+
   /* Initialization */
 
   cs_field_t *f_qinspe;
@@ -425,7 +1180,8 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
   /* There are Dirichlet BCs */
   int ndirc1 = 1;
 
-  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
+  if (   cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1
+      || (cs_glob_rad_transfer_params->dom_sweep && _sweep_orders == NULL))
     _order_by_direction();
 
   /*                              / -> ->
@@ -500,14 +1256,51 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
     f_down = cs_field_by_name_try("rad_flux_down");
   }
 
+  /* No face diffusion */
+
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+    viscf[face_id] = 0.0;
+
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+    viscb[face_id] = 0.0;
+
   /* Angular discretization */
 
   int kdir = 0;
+  int octant_id = 0;
 
   for (int ii = -1; ii <= 1; ii+=2) {
     for (int jj = -1; jj <= 1; jj+=2) {
       for (int kk = -1; kk <= 1; kk+=2) {
 
+        /* Batched solution of all directions of the octant */
+
+        octant_id++;
+
+        cs_sles_it_t *sc_batch = NULL;
+
+        if (radiance_b != NULL) {
+          sc_batch = _batch_sles_context(octant_id);
+          if (sc_batch != NULL) {
+            const int octant[3] = {ii, jj, kk};
+            _batch_solve(sc_batch,
+                         octant_id,
+                         octant,
+                         vcopt.iwarni,
+                         vcopt.epsilo,
+                         coefap,
+                         coefbp,
+                         cofbfp,
+                         flurds,
+                         flurdb,
+                         viscf,
+                         viscb,
+                         rovsdt,
+                         rhs0,
+                         radiance_b);
+          }
+        }
+
         for (int dir_id = 0; dir_id < cs_glob_rad_transfer_params->ndirs; dir_id++) {
           vect_s[0] = ii * cs_glob_rad_transfer_params->vect_s[dir_id][0];
           vect_s[1] = jj * cs_glob_rad_transfer_params->vect_s[dir_id][1];
@@ -597,37 +1390,58 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
           /* All boundary convective fluxes with upwind */
           int icvflb = 0;
 
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
-                                             1,   /* external sub-iteration */
-                                             -1,  /* f_id */
-                                             cnom,
-                                             ndirc1,
-                                             iescap,
-                                             imucpp,
-                                             &vcopt,
-                                             radiance_prev,
-                                             radiance,
-                                             coefap,
-                                             coefbp,
-                                             cofafp,
-                                             cofbfp,
-                                             flurds,
-                                             flurdb,
-                                             viscf,
-                                             viscb,
-                                             viscf,
-                                             viscb,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             icvflb,
-                                             NULL,
-                                             rovsdt,
-                                             rhs,
-                                             radiance,
-                                             dpvar,
-                                             NULL,
-                                             NULL);
+          if (cs_glob_rad_transfer_params->dom_sweep) {
+            _sweep_solve(_sweep_orders + kdir - 1,
+                         cnom,
+                         vcopt.iwarni,
+                         vcopt.epsrsm,
+                         coefap,
+                         coefbp,
+                         flurds,
+                         flurdb,
+                         rovsdt,
+                         rhs,
+                         radiance,
+                         radiance_prev);
+          }
+          else if (sc_batch != NULL) {
+            const int n_dirs = cs_glob_rad_transfer_params->ndirs;
+            for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+              radiance[cell_id] = radiance_b[cell_id*n_dirs + dir_id];
+          }
+          else {
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
+                                               1,   /* external sub-iteration */
+                                               -1,  /* f_id */
+                                               cnom,
+                                               ndirc1,
+                                               iescap,
+                                               imucpp,
+                                               &vcopt,
+                                               radiance_prev,
+                                               radiance,
+                                               coefap,
+                                               coefbp,
+                                               cofafp,
+                                               cofbfp,
+                                               flurds,
+                                               flurdb,
+                                               viscf,
+                                               viscb,
+                                               viscf,
+                                               viscb,
+                                               NULL,
+                                               NULL,
+                                               NULL,
+                                               icvflb,
+                                               NULL,
+                                               rovsdt,
+                                               rhs,
+                                               radiance,
+                                               dpvar,
+                                               NULL,
+                                               NULL);
+          }
 
           /* Integration of fluxes and source terms */
 
@@ -714,6 +1528,7 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
   BFT_FREE(dpvar);
   BFT_FREE(radiance);
   BFT_FREE(radiance_prev);
+  BFT_FREE(radiance_b);
 }
 
 /*-------------------------------------------------------------------------------*/
@@ -2102,6 +2917,19 @@ cs_rad_transfer_solve(int               bc_type[],
   BFT_FREE(iempimh2);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data cached by the radiative transfer solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  _free_sweep_orders();
+  _free_batch_matrices();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -54,6 +54,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_prototypes.h"
 #include "cs_random.h"
+#include "cs_sort.h"
 #include "cs_timer.h"
 #include "cs_mesh_location.h"
 #include "cs_restart.h"
@@ -183,6 +184,19 @@ typedef struct _cs_inflow_sem_t {
 
 } cs_inflow_sem_t;
 
+/* Binning of synthetic eddies on a uniform grid (SEM) */
+
+typedef struct {
+
+  int            n_bins[3];           /* Number of bins in each direction     */
+  double         origin[3];           /* Minimum coordinates of the grid      */
+  double         inv_size[3];         /* Inverse of bin size (per direction)  */
+
+  cs_lnum_t     *bin_index;           /* Index of eddies by bin               */
+  cs_lnum_t     *eddy_ids;            /* Eddy ids, grouped by bin             */
+
+} _sem_bins_t;
+
 typedef struct
 {
   double  val;
@@ -416,6 +430,313 @@ _batten_method(const cs_int_t       n_points,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the range of bins intersecting a coordinate interval
+ * in a given direction.
+ *
+ * parameters:
+ *   bins    <-- eddy bins structure
+ *   coo_id  <-- direction
+ *   c_min   <-- interval minimum coordinate
+ *   c_max   <-- interval maximum coordinate
+ *   s_id    --> first bin id in range
+ *   e_id    --> past-the-end bin id in range
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_sem_bin_range(const _sem_bins_t  *bins,
+               int                 coo_id,
+               double              c_min,
+               double              c_max,
+               int                *s_id,
+               int                *e_id)
+{
+  const int n = bins->n_bins[coo_id];
+
+  double b_min = (c_min - bins->origin[coo_id]) * bins->inv_size[coo_id];
+  double b_max = (c_max - bins->origin[coo_id]) * bins->inv_size[coo_id];
+
+  int i_min = (b_min > 0) ? (int)CS_MIN(b_min, n-1) : 0;
+  int i_max = (b_max > 0) ? (int)CS_MIN(b_max, n-1) : 0;
+
+  if (c_max < c_min) { /* empty interval */
+    i_min = 0;
+    i_max = -1;
+  }
+
+  *s_id = i_min;
+  *e_id = i_max + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Bucket synthetic eddies in a uniform grid over the eddy box.
+ *
+ * Bins are at least as large as the largest eddy support in each
+ * direction, so that a point only needs to visit bins adjacent to its own.
+ * Eddy ids remain in increasing order inside each bin.
+ *
+ * parameters:
+ *   n_eddies   <-- number of eddies
+ *   position   <-- eddy positions
+ *   box_min    <-- minimum coordinates of the eddy box
+ *   box_length <-- dimensions of the eddy box
+ *   l_max      <-- maximum length scale in each direction
+ *   bins       --> eddy bins structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bins_build(cs_lnum_t       n_eddies,
+                const double    position[],
+                const double    box_min[3],
+                const double    box_length[3],
+                const double    l_max[3],
+                _sem_bins_t    *bins)
+{
+  const int max_bins_per_dim = 1024;
+
+  /* Grid dimensions, limiting the total number of bins to
+     the number of eddies */
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    double n = 1.;
+    if (l_max[coo_id] > 0.)
+      n = box_length[coo_id] / l_max[coo_id];
+    bins->n_bins[coo_id] = (int)CS_MAX(1., CS_MIN(n, max_bins_per_dim));
+  }
+
+  while (  (double)bins->n_bins[0] * bins->n_bins[1] * bins->n_bins[2]
+         > CS_MAX(n_eddies, 1)) {
+    int coo_max = 0;
+    for (int coo_id = 1; coo_id < 3; coo_id++) {
+      if (bins->n_bins[coo_id] > bins->n_bins[coo_max])
+        coo_max = coo_id;
+    }
+    bins->n_bins[coo_max] = (bins->n_bins[coo_max] + 1) / 2;
+  }
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    bins->origin[coo_id] = box_min[coo_id];
+    bins->inv_size[coo_id] = 0.;
+    if (box_length[coo_id] > 0.)
+      bins->inv_size[coo_id] = bins->n_bins[coo_id] / box_length[coo_id];
+  }
+
+  /* Counting sort of eddies by bin */
+
+  const cs_lnum_t n_bins = bins->n_bins[0] * bins->n_bins[1] * bins->n_bins[2];
+
+  cs_lnum_t *bin_id;
+  BFT_MALLOC(bin_id, n_eddies, cs_lnum_t);
+  BFT_MALLOC(bins->bin_index, n_bins + 1, cs_lnum_t);
+  BFT_MALLOC(bins->eddy_ids, n_eddies, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_bins + 1; i++)
+    bins->bin_index[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_eddies; i++) {
+    int b[3], e[3];
+    for (int coo_id = 0; coo_id < 3; coo_id++)
+      _sem_bin_range(bins, coo_id,
+                     position[i*3 + coo_id], position[i*3 + coo_id],
+                     b + coo_id, e + coo_id);
+    bin_id[i] = (b[2]*bins->n_bins[1] + b[1])*bins->n_bins[0] + b[0];
+    bins->bin_index[bin_id[i] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_bins; i++)
+    bins->bin_index[i+1] += bins->bin_index[i];
+
+  for (cs_lnum_t i = 0; i < n_eddies; i++) {
+    cs_lnum_t j = bins->bin_index[bin_id[i]];
+    bins->eddy_ids[j] = i;
+    bins->bin_index[bin_id[i]] += 1;
+  }
+
+  for (cs_lnum_t i = n_bins; i > 0; i--)
+    bins->bin_index[i] = bins->bin_index[i-1];
+  bins->bin_index[0] = 0;
+
+  BFT_FREE(bin_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Free arrays of an eddy bins structure.
+ *
+ * parameters:
+ *   bins <-> eddy bins structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bins_free(_sem_bins_t  *bins)
+{
+  BFT_FREE(bins->bin_index);
+  BFT_FREE(bins->eddy_ids);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Select eddies located inside a given box, using bins.
+ *
+ * Selected eddy ids are returned in increasing order.
+ *
+ * parameters:
+ *   bins     <-- eddy bins structure
+ *   position <-- eddy positions
+ *   box      <-- box extents (min x, y, z, max x, y, z)
+ *   ids      --> selected eddy ids (size: number of eddies)
+ *
+ * returns:
+ *   number of selected eddies
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_sem_bins_select(const _sem_bins_t  *bins,
+                 const double        position[],
+                 const double        box[6],
+                 cs_lnum_t           ids[])
+{
+  cs_lnum_t n_sel = 0;
+
+  int s[3], e[3];
+  for (int coo_id = 0; coo_id < 3; coo_id++)
+    _sem_bin_range(bins, coo_id, box[coo_id], box[3 + coo_id],
+                   s + coo_id, e + coo_id);
+
+  for (int bk = s[2]; bk < e[2]; bk++) {
+    for (int bj = s[1]; bj < e[1]; bj++) {
+      for (int bi = s[0]; bi < e[0]; bi++) {
+        cs_lnum_t bin_id = (bk*bins->n_bins[1] + bj)*bins->n_bins[0] + bi;
+        for (cs_lnum_t k = bins->bin_index[bin_id];
+             k < bins->bin_index[bin_id + 1];
+             k++) {
+          cs_lnum_t i = bins->eddy_ids[k];
+          const double *p = position + 3*i;
+          if (   p[0] >= box[0] && p[0] <= box[3]
+              && p[1] >= box[1] && p[1] <= box[4]
+              && p[2] >= box[2] && p[2] <= box[5])
+            ids[n_sel++] = i;
+        }
+      }
+    }
+  }
+
+  cs_sort_lnum(ids, n_sel);
+
+  return n_sel;
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute synthetic eddies from rank 0 to all ranks, each rank
+ * receiving only the eddies located in the support box of its points.
+ *
+ * parameters:
+ *   inflow     <-- SEM structure (complete eddy set on rank 0)
+ *   bins       <-- bins of complete eddy set (used on rank 0 only)
+ *   l_box      <-- local support box (min x, y, z, max x, y, z)
+ *   n_l_eddies --> number of local eddies
+ *   l_position --> local eddy positions (allocated here)
+ *   l_energy   --> local eddy energies (allocated here)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_distribute(const cs_inflow_sem_t  *inflow,
+                const _sem_bins_t      *bins,
+                double                  l_box[6],
+                cs_lnum_t              *n_l_eddies,
+                double                **l_position,
+                double                **l_energy)
+{
+  const int n_ranks = cs_glob_n_ranks;
+
+  int n_recv = 0;
+  int *send_count = NULL, *send_shift = NULL;
+  double *boxes = NULL, *send_buf = NULL;
+
+  if (cs_glob_rank_id == 0)
+    BFT_MALLOC(boxes, 6*n_ranks, double);
+
+  MPI_Gather(l_box, 6, MPI_DOUBLE, boxes, 6, MPI_DOUBLE, 0,
+             cs_glob_mpi_comm);
+
+  /* Select and pack eddies for each rank */
+
+  if (cs_glob_rank_id == 0) {
+
+    const int n_structures = inflow->n_structures;
+
+    cs_lnum_t *ids;
+    BFT_MALLOC(ids, n_structures, cs_lnum_t);
+    BFT_MALLOC(send_count, n_ranks, int);
+    BFT_MALLOC(send_shift, n_ranks + 1, int);
+
+    size_t buf_size = 6*n_structures;
+    BFT_MALLOC(send_buf, buf_size, double);
+
+    send_shift[0] = 0;
+
+    for (int rank_id = 0; rank_id < n_ranks; rank_id++) {
+
+      cs_lnum_t n_sel = _sem_bins_select(bins,
+                                         inflow->position,
+                                         boxes + 6*rank_id,
+                                         ids);
+
+      if ((size_t)(send_shift[rank_id] + 6*n_sel) > buf_size) {
+        buf_size = CS_MAX(2*buf_size, (size_t)(send_shift[rank_id] + 6*n_sel));
+        BFT_REALLOC(send_buf, buf_size, double);
+      }
+
+      double *_buf = send_buf + send_shift[rank_id];
+      for (cs_lnum_t j = 0; j < n_sel; j++) {
+        for (int coo_id = 0; coo_id < 3; coo_id++) {
+          _buf[6*j + coo_id] = inflow->position[3*ids[j] + coo_id];
+          _buf[6*j + 3 + coo_id] = inflow->energy[3*ids[j] + coo_id];
+        }
+      }
+
+      send_count[rank_id] = 6*n_sel;
+      send_shift[rank_id + 1] = send_shift[rank_id] + 6*n_sel;
+
+    }
+
+    BFT_FREE(ids);
+    BFT_FREE(boxes);
+
+  }
+
+  MPI_Scatter(send_count, 1, MPI_INT, &n_recv, 1, MPI_INT, 0,
+              cs_glob_mpi_comm);
+
+  double *recv_buf;
+  BFT_MALLOC(recv_buf, n_recv, double);
+
+  MPI_Scatterv(send_buf, send_count, send_shift, MPI_DOUBLE,
+               recv_buf, n_recv, MPI_DOUBLE, 0, cs_glob_mpi_comm);
+
+  BFT_FREE(send_buf);
+  BFT_FREE(send_shift);
+  BFT_FREE(send_count);
+
+  /* Unpack local eddies */
+
+  *n_l_eddies = n_recv / 6;
+
+  BFT_MALLOC(*l_position, 3*(*n_l_eddies), double);
+  BFT_MALLOC(*l_energy, 3*(*n_l_eddies), double);
+
+  for (cs_lnum_t j = 0; j < *n_l_eddies; j++) {
+    for (int coo_id = 0; coo_id < 3; coo_id++) {
+      (*l_position)[3*j + coo_id] = recv_buf[6*j + coo_id];
+      (*l_energy)[3*j + coo_id] = recv_buf[6*j + 3 + coo_id];
+    }
+  }
+
+  BFT_FREE(recv_buf);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Generation of synthetic turbulence via the Synthetic Eddy Method (SEM).
  *
@@ -468,6 +789,11 @@ _synthetic_eddy_method(const cs_int_t    n_points,
   double     box_min_coord[3];
   double     box_max_coord[3];
 
+#if defined(HAVE_MPI)
+  double     l_box[6];
+#endif
+  double     l_max[3] = {0., 0., 0.};
+
   double    *length_scale;
   double    *ponderation;
 
@@ -603,11 +929,30 @@ _synthetic_eddy_method(const cs_int_t    n_points,
 
     }
 
+  /* Local box, and maximum size of eddies, used for binning */
+
+#if defined(HAVE_MPI)
+  for (coo_id = 0; coo_id < 3; coo_id++) {
+    l_box[coo_id] = box_min_coord[coo_id];
+    l_box[3 + coo_id] = box_max_coord[coo_id];
+  }
+#endif
+
+  for (point_id = 0; point_id < n_points; point_id++)
+    for (coo_id = 0; coo_id < 3; coo_id++)
+      l_max[coo_id] = CS_MAX(l_max[coo_id], length_scale[3*point_id + coo_id]);
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_rank_id >= 0) {
 
-    double min_glob[3], max_glob[3];
+    double min_glob[3], max_glob[3], l_max_glob[3];
+
+    MPI_Allreduce(l_max, l_max_glob, 3, CS_MPI_REAL, MPI_MAX,
+                  cs_glob_mpi_comm);
+
+    for (coo_id = 0; coo_id < 3; coo_id++)
+      l_max[coo_id] = l_max_glob[coo_id];
 
     MPI_Allreduce(box_min_coord, &min_glob, 3, CS_MPI_REAL, MPI_MIN,
                   cs_glob_mpi_comm);
@@ -671,19 +1016,6 @@ _synthetic_eddy_method(const cs_int_t    n_points,
 
     }
 
-#if defined(HAVE_MPI)
-
-    if (cs_glob_rank_id >= 0) {
-
-      MPI_Bcast(inflow->energy,   3*inflow->n_structures,
-                CS_MPI_REAL, 0, cs_glob_mpi_comm);
-      MPI_Bcast(inflow->position, 3*inflow->n_structures,
-                CS_MPI_REAL, 0, cs_glob_mpi_comm);
-
-    }
-
-#endif
-
   }
 
   /* Estimation of the convection speed (with ponderation by surface) */
@@ -820,58 +1152,110 @@ _synthetic_eddy_method(const cs_int_t    n_points,
 
   }
 
+  /* Binning and distribution of the eddies */
+  /*-----------------------------------------*/
+
+  /* Eddies are advanced on rank 0; other ranks only receive those
+     which may overlap their own points */
+
+  cs_lnum_t n_l_eddies = inflow->n_structures;
+  const double *l_position = inflow->position;
+  const double *l_energy = inflow->energy;
+
+  double *_l_position = NULL, *_l_energy = NULL;
+
+  _sem_bins_t  bins;
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_rank_id >= 0) {
 
-    MPI_Bcast(inflow->energy,   3*inflow->n_structures,
-              CS_MPI_REAL, 0, cs_glob_mpi_comm);
-    MPI_Bcast(inflow->position, 3*inflow->n_structures,
-              CS_MPI_REAL, 0, cs_glob_mpi_comm);
+    if (cs_glob_rank_id == 0)
+      _sem_bins_build(inflow->n_structures, inflow->position,
+                      box_min_coord, box_length, l_max, &bins);
+
+    _sem_distribute(inflow, &bins, l_box,
+                    &n_l_eddies, &_l_position, &_l_energy);
+
+    if (cs_glob_rank_id == 0)
+      _sem_bins_free(&bins);
+
+    l_position = _l_position;
+    l_energy = _l_energy;
 
   }
 
 #endif
 
+  _sem_bins_build(n_l_eddies, l_position,
+                  box_min_coord, box_length, l_max, &bins);
+
   /* Computation of the eddy signal */
   /*--------------------------------*/
 
+  /* Only eddies in bins overlapping the support of each point are visited */
+
   alpha = sqrt(box_volume / (double) inflow->n_structures);
 
-  for (point_id = 0; point_id < n_points; point_id++) {
+# pragma omp parallel for if(n_points > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+    const double *p_coo = point_coordinates + p_id*3;
+    const double *p_ls = length_scale + p_id*3;
 
     double distance[3];
+    int s_id[3], e_id[3];
 
-    for (struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    for (int i = 0; i < 3; i++)
+      _sem_bin_range(&bins, i, p_coo[i] - p_ls[i], p_coo[i] + p_ls[i],
+                     s_id + i, e_id + i);
 
-      for (coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id*3 + coo_id]
-                 - inflow->position[struct_id*3 + coo_id]);
+    for (int bk = s_id[2]; bk < e_id[2]; bk++) {
+      for (int bj = s_id[1]; bj < e_id[1]; bj++) {
+        for (int bi = s_id[0]; bi < e_id[0]; bi++) {
 
-      if (distance[0] < length_scale[point_id*3 + 0] &&
-          distance[1] < length_scale[point_id*3 + 1] &&
-          distance[2] < length_scale[point_id*3 + 2]) {
+          cs_lnum_t bin_id = (bk*bins.n_bins[1] + bj)*bins.n_bins[0] + bi;
 
-        double form_function = 1.;
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id*3 + coo_id])
-            /sqrt(2./3.*length_scale[point_id*3 + coo_id]);
+          for (cs_lnum_t k = bins.bin_index[bin_id];
+               k < bins.bin_index[bin_id + 1];
+               k++) {
 
-        for (coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id*3 + coo_id] +=
-            inflow->energy[struct_id*3 + coo_id]*form_function;
+            cs_lnum_t e = bins.eddy_ids[k];
 
-      }
+            for (int i = 0; i < 3; i++)
+              distance[i] = CS_ABS(p_coo[i] - l_position[e*3 + i]);
+
+            if (distance[0] < p_ls[0] &&
+                distance[1] < p_ls[1] &&
+                distance[2] < p_ls[2]) {
 
+              double form_function = 1.;
+              for (int i = 0; i < 3; i++)
+                form_function *=
+                  (1.-distance[i]/p_ls[i])
+                  /sqrt(2./3.*p_ls[i]);
+
+              for (int i = 0; i < 3; i++)
+                fluctuations[p_id*3 + i] += l_energy[e*3 + i]*form_function;
+
+            }
+
+          }
+
+        }
+      }
     }
 
-    for (coo_id = 0; coo_id < 3; coo_id++)
-      fluctuations[point_id*3 + coo_id] *= alpha;
+    for (int i = 0; i < 3; i++)
+      fluctuations[p_id*3 + i] *= alpha;
 
   }
 
+  _sem_bins_free(&bins);
+
+  BFT_FREE(_l_position);
+  BFT_FREE(_l_energy);
+
   BFT_FREE(length_scale);
 }
 
@@ -108,6 +108,7 @@ integer          imucpp, idftnp, iswdyp
 
 integer          icvflb, imasac
 integer          ivoid(1)
+integer          f_ids(2)
 
 double precision rnorm , d2s3, divp23, epz2
 double precision deltk , deltw, a11, a12, a22, a21
@@ -128,7 +129,8 @@ double precision rvoid(1)
 double precision, allocatable, dimension(:) :: viscf, viscb
 double precision, allocatable, dimension(:) :: smbrk, smbrw
 double precision, allocatable, dimension(:) :: tinstk, tinstw, xf1
-double precision, allocatable, dimension(:,:) :: gradk, grado, grad
+double precision, allocatable, dimension(:,:) :: grad
+double precision, allocatable, dimension(:,:,:) :: gradkw
 double precision, allocatable, dimension(:,:,:) :: gradv
 double precision, allocatable, dimension(:) :: s2pw2
 double precision, allocatable, dimension(:) :: w1, w2
@@ -256,19 +258,18 @@ d2s3 = 2.d0/3.d0
 !===============================================================================
 
 ! Allocate temporary arrays for gradients calculation
-allocate(gradk(3,ncelet), grado(3,ncelet))
+allocate(gradkw(3,ncelet,2))
 
 iccocg = 1
 inc = 1
 iprev = 1
 
-call field_gradient_scalar(ivarfl(ik), iprev, imrgra, inc,          &
-                           iccocg,                                  &
-                           gradk)
+f_ids(1) = ivarfl(ik)
+f_ids(2) = ivarfl(iomg)
 
-call field_gradient_scalar(ivarfl(iomg), iprev, imrgra, inc,        &
-                           iccocg,                                  &
-                           grado)
+call field_gradient_scalars(2, f_ids, iprev, imrgra, inc,           &
+                            iccocg,                                 &
+                            gradkw)
 
 if (iddes.eq.1) then
   call field_get_val_s_by_name("hybrid_blend", ddes_fd_coeff)
@@ -283,13 +284,13 @@ if (iddes.eq.1) then
 end if
 
 do iel = 1, ncel
-  gdkgdw(iel) = gradk(1,iel)*grado(1,iel) &
-              + gradk(2,iel)*grado(2,iel) &
-              + gradk(3,iel)*grado(3,iel)
+  gdkgdw(iel) = gradkw(1,iel,1)*gradkw(1,iel,2) &
+              + gradkw(2,iel,1)*gradkw(2,iel,2) &
+              + gradkw(3,iel,1)*gradkw(3,iel,2)
 enddo
 
 ! Free memory
-deallocate(gradk, grado)
+deallocate(gradkw)
 
 !===============================================================================
 ! 2.2. Compute the weight f1 (stored in xf1)
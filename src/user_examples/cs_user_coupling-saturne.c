@@ -130,6 +130,18 @@ cs_user_saturne_coupling(void)
   }
   /*! [coupling_saturne_2] */
 
+  /*! [coupling_saturne_3] */
+  {
+    /*-------------------------------------------------------------------------
+     * Example 3: use MPI-3 neighborhood collectives for coupling exchanges
+     * (must be set identically in all coupled instances).
+     *-------------------------------------------------------------------------*/
+
+    cs_sat_coupling_set_exchange_type(PLE_LOCATOR_EXCHANGE_NEIGHBOR);
+
+  }
+  /*! [coupling_saturne_3] */
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -339,6 +339,25 @@ cs_user_parameters(void)
   /*! [param_var_is_buoyant] */
 
 
+  /* Example: share implicit boundary condition coefficients of scalars
+   * having the same boundary condition types and diffusivity, so that
+   * only their explicit coefficients are stored separately */
+  /*-------------------------------------------------------------------*/
+
+  /*! [param_var_bc_coeffs_ref] */
+  {
+    /* retrieve scalar fields by their names */
+    cs_field_t *sca1 = cs_field_by_name("scalar1");
+    cs_field_t *sca2 = cs_field_by_name("scalar2");
+
+    int key_bc_ref = cs_field_key_id("bc_coeffs_ref");
+
+    cs_field_set_key_int(sca2, key_bc_ref, sca1->id);
+
+  }
+  /*! [param_var_bc_coeffs_ref] */
+
+
   /* Example: add boundary values for all scalars */
   /*----------------------------------------------*/
 
@@ -283,6 +283,13 @@ cs_user_time_moments(void)
    *   restart_name <--  name in previous run, NULL for default
    */
 
+  /* Use compensated accumulation, to limit rounding errors
+     over long averaging periods. */
+
+  /*! [tmom_compensated] */
+  cs_time_moment_set_compensated(true);
+  /*! [tmom_compensated] */
+
   {
     /* Moment <U> calculated starting from time step 1000. */
 
@@ -154,6 +154,23 @@ cs_user_parallel_io(void)
 #endif /* defined(HAVE_MPI_IO) && MPI_VERSION > 1 */
 
   /*! [perfomance_tuning_parallel_io] */
+
+  /* Example: write files funnelled through rank 0 using standard C IO,
+     with writes handed over to a background thread, so that computation
+     may proceed during postprocessing output (at most 256 MiB of data
+     is queued; beyond this, output waits for previous writes). */
+
+  /*! [perfomance_tuning_parallel_io_async] */
+
+#if defined(HAVE_MPI)
+  cs_file_set_default_access(CS_FILE_MODE_WRITE,
+                             CS_FILE_STDIO_SERIAL,
+                             MPI_INFO_NULL);
+#endif
+
+  cs_file_set_async_write_size(256*1024*1024);
+
+  /*! [perfomance_tuning_parallel_io_async] */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -482,6 +482,47 @@ cs_user_postprocess_meshes(void)
 
   /*--------------------------------------------------------------------------*/
 
+  /* Reduced output examples: instead of writing fields on the whole
+     volume, write them only on the cells cut by the plane z = 0.5,
+     and on the (time varying) layer of cells containing the 0.5
+     iso-surface of the field named "scalar1" */
+
+  /*! [post_define_mesh_6] */
+  {
+    const int n_writers = 1;
+    const int writer_ids[] = {2};  /* Associate to writer 2 */
+
+    /* Input must remain valid when the selection function is called */
+
+    static cs_real_t plane[4] = {0., 0., 1., -0.5};
+    static cs_post_iso_value_t iso = {-1, 0.5};
+
+    iso.field_id = cs_field_by_name("scalar1")->id;
+
+    cs_post_define_volume_mesh_by_func(6,               /* mesh id */
+                                       "Slice z = 0.5",
+                                       cs_cell_plane_intersect_select,
+                                       plane,           /* select input */
+                                       false,           /* time varying */
+                                       false,           /* add_groups */
+                                       true,            /* auto_variables */
+                                       n_writers,
+                                       writer_ids);
+
+    cs_post_define_volume_mesh_by_func(7,               /* mesh id */
+                                       "scalar1 = 0.5",
+                                       cs_cell_iso_value_select,
+                                       &iso,            /* select input */
+                                       true,            /* time varying */
+                                       false,           /* add_groups */
+                                       true,            /* auto_variables */
+                                       n_writers,
+                                       writer_ids);
+  }
+  /*! [post_define_mesh_6] */
+
+  /*--------------------------------------------------------------------------*/
+
   /* Example: extract face edges of another mesh */
 
   /*! [post_define_mesh_5] */
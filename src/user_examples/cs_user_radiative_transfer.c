@@ -140,6 +140,14 @@ cs_user_radiative_transfer_parameters(void)
   /* Number of directions, only for Tn quadrature */
   cs_glob_rad_transfer_params->ndirec = 3;
 
+  /* Solve each direction by sweeping cells in upwind order (true)
+     rather than with an iterative linear solver (false) */
+  cs_glob_rad_transfer_params->dom_sweep = false;
+
+  /* With the linear solver, solve all directions of an octant
+     together (true) rather than one direction at a time (false) */
+  cs_glob_rad_transfer_params->dom_batch = false;
+
   /* Method used to calculate the radiative source term:
      - 0: semi-analytic calculation (required with transparent media)
      - 1: conservative calculation
@@ -94,6 +94,43 @@ main (int argc, char *argv[])
   BFT_REALLOC(p3, 0, double);
   printf("p3 = %p\n", p3);
 
+  /* Many blocks, freed and reallocated in mixed order */
+
+  {
+    void *p[2000];
+    int i;
+    for (i = 0; i < 2000; i++)
+      BFT_MALLOC(p[i], i+1, double);
+    for (i = 0; i < 2000; i += 2)
+      BFT_FREE(p[i]);
+    for (i = 1; i < 2000; i += 2)
+      BFT_REALLOC(p[i], i+100, double);
+    for (i = 1; i < 2000; i += 2)
+      BFT_FREE(p[i]);
+    printf("current memory after mixed frees: %lu kB\n",
+           (unsigned long)bft_mem_size_current());
+  }
+
+  /* Memory arena */
+
+  {
+    double *a1, *a2;
+    bft_mem_arena_t *arena = bft_mem_arena_get("test");
+    BFT_ARENA_ALLOC(a1, arena, 1000, double);
+    printf("a1 = %p\n", (void *)a1);
+    bft_mem_arena_mark_t mark = bft_mem_arena_mark(arena);
+    BFT_ARENA_ALLOC(a2, arena, 1000000, double);
+    printf("a2 = %p\n", (void *)a2);
+    bft_mem_arena_release(arena, mark);
+    BFT_ARENA_ALLOC(a2, arena, 1000, double);
+    printf("a2 = %p\n", (void *)a2);
+    bft_mem_arena_reset_all();
+    printf("arena \"%s\" maximum size: %lu kB\n",
+           bft_mem_arena_get_name(arena),
+           (unsigned long)bft_mem_arena_size_max(arena));
+    bft_mem_arena_destroy_all();
+  }
+
   if (bft_mem_have_memalign() == 1) {
     void *pa;
     BFT_MEMALIGN(pa, 128, 100, double);
@@ -0,0 +1,211 @@
+/*============================================================================
+ * Unit test for shared boundary condition coefficients in cs_field.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_parameters.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static jmp_buf  _error_env;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Error handler returning to the test instead of exiting.
+ *----------------------------------------------------------------------------*/
+
+static void
+_error_handler(const char    *const file_name,
+               const int            line_num,
+               const int            sys_error_code,
+               const char    *const format,
+               va_list              arg_ptr)
+{
+  CS_UNUSED(file_name);
+  CS_UNUSED(line_num);
+  CS_UNUSED(sys_error_code);
+
+  printf("  expected error:\n");
+  vprintf(format, arg_ptr);
+  printf("\n");
+
+  longjmp(_error_env, 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Try to share implicit BC coefficients of a reference field.
+ *
+ * parameters:
+ *   f      <-> field which should share coefficients
+ *   f_ref  <-- reference field
+ *
+ * returns:
+ *   true if coefficients are shared, false if sharing was refused
+ *----------------------------------------------------------------------------*/
+
+static bool
+_try_share(cs_field_t        *f,
+           const cs_field_t  *f_ref)
+{
+  bool shared = false;
+
+  cs_field_set_key_int(f, cs_field_key_id("bc_coeffs_ref"), f_ref->id);
+
+  bft_error_handler_t *handler_prev = bft_error_handler_get();
+  bft_error_handler_set(_error_handler);
+
+  if (setjmp(_error_env) == 0) {
+    cs_field_allocate_bc_coeffs(f, true, false, false);
+    shared = (   f->bc_coeffs->ref_id == f_ref->id
+              && f->bc_coeffs->b == f_ref->bc_coeffs->b
+              && f->bc_coeffs->bf == f_ref->bc_coeffs->bf
+              && f->bc_coeffs->a != f_ref->bc_coeffs->a);
+  }
+
+  bft_error_handler_set(handler_prev);
+
+  return shared;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Minimal mesh: only element counts are needed */
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh->n_cells = 2;
+  cs_glob_mesh->n_cells_with_ghosts = 2;
+  cs_glob_mesh->n_b_faces = 10;
+
+  cs_mesh_location_initialize();
+  cs_mesh_location_build(cs_glob_mesh, -1);
+
+  cs_field_define_keys_base();
+  cs_parameters_define_field_keys();
+
+  const int k_sca_dif = cs_field_key_id("scalar_diffusivity_id");
+  const int k_sca_dif_ref = cs_field_key_id("scalar_diffusivity_ref");
+  const int k_sigma = cs_field_key_id("turbulent_schmidt");
+
+  const int type_flag = CS_FIELD_INTENSIVE | CS_FIELD_VARIABLE;
+
+  cs_field_t *f_ref = cs_field_create("ref", type_flag,
+                                      CS_MESH_LOCATION_CELLS, 1, true);
+  cs_field_t *f_same = cs_field_create("same", type_flag,
+                                       CS_MESH_LOCATION_CELLS, 1, true);
+  cs_field_t *f_sigma = cs_field_create("sigma", type_flag,
+                                        CS_MESH_LOCATION_CELLS, 1, true);
+  cs_field_t *f_dif = cs_field_create("dif", type_flag,
+                                      CS_MESH_LOCATION_CELLS, 1, true);
+  cs_field_t *f_dif_id = cs_field_create("dif_id", type_flag,
+                                         CS_MESH_LOCATION_CELLS, 1, true);
+  cs_field_t *f_visls = cs_field_create("visls", CS_FIELD_PROPERTY,
+                                        CS_MESH_LOCATION_CELLS, 1, false);
+
+  cs_field_t *f_var[] = {f_ref, f_same, f_sigma, f_dif, f_dif_id};
+
+  for (int i = 0; i < 5; i++) {
+    cs_field_set_key_double(f_var[i], k_sca_dif_ref, 1.e-5);
+    cs_field_set_key_double(f_var[i], k_sigma, 0.7);
+  }
+
+  cs_field_set_key_double(f_sigma, k_sigma, 1.0);
+  cs_field_set_key_double(f_dif, k_sca_dif_ref, 2.e-5);
+  cs_field_set_key_int(f_dif_id, k_sca_dif, f_visls->id);
+
+  cs_field_allocate_bc_coeffs(f_ref, true, false, false);
+
+  /* Identical diffusion settings: coefficients are shared */
+
+  printf("\nShare BC coefficients with identical settings:\n");
+  if (_try_share(f_same, f_ref) == false) {
+    printf("  error: BC coefficients not shared\n");
+    n_errors++;
+  }
+
+  /* Different turbulent Schmidt number or diffusivity: sharing refused */
+
+  cs_field_t *f_mismatch[] = {f_sigma, f_dif, f_dif_id};
+
+  for (int i = 0; i < 3; i++) {
+    printf("\nShare BC coefficients for field \"%s\":\n",
+           f_mismatch[i]->name);
+    if (_try_share(f_mismatch[i], f_ref)) {
+      printf("  error: BC coefficients shared with mismatched settings\n");
+      n_errors++;
+    }
+  }
+
+  cs_field_destroy_all();
+  cs_field_destroy_all_keys();
+
+  cs_mesh_location_finalize();
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  printf("\nShared BC coefficients test: %d error(s)\n", n_errors);
+
+  exit((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
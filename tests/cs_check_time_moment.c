@@ -0,0 +1,206 @@
+/*============================================================================
+ * Unit test for compensated accumulation in cs_time_moment.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bft_mem.h"
+
+#include "cs_field.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_time_moment.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define N_CELLS 4
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Data values at current time step (cs_time_moment_data_t function).
+ *
+ * parameters:
+ *   input <-- unused
+ *   vals  --> data values
+ *----------------------------------------------------------------------------*/
+
+static void
+_data_values(const void  *input,
+             cs_real_t   *vals)
+{
+  CS_UNUSED(input);
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  for (cs_lnum_t i = 0; i < N_CELLS; i++)
+    vals[i] = (1. + i)/3. + 1.e-2*((7*nt_cur) % 13);
+}
+
+/*----------------------------------------------------------------------------
+ * Accumulate a mean with a constant time step, and return the maximum
+ * relative error compared to a compensated sum of data values.
+ *
+ * parameters:
+ *   n_steps     <-- number of time steps
+ *   compensated <-- use compensated accumulation if true
+ *
+ * returns:
+ *   maximum relative error
+ *----------------------------------------------------------------------------*/
+
+static double
+_mean_error(int   n_steps,
+            bool  compensated)
+{
+  const cs_real_t dt[] = {0.1};
+
+  cs_real_t x[N_CELLS], sum[N_CELLS], c[N_CELLS];
+
+  for (cs_lnum_t i = 0; i < N_CELLS; i++) {
+    sum[i] = 0.;
+    c[i] = 0.;
+  }
+
+  /* Time step 0 only sets the previous time of moments */
+
+  cs_time_step_redefine_cur(0, 0.);
+
+  cs_time_moment_set_compensated(compensated);
+
+  int m_id = cs_time_moment_define_by_func("mean",
+                                           CS_MESH_LOCATION_CELLS,
+                                           1,
+                                           _data_values,
+                                           NULL,
+                                           NULL,
+                                           NULL,
+                                           CS_TIME_MOMENT_MEAN,
+                                           1,    /* nt_start */
+                                           -1,   /* t_start */
+                                           CS_TIME_MOMENT_RESTART_RESET,
+                                           NULL);
+
+  cs_field_t *f = cs_time_moment_get_field(m_id);
+  cs_field_allocate_values(f);
+  for (cs_lnum_t i = 0; i < N_CELLS; i++)
+    f->val[i] = 0.;
+
+  cs_time_moment_map_cell_dt(dt);
+  cs_time_moment_update_all();
+
+  for (int n = 0; n < n_steps; n++) {
+    cs_time_step_increment(dt[0]);
+    cs_time_moment_update_all();
+    _data_values(NULL, x);
+    for (cs_lnum_t i = 0; i < N_CELLS; i++) {  /* Kahan summation */
+      double y = x[i] - c[i];
+      double t = sum[i] + y;
+      c[i] = (t - sum[i]) - y;
+      sum[i] = t;
+    }
+  }
+
+  double err_max = 0.;
+
+  for (cs_lnum_t i = 0; i < N_CELLS; i++) {
+    double ref = sum[i] / n_steps;
+    double err = fabs((f->val[i] - ref) / ref);
+    if (err > err_max)
+      err_max = err;
+  }
+
+  cs_time_moment_destroy_all();
+  cs_field_destroy_all();
+
+  return err_max;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  const int n_steps = 1000000;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Minimal mesh: only element counts are needed */
+
+  cs_glob_mesh = cs_mesh_create();
+  cs_glob_mesh->n_cells = N_CELLS;
+  cs_glob_mesh->n_cells_with_ghosts = N_CELLS;
+
+  cs_mesh_location_initialize();
+  cs_mesh_location_build(cs_glob_mesh, -1);
+
+  /* Accumulate mean over a long period, with constant weight */
+
+  double err_std = _mean_error(n_steps, false);
+  double err_comp = _mean_error(n_steps, true);
+
+  cs_time_moment_set_compensated(false);
+
+  printf("\nMean over %d time steps, maximum relative error:\n"
+         "  standard accumulation:    %12.5e\n"
+         "  compensated accumulation: %12.5e\n",
+         n_steps, err_std, err_comp);
+
+  cs_field_destroy_all_keys();
+
+  cs_mesh_location_finalize();
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  /* Compensated result should be correct to rounding */
+
+  int retval = (err_comp > 1.e-15) ? EXIT_FAILURE : EXIT_SUCCESS;
+
+  exit(retval);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
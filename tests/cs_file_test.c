@@ -95,6 +95,127 @@ _create_test_data(void)
   f = cs_file_free(f);
 }
 
+/*----------------------------------------------------------------------------
+ * Write several records with a given asynchronous write queue size,
+ * then read them back and check values.
+ *
+ * parameters:
+ *   async_size  <-- maximum size of queued data (0 for synchronous writes)
+ *   block_start <-- global number of first value written by this rank
+ *   block_end   <-- global number of past-the-end value for this rank
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_async_write_test(size_t     async_size,
+                  cs_gnum_t  block_start,
+                  cs_gnum_t  block_end)
+{
+  const int n_records = 10;
+
+  int n_errors = 0;
+  char buf[80], ref_buf[80];
+  int ibuf[30];
+  cs_gnum_t i;
+  cs_file_t *f = NULL;
+
+  cs_file_set_async_write_size(async_size);
+
+  bft_printf("\nAsynchronous write test, queue size %lu "
+             "(active setting: %lu)\n"
+             "---------------------------------------\n\n",
+             (unsigned long)async_size,
+             (unsigned long)cs_file_get_async_write_size());
+
+  memset(ref_buf, 0, 80);
+  sprintf(ref_buf, "fvm async test file");
+
+#if defined(HAVE_MPI)
+  f = cs_file_open("output_data_async",
+                   CS_FILE_MODE_WRITE,
+                   CS_FILE_STDIO_SERIAL,
+                   MPI_INFO_NULL,
+                   MPI_COMM_WORLD,
+                   MPI_COMM_WORLD);
+#else
+  f = cs_file_open("output_data_async",
+                   CS_FILE_MODE_WRITE,
+                   CS_FILE_STDIO_SERIAL);
+#endif
+
+  cs_file_set_big_endian(f);
+
+  cs_file_write_global(f, ref_buf, 1, 80);
+
+  /* Records are larger than a small queue, so that writes must wait */
+
+  for (int r_id = 0; r_id < n_records; r_id++) {
+    for (i = block_start; i < block_end; i++)
+      ibuf[i-block_start] = r_id*100 + i;
+    cs_file_write_block(f, ibuf, sizeof(int), 1, block_start, block_end);
+  }
+
+  /* Querying the position waits for pending writes */
+
+  cs_file_off_t size_ref = 80 + n_records*30*sizeof(int);
+  cs_file_off_t size = cs_file_tell(f);
+  if (size != size_ref) {
+    bft_printf("  error: position %ld after writes (expected %ld)\n",
+               (long)size, (long)size_ref);
+    n_errors++;
+  }
+
+  cs_file_async_wait();
+
+  f = cs_file_free(f);
+
+  /* Read back and check */
+
+#if defined(HAVE_MPI)
+  f = cs_file_open("output_data_async",
+                   CS_FILE_MODE_READ,
+                   CS_FILE_STDIO_SERIAL,
+                   MPI_INFO_NULL,
+                   MPI_COMM_WORLD,
+                   MPI_COMM_WORLD);
+#else
+  f = cs_file_open("output_data_async",
+                   CS_FILE_MODE_READ,
+                   CS_FILE_STDIO_SERIAL);
+#endif
+
+  cs_file_set_big_endian(f);
+
+  cs_file_read_global(f, buf, 1, 80);
+  if (memcmp(buf, ref_buf, 80) != 0) {
+    bft_printf("  error: header read back as \"%s\"\n", buf);
+    n_errors++;
+  }
+
+  for (int r_id = 0; r_id < n_records; r_id++) {
+    for (i = block_start; i < block_end; i++)
+      ibuf[i-block_start] = -1;
+    cs_file_read_block(f, ibuf, sizeof(int), 1, block_start, block_end);
+    for (i = block_start; i < block_end; i++) {
+      if (ibuf[i-block_start] != (int)(r_id*100 + i)) {
+        bft_printf("  error: record %d, value %d read back as %d\n",
+                   r_id, (int)i, ibuf[i-block_start]);
+        n_errors++;
+      }
+    }
+  }
+
+  f = cs_file_free(f);
+
+  cs_file_set_async_write_size(0);
+
+  bft_printf("%d error(s)\n", n_errors);
+
+  return n_errors;
+}
+
 /*---------------------------------------------------------------------------*/
 
 int
@@ -382,6 +503,12 @@ main (int argc, char *argv[])
     }
   }
 
+  /* Asynchronous writes, with a queue smaller than written records,
+     and synchronous writes */
+
+  int n_errors = _async_write_test(64, block_start, block_end);
+  n_errors += _async_write_test(0, block_start, block_end);
+
   /* We are finished */
 
   bft_mem_end();
@@ -392,5 +519,5 @@ main (int argc, char *argv[])
 
 #endif
 
-  exit (EXIT_SUCCESS);
+  exit ((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
 }
@@ -0,0 +1,401 @@
+/*============================================================================
+ * Unit test for bounding volume hierarchy based location in
+ * fvm_point_location.c;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bft_mem.h"
+
+#include "fvm_nodal.h"
+#include "fvm_nodal_append.h"
+#include "fvm_point_location.h"
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of cells in each direction of the unit cube */
+
+#define NX 4
+
+/* Location tolerance */
+
+#define TOL_BASE      0.
+#define TOL_FRACTION  0.1
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a nodal mesh of NX*NX*NX hexahedra on the unit cube, sharing
+ * the given vertex coordinates, and its cell -> cell adjacency through
+ * faces.
+ *
+ * parameters:
+ *   vtx_coords  <-- vertex coordinates (size: (NX+1)^3 * 3)
+ *   adj_idx     --> adjacency index (size: NX^3 + 1)
+ *   adj         --> adjacency, as cell number - 1 (size: adj_idx[NX^3])
+ *
+ * returns:
+ *   pointer to nodal mesh
+ *----------------------------------------------------------------------------*/
+
+static fvm_nodal_t *
+_hexa_grid(cs_coord_t    vtx_coords[],
+           cs_lnum_t     adj_idx[],
+           cs_lnum_t   **adj)
+{
+  const cs_lnum_t n_cells = NX*NX*NX;
+  const double h = 1./NX;
+
+  for (int k = 0; k < NX+1; k++) {
+    for (int j = 0; j < NX+1; j++) {
+      for (int i = 0; i < NX+1; i++) {
+        cs_coord_t *c = vtx_coords + ((k*(NX+1) + j)*(NX+1) + i)*3;
+        c[0] = i*h;
+        c[1] = j*h;
+        c[2] = k*h;
+      }
+    }
+  }
+
+  cs_lnum_t *vtx_num;
+  BFT_MALLOC(vtx_num, n_cells*8, cs_lnum_t);
+  BFT_MALLOC(*adj, n_cells*6, cs_lnum_t);
+
+  cs_lnum_t *_adj = *adj;
+
+  adj_idx[0] = 0;
+
+  for (int k = 0; k < NX; k++) {
+    for (int j = 0; j < NX; j++) {
+      for (int i = 0; i < NX; i++) {
+
+        const cs_lnum_t c_id = (k*NX + j)*NX + i;
+        const cs_lnum_t v0 = (k*(NX+1) + j)*(NX+1) + i + 1;
+        const cs_lnum_t dj = NX+1, dk = (NX+1)*(NX+1);
+
+        cs_lnum_t *vn = vtx_num + c_id*8;
+        vn[0] = v0;
+        vn[1] = v0 + 1;
+        vn[2] = v0 + 1 + dj;
+        vn[3] = v0 + dj;
+        vn[4] = v0 + dk;
+        vn[5] = v0 + 1 + dk;
+        vn[6] = v0 + 1 + dj + dk;
+        vn[7] = v0 + dj + dk;
+
+        cs_lnum_t n_adj = adj_idx[c_id];
+        if (i > 0)    _adj[n_adj++] = c_id - 1;
+        if (i < NX-1) _adj[n_adj++] = c_id + 1;
+        if (j > 0)    _adj[n_adj++] = c_id - NX;
+        if (j < NX-1) _adj[n_adj++] = c_id + NX;
+        if (k > 0)    _adj[n_adj++] = c_id - NX*NX;
+        if (k < NX-1) _adj[n_adj++] = c_id + NX*NX;
+        adj_idx[c_id + 1] = n_adj;
+
+      }
+    }
+  }
+
+  fvm_nodal_t *nm = fvm_nodal_create("hexa_grid", 3);
+
+  fvm_nodal_append_by_transfer(nm, n_cells, FVM_CELL_HEXA,
+                               NULL, NULL, NULL, vtx_num, NULL);
+
+  fvm_nodal_set_shared_vertices(nm, vtx_coords);
+
+  return nm;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare locations with those of fvm_point_location_nodal().
+ *
+ * parameters:
+ *   nm        <-- pointer to nodal mesh
+ *   n_points  <-- number of points
+ *   coords    <-- point coordinates
+ *   location  <-- location to check
+ *   distance  <-- distance to check
+ *
+ * returns:
+ *   number of differences
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare(const fvm_nodal_t  *nm,
+         cs_lnum_t           n_points,
+         const cs_coord_t    coords[],
+         const cs_lnum_t     location[],
+         const float         distance[])
+{
+  int n_errors = 0;
+
+  cs_lnum_t *ref_location;
+  float *ref_distance;
+  BFT_MALLOC(ref_location, n_points, cs_lnum_t);
+  BFT_MALLOC(ref_distance, n_points, float);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    ref_location[i] = -1;
+    ref_distance[i] = -1.;
+  }
+
+  fvm_point_location_nodal(nm, TOL_BASE, TOL_FRACTION, 0,
+                           n_points, NULL, coords,
+                           ref_location, ref_distance);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    if (   location[i] != ref_location[i]
+        || fabs(distance[i] - ref_distance[i]) > 1.e-6) {
+      if (n_errors < 10)
+        printf("  error: point %d (%g, %g, %g): location %d (%g), "
+               "reference %d (%g)\n",
+               (int)i, coords[i*3], coords[i*3+1], coords[i*3+2],
+               (int)location[i], distance[i],
+               (int)ref_location[i], ref_distance[i]);
+      n_errors++;
+    }
+  }
+
+  BFT_FREE(ref_distance);
+  BFT_FREE(ref_location);
+
+  return n_errors;
+}
+
+/*----------------------------------------------------------------------------
+ * Relocate moved points, with and without element adjacency, and compare
+ * with fvm_point_location_nodal().
+ *
+ * parameters:
+ *   nm        <-- pointer to nodal mesh
+ *   bvh       <-- pointer to bounding volume hierarchy
+ *   adj_idx   <-- cell adjacency index
+ *   adj       <-- cell adjacency
+ *   n_points  <-- number of points
+ *   coords    <-- point coordinates
+ *   location  <-- previous location of points
+ *
+ * returns:
+ *   number of differences
+ *----------------------------------------------------------------------------*/
+
+static int
+_relocate(const fvm_nodal_t               *nm,
+          const fvm_point_location_bvh_t  *bvh,
+          const cs_lnum_t                  adj_idx[],
+          const cs_lnum_t                  adj[],
+          cs_lnum_t                        n_points,
+          const cs_coord_t                 coords[],
+          const cs_lnum_t                  location[])
+{
+  int n_errors = 0;
+
+  cs_lnum_t *r_location;
+  float *r_distance;
+  BFT_MALLOC(r_location, n_points, cs_lnum_t);
+  BFT_MALLOC(r_distance, n_points, float);
+
+  for (int use_adj = 0; use_adj < 2; use_adj++) {
+
+    for (cs_lnum_t i = 0; i < n_points; i++)
+      r_location[i] = location[i];
+
+    cs_lnum_t n_full
+      = fvm_point_location_bvh_relocate(bvh, n_points, NULL, coords,
+                                        (use_adj) ? adj_idx : NULL,
+                                        (use_adj) ? adj : NULL,
+                                        r_location, r_distance);
+
+    int n_r_errors = _compare(nm, n_points, coords, r_location, r_distance);
+
+    printf("  relocate (%s adjacency): %d full searches, %d error(s)\n",
+           (use_adj) ? "with" : "without", (int)n_full, n_r_errors);
+
+    n_errors += n_r_errors;
+
+  }
+
+  BFT_FREE(r_distance);
+  BFT_FREE(r_location);
+
+  return n_errors;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+
+  const cs_lnum_t n_cells = NX*NX*NX;
+  const double h = 1./NX;
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  cs_coord_t *vtx_coords;
+  cs_lnum_t *adj_idx, *adj;
+  BFT_MALLOC(vtx_coords, (NX+1)*(NX+1)*(NX+1)*3, cs_coord_t);
+  BFT_MALLOC(adj_idx, n_cells + 1, cs_lnum_t);
+
+  fvm_nodal_t *nm = _hexa_grid(vtx_coords, adj_idx, &adj);
+
+  /* Points inside cells (away from faces), near the x = 1 boundary
+     (within tolerance), and far outside the mesh */
+
+  const cs_lnum_t n_points = 2*n_cells + 2*NX + 2;
+
+  cs_coord_t *coords, *m_coords;
+  cs_lnum_t *location;
+  float *distance;
+  BFT_MALLOC(coords, n_points*3, cs_coord_t);
+  BFT_MALLOC(m_coords, n_points*3, cs_coord_t);
+  BFT_MALLOC(location, n_points, cs_lnum_t);
+  BFT_MALLOC(distance, n_points, float);
+
+  cs_lnum_t p_id = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int ijk[3] = {c_id % NX, (c_id / NX) % NX, c_id / (NX*NX)};
+    for (int l = 0; l < 2; l++) {
+      for (int m = 0; m < 3; m++) {
+        double r = 0.35*sin(1.3*(p_id*3 + m) + 0.4);
+        coords[p_id*3 + m] = (ijk[m] + 0.5 + r)*h;
+      }
+      p_id++;
+    }
+  }
+
+  for (int j = 0; j < NX; j++) {
+    for (int l = 0; l < 2; l++) {
+      coords[p_id*3]     = (l == 0) ? 1. + 0.02*h : -0.05*h;
+      coords[p_id*3 + 1] = (j + 0.5)*h;
+      coords[p_id*3 + 2] = 0.5*h;
+      p_id++;
+    }
+  }
+
+  for (int l = 0; l < 2; l++) {
+    for (int m = 0; m < 3; m++)
+      coords[p_id*3 + m] = (l == 0) ? 2. : -0.5;
+    p_id++;
+  }
+
+  assert(p_id == n_points);
+
+  /* Points displaced by a fraction of a cell, some crossing faces
+     (values chosen so that no point lies on a face) */
+
+  const double disp[3] = {0.31*h, -0.23*h, 0.17*h};
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    for (int m = 0; m < 3; m++)
+      m_coords[i*3 + m] = coords[i*3 + m] + disp[m];
+  }
+
+  fvm_point_location_bvh_t *bvh
+    = fvm_point_location_bvh_create(nm, TOL_BASE, TOL_FRACTION, 0);
+
+  /* Location and relocation on initial mesh */
+
+  printf("\nInitial mesh:\n");
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    location[i] = -1;
+    distance[i] = -1.;
+  }
+
+  fvm_point_location_bvh_locate(bvh, n_points, NULL, coords,
+                                location, distance);
+
+  int n_l_errors = _compare(nm, n_points, coords, location, distance);
+  printf("  locate: %d error(s)\n", n_l_errors);
+  n_errors += n_l_errors;
+
+  n_errors += _relocate(nm, bvh, adj_idx, adj, n_points, m_coords, location);
+
+  /* Deform mesh (shared vertices are modified in place), and update
+     hierarchy; locations on the initial mesh are used as a start point
+     for relocation */
+
+  for (cs_lnum_t v_id = 0; v_id < (NX+1)*(NX+1)*(NX+1); v_id++) {
+    cs_coord_t *c = vtx_coords + v_id*3;
+    const cs_coord_t x = c[0], y = c[1];
+    c[0] = 1.2*x + 0.1*y;
+    c[1] = 0.9*y;
+    c[2] += 0.15*x;
+  }
+
+  fvm_point_location_bvh_update(bvh);
+
+  printf("\nDeformed mesh:\n");
+
+  n_errors += _relocate(nm, bvh, adj_idx, adj, n_points, coords, location);
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    location[i] = -1;
+    distance[i] = -1.;
+  }
+
+  fvm_point_location_bvh_locate(bvh, n_points, NULL, coords,
+                                location, distance);
+
+  n_l_errors = _compare(nm, n_points, coords, location, distance);
+  printf("  locate: %d error(s)\n", n_l_errors);
+  n_errors += n_l_errors;
+
+  bvh = fvm_point_location_bvh_destroy(bvh);
+  nm = fvm_nodal_destroy(nm);
+
+  BFT_FREE(distance);
+  BFT_FREE(location);
+  BFT_FREE(m_coords);
+  BFT_FREE(coords);
+  BFT_FREE(adj);
+  BFT_FREE(adj_idx);
+  BFT_FREE(vtx_coords);
+
+  bft_mem_end();
+
+  printf("\nBounding volume hierarchy location test: %d error(s)\n",
+         n_errors);
+
+  exit((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
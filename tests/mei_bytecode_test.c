@@ -0,0 +1,289 @@
+/*============================================================================
+ * Unit test for mei_bytecode.c, compared to the mei interpreter;
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2018 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*----------------------------------------------------------------------------
+ * BFT library headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "mei_evaluate.h"
+#include "mei_bytecode.h"
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of points (more than one chunk, not a multiple of the chunk size) */
+
+#define N_POINTS 203
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+typedef struct {
+
+  const char  *expr;       /* expression */
+  bool         compiled;   /* true if bytecode evaluation is expected */
+
+} _test_case_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const _test_case_t _cases[] = {
+
+  /* Nested if/else */
+
+  {"if (x < -1) {\n"
+   "  a = 1;\n"
+   "} else {\n"
+   "  if (x < 1) {\n"
+   "    if (y > 0) a = 2; else a = 3;\n"
+   "  } else a = 4;\n"
+   "}\n"
+   "b = a*x + y;\n",
+   true},
+
+  /* && and || short-circuiting (division by zero for x = 0) */
+
+  {"a = (x != 0 && 1/x > 0.5);\n"
+   "b = (x == 0 || 1/x < -0.5) + (x > 1 && y > 0 || x < -1);\n",
+   true},
+
+  /* Division, power, and functions masked by conditions */
+
+  {"if (x > 0) {\n"
+   "  a = x^0.5 + log(x);\n"
+   "} else {\n"
+   "  a = (-x)^1.5;\n"
+   "}\n"
+   "if (x != 0) b = y/x; else b = sqrt(abs(y));\n",
+   true},
+
+  /* Outputs assigned only in some branches */
+
+  {"if (x > 0.5) a = x*t;\n"
+   "if (y < 0) { b = y; a = a + 1; } else if (x < 0) b = -x;\n",
+   true},
+
+  /* Uniform values only */
+
+  {"a = 2*t + pi;\n"
+   "b = cos(t)*a;\n",
+   true},
+
+  /* Statements which are not compiled: use the interpreter */
+
+  {"i = 0;\n"
+   "while (i < 3) i = i + 1;\n"
+   "a = x + i;\n"
+   "b = y*i;\n",
+   false},
+
+  {"if (x > 100) print x;\n"
+   "a = x;\n"
+   "b = y;\n",
+   false}
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compare compiled and interpreted evaluations of an expression.
+ *
+ * Outputs which are not assigned for a given point keep their value
+ * in the symbol table, so they are reset for each point.
+ *
+ * parameters:
+ *   tc       <-- test case
+ *   n_elts   <-- number of evaluated points
+ *   elt_ids  <-- ids of evaluated points, or NULL
+ *   x        <-- values of input x
+ *   y        <-- values of input y
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare(const _test_case_t  *tc,
+         cs_lnum_t            n_elts,
+         const cs_lnum_t      elt_ids[],
+         const cs_real_t      x[],
+         const cs_real_t      y[])
+{
+  int n_errors = 0;
+
+  const char *input_names[] = {"x", "y"};
+  const char *output_names[] = {"a", "b"};
+
+  cs_real_t ref[2][N_POINTS], val[2*N_POINTS];
+
+  mei_tree_t *ev = mei_tree_new(tc->expr);
+
+  mei_tree_insert(ev, "x", 0.);
+  mei_tree_insert(ev, "y", 0.);
+  mei_tree_insert(ev, "t", 0.3);
+  mei_tree_insert(ev, "a", 0.);
+  mei_tree_insert(ev, "b", 0.);
+
+  if (mei_tree_builder(ev)) {
+    printf("  error: can not interpret expression\n");
+    mei_tree_destroy(ev);
+    return 1;
+  }
+
+  /* Reference: interpreter, point by point */
+
+  for (cs_lnum_t j = 0; j < n_elts; j++) {
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[j] : j;
+    mei_tree_insert(ev, "x", x[e_id]);
+    mei_tree_insert(ev, "y", y[e_id]);
+    mei_tree_insert(ev, "a", 0.);
+    mei_tree_insert(ev, "b", 0.);
+    mei_evaluate(ev);
+    ref[0][e_id] = mei_tree_lookup(ev, "a");
+    ref[1][e_id] = mei_tree_lookup(ev, "b");
+  }
+
+  mei_tree_insert(ev, "a", 0.);
+  mei_tree_insert(ev, "b", 0.);
+
+  /* Compiled evaluation, with interleaved outputs */
+
+  const cs_real_t *input_vals[] = {x, y};
+  const int input_strides[] = {1, 1};
+  cs_real_t *output_vals[] = {val, val + 1};
+  const int output_strides[] = {2, 2};
+
+  mei_bytecode_t *bc = mei_bytecode_create(ev,
+                                           2, input_names,
+                                           2, output_names);
+
+  if (mei_bytecode_is_compiled(bc) != tc->compiled) {
+    printf("  error: expression %s compiled\n",
+           (tc->compiled) ? "not" : "unexpectedly");
+    n_errors++;
+  }
+
+  mei_bytecode_evaluate(bc,
+                        n_elts,
+                        elt_ids,
+                        input_vals,
+                        input_strides,
+                        output_vals,
+                        output_strides);
+
+  mei_bytecode_destroy(bc);
+  mei_tree_destroy(ev);
+
+  for (cs_lnum_t j = 0; j < n_elts; j++) {
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[j] : j;
+    for (int i = 0; i < 2; i++) {
+      double r = ref[i][e_id], v = val[e_id*2 + i];
+      if (fabs(v - r) > 1.e-14*fmax(1., fabs(r))) {
+        if (n_errors < 10)
+          printf("  error: %s(x = %g, y = %g) = %g (interpreter: %g)\n",
+                 output_names[i], x[e_id], y[e_id], v, r);
+        n_errors++;
+      }
+    }
+  }
+
+  return n_errors;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main(int    argc,
+     char  *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_errors = 0;
+
+  cs_lnum_t elt_ids[N_POINTS];
+  cs_real_t x[N_POINTS], y[N_POINTS];
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  /* Inputs, with x = 0 for some points; selected points in reverse order */
+
+  cs_lnum_t n_sel = 0;
+
+  for (cs_lnum_t j = 0; j < N_POINTS; j++) {
+    x[j] = (double)((j*37) % 101 - 50) / 20.;
+    y[j] = sin(0.7*j);
+  }
+
+  for (cs_lnum_t j = N_POINTS - 1; j >= 0; j -= 3)
+    elt_ids[n_sel++] = j;
+
+  const int n_cases = sizeof(_cases) / sizeof(_test_case_t);
+
+  for (int i = 0; i < n_cases; i++) {
+
+    printf("\nExpression:\n%s", _cases[i].expr);
+
+    int n_c_errors = _compare(_cases + i, N_POINTS, NULL, x, y);
+    n_c_errors += _compare(_cases + i, n_sel, elt_ids, x, y);
+
+    printf("  %d error(s)\n", n_c_errors);
+
+    n_errors += n_c_errors;
+
+  }
+
+  bft_mem_end();
+
+  printf("\nBytecode evaluation test: %d error(s)\n", n_errors);
+
+  exit((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}